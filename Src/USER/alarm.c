@@ -0,0 +1,368 @@
+#include "alarm.h"
+
+/**
+ * @brief  将实时时钟的小时转换为24小时制。
+ * @param  time 时间。
+ * @return 0 ~ 23。
+ */
+static uint8_t alarm_get_hours24(const struct RTC_Time *time)
+{
+    if (time->Is_12hr == 0)
+    {
+        return time->Hours;
+    }
+    return time->Hours % 12 + (time->PM != 0 ? 12 : 0);
+}
+
+/**
+ * @brief  公历日期加1天，同时更新星期。
+ * @param  time 日期，只使用年、月、日和星期。
+ */
+static void alarm_next_day(struct RTC_Time *time)
+{
+    uint8_t days;
+
+    time->Day = time->Day % 7 + 1;
+    time->Date += 1;
+    if (time->Month < 1 || time->Month > 12)
+    {
+        return;
+    }
+    days = EPOCH_GetMonthDays(time->Year, time->Month);
+    if (time->Date <= days)
+    {
+        return;
+    }
+    time->Date = 1;
+    time->Month += 1;
+    if (time->Month > 12)
+    {
+        time->Month = 1;
+        time->Year += 1;
+    }
+}
+
+/**
+ * @brief  检查闹钟在指定日期是否需要响，不比较时间。
+ * @param  entry 闹钟。
+ * @param  day 公历日期和星期。
+ * @param  lunar 对应的农历日期，没有农历闹钟时不使用。
+ * @return 1：需要响，0：不需要响。
+ */
+static uint8_t alarm_match_day(const struct ALARM_Entry *entry, const struct RTC_Time *day, const struct Lunar_Date *lunar)
+{
+    switch (entry->type)
+    {
+    case ALARM_TYPE_ONCE:
+        return entry->date == day->Date && entry->month == day->Month && entry->year == day->Year;
+    case ALARM_TYPE_DAILY:
+        return 1;
+    case ALARM_TYPE_WEEKDAY:
+        return (entry->days & (1 << day->Day)) != 0;
+    case ALARM_TYPE_LUNAR:
+        if (lunar->Date != entry->date)
+        {
+            return 0;
+        }
+        return entry->month == 0 || (lunar->IsLeap == 0 && lunar->Month == entry->month);
+    }
+    return 0;
+}
+
+/**
+ * @brief  读取全部闹钟。
+ * @param  entries 闹钟表，大小为ALARM_SLOT_COUNT。
+ * @param  need_lunar 是否有农历闹钟，有时才需要计算农历日期。
+ * @return 已打开的闹钟数量。
+ */
+static uint8_t alarm_load_all(struct ALARM_Entry *entries, uint8_t *need_lunar)
+{
+    uint8_t i, count;
+
+    count = 0;
+    *need_lunar = 0;
+    for (i = 0; i < ALARM_SLOT_COUNT; i++)
+    {
+        ALARM_Read(i, &entries[i]);
+        if (entries[i].type != ALARM_TYPE_NONE)
+        {
+            count += 1;
+        }
+        if (entries[i].type == ALARM_TYPE_LUNAR)
+        {
+            *need_lunar = 1;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief  从EEPROM读取一个闹钟。
+ * @param  slot 闹钟位置，0 ~ ALARM_SLOT_COUNT - 1。
+ * @param  entry 闹钟，内容超出范围时按已关闭处理。
+ * @return 1：位置超出范围，0：读取完成。
+ */
+uint8_t ALARM_Read(uint8_t slot, struct ALARM_Entry *entry)
+{
+    uint8_t i, *entry_ptr;
+
+    entry_ptr = (uint8_t *)entry;
+    if (slot >= ALARM_SLOT_COUNT)
+    {
+        entry->type = ALARM_TYPE_NONE;
+        return 1;
+    }
+    for (i = 0; i < sizeof(struct ALARM_Entry); i++)
+    {
+        entry_ptr[i] = EEPROM_ReadByte(ALARM_EEPROM_ADDR_BYTE + slot * sizeof(struct ALARM_Entry) + i);
+    }
+    if (entry->type > ALARM_TYPE_LUNAR || entry->hours > 23 || entry->minutes > 59)
+    {
+        entry->type = ALARM_TYPE_NONE;
+    }
+    return 0;
+}
+
+/**
+ * @brief  向EEPROM写入一个闹钟，内容相同的字节跳过，修改后需要调用ALARM_Schedule()。
+ * @param  slot 闹钟位置，0 ~ ALARM_SLOT_COUNT - 1。
+ * @param  entry 闹钟。
+ * @return 1：写入错误，0：写入完成。
+ */
+uint8_t ALARM_Write(uint8_t slot, const struct ALARM_Entry *entry)
+{
+    uint8_t i, ret;
+    uint16_t addr;
+    const uint8_t *entry_ptr;
+
+    if (slot >= ALARM_SLOT_COUNT)
+    {
+        return 1;
+    }
+    ret = 0;
+    entry_ptr = (const uint8_t *)entry;
+    for (i = 0; i < sizeof(struct ALARM_Entry); i++)
+    {
+        addr = ALARM_EEPROM_ADDR_BYTE + slot * sizeof(struct ALARM_Entry) + i;
+        if (EEPROM_ReadByte(addr) != entry_ptr[i])
+        {
+            ret |= EEPROM_WriteByte(addr, entry_ptr[i]);
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief  查找当前时间之后最近一次需要响的闹钟。
+ * @param  now 当前时间。
+ * @param  due 到期时间，24小时制，秒为0。
+ * @return 1：没有打开的闹钟，0：查找完成。
+ * @note   查找范围内没有到期的闹钟时返回范围结束那天的0点，到时没有闹钟匹配，重新查找即可。
+ * @note   只在闹钟响过、修改闹钟或修改时间后调用，有农历闹钟时每天需要计算一次农历日期。
+ */
+uint8_t ALARM_GetNext(const struct RTC_Time *now, struct RTC_Time *due)
+{
+    uint8_t i, need_lunar;
+    uint16_t offset, now_minute, minute, best;
+    struct RTC_Time day;
+    struct Lunar_Date lunar = {0}; /* 没有农历闹钟时不计算 */
+    struct ALARM_Entry entries[ALARM_SLOT_COUNT];
+
+    if (alarm_load_all(entries, &need_lunar) == 0)
+    {
+        return 1;
+    }
+    now_minute = alarm_get_hours24(now) * 60 + now->Minutes;
+    day = *now;
+    for (offset = 0; offset <= ALARM_SEARCH_DAYS; offset++)
+    {
+        if (need_lunar != 0)
+        {
+            LUNAR_SolarToLunar(&lunar, 2000 + day.Year, day.Month, day.Date);
+        }
+        best = 0xFFFF;
+        for (i = 0; i < ALARM_SLOT_COUNT; i++)
+        {
+            if (alarm_match_day(&entries[i], &day, &lunar) == 0)
+            {
+                continue;
+            }
+            minute = entries[i].hours * 60 + entries[i].minutes;
+            if ((offset != 0 || minute > now_minute) && minute < best) /* 当天只查找当前分钟之后的闹钟 */
+            {
+                best = minute;
+            }
+        }
+        if (best != 0xFFFF)
+        {
+            break;
+        }
+        alarm_next_day(&day);
+    }
+    if (best == 0xFFFF)
+    {
+        best = 0;
+    }
+
+    *due = day;
+    due->Seconds = 0;
+    due->Minutes = best % 60;
+    due->Hours = best / 60;
+    due->PM = 0;
+    due->Is_12hr = 0;
+    return 0;
+}
+
+/**
+ * @brief  查找最近一次需要响的闹钟并设置到实时时钟的闹钟1，没有闹钟时关闭闹钟1中断。
+ * @param  now 当前时间。
+ * @return 1：没有打开的闹钟，0：已设置闹钟1。
+ * @note   闹钟1匹配日、时、分、秒，到期前MCU一直在Standby模式，不需要每分钟检查。
+ * @note   到期时间在一个月以后时，中间月份的同一天也会唤醒，由ALARM_Fire()排除。
+ */
+uint8_t ALARM_Schedule(const struct RTC_Time *now)
+{
+    struct RTC_Time due;
+    struct RTC_Alarm alarm;
+
+    if (ALARM_GetNext(now, &due) != 0)
+    {
+        RTC_ModifyA1IE(0);
+        RTC_ClearA1F();
+        return 1;
+    }
+    alarm.Seconds = 0;
+    alarm.Minutes = due.Minutes;
+    alarm.Day = 0;
+    alarm.Date = due.Date;
+    alarm.DY = 0;
+    if (now->Is_12hr != 0) /* 闹钟寄存器与时间寄存器使用相同的12/24小时制 */
+    {
+        alarm.Is_12hr = 1;
+        alarm.PM = due.Hours >= 12;
+        alarm.Hours = due.Hours % 12 == 0 ? 12 : due.Hours % 12;
+    }
+    else
+    {
+        alarm.Is_12hr = 0;
+        alarm.PM = 0;
+        alarm.Hours = due.Hours;
+    }
+    RTC_SetAlarm1(&alarm);
+    RTC_ModifyAM1Mask(0x00); /* 日期、时、分、秒全部匹配时产生中断 */
+    RTC_ClearA1F();
+    RTC_ModifyA1IE(1);
+    return 0;
+}
+
+/**
+ * @brief  检查闹钟1是否由闹钟表使用，否则可以用于其他定时唤醒。
+ * @return 1：已由ALARM_Schedule()设置，0：没有使用。
+ */
+uint8_t ALARM_IsArmed(void)
+{
+    return RTC_GetA1IE() != 0 && (RTC_GetAM1Mask() & 0x0F) == 0x00;
+}
+
+/**
+ * @brief  读取闹钟1的到期时间，用于到期后没有立即处理的情况，例如菜单打开期间到期。
+ * @param  now 当前时间。
+ * @param  due 当前时间之前最近一次与闹钟1的日、时、分匹配的时间，秒为0，12/24小时制与当前时间相同。
+ * @return 1：闹钟1没有由ALARM_Schedule()设置，0：读取完成。
+ */
+uint8_t ALARM_GetDue(const struct RTC_Time *now, struct RTC_Time *due)
+{
+    uint8_t i, hours;
+    uint32_t now_seconds, seconds;
+    struct RTC_Alarm alarm;
+
+    if (ALARM_IsArmed() == 0 || RTC_GetAlarm1(&alarm) != 0)
+    {
+        return 1;
+    }
+    hours = alarm.Hours;
+    if (alarm.Is_12hr != 0)
+    {
+        hours = alarm.Hours % 12 + (alarm.PM != 0 ? 12 : 0);
+    }
+    now_seconds = EPOCH_FromTime(now);
+    seconds = now_seconds - now_seconds % EPOCH_SECONDS_PER_DAY + hours * 3600UL + alarm.Minutes * 60;
+    if (seconds > now_seconds) /* 今天还没有到，从昨天开始查找 */
+    {
+        seconds -= EPOCH_SECONDS_PER_DAY;
+    }
+    EPOCH_ToTime(seconds, now->Is_12hr, due);
+    for (i = 0; i < 31 && due->Date != alarm.Date; i++) /* 闹钟1匹配日期，向前查找到日期相同的一天 */
+    {
+        seconds -= EPOCH_SECONDS_PER_DAY;
+        EPOCH_ToTime(seconds, now->Is_12hr, due);
+    }
+    return 0;
+}
+
+/**
+ * @brief  闹钟1唤醒后查找在指定分钟到期的闹钟，一次性闹钟和稍后提醒同时关闭。
+ * @param  now 到期时间，由ALARM_GetDue()读取，到期后立即处理时也可以使用当前时间。
+ * @return 到期闹钟的位置，第n位为位置n，0为没有到期的闹钟。
+ */
+uint8_t ALARM_Fire(const struct RTC_Time *now)
+{
+    uint8_t i, fired, need_lunar;
+    uint16_t now_minute;
+    struct Lunar_Date lunar = {0}; /* 没有农历闹钟时不计算 */
+    struct ALARM_Entry entries[ALARM_SLOT_COUNT];
+
+    if (alarm_load_all(entries, &need_lunar) == 0)
+    {
+        return 0;
+    }
+    if (need_lunar != 0)
+    {
+        LUNAR_SolarToLunar(&lunar, 2000 + now->Year, now->Month, now->Date);
+    }
+    now_minute = alarm_get_hours24(now) * 60 + now->Minutes;
+    fired = 0;
+    for (i = 0; i < ALARM_SLOT_COUNT; i++)
+    {
+        if (alarm_match_day(&entries[i], now, &lunar) == 0 || entries[i].hours * 60 + entries[i].minutes != now_minute)
+        {
+            continue;
+        }
+        fired |= 1 << i;
+        if (entries[i].type == ALARM_TYPE_ONCE)
+        {
+            entries[i].type = ALARM_TYPE_NONE;
+            ALARM_Write(i, &entries[i]);
+        }
+    }
+    return fired;
+}
+
+/**
+ * @brief  在当前时间的ALARM_SNOOZE_MIN分钟后再响一次，之后需要调用ALARM_Schedule()。
+ * @param  now 当前时间。
+ * @return 1：写入错误，0：设置完成。
+ */
+uint8_t ALARM_Snooze(const struct RTC_Time *now)
+{
+    uint16_t minute;
+    struct RTC_Time day;
+    struct ALARM_Entry entry;
+
+    day = *now;
+    minute = alarm_get_hours24(now) * 60 + now->Minutes + ALARM_SNOOZE_MIN;
+    if (minute >= 24 * 60)
+    {
+        minute -= 24 * 60;
+        alarm_next_day(&day);
+    }
+    entry.type = ALARM_TYPE_ONCE;
+    entry.hours = minute / 60;
+    entry.minutes = minute % 60;
+    entry.days = 0;
+    entry.date = day.Date;
+    entry.month = day.Month;
+    entry.year = day.Year;
+    entry.reserved = 0;
+    return ALARM_Write(ALARM_SLOT_SNOOZE, &entry);
+}
@@ -0,0 +1,51 @@
+#ifndef _ALARM_H_
+#define _ALARM_H_
+
+#include "main.h"
+#include "eeprom.h"
+#include "ds3231.h"
+#include "lunar.h"
+#include "epoch.h"
+
+/* 可修改 */
+#define ALARM_EEPROM_ADDR_BYTE 0x0500 /* 闹钟表在EEPROM中的起始地址（Byte），占用8 * ALARM_SLOT_COUNT个Byte */
+#define ALARM_COUNT 6                 /* 用户闹钟数量，加上稍后提醒不能超过8个 */
+#define ALARM_SNOOZE_MIN 5            /* 稍后提醒的间隔 */
+#define ALARM_SEARCH_DAYS 400         /* 向后查找闹钟的天数，需要覆盖农历闰年，更远的闹钟在到期前重新查找 */
+/* 结束 */
+
+#define ALARM_SLOT_SNOOZE ALARM_COUNT /* 最后一个位置保存稍后提醒，按一次性闹钟调度 */
+#define ALARM_SLOT_COUNT (ALARM_COUNT + 1)
+
+#define ALARM_TYPE_NONE 0    /* 未使用或已关闭 */
+#define ALARM_TYPE_ONCE 1    /* 指定公历日期响一次，响过后自动关闭 */
+#define ALARM_TYPE_DAILY 2   /* 每天 */
+#define ALARM_TYPE_WEEKDAY 3 /* 按星期掩码重复 */
+#define ALARM_TYPE_LUNAR 4   /* 指定农历日期，每年或每月重复 */
+
+#define ALARM_DAYS_WORKDAY 0x3E /* 星期一至星期五 */
+#define ALARM_DAYS_WEEKEND 0xC0 /* 星期六和星期日 */
+
+struct ALARM_Entry /* 一个闹钟，在EEPROM中占用8Byte */
+{
+    uint8_t type;    /* ALARM_TYPE_xxx */
+    uint8_t hours;   /* 24小时制，与实时时钟当前的12/24小时制无关 */
+    uint8_t minutes;
+    uint8_t days;    /* ALARM_TYPE_WEEKDAY：第n位为星期n，与实时时钟的Day相同，7为星期日 */
+    uint8_t date;    /* ALARM_TYPE_ONCE：公历日，ALARM_TYPE_LUNAR：农历日 */
+    uint8_t month;   /* ALARM_TYPE_ONCE：公历月，ALARM_TYPE_LUNAR：农历月，0为每月（包括闰月），指定月份时闰月不响 */
+    uint8_t year;    /* ALARM_TYPE_ONCE：公历年的后两位 */
+    uint8_t reserved;
+};
+
+uint8_t ALARM_Read(uint8_t slot, struct ALARM_Entry *entry);
+uint8_t ALARM_Write(uint8_t slot, const struct ALARM_Entry *entry);
+
+uint8_t ALARM_GetNext(const struct RTC_Time *now, struct RTC_Time *due);
+uint8_t ALARM_Schedule(const struct RTC_Time *now);
+uint8_t ALARM_IsArmed(void);
+uint8_t ALARM_GetDue(const struct RTC_Time *now, struct RTC_Time *due);
+uint8_t ALARM_Fire(const struct RTC_Time *now);
+uint8_t ALARM_Snooze(const struct RTC_Time *now);
+
+#endif
@@ -1,36 +1,8 @@
 #include "analog.h"
+#include "wait.h"
 
 static int16_t VREFINT_offset = 0;
 
-#define WAIT_TIMEOUT(val)                                       \
-    timeout = ADC_TIMEOUT_MS;                                   \
-    systick_tmp = SysTick->CTRL;                                \
-    ((void)systick_tmp);                                        \
-    while (timeout != 0 && val)                                 \
-    {                                                           \
-        if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U) \
-        {                                                       \
-            timeout -= 1;                                       \
-        }                                                       \
-    }                                                           \
-    if (timeout == 0)                                           \
-    {                                                           \
-        return 1;                                               \
-    }
-
-/**
- * @brief  延时100ns的倍数（不准确，只需大于即可）。
- * @param  nsX100 延时时间。
- */
-void delay_100ns(volatile uint16_t nsX100)
-{
-    while (nsX100)
-    {
-        nsX100--;
-    }
-    ((void)nsX100);
-}
-
 /**
  * @brief  根据内部参考电压计算VDDA电压。
  * @param  vrefint 内部参考电压的ADC读数。
@@ -114,8 +86,7 @@ static float conv_float_avg(float *data, uint8_t data_size)
  */
 uint8_t ADC_Enable(void)
 {
-    uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    struct WAIT_Context wait;
 
     if (LL_ADC_IsEnabled(ADC_NUM) == 0)
     {
@@ -128,10 +99,14 @@ uint8_t ADC_Enable(void)
            https://community.st.com/s/question/0D50X0000C20aDz/bug-cubemx-550-stm32g0-wrong-setcommonpathinternalch-initialization
         */
         LL_ADC_SetCommonPathInternalCh(__LL_ADC_COMMON_INSTANCE(ADC_NUM), LL_ADC_PATH_INTERNAL_TEMPSENSOR | LL_ADC_PATH_INTERNAL_VREFINT);
-        delay_100ns(LL_ADC_DELAY_TEMPSENSOR_STAB_US * 10); /* 等待温度传感器稳定 */
+        WAIT_DelayUs(LL_ADC_DELAY_TEMPSENSOR_STAB_US); /* 等待温度传感器稳定 */
         /* 结束 */
         LL_ADC_Enable(ADC_NUM);
-        WAIT_TIMEOUT((LL_ADC_IsActiveFlag_ADRDY(ADC_NUM) == 0 || LL_PWR_IsActiveFlag_VREFINTRDY() == 0));
+        WAIT_WHILE(wait, LL_ADC_IsActiveFlag_ADRDY(ADC_NUM) == 0 || LL_PWR_IsActiveFlag_VREFINTRDY() == 0, ADC_TIMEOUT_MS, WAIT_SITE_ADC_READY);
+        if (wait.timeout != 0)
+        {
+            return 1;
+        }
     }
     return 0;
 }
@@ -142,8 +117,7 @@ uint8_t ADC_Enable(void)
  */
 uint8_t ADC_Disable(void)
 {
-    uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    struct WAIT_Context wait;
 
     /* DocID025942 Rev 8 - Page 276 */
     if (LL_ADC_IsEnabled(ADC_NUM) != 0)
@@ -151,10 +125,18 @@ uint8_t ADC_Disable(void)
         if (LL_ADC_REG_IsConversionOngoing(ADC_NUM) != 0)
         {
             LL_ADC_REG_StopConversion(ADC_NUM);
-            WAIT_TIMEOUT(LL_ADC_REG_IsStopConversionOngoing(ADC_NUM) != 0);
+            WAIT_WHILE(wait, LL_ADC_REG_IsStopConversionOngoing(ADC_NUM) != 0, ADC_TIMEOUT_MS, WAIT_SITE_ADC_ABORT);
+            if (wait.timeout != 0)
+            {
+                return 1;
+            }
         }
         LL_ADC_Disable(ADC_NUM);
-        WAIT_TIMEOUT(LL_ADC_IsEnabled(ADC_NUM) != 0);
+        WAIT_WHILE(wait, LL_ADC_IsEnabled(ADC_NUM) != 0, ADC_TIMEOUT_MS, WAIT_SITE_ADC_DISABLE);
+        if (wait.timeout != 0)
+        {
+            return 1;
+        }
         LL_ADC_ClearFlag_ADRDY(ADC_NUM);
         LL_ADC_DisableInternalRegulator(ADC_NUM);
     }
@@ -168,8 +150,7 @@ uint8_t ADC_Disable(void)
  */
 uint8_t ADC_StartCal(void)
 {
-    uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    struct WAIT_Context wait;
 
     if (LL_ADC_IsEnabled(ADC_NUM) != 0)
     {
@@ -178,9 +159,13 @@ uint8_t ADC_StartCal(void)
     /* DocID025942 Rev 8 - Page 277 */
     LL_ADC_ClearFlag_EOCAL(ADC_NUM);
     LL_ADC_StartCalibration(ADC_NUM);
-    WAIT_TIMEOUT(LL_ADC_IsActiveFlag_EOCAL(ADC_NUM) == 0);
+    WAIT_WHILE(wait, LL_ADC_IsActiveFlag_EOCAL(ADC_NUM) == 0, ADC_TIMEOUT_MS, WAIT_SITE_ADC_CAL);
+    if (wait.timeout != 0)
+    {
+        return 1;
+    }
     LL_ADC_ClearFlag_EOCAL(ADC_NUM);
-    delay_100ns(LL_ADC_DELAY_CALIB_ENABLE_ADC_CYCLES);
+    WAIT_DelayUs(1); /* 校准完成后需要等待LL_ADC_DELAY_CALIB_ENABLE_ADC_CYCLES个ADC时钟才能打开ADC */
     return 0;
 }
 
@@ -203,8 +188,7 @@ uint8_t ADC_GetCalFactor(void)
 uint8_t ADC_StartConversionSequence(uint32_t channels, uint16_t *data, uint8_t conv_count)
 {
     uint16_t i;
-    uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    struct WAIT_Context wait;
 
     if (LL_ADC_IsActiveFlag_ADRDY(ADC_NUM) == 0)
     {
@@ -216,14 +200,8 @@ uint8_t ADC_StartConversionSequence(uint32_t channels, uint16_t *data, uint8_t c
     }
     LL_ADC_ClearFlag_EOS(ADC_NUM);
     LL_ADC_ClearFlag_EOC(ADC_NUM);
-    for (i = 0; i < 65535; i++)
-    {
-        if (LL_PWR_IsActiveFlag_VREFINTRDY() != 0) /* 等待VREFINT准备完成 */
-        {
-            break;
-        }
-    }
-    if (i == 65534)
+    WAIT_WHILE(wait, LL_PWR_IsActiveFlag_VREFINTRDY() == 0, ADC_TIMEOUT_MS, WAIT_SITE_ADC_VREFINT); /* 等待VREFINT准备完成 */
+    if (wait.timeout != 0)
     {
         for (i = 0; i < conv_count; i++)
         {
@@ -237,14 +215,22 @@ uint8_t ADC_StartConversionSequence(uint32_t channels, uint16_t *data, uint8_t c
         {
             LL_ADC_REG_StartConversion(ADC_NUM);
         }
-        WAIT_TIMEOUT(LL_ADC_IsActiveFlag_EOC(ADC_NUM) == 0);
+        WAIT_WHILE(wait, LL_ADC_IsActiveFlag_EOC(ADC_NUM) == 0, ADC_TIMEOUT_MS, WAIT_SITE_ADC_EOC);
+        if (wait.timeout != 0)
+        {
+            return 1;
+        }
         data[i] = LL_ADC_REG_ReadConversionData12(ADC_NUM) & 0x0FFF;
         LL_ADC_ClearFlag_EOC(ADC_NUM);
     }
     if (LL_ADC_REG_IsConversionOngoing(ADC_NUM) != 0)
     {
         LL_ADC_REG_StopConversion(ADC_NUM);
-        WAIT_TIMEOUT(LL_ADC_REG_IsStopConversionOngoing(ADC_NUM) != 0);
+        WAIT_WHILE(wait, LL_ADC_REG_IsStopConversionOngoing(ADC_NUM) != 0, ADC_TIMEOUT_MS, WAIT_SITE_ADC_STOP);
+        if (wait.timeout != 0)
+        {
+            return 1;
+        }
     }
     LL_ADC_ClearFlag_EOS(ADC_NUM);
     return 0;
@@ -0,0 +1,335 @@
+#include "button.h"
+
+struct button_pin
+{
+    GPIO_TypeDef *port;
+    uint32_t pin;
+    uint32_t exti_port; /* SYSCFG外部中断源端口 */
+    uint32_t exti_src;  /* SYSCFG外部中断源线 */
+    uint32_t exti_line; /* 外部中断线 */
+};
+
+struct button_state
+{
+    uint16_t edge_tick; /* 最近一次发现电平变化时的低功耗定时器计数值 */
+    uint16_t hold_tick; /* 按下或上一次长按、连发事件时的计数值 */
+    uint16_t hold_ms;   /* 距离下一次长按或连发事件的时间，0为不再产生 */
+    uint16_t repeat_ms; /* 下一次连发的间隔 */
+    uint8_t pressed;    /* 消抖后的状态，1：按下 */
+    uint8_t bouncing;   /* 1：电平变化后等待稳定 */
+    uint8_t long_sent;  /* 1：本次按下已产生长按事件 */
+};
+
+static const struct button_pin Pins[BUTTON_COUNT] = {
+    {BTN_SET_GPIO_Port, BTN_SET_Pin, LL_SYSCFG_EXTI_PORTA, LL_SYSCFG_EXTI_LINE15, LL_EXTI_LINE_15},
+    {BTN_UP_GPIO_Port, BTN_UP_Pin, LL_SYSCFG_EXTI_PORTB, LL_SYSCFG_EXTI_LINE3, LL_EXTI_LINE_3},
+    {BTN_DOWN_GPIO_Port, BTN_DOWN_Pin, LL_SYSCFG_EXTI_PORTB, LL_SYSCFG_EXTI_LINE4, LL_EXTI_LINE_4},
+};
+
+#define BUTTON_SLEEP_MAX_MS 20000 /* 单次Stop模式最长时间，不能超过低功耗定时器的计数周期 */
+
+static struct button_state State[BUTTON_COUNT];
+static struct BUTTON_Event Queue[BUTTON_QUEUE_SIZE];
+static uint8_t Queue_Head, Queue_Tail;
+static uint16_t Last_Poll_Tick;
+
+/**
+ * @brief  读取按钮引脚电平。
+ * @param  button 按钮编号。
+ * @return 1：按下，0：释放，按钮为低电平有效。
+ */
+static uint8_t read_level(uint8_t button)
+{
+    return LL_GPIO_IsInputPinSet(Pins[button].port, Pins[button].pin) == 0;
+}
+
+/**
+ * @brief  事件加入队列，队列已满时丢弃。
+ */
+static void push_event(uint8_t button, uint8_t type)
+{
+    uint8_t next;
+
+    next = (Queue_Head + 1) & (BUTTON_QUEUE_SIZE - 1);
+    if (next == Queue_Tail)
+    {
+        return;
+    }
+    Queue[Queue_Head].button = button;
+    Queue[Queue_Head].type = type;
+    Queue_Head = next;
+}
+
+/**
+ * @brief  更新单个按钮的状态并产生事件。
+ * @param  button 按钮编号。
+ * @param  gap 距离上一次轮询的时间，单位为毫秒。
+ */
+static void poll_button(uint8_t button, uint16_t gap)
+{
+    struct button_state *state;
+    uint8_t level, edge;
+
+    state = &State[button];
+    level = read_level(button);
+    edge = LL_EXTI_IsActiveFlag_0_31(Pins[button].exti_line);
+    if (edge != 0)
+    {
+        LL_EXTI_ClearFlag_0_31(Pins[button].exti_line);
+        if (state->bouncing == 0 && state->pressed == 0 && level == 0 && gap >= BUTTON_DEBOUNCE_MS)
+        {
+            /* 两次轮询之间完成了一次完整的短按，只能从外部中断标志得知 */
+            push_event(button, BUTTON_EVENT_PRESS);
+            push_event(button, BUTTON_EVENT_RELEASE);
+            return;
+        }
+    }
+    if (edge != 0 || (level != state->pressed && state->bouncing == 0))
+    {
+        state->edge_tick = LP_GetTick(); /* 每次发现变化都重新开始消抖计时 */
+        state->bouncing = 1;
+        return;
+    }
+
+    if (state->bouncing != 0)
+    {
+        if (LP_GetElapsedMs(state->edge_tick) < BUTTON_DEBOUNCE_MS)
+        {
+            return;
+        }
+        state->bouncing = 0;
+        if (level != state->pressed)
+        {
+            state->pressed = level;
+            if (level != 0)
+            {
+                state->hold_tick = LP_GetTick();
+                state->hold_ms = BUTTON_LONG_MS;
+                state->repeat_ms = BUTTON_REPEAT_START_MS;
+                state->long_sent = 0;
+                push_event(button, BUTTON_EVENT_PRESS);
+            }
+            else
+            {
+                push_event(button, BUTTON_EVENT_RELEASE);
+            }
+        }
+        return;
+    }
+
+    if (state->pressed == 0 || state->hold_ms == 0)
+    {
+        return;
+    }
+    if (LP_GetElapsedMs(state->hold_tick) < state->hold_ms)
+    {
+        return;
+    }
+    state->hold_tick = LP_GetTick();
+    if (state->long_sent == 0)
+    {
+        state->long_sent = 1;
+        state->hold_ms = 0;
+        push_event(button, BUTTON_EVENT_LONG);
+    }
+    if (((BUTTON_REPEAT_MASK >> button) & 1) != 0)
+    {
+        push_event(button, BUTTON_EVENT_REPEAT);
+        state->hold_ms = state->repeat_ms;
+        state->repeat_ms = state->repeat_ms * 3 / 4; /* 按住越久连发越快 */
+        if (state->repeat_ms < BUTTON_REPEAT_MIN_MS)
+        {
+            state->repeat_ms = BUTTON_REPEAT_MIN_MS;
+        }
+    }
+}
+
+/**
+ * @brief  计算距离最近一次需要处理的消抖、长按或连发的时间，到时需调用BUTTON_Poll()。
+ * @return 剩余时间，单位为毫秒，0xFFFF为没有需要定时处理的按钮。
+ */
+uint16_t BUTTON_GetDeadline(void)
+{
+    uint8_t i;
+    uint16_t elapsed, remain, deadline;
+    struct button_state *state;
+
+    deadline = 0xFFFF;
+    for (i = 0; i < BUTTON_COUNT; i++)
+    {
+        state = &State[i];
+        if (state->bouncing != 0)
+        {
+            elapsed = LP_GetElapsedMs(state->edge_tick);
+            remain = elapsed < BUTTON_DEBOUNCE_MS ? BUTTON_DEBOUNCE_MS - elapsed : 0;
+        }
+        else if (state->pressed != 0 && state->hold_ms != 0)
+        {
+            elapsed = LP_GetElapsedMs(state->hold_tick);
+            remain = elapsed < state->hold_ms ? state->hold_ms - elapsed : 0;
+        }
+        else
+        {
+            continue;
+        }
+        if (remain < deadline)
+        {
+            deadline = remain;
+        }
+    }
+    return deadline;
+}
+
+/**
+ * @brief  按钮初始化，打开按钮引脚的双边沿外部中断，并读取当前状态。
+ * @note   初始化时已经按住的按钮视为按下状态，不产生按下事件，例如由“设置”按钮唤醒时。
+ * @note   只使用外部中断标志和中断请求唤醒，不需要中断服务函数。
+ */
+void BUTTON_Init(void)
+{
+    LL_EXTI_InitTypeDef exti_init = {0};
+    uint8_t i, any;
+
+    any = 0;
+    for (i = 0; i < BUTTON_COUNT; i++)
+    {
+        LL_SYSCFG_SetEXTISource(Pins[i].exti_port, Pins[i].exti_src);
+        State[i].pressed = read_level(i);
+        State[i].bouncing = 0;
+        State[i].hold_ms = 0; /* 初始化前按下的按钮不产生长按和连发事件 */
+        any |= State[i].pressed;
+    }
+    if (any != 0) /* 有按钮按下时等待电平稳定后再确认一次 */
+    {
+        LL_mDelay(BUTTON_DEBOUNCE_MS);
+        for (i = 0; i < BUTTON_COUNT; i++)
+        {
+            State[i].pressed &= read_level(i);
+        }
+    }
+
+    exti_init.Line_0_31 = BUTTON_EXTI_LINES;
+    exti_init.LineCommand = ENABLE;
+    exti_init.Mode = LL_EXTI_MODE_IT;
+    exti_init.Trigger = LL_EXTI_TRIGGER_RISING_FALLING;
+    LL_EXTI_Init(&exti_init);
+    LL_EXTI_ClearFlag_0_31(BUTTON_EXTI_LINES);
+
+    Queue_Head = 0;
+    Queue_Tail = 0;
+    Last_Poll_Tick = LP_GetTick();
+}
+
+/**
+ * @brief  关闭按钮外部中断。
+ */
+void BUTTON_Deinit(void)
+{
+    LL_EXTI_DisableIT_0_31(BUTTON_EXTI_LINES);
+    LL_EXTI_DisableRisingTrig_0_31(BUTTON_EXTI_LINES);
+    LL_EXTI_DisableFallingTrig_0_31(BUTTON_EXTI_LINES);
+    LL_EXTI_ClearFlag_0_31(BUTTON_EXTI_LINES);
+}
+
+/**
+ * @brief  检查所有按钮，处理消抖、长按和连发，产生的事件加入队列。
+ */
+void BUTTON_Poll(void)
+{
+    uint8_t i;
+    uint16_t gap;
+
+    gap = LP_GetElapsedMs(Last_Poll_Tick);
+    Last_Poll_Tick = LP_GetTick();
+    for (i = 0; i < BUTTON_COUNT; i++)
+    {
+        poll_button(i, gap);
+    }
+}
+
+/**
+ * @brief  取出一个按钮事件，不等待。
+ * @param  event 事件。
+ * @return 1：没有事件，0：成功。
+ */
+uint8_t BUTTON_GetEvent(struct BUTTON_Event *event)
+{
+    BUTTON_Poll();
+    if (Queue_Tail == Queue_Head)
+    {
+        return 1;
+    }
+    *event = Queue[Queue_Tail];
+    Queue_Tail = (Queue_Tail + 1) & (BUTTON_QUEUE_SIZE - 1);
+    return 0;
+}
+
+/**
+ * @brief  等待一个按钮事件，等待期间进入Stop模式，由按钮外部中断或低功耗定时器唤醒。
+ * @param  event 事件。
+ * @param  timeout_ms 超时时间，0为永不超时。
+ * @return 1：等待超时，0：成功。
+ */
+uint8_t BUTTON_WaitEvent(struct BUTTON_Event *event, uint16_t timeout_ms)
+{
+    uint16_t tick, elapsed, remain, sleep_ms;
+
+    remain = timeout_ms;
+    tick = LP_GetTick();
+    while (BUTTON_GetEvent(event) != 0)
+    {
+        if (timeout_ms != 0)
+        {
+            elapsed = LP_GetElapsedMs(tick); /* 分段累计，超时时间可以超过低功耗定时器的计数周期 */
+            tick = LP_GetTick();
+            if (elapsed >= remain)
+            {
+                return 1;
+            }
+            remain -= elapsed;
+        }
+        sleep_ms = BUTTON_GetDeadline();
+        if (timeout_ms != 0 && remain < sleep_ms)
+        {
+            sleep_ms = remain;
+        }
+        if (sleep_ms == 0)
+        {
+            continue;
+        }
+        if (sleep_ms > BUTTON_SLEEP_MAX_MS)
+        {
+            sleep_ms = (timeout_ms == 0 && sleep_ms == 0xFFFF) ? 0 : BUTTON_SLEEP_MAX_MS; /* 没有定时任务时只等待按钮唤醒 */
+        }
+        LP_EnterStopEXTI(BUTTON_EXTI_LINES, sleep_ms);
+    }
+    return 0;
+}
+
+/**
+ * @brief  读取消抖后的按钮状态，状态在BUTTON_Poll()中更新。
+ * @param  button 按钮编号。
+ * @return 1：按下，0：释放。
+ */
+uint8_t BUTTON_IsPressed(uint8_t button)
+{
+    return State[button].pressed;
+}
+
+/**
+ * @brief  检查是否有按钮按下或正在消抖。
+ * @return 1：有按钮按下或电平未稳定，0：全部释放。
+ */
+uint8_t BUTTON_IsAnyPressed(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < BUTTON_COUNT; i++)
+    {
+        if (State[i].pressed != 0 || State[i].bouncing != 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+#ifndef _BUTTON_H_
+#define _BUTTON_H_
+
+#include "main.h"
+#include "lowpower.h"
+
+/* 可修改 */
+#define BUTTON_DEBOUNCE_MS 24      /* 电平保持稳定超过此时间后才确认按下或释放 */
+#define BUTTON_LONG_MS 500         /* 按住超过此时间产生长按事件 */
+#define BUTTON_REPEAT_START_MS 250 /* 长按后第一次连发的间隔 */
+#define BUTTON_REPEAT_MIN_MS 40    /* 连发间隔每次缩短为3/4，直到此值 */
+#define BUTTON_QUEUE_SIZE 8        /* 事件队列长度，必须为2的幂 */
+/* 结束 */
+
+#define BUTTON_SET 0 /* 按钮编号 */
+#define BUTTON_UP 1
+#define BUTTON_DOWN 2
+#define BUTTON_COUNT 3
+
+#define BUTTON_EXTI_LINES (LL_EXTI_LINE_15 | LL_EXTI_LINE_3 | LL_EXTI_LINE_4) /* 与按钮引脚对应的外部中断线 */
+#define BUTTON_REPEAT_MASK ((1 << BUTTON_UP) | (1 << BUTTON_DOWN)) /* 长按后连发的按钮 */
+
+#define BUTTON_EVENT_PRESS 1   /* 按下 */
+#define BUTTON_EVENT_RELEASE 2 /* 释放 */
+#define BUTTON_EVENT_LONG 3    /* 长按，每次按下只产生一次 */
+#define BUTTON_EVENT_REPEAT 4  /* 长按后连发，间隔逐渐缩短 */
+
+struct BUTTON_Event
+{
+    uint8_t button; /* 按钮编号，BUTTON_xxx */
+    uint8_t type;   /* 事件类型，BUTTON_EVENT_xxx */
+};
+
+void BUTTON_Init(void);
+void BUTTON_Deinit(void);
+
+void BUTTON_Poll(void);
+uint16_t BUTTON_GetDeadline(void);
+uint8_t BUTTON_GetEvent(struct BUTTON_Event *event);
+uint8_t BUTTON_WaitEvent(struct BUTTON_Event *event, uint16_t timeout_ms);
+uint8_t BUTTON_IsPressed(uint8_t button);
+uint8_t BUTTON_IsAnyPressed(void);
+
+#endif
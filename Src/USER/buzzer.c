@@ -1,6 +1,34 @@
 #include "buzzer.h"
 #include <math.h>
 
+static uint8_t Volume;                  /* 最近一次设置的音量，序列改变频率后重新设置 */
+static const struct BUZZER_Note *Notes; /* 正在播放的序列，NULL为没有播放 */
+static uint8_t Note_Count;
+static uint8_t Note_Index;
+static uint16_t Repeat_Remain; /* 包括本次在内剩余的播放次数 */
+static uint16_t Note_Tick;     /* 当前音符开始时的低功耗定时器计数值 */
+
+/**
+ * @brief  开始播放序列中的当前音符。
+ */
+static void start_note(void)
+{
+    const struct BUZZER_Note *note;
+
+    note = &Notes[Note_Index];
+    if (note->freq == 0)
+    {
+        BUZZER_Stop();
+    }
+    else
+    {
+        BUZZER_SetFrqe(note->freq);
+        BUZZER_SetVolume(Volume); /* 比较值按自动重装载值计算，改变频率后需要重新设置 */
+        BUZZER_Start();
+    }
+    Note_Tick = LP_GetTick();
+}
+
 /**
  * @brief  打开蜂鸣器定时器。
  */
@@ -57,6 +85,7 @@ void BUZZER_SetVolume(uint8_t vol)
 
     autoreload = LL_TIM_GetAutoReload(BUZZER_TIMER);
     vol = vol % 11;
+    Volume = vol;
     BUZZER_OC_SET_FUNC(BUZZER_TIMER, ((autoreload / 2.0) / 100) * pow(vol, 2.0));
 }
 
@@ -91,3 +120,73 @@ void BUZZER_Stop(void)
 {
     LL_TIM_CC_DisableChannel(BUZZER_TIMER, BUZZER_CHANNEL);
 }
+
+/**
+ * @brief  开始播放音符序列，不等待，之后需要按BUZZER_Poll()返回的时间调用BUZZER_Poll()。
+ * @param  notes 音符序列，播放期间必须保持有效。
+ * @param  count 音符数量。
+ * @param  repeat 整个序列的播放次数，0为不播放。
+ * @note   使用最近一次BUZZER_SetVolume()设置的音量，Stop模式下定时器停止，等待时只能进入Sleep模式。
+ */
+void BUZZER_Play(const struct BUZZER_Note *notes, uint8_t count, uint16_t repeat)
+{
+    if (notes == NULL || count == 0 || repeat == 0)
+    {
+        BUZZER_Cancel();
+        return;
+    }
+    Notes = notes;
+    Note_Count = count;
+    Note_Index = 0;
+    Repeat_Remain = repeat;
+    start_note();
+}
+
+/**
+ * @brief  检查当前音符是否结束并切换到下一个音符。
+ * @return 距离下一次需要调用的时间，单位为毫秒，0xFFFF为序列已播放完毕。
+ */
+uint16_t BUZZER_Poll(void)
+{
+    uint16_t elapsed;
+
+    while (Notes != NULL)
+    {
+        elapsed = LP_GetElapsedMs(Note_Tick);
+        if (elapsed < Notes[Note_Index].ms)
+        {
+            return Notes[Note_Index].ms - elapsed;
+        }
+        Note_Index += 1;
+        if (Note_Index >= Note_Count)
+        {
+            Note_Index = 0;
+            Repeat_Remain -= 1;
+            if (Repeat_Remain == 0)
+            {
+                BUZZER_Cancel();
+                break;
+            }
+        }
+        start_note();
+    }
+    return 0xFFFF;
+}
+
+/**
+ * @brief  检查序列是否正在播放。
+ * @return 1：正在播放，0：没有播放。
+ */
+uint8_t BUZZER_IsPlaying(void)
+{
+    return Notes != NULL;
+}
+
+/**
+ * @brief  停止播放序列并关闭鸣响。
+ */
+void BUZZER_Cancel(void)
+{
+    Notes = NULL;
+    BUZZER_Stop();
+}
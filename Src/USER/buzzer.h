@@ -2,6 +2,8 @@
 #define _BUZZER_H_
 
 #include "main.h"
+#include "lowpower.h"
+#include <stddef.h>
 
 /* 可修改 */
 #define BUZZER_TIMER TIM2
@@ -12,6 +14,12 @@
 
 #define BUZZER_MAX_VOL 10
 
+struct BUZZER_Note /* 序列中的一个音符 */
+{
+    uint16_t freq; /* 频率，0为静音 */
+    uint16_t ms;   /* 持续时间 */
+};
+
 void BUZZER_Enable(void);
 void BUZZER_Disable(void);
 void BUZZER_Start(void);
@@ -20,4 +28,9 @@ void BUZZER_Beep(uint16_t time_ms);
 void BUZZER_SetVolume(uint8_t vol);
 void BUZZER_SetFrqe(uint32_t freq);
 
+void BUZZER_Play(const struct BUZZER_Note *notes, uint8_t count, uint16_t repeat);
+uint16_t BUZZER_Poll(void);
+uint8_t BUZZER_IsPlaying(void);
+void BUZZER_Cancel(void);
+
 #endif
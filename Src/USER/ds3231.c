@@ -2,6 +2,13 @@
 
 #include "serial.h"
 #include <stdio.h>
+#include <string.h>
+
+static uint8_t Shadow[RTC_REG_COUNT]; /* 寄存器缓存 */
+static uint8_t ShadowSTA;             /* 载入缓存时的状态寄存器 */
+static uint32_t ShadowDirty;          /* 已修改的寄存器，每个寄存器一位 */
+static uint8_t ShadowActive;          /* 1：寄存器读写在缓存中进行 */
+
 /**
  * @brief  BIN转BCD。
  * @param  bin 要转换的数值。
@@ -48,23 +55,108 @@ static void check_range(uint8_t *number, uint8_t max, uint8_t min)
     }
 }
 
+/**
+ * @brief  通过I2C读取多个寄存器。
+ * @param  start_reg 起始寄存器。
+ * @param  read_size 要读取的大小。
+ * @param  read_data 存放数值的指针。
+ * @return 1：读取失败，0：读取成功。
+ */
+static uint8_t read_reg_multi(uint8_t start_reg, uint8_t read_size, uint8_t *read_data)
+{
+    struct I2C_Transfer transfer;
+
+    transfer.addr = RTC_I2C_ADDR;
+    transfer.tx_data = &start_reg;
+    transfer.tx_size = 1;
+    transfer.rx_data = read_data;
+    transfer.rx_size = read_size;
+    transfer.restart = 1;
+    if (I2C_Transfer(&transfer) != I2C_STATUS_OK)
+    {
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief  通过I2C写入多个寄存器。
+ * @param  start_reg 起始寄存器。
+ * @param  write_size 要写入的大小，不超过RTC_REG_COUNT。
+ * @param  write_data 存放数值的指针。
+ * @return 1：写入失败，0：写入成功。
+ */
+static uint8_t write_reg_multi(uint8_t start_reg, uint8_t write_size, const uint8_t *write_data)
+{
+    uint8_t buffer[RTC_REG_COUNT + 1];
+    struct I2C_Transfer transfer;
+
+    if (write_size > RTC_REG_COUNT)
+    {
+        return 1;
+    }
+    buffer[0] = start_reg; /* 寄存器地址和数据需要在同一次传输中发送 */
+    memcpy(&buffer[1], write_data, write_size);
+    transfer.addr = RTC_I2C_ADDR;
+    transfer.tx_data = buffer;
+    transfer.tx_size = write_size + 1;
+    transfer.rx_data = NULL;
+    transfer.rx_size = 0;
+    transfer.restart = 0;
+    if (I2C_Transfer(&transfer) != I2C_STATUS_OK)
+    {
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief  修改缓存中的寄存器，数值变化时标记为已修改。
+ * @param  reg 要修改的寄存器。
+ * @param  data 新的数值。
+ */
+static void shadow_write(uint8_t reg, uint8_t data)
+{
+    if (Shadow[reg] != data)
+    {
+        Shadow[reg] = data;
+        ShadowDirty |= 1UL << reg;
+    }
+}
+
+/**
+ * @brief  检查未修改的寄存器能否随相邻的已修改寄存器一起写回。
+ * @param  reg 要检查的寄存器。
+ * @return 1：可以，0：不可以。
+ * @note   时间寄存器在缓存期间仍在走时，控制寄存器的CONV位写1会启动温度转换，温度寄存器只读，都不能合并。
+ */
+static uint8_t shadow_gap_safe(uint8_t reg)
+{
+    if ((reg >= RTC_REG_AL1_SEC && reg <= RTC_REG_AL2_DDT) || reg == RTC_REG_STA)
+    {
+        return 1;
+    }
+    return 0;
+}
+
 /**
  * @brief  读取寄存器。
  * @param  reg 要读取的寄存器。
  * @return 读取到的数值。
+ * @note   缓存打开时从缓存中读取，下同。
  */
 uint8_t RTC_ReadREG(uint8_t reg)
 {
     uint8_t read_temp;
 
-    if (I2C_Start(RTC_I2C_ADDR, 0, 1) != 0 ||
-        I2C_WriteByte(reg) != 0 ||
-        I2C_Start(RTC_I2C_ADDR, 1, 1) != 0)
+    if (ShadowActive != 0 && reg < RTC_REG_COUNT)
+    {
+        return Shadow[reg];
+    }
+    if (read_reg_multi(reg, 1, &read_temp) != 0)
     {
         return 0x00;
     }
-    read_temp = I2C_ReadByte();
-    I2C_Stop();
     return read_temp;
 }
 
@@ -76,14 +168,12 @@ uint8_t RTC_ReadREG(uint8_t reg)
  */
 uint8_t RTC_WriteREG(uint8_t reg, uint8_t data)
 {
-    if (I2C_Start(RTC_I2C_ADDR, 0, 2) != 0 ||
-        I2C_WriteByte(reg) != 0 ||
-        I2C_WriteByte(data) != 0)
+    if (ShadowActive != 0 && reg < RTC_REG_COUNT)
     {
-        return 1;
+        shadow_write(reg, data);
+        return 0;
     }
-    I2C_Stop();
-    return 0;
+    return write_reg_multi(reg, 1, &data);
 }
 
 /**
@@ -95,20 +185,12 @@ uint8_t RTC_WriteREG(uint8_t reg, uint8_t data)
  */
 uint8_t RTC_ReadREG_Multi(uint8_t start_reg, uint8_t read_size, uint8_t *read_data)
 {
-    uint8_t i;
-
-    if (I2C_Start(RTC_I2C_ADDR, 0, 1) != 0 ||
-        I2C_WriteByte(start_reg) != 0 ||
-        I2C_Start(RTC_I2C_ADDR, 1, read_size) != 0)
-    {
-        return 1;
-    }
-    for (i = 0; i < read_size; i++)
+    if (ShadowActive != 0 && start_reg + read_size <= RTC_REG_COUNT)
     {
-        read_data[i] = I2C_ReadByte();
+        memcpy(read_data, &Shadow[start_reg], read_size);
+        return 0;
     }
-    I2C_Stop();
-    return 0;
+    return read_reg_multi(start_reg, read_size, read_data);
 }
 
 /**
@@ -120,24 +202,17 @@ uint8_t RTC_ReadREG_Multi(uint8_t start_reg, uint8_t read_size, uint8_t *read_da
  */
 uint8_t RTC_WriteREG_Multi(uint8_t start_reg, uint8_t write_size, const uint8_t *write_data)
 {
-    uint8_t i, err;
+    uint8_t i;
 
-    if (I2C_Start(RTC_I2C_ADDR, 0, write_size + 1) != 0 ||
-        I2C_WriteByte(start_reg) != 0)
+    if (ShadowActive != 0 && start_reg + write_size <= RTC_REG_COUNT)
     {
-        return 1;
-    }
-    err = 0;
-    for (i = 0; i < write_size; i++)
-    {
-        if (I2C_WriteByte(write_data[i]) != 0)
+        for (i = 0; i < write_size; i++)
         {
-            err = 1;
-            break;
+            shadow_write(start_reg + i, write_data[i]);
         }
+        return 0;
     }
-    I2C_Stop();
-    return err;
+    return write_reg_multi(start_reg, write_size, write_data);
 }
 
 /**
@@ -182,6 +257,82 @@ uint8_t RTC_TestREG(uint8_t reg, uint8_t mask)
     }
 }
 
+/**
+ * @brief  一次读取全部寄存器到缓存，之后的寄存器读写都在缓存中进行，直到调用RTC_FlushShadow()。
+ * @return 1：读取失败，仍直接读写寄存器，0：读取成功或缓存已经打开。
+ * @note   缓存期间读取的时间和标志都是载入时的数值，需要实时读取时先写回缓存。
+ */
+uint8_t RTC_LoadShadow(void)
+{
+    if (ShadowActive != 0)
+    {
+        return 0;
+    }
+    if (read_reg_multi(RTC_REG_SEC, RTC_REG_COUNT, Shadow) != 0)
+    {
+        return 1;
+    }
+    ShadowSTA = Shadow[RTC_REG_STA];
+    ShadowDirty = 0;
+    ShadowActive = 1;
+    return 0;
+}
+
+/**
+ * @brief  将缓存中已修改的寄存器写回并关闭缓存，连续或间隔很近的寄存器合并为一次写入。
+ * @return 1：写入失败，0：写入成功或缓存没有打开。
+ * @note   闹钟标志只能写0清除，载入时为0的标志写回1，不会清除缓存期间新产生的闹钟。
+ */
+uint8_t RTC_FlushShadow(void)
+{
+    uint8_t i, reg, start, end, err;
+    uint8_t data[RTC_REG_COUNT];
+
+    if (ShadowActive == 0)
+    {
+        return 0;
+    }
+    ShadowActive = 0;
+    err = 0;
+    reg = 0;
+    while (reg < RTC_REG_COUNT)
+    {
+        if ((ShadowDirty & (1UL << reg)) == 0)
+        {
+            reg += 1;
+            continue;
+        }
+        start = reg;
+        end = reg;
+        for (reg = start + 1; reg < RTC_REG_COUNT; reg++) /* 向后查找可以合并的已修改寄存器 */
+        {
+            if ((ShadowDirty & (1UL << reg)) != 0)
+            {
+                end = reg;
+            }
+            else if (reg - end > RTC_SHADOW_MERGE_GAP || shadow_gap_safe(reg) == 0)
+            {
+                break;
+            }
+        }
+        for (i = start; i <= end; i++)
+        {
+            data[i - start] = Shadow[i];
+            if (i == RTC_REG_STA)
+            {
+                data[i - start] |= ~ShadowSTA & 0x03;
+            }
+        }
+        if (write_reg_multi(start, end - start + 1, data) != 0)
+        {
+            err = 1;
+        }
+        reg = end + 1;
+    }
+    ShadowDirty = 0;
+    return err;
+}
+
 /**
  * @brief  读取实时时钟时间。
  * @param  time 时间存储结构体。
@@ -327,7 +478,7 @@ uint8_t RTC_GetAlarm1(struct RTC_Alarm *alarm)
     if ((alarm->Hours & 0x40) != 0) /* 12小时制 */
     {
         alarm->Is_12hr = 1;
-        if ((alarm->Hours & 0x60) != 0) /* PM标志 */
+        if ((alarm->Hours & 0x20) != 0) /* PM标志，0x40为12小时标志，不能一起判断 */
         {
             alarm->PM = 1;
         }
@@ -432,7 +583,7 @@ uint8_t RTC_GetAlarm2(struct RTC_Alarm *alarm)
     if ((alarm->Hours & 0x40) != 0) /* 12小时制 */
     {
         alarm->Is_12hr = 1;
-        if ((alarm->Hours & 0x60) != 0) /* PM标志 */
+        if ((alarm->Hours & 0x20) != 0) /* PM标志，0x40为12小时标志，不能一起判断 */
         {
             alarm->PM = 1;
         }
@@ -6,6 +6,7 @@
 
 /* 可修改 */
 #define RTC_I2C_ADDR ((0x68 & 0xFE) << 1)
+#define RTC_SHADOW_MERGE_GAP 2 /* 写回缓存时，两段已修改的闹钟寄存器之间不超过此数量的未修改寄存器时合并为一次写入 */
 /* 结束 */
 
 #define RTC_REG_SEC 0x00
@@ -30,6 +31,7 @@
 #define RTC_REG_AGI 0x10
 #define RTC_REG_TPM 0x11
 #define RTC_REG_TPL 0x12
+#define RTC_REG_COUNT 0x13
 
 struct RTC_Time
 {
@@ -63,6 +65,9 @@ uint8_t RTC_WriteREG_Multi(uint8_t start_reg, uint8_t write_size, const uint8_t
 uint8_t RTC_ModifyREG(uint8_t reg, uint8_t mask, uint8_t new_val);
 uint8_t RTC_TestREG(uint8_t reg, uint8_t mask);
 
+uint8_t RTC_LoadShadow(void);
+uint8_t RTC_FlushShadow(void);
+
 uint8_t RTC_GetTime(struct RTC_Time *time);
 uint8_t RTC_SetTime(const struct RTC_Time *time);
 void RTC_CheckTimeRange(struct RTC_Time *time);
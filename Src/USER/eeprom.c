@@ -1,4 +1,5 @@
 #include "eeprom.h"
+#include "wait.h"
 
 #define EEPROM_UNLOCK()       \
     if (eeprom_unlock() != 0) \
@@ -18,24 +19,10 @@
  */
 static uint8_t eeprom_wait_busy(void)
 {
-    uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    struct WAIT_Context wait;
 
-    timeout = EEPROM_TIMEOUT_MS;
-    systick_tmp = SysTick->CTRL;
-    ((void)systick_tmp);
-    while (timeout != 0 && (FLASH->SR & FLASH_SR_BSY) != 0)
-    {
-        if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
-        {
-            timeout -= 1;
-        }
-    }
-    if (timeout == 0)
-    {
-        return 1;
-    }
-    return 0;
+    WAIT_WHILE(wait, (FLASH->SR & FLASH_SR_BSY) != 0, EEPROM_TIMEOUT_MS, WAIT_SITE_EEPROM); /* 编程期间CPU进入Sleep模式，NVM保持供电 */
+    return wait.timeout;
 }
 
 /**
@@ -0,0 +1,131 @@
+#include "energy.h"
+
+#define ENERGY_UC_PER_MAH 3600000.0 /* 1mAh = 3.6C */
+#define ENERGY_MS_PER_DAY 86400000.0
+
+/*
+ * 按PROF_PHASE_xxx的顺序：读取时间，温湿度测量，电子纸初始化，绘制并发送，电子纸刷新，电池电压测量和电子纸休眠。
+ * 温湿度测量与电子纸初始化和绘制同时进行，MCU电流已经计入其他阶段，只计SHT30的电流。
+ */
+const struct ENERGY_Model ENERGY_DefaultModel = {
+    {ENERGY_CURRENT_MCU_RUN_UA,
+     ENERGY_CURRENT_SHT30_UA,
+     ENERGY_CURRENT_MCU_RUN_UA + ENERGY_CURRENT_EPD_IDLE_UA,
+     ENERGY_CURRENT_MCU_RUN_UA + ENERGY_CURRENT_EPD_IDLE_UA,
+     ENERGY_CURRENT_MCU_STOP_UA + ENERGY_CURRENT_EPD_SHOW_UA,
+     ENERGY_CURRENT_MCU_RUN_UA + ENERGY_CURRENT_ADC_UA + ENERGY_CURRENT_EPD_IDLE_UA},
+    1 << ENERGY_PHASE_SENSOR,
+    ENERGY_CURRENT_STANDBY_UA,
+    ENERGY_BATTERY_CAPACITY_MAH};
+
+/**
+ * @brief  计算一次唤醒消耗的电量。
+ * @param  model 电流模型。
+ * @param  phase_ms 各阶段的时间，单位为毫秒，共ENERGY_PHASE_COUNT个。
+ * @return 消耗的电量，单位为微库仑。
+ */
+float ENERGY_GetWakeCharge(const struct ENERGY_Model *model, const uint16_t *phase_ms)
+{
+    uint8_t i;
+    float charge;
+
+    charge = 0;
+    for (i = 0; i < ENERGY_PHASE_COUNT; i++)
+    {
+        charge += model->phase_ua[i] * phase_ms[i] / 1000;
+    }
+    return charge;
+}
+
+/**
+ * @brief  计算每天消耗的电量，包括唤醒和两次唤醒之间的Standby模式。
+ * @param  model 电流模型。
+ * @param  phase_ms 各阶段的时间，单位为毫秒，共ENERGY_PHASE_COUNT个。
+ * @param  wakes_per_day 每天唤醒的次数。
+ * @return 消耗的电量，单位为毫安时。
+ */
+float ENERGY_GetDailyCharge(const struct ENERGY_Model *model, const uint16_t *phase_ms, uint16_t wakes_per_day)
+{
+    uint8_t i;
+    float wake_ms, standby_ms;
+
+    wake_ms = 0;
+    for (i = 0; i < ENERGY_PHASE_COUNT; i++)
+    {
+        if ((model->overlap_mask & (1 << i)) == 0) /* 同时进行的阶段已经包含在其他阶段的时间中 */
+        {
+            wake_ms += phase_ms[i];
+        }
+    }
+    standby_ms = ENERGY_MS_PER_DAY - wake_ms * wakes_per_day;
+    if (standby_ms < 0)
+    {
+        standby_ms = 0;
+    }
+    return (ENERGY_GetWakeCharge(model, phase_ms) * wakes_per_day + model->standby_ua * standby_ms / 1000) / ENERGY_UC_PER_MAH;
+}
+
+/**
+ * @brief  根据电池电压估算剩余电量。
+ * @param  model 电流模型。
+ * @param  voltage 当前电池电压。
+ * @param  max_voltage 满电电压。
+ * @param  min_voltage 放电截止电压，低于此电压剩余电量为0。
+ * @return 剩余电量，单位为毫安时。
+ * @note   按电压在满电和截止电压之间线性估算，碱性电池放电后期电压下降较快，估算结果偏保守。
+ */
+float ENERGY_GetRemainingCapacity(const struct ENERGY_Model *model, float voltage, float max_voltage, float min_voltage)
+{
+    float ratio;
+
+    if (max_voltage <= min_voltage)
+    {
+        return 0;
+    }
+    ratio = (voltage - min_voltage) / (max_voltage - min_voltage);
+    if (ratio < 0)
+    {
+        ratio = 0;
+    }
+    else if (ratio > 1)
+    {
+        ratio = 1;
+    }
+    return model->capacity_mah * ratio;
+}
+
+/**
+ * @brief  估算每次唤醒和每天的电量消耗，以及剩余的运行天数。
+ * @param  model 电流模型。
+ * @param  phase_ms 各阶段的时间，单位为毫秒，共ENERGY_PHASE_COUNT个。
+ * @param  wakes_per_day 每天唤醒的次数。
+ * @param  voltage 当前电池电压。
+ * @param  max_voltage 满电电压。
+ * @param  warn_voltage 电量警告电压。
+ * @param  stop_voltage 关机电压。
+ * @param  result 估算结果的指针。
+ */
+void ENERGY_Estimate(const struct ENERGY_Model *model, const uint16_t *phase_ms, uint16_t wakes_per_day,
+                     float voltage, float max_voltage, float warn_voltage, float stop_voltage, struct ENERGY_Result *result)
+{
+    float warn_mah;
+
+    result->wake_uc = ENERGY_GetWakeCharge(model, phase_ms);
+    result->daily_mah = ENERGY_GetDailyCharge(model, phase_ms, wakes_per_day);
+    result->remaining_mah = ENERGY_GetRemainingCapacity(model, voltage, max_voltage, stop_voltage);
+    warn_mah = result->remaining_mah - ENERGY_GetRemainingCapacity(model, warn_voltage, max_voltage, stop_voltage);
+    if (warn_mah < 0)
+    {
+        warn_mah = 0;
+    }
+    if (result->daily_mah > 0)
+    {
+        result->days_to_warn = warn_mah / result->daily_mah;
+        result->days_to_stop = result->remaining_mah / result->daily_mah;
+    }
+    else
+    {
+        result->days_to_warn = 0;
+        result->days_to_stop = 0;
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef _ENERGY_H_
+#define _ENERGY_H_
+
+#include <stdint.h> /* 不依赖硬件，可以直接在电脑上编译，用于评估配置修改 */
+
+/* 可修改，电流均为在电池端测得的平均值，单位为微安 */
+#define ENERGY_BATTERY_CAPACITY_MAH 1000.0 /* 电池容量，两节AAA碱性电池串联 */
+#define ENERGY_CURRENT_STANDBY_UA 6.0      /* Standby模式整机电流，包括DS3231计时和升压芯片静态电流 */
+#define ENERGY_CURRENT_MCU_RUN_UA 1200.0   /* MCU运行，系统时钟8MHz */
+#define ENERGY_CURRENT_MCU_STOP_UA 2.0     /* MCU在Stop模式等待 */
+#define ENERGY_CURRENT_SHT30_UA 800.0      /* SHT30单次测量 */
+#define ENERGY_CURRENT_EPD_IDLE_UA 300.0   /* 电子纸通电，未刷新 */
+#define ENERGY_CURRENT_EPD_SHOW_UA 4000.0  /* 电子纸刷新 */
+#define ENERGY_CURRENT_ADC_UA 400.0        /* ADC和内部参考电压 */
+/* 结束 */
+
+#define ENERGY_PHASE_COUNT 6 /* 阶段的数量和顺序与PROF_PHASE_xxx相同 */
+#define ENERGY_PHASE_SENSOR 1 /* 与PROF_PHASE_SENSOR相同 */
+
+struct ENERGY_Model
+{
+    float phase_ua[ENERGY_PHASE_COUNT]; /* 各阶段的平均电流，与其他阶段同时进行的阶段只包括额外的电流 */
+    uint8_t overlap_mask;               /* 与其他阶段同时进行的阶段，按位表示，不计入唤醒时长 */
+    float standby_ua;                   /* 两次唤醒之间的电流 */
+    float capacity_mah;                 /* 电池容量 */
+};
+
+struct ENERGY_Result
+{
+    float wake_uc;       /* 每次唤醒消耗的电量，单位为微库仑 */
+    float daily_mah;     /* 每天消耗的电量 */
+    float remaining_mah; /* 到关机电压为止的剩余电量 */
+    float days_to_warn;  /* 到警告电压为止的天数 */
+    float days_to_stop;  /* 到关机电压为止的天数 */
+};
+
+extern const struct ENERGY_Model ENERGY_DefaultModel;
+
+float ENERGY_GetWakeCharge(const struct ENERGY_Model *model, const uint16_t *phase_ms);
+float ENERGY_GetDailyCharge(const struct ENERGY_Model *model, const uint16_t *phase_ms, uint16_t wakes_per_day);
+float ENERGY_GetRemainingCapacity(const struct ENERGY_Model *model, float voltage, float max_voltage, float min_voltage);
+void ENERGY_Estimate(const struct ENERGY_Model *model, const uint16_t *phase_ms, uint16_t wakes_per_day,
+                     float voltage, float max_voltage, float warn_voltage, float stop_voltage, struct ENERGY_Result *result);
+
+#endif
@@ -0,0 +1,218 @@
+#include "epoch.h"
+
+static const uint8_t Month_Days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+static const uint16_t Month_Start[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334}; /* 平年每月1日之前的天数 */
+
+static uint8_t epoch_bin_to_bcd(uint8_t bin) /* BIN转BCD */
+{
+    return ((bin / 10) << 4) | (bin % 10);
+}
+
+static uint8_t epoch_bcd_to_bin(uint8_t bcd) /* BCD转BIN */
+{
+    return (bcd >> 4) * 10 + (bcd & 0x0F);
+}
+
+/**
+ * @brief  计算某年1月1日的天数。
+ * @param  year 年，0 ~ 199。
+ * @return 天数。
+ * @note   2000年是闰年，之前各年的闰年数量按(year + 3) / 4计算，再扣除整百年并加回整四百年。
+ */
+static uint32_t epoch_year_start(uint8_t year)
+{
+    return year * 365UL + (year + 3) / 4 - (year + 99) / 100 + (year + 399) / 400;
+}
+
+/**
+ * @brief  判断是否为闰年。
+ * @param  year 年，0 ~ 199，与实时时钟的Year相同。
+ * @return 1：闰年，0：平年。
+ */
+uint8_t EPOCH_IsLeapYear(uint8_t year)
+{
+    return year % 4 == 0 && (year % 100 != 0 || year == 0); /* 2000年以后的整百年中只有2000年是闰年 */
+}
+
+/**
+ * @brief  获取某月的天数。
+ * @param  year 年，0 ~ 199。
+ * @param  month 月，1 ~ 12。
+ * @return 28 ~ 31，月超出范围时返回0。
+ */
+uint8_t EPOCH_GetMonthDays(uint8_t year, uint8_t month)
+{
+    if (month < 1 || month > 12)
+    {
+        return 0;
+    }
+    if (month == 2 && EPOCH_IsLeapYear(year) != 0)
+    {
+        return 29;
+    }
+    return Month_Days[month - 1];
+}
+
+/**
+ * @brief  公历日期转换为天数。
+ * @param  year 年，0 ~ 199。
+ * @param  month 月，1 ~ 12。
+ * @param  date 日，1 ~ 31。
+ * @return 2000年1月1日以来的天数，0 ~ EPOCH_DAY_COUNT - 1。
+ * @note   不检查日期是否有效，超出当月天数时顺延到下个月。
+ */
+uint32_t EPOCH_DateToDays(uint8_t year, uint8_t month, uint8_t date)
+{
+    uint32_t days;
+
+    days = epoch_year_start(year) + Month_Start[(uint8_t)(month - 1) % 12] + date - 1;
+    if (month > 2 && EPOCH_IsLeapYear(year) != 0)
+    {
+        days += 1;
+    }
+    return days;
+}
+
+/**
+ * @brief  天数转换为公历日期。
+ * @param  days 2000年1月1日以来的天数，0 ~ EPOCH_DAY_COUNT - 1。
+ * @param  year 年，0 ~ 199。
+ * @param  month 月，1 ~ 12。
+ * @param  date 日，1 ~ 31。
+ * @note   按365天估计的年最多大1，按31天估计的月最多小1，各修正一次，不需要循环。
+ */
+void EPOCH_DaysToDate(uint32_t days, uint8_t *year, uint8_t *month, uint8_t *date)
+{
+    uint8_t y, m, leap;
+    uint16_t day_of_year, start;
+
+    y = days / 365;
+    if (epoch_year_start(y) > days)
+    {
+        y -= 1;
+    }
+    day_of_year = days - epoch_year_start(y);
+    leap = EPOCH_IsLeapYear(y);
+
+    m = day_of_year / 31; /* 0 ~ 11 */
+    if (m < 11)
+    {
+        start = Month_Start[m + 1] + (m + 1 >= 2 ? leap : 0);
+        if (day_of_year >= start)
+        {
+            m += 1;
+        }
+    }
+    start = Month_Start[m] + (m >= 2 ? leap : 0);
+
+    *year = y;
+    *month = m + 1;
+    *date = day_of_year - start + 1;
+}
+
+/**
+ * @brief  计算星期。
+ * @param  days 2000年1月1日以来的天数。
+ * @return 1 ~ 7，与实时时钟的Day相同，7为星期日。
+ * @note   2000年1月1日是星期六。
+ */
+uint8_t EPOCH_GetDay(uint32_t days)
+{
+    return (days + 5) % 7 + 1;
+}
+
+/**
+ * @brief  实时时钟时间转换为秒数。
+ * @param  time 时间，不使用星期，12小时制时按PM换算。
+ * @return 2000年1月1日0点以来的秒数。
+ * @note   日期在2136年2月7日之后时溢出，需要更大范围时使用EPOCH_DateToDays()按天计算。
+ */
+uint32_t EPOCH_FromTime(const struct RTC_Time *time)
+{
+    uint8_t hours;
+
+    hours = time->Hours;
+    if (time->Is_12hr != 0)
+    {
+        hours = time->Hours % 12 + (time->PM != 0 ? 12 : 0);
+    }
+    return EPOCH_DateToDays(time->Year, time->Month, time->Date) * EPOCH_SECONDS_PER_DAY +
+           hours * 3600UL + time->Minutes * 60 + time->Seconds;
+}
+
+/**
+ * @brief  秒数转换为实时时钟时间，同时计算星期。
+ * @param  seconds 2000年1月1日0点以来的秒数。
+ * @param  is_12hr 1：转换为12小时制，0：转换为24小时制。
+ * @param  time 时间。
+ */
+void EPOCH_ToTime(uint32_t seconds, uint8_t is_12hr, struct RTC_Time *time)
+{
+    uint32_t days, second_of_day;
+
+    days = seconds / EPOCH_SECONDS_PER_DAY;
+    second_of_day = seconds - days * EPOCH_SECONDS_PER_DAY;
+    EPOCH_DaysToDate(days, &time->Year, &time->Month, &time->Date);
+    time->Day = EPOCH_GetDay(days);
+    time->Hours = second_of_day / 3600;
+    time->Minutes = (second_of_day / 60) % 60;
+    time->Seconds = second_of_day % 60;
+    time->Is_12hr = is_12hr != 0;
+    time->PM = 0;
+    if (is_12hr != 0)
+    {
+        time->PM = time->Hours >= 12;
+        time->Hours = time->Hours % 12 == 0 ? 12 : time->Hours % 12;
+    }
+}
+
+/**
+ * @brief  DS3231时间寄存器的内容转换为秒数，不经过struct RTC_Time。
+ * @param  regs 0x00 ~ 0x06寄存器的原始内容，共EPOCH_RTC_REG_COUNT个，可以由RTC_ReadREG_Multi()一次读出。
+ * @return 2000年1月1日0点以来的秒数。
+ */
+uint32_t EPOCH_FromRegs(const uint8_t *regs)
+{
+    uint8_t hours, year;
+
+    if ((regs[2] & 0x40) != 0) /* 12小时制 */
+    {
+        hours = epoch_bcd_to_bin(regs[2] & 0x1F) % 12 + ((regs[2] & 0x20) != 0 ? 12 : 0);
+    }
+    else
+    {
+        hours = epoch_bcd_to_bin(regs[2] & 0x3F);
+    }
+    year = epoch_bcd_to_bin(regs[6]) + ((regs[5] & 0x80) != 0 ? 100 : 0); /* 世纪处理 */
+    return EPOCH_DateToDays(year, epoch_bcd_to_bin(regs[5] & 0x1F), epoch_bcd_to_bin(regs[4] & 0x3F)) * EPOCH_SECONDS_PER_DAY +
+           hours * 3600UL + epoch_bcd_to_bin(regs[1] & 0x7F) * 60 + epoch_bcd_to_bin(regs[0] & 0x7F);
+}
+
+/**
+ * @brief  秒数转换为DS3231时间寄存器的内容，不经过struct RTC_Time。
+ * @param  seconds 2000年1月1日0点以来的秒数。
+ * @param  is_12hr 1：使用12小时制，0：使用24小时制。
+ * @param  regs 0x00 ~ 0x06寄存器的内容，共EPOCH_RTC_REG_COUNT个，可以由RTC_WriteREG_Multi()一次写入。
+ * @note   星期寄存器与ds3231.c相同，以1为星期日。
+ */
+void EPOCH_ToRegs(uint32_t seconds, uint8_t is_12hr, uint8_t *regs)
+{
+    struct RTC_Time time;
+
+    EPOCH_ToTime(seconds, is_12hr, &time);
+    regs[0] = epoch_bin_to_bcd(time.Seconds);
+    regs[1] = epoch_bin_to_bcd(time.Minutes);
+    regs[2] = epoch_bin_to_bcd(time.Hours);
+    if (is_12hr != 0)
+    {
+        regs[2] |= 0x40 | (time.PM != 0 ? 0x20 : 0x00);
+    }
+    regs[3] = time.Day % 7 + 1;
+    regs[4] = epoch_bin_to_bcd(time.Date);
+    regs[5] = epoch_bin_to_bcd(time.Month);
+    regs[6] = epoch_bin_to_bcd(time.Year % 100);
+    if (time.Year > 99)
+    {
+        regs[5] |= 0x80;
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef _EPOCH_H_
+#define _EPOCH_H_
+
+#include "ds3231.h" /* 只使用struct RTC_Time，epoch.c不访问硬件，可以直接在电脑上编译和验证 */
+
+#define EPOCH_BASE_YEAR 2000 /* 第0天为2000年1月1日，与实时时钟的Year为0时相同 */
+#define EPOCH_YEAR_COUNT 200 /* 实时时钟的世纪标志可以表示2000年至2199年 */
+#define EPOCH_DAY_COUNT 73049UL
+#define EPOCH_SECONDS_PER_DAY 86400UL
+#define EPOCH_SECONDS_DAY_COUNT 49710UL /* 秒数为32位，只能表示前49710天，即到2136年2月7日 */
+
+#define EPOCH_RTC_REG_COUNT 7 /* DS3231的0x00 ~ 0x06寄存器：秒、分、时、星期、日、月和世纪、年 */
+
+uint8_t EPOCH_IsLeapYear(uint8_t year);
+uint8_t EPOCH_GetMonthDays(uint8_t year, uint8_t month);
+uint32_t EPOCH_DateToDays(uint8_t year, uint8_t month, uint8_t date);
+void EPOCH_DaysToDate(uint32_t days, uint8_t *year, uint8_t *month, uint8_t *date);
+uint8_t EPOCH_GetDay(uint32_t days);
+
+uint32_t EPOCH_FromTime(const struct RTC_Time *time);
+void EPOCH_ToTime(uint32_t seconds, uint8_t is_12hr, struct RTC_Time *time);
+uint32_t EPOCH_FromRegs(const uint8_t *regs);
+void EPOCH_ToRegs(uint32_t seconds, uint8_t is_12hr, uint8_t *regs);
+
+#endif
@@ -0,0 +1,132 @@
+#include "event.h"
+
+static uint32_t Idle_Ms;     /* 无操作超时时间，0为不使用 */
+static uint32_t Idle_Remain; /* 距离无操作超时的时间 */
+static uint32_t RTC_Remain;  /* 距离下一次检查闹钟标志的时间 */
+static uint16_t Last_Tick;   /* 上一次更新剩余时间时的低功耗定时器计数值 */
+static uint8_t EPD_Busy;     /* 上一次检查时电子纸是否忙 */
+
+/**
+ * @brief  根据实时时钟的秒数计算到下一个整分钟的时间。
+ * @note   闹钟中断引脚与“设置”按钮共用Standby唤醒引脚，外部中断线0已用于电子纸BUSY引脚，所以按时读取闹钟标志代替中断。
+ */
+static void rtc_schedule(void)
+{
+    struct RTC_Time time;
+
+    if (RTC_GetTime(&time) != 0 || time.Seconds > 59)
+    {
+        RTC_Remain = 60000;
+        return;
+    }
+    RTC_Remain = (60 - time.Seconds) * 1000UL + EVENT_RTC_MARGIN_MS;
+}
+
+/**
+ * @brief  从剩余时间中扣除经过的时间，每次间隔不能超过低功耗定时器的计数周期。
+ */
+static void update_remain(void)
+{
+    uint16_t elapsed;
+
+    elapsed = LP_GetElapsedMs(Last_Tick);
+    Last_Tick = LP_GetTick();
+    Idle_Remain = Idle_Remain > elapsed ? Idle_Remain - elapsed : 0;
+    RTC_Remain = RTC_Remain > elapsed ? RTC_Remain - elapsed : 0;
+}
+
+/**
+ * @brief  事件循环初始化。
+ * @param  idle_s 无操作超时时间，单位为秒，0为不使用。
+ */
+void EVENT_Init(uint16_t idle_s)
+{
+    Idle_Ms = idle_s * 1000UL;
+    Idle_Remain = Idle_Ms;
+    Last_Tick = LP_GetTick();
+    EPD_Busy = EPD_GetBusy();
+    rtc_schedule();
+}
+
+/**
+ * @brief  重新开始无操作计时，在事件循环以外取出按钮事件时调用。
+ */
+void EVENT_ResetIdle(void)
+{
+    Idle_Remain = Idle_Ms;
+}
+
+/**
+ * @brief  等待下一个事件，没有事件时进入Stop模式，由按钮、电子纸BUSY引脚或低功耗定时器唤醒。
+ * @param  event 事件。
+ * @note   事件的优先级依次为：按钮、电子纸刷新完成、闹钟表到期、实时时钟闹钟、无操作超时。
+ */
+void EVENT_Wait(struct EVENT *event)
+{
+    uint8_t busy, alarm;
+    uint32_t sleep_ms;
+
+    while (1)
+    {
+        update_remain();
+        if (BUTTON_GetEvent(&event->button) == 0)
+        {
+            Idle_Remain = Idle_Ms;
+            event->type = EVENT_TYPE_BUTTON;
+            return;
+        }
+        busy = EPD_GetBusy();
+        if (EPD_Busy != 0 && busy == 0)
+        {
+            EPD_Busy = 0;
+            event->type = EVENT_TYPE_EPD_READY;
+            return;
+        }
+        EPD_Busy = busy;
+        if (RTC_Remain == 0)
+        {
+            if (RTC_GetA1F() != 0 && ALARM_IsArmed() != 0) /* 闹钟1与闹钟2同在整分钟置位，不重新计时，下一次调用继续检查闹钟2 */
+            {
+                RTC_ClearA1F();
+                event->type = EVENT_TYPE_ALARM;
+                return;
+            }
+            alarm = RTC_GetA2F();
+            rtc_schedule();
+            if (alarm != 0)
+            {
+                RTC_ClearA2F(); /* 清除后才能区分下一分钟的闹钟 */
+                event->type = EVENT_TYPE_RTC;
+                return;
+            }
+        }
+        if (Idle_Ms != 0 && Idle_Remain == 0)
+        {
+            Idle_Remain = Idle_Ms;
+            event->type = EVENT_TYPE_IDLE;
+            return;
+        }
+
+        sleep_ms = BUTTON_GetDeadline();
+        if (sleep_ms > RTC_Remain)
+        {
+            sleep_ms = RTC_Remain;
+        }
+        if (Idle_Ms != 0 && sleep_ms > Idle_Remain)
+        {
+            sleep_ms = Idle_Remain;
+        }
+        if (sleep_ms > EVENT_SLEEP_MAX_MS)
+        {
+            sleep_ms = EVENT_SLEEP_MAX_MS;
+        }
+        if (sleep_ms != 0 && EPD_Busy != 0)
+        {
+            LP_EnterStopWkupEXTI(BUTTON_EXTI_LINES, sleep_ms); /* 电子纸BUSY引脚下降沿也会唤醒，检查之后已经变为低电平时不进入Stop模式 */
+        }
+        else if (sleep_ms != 0)
+        {
+            LP_EnterStopEXTI(BUTTON_EXTI_LINES, sleep_ms);
+        }
+    }
+}
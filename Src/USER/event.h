@@ -0,0 +1,33 @@
+#ifndef _EVENT_H_
+#define _EVENT_H_
+
+#include "main.h"
+#include "lowpower.h"
+#include "button.h"
+#include "gdeh029a1.h"
+#include "ds3231.h"
+#include "alarm.h"
+
+/* 可修改 */
+#define EVENT_SLEEP_MAX_MS 20000 /* 单次Stop模式最长时间，不能超过低功耗定时器的计数周期 */
+#define EVENT_RTC_MARGIN_MS 100  /* 在整分钟之后多等待的时间，保证闹钟标志已经置位 */
+/* 结束 */
+
+#define EVENT_TYPE_NONE 0
+#define EVENT_TYPE_BUTTON 1    /* 按钮事件，内容在button中 */
+#define EVENT_TYPE_EPD_READY 2 /* 电子纸BUSY引脚下降沿，刷新完成 */
+#define EVENT_TYPE_RTC 3       /* 实时时钟闹钟2，每分钟一次 */
+#define EVENT_TYPE_IDLE 4      /* 超过设定时间没有按钮操作 */
+#define EVENT_TYPE_ALARM 5     /* 闹钟表中的闹钟到期，闹钟1标志已清除 */
+
+struct EVENT
+{
+    uint8_t type;               /* 事件类型，EVENT_TYPE_xxx */
+    struct BUTTON_Event button; /* type为EVENT_TYPE_BUTTON时有效 */
+};
+
+void EVENT_Init(uint16_t idle_s);
+void EVENT_ResetIdle(void);
+void EVENT_Wait(struct EVENT *event);
+
+#endif
@@ -1,29 +1,75 @@
 ﻿#include "func.h"
+#include "adc.h"
+#include "tim.h"
+#include "usart.h"
 
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <math.h>
 
 const struct Func_Setting DefaultSetting = {0x00, 1, 3, 1.50, 1.20, 0.00, 0.00, 0, 0}; /* 设置未完成，蜂鸣器开关，蜂鸣器音量，警告电压，关机电压，温度传感器偏移，湿度传感器偏移，内置参考电压偏移，实时时钟老化偏移 */
 const struct RTC_Time DefaultTime = {0, 0, 12, 4, 1, 10, 20, 0, 0};                    /* 2020年10月1日，星期4，12:00:00，Is_12hr = 0，PM = 0  */
 
 static uint8_t ResetInfo;
+static uint8_t BTN_Clicked; /* 已按下但尚未读取的按钮，按位表示 */
+static uint8_t Menu_Idle;   /* 1：长时间无操作，所有菜单依次退出并返回主界面 */
+static uint8_t Alarm_Slot;  /* 闹钟设置中正在修改的闹钟位置 */
+static uint8_t Alarm_Edit;  /* 1：在选择页面中确认了闹钟位置 */
+
+/* 主界面各部分的区域，按HOME_AREA_xxx顺序排列，区域外的线条等固定内容不会变化 */
+static const struct Home_Area HomeAreas[HOME_AREA_COUNT] = {
+    {0, 0, 258, 3},   /* 日期和星期 */
+    {258, 0, 38, 3},  /* 电池 */
+    {0, 5, 121, 7},   /* 上下午和小时 */
+    {121, 5, 81, 7},  /* 分钟 */
+    {213, 5, 83, 3},  /* 温度 */
+    {213, 9, 83, 3},  /* 湿度 */
+    {0, 14, 296, 2}}; /* 农历 */
+
+/* 主界面更新各阶段的名称，按PROF_PHASE_xxx顺序排列 */
+static const char *const ProfPhaseName[PROF_PHASE_COUNT] = {"RTC", "SENSOR", "EPDINIT", "DRAW", "SHOW", "ADC"};
+
+/* 等待位置的简称，按WAIT_SITE_xxx顺序排列，系统信息页面每项只显示4个字符 */
+static const char *const WaitSiteName[WAIT_SITE_COUNT] = {"I2C", "ARDY", "AABT", "ADIS", "ACAL", "AREF", "AEOC", "ASTP",
+                                                          "EEPR", "UTXE", "UTC", "STXE", "SBSY", "BUSY"};
+
+/* 闹钟响铃的音符序列，每组响4声，循环播放 */
+static const struct BUZZER_Note AlarmMelody[] = {{2000, 100}, {0, 100}, {2000, 100}, {0, 100}, {2000, 100}, {0, 100}, {2000, 100}, {0, 600}};
+
+/* 闹钟类型的名称，按ALARM_TYPE_xxx顺序排列，字库中没有闹钟相关的汉字，使用英文 */
+static const char *const AlarmTypeName[ALARM_TYPE_LUNAR + 1] = {"OFF", "ONCE", "DAILY", "WEEKDAY", "LUNAR"};
+
 static struct RTC_Time Time;
-static struct Lunar_Date Lunar;
 static struct TH_Value Sensor;
 static struct Func_Setting Setting;
+static struct Home_Wake Wake; /* 主界面更新任务之间共享的数据，任务等待前后局部变量不会保留 */
 static char String[256];
 
-/* 软延时 */
-static void Delay_100ns(volatile uint16_t nsX100);
-
 /* 菜单相关 */
 static void UpdateHomeDisplay(void);
+static void Alarm_Ring(uint8_t show);
+static uint8_t Home_SensorTask(struct TASK *task);
+static uint8_t Home_DisplayTask(struct TASK *task);
+static void Home_GetState(struct Home_State *state, float battery_voltage);
+static void Home_Draw(const struct Home_State *state);
+static void Home_SaveState(const struct Home_State *state);
+static uint8_t Home_LoadState(struct Home_State *state);
+static uint8_t Home_GetDirty(const struct Home_State *last_state, const struct Home_State *state);
+static void Home_ClearState(void);
+static void Home_SendArea(uint8_t ram, uint8_t dirty);
+static void Home_NextMinute(struct RTC_Time *time);
+static uint16_t Home_GetPrerenderDelay(void);
+static void Home_WaitMinute(void);
 static void FullInit(void);
-static void Menu_DrawMenuFrame(char *title, uint8_t button_style);
+static void Menu_DrawMenuFrame(const uint8_t *title, uint8_t button_style);
 static void Menu_DrawSubmenuSaveSelect(uint8_t select);
 static void Menu_MainMenu(void);
+static uint8_t Menu_WaitEvent(uint8_t update_display);
+static void Menu_RunPage(const struct Menu_Page *page);
+static void Menu_DrawField(const struct Menu_Field *field, int16_t value);
+static void Menu_DrawCursor(const struct Menu_Field *field, uint8_t show);
+static uint8_t Menu_StepField(const struct Menu_Field *field, int16_t *value, int8_t direction);
+static void Menu_GetTimeArrow(uint8_t select, uint16_t *x, uint8_t *y_x8);
 static void Menu_Guide(void);
 static void Menu_SetTime(void);
 static void Menu_SetBuzzer(void);
@@ -32,21 +78,52 @@ static void Menu_SetSensor(void);
 static void Menu_SetVrefint(void);
 static void Menu_SetRTCAging(void);
 static void Menu_Info(void);
+static void Info_DrawPage(uint8_t page);
 static void Menu_ResetAll(void);
 static void Menu_SetHWVer(void);
-static void EPD_DrawBattery(uint16_t x, uint8_t y_x8, float max_voltage, float min_voltage, float voltage);
+static void Menu_SetAlarm(void);
+
+/* 设置页面的读取、生效、保存和附加信息 */
+static void Page_LoadBuzzer(int16_t *values);
+static void Page_ApplyBuzzer(const int16_t *values);
+static void Page_SaveBuzzer(const int16_t *values);
+static void Page_LoadBattery(int16_t *values);
+static void Page_SaveBattery(const int16_t *values);
+static void Page_DrawBatteryInfo(const int16_t *values);
+static void Page_LoadSensor(int16_t *values);
+static void Page_SaveSensor(const int16_t *values);
+static void Page_LoadVrefint(int16_t *values);
+static void Page_SaveVrefint(const int16_t *values);
+static void Page_DrawVrefintInfo(const int16_t *values);
+static void Page_LoadRTCAging(int16_t *values);
+static void Page_SaveRTCAging(const int16_t *values);
+static void Page_LoadHWVer(int16_t *values);
+static void Page_SaveHWVer(const int16_t *values);
+static void Page_LoadAlarmSlot(int16_t *values);
+static void Page_SaveAlarmSlot(const int16_t *values);
+static void Page_DrawAlarmSlotInfo(const int16_t *values);
+static void Page_LoadAlarm(int16_t *values);
+static void Page_SaveAlarm(const int16_t *values);
+static void Page_DrawAlarmInfo(const int16_t *values);
+static void Alarm_FromValues(const int16_t *values, struct ALARM_Entry *entry);
+static void Alarm_FormatParam(char *text, uint8_t size, const struct ALARM_Entry *entry);
+static uint8_t GetBatteryLevel(float max_voltage, float min_voltage, float voltage);
+static void EPD_DrawBattery(uint16_t x, uint8_t y_x8, uint8_t bar_size);
 
 /* 设置保存 */
 static void SaveSetting(const struct Func_Setting *setting);
 static void ReadSetting(struct Func_Setting *setting);
+static void SaveBusStat(uint8_t addr, uint16_t word_addr);
+static void ReadBusStat(uint8_t addr, uint16_t word_addr);
 
 /* 按键消抖读取 */
+static void BTN_Update(void);
+static uint8_t BTN_ReadClick(uint8_t button);
 static uint8_t BTN_ReadUP(void);
-static uint8_t BTN_ReadUPFast(void);
 static uint8_t BTN_ReadDOWN(void);
 static uint8_t BTN_ReadSET(void);
 static void BTN_WaitSET(void);
-static void BTN_WaitAll(void);
+static uint8_t BTN_WaitAll(void);
 static uint8_t BTN_ModifySingleDigit(uint8_t *number, uint8_t modify_digit, uint8_t max_val, uint8_t min_val);
 
 /* 蜂鸣器控制 */
@@ -63,41 +140,84 @@ static void Power_DisableGDEH029A1(void);
 static void Power_Disable_I2C_SHT30(void);
 static uint8_t Power_DisableADC(void);
 static void Power_DisableBUZZER(void);
+static void Power_EnableUSART(void);
 static void Power_DisableUSART(void);
 
 /* 调制辅助功能，需要串口输出 */
 static void DumpRTCReg(void);
 static void DumpEEPROM(void);
 static void DumpBKPR(void);
-
-/**
- * @brief  延时100ns的倍数（不准确，只是大概）。
- * @param  nsX100 延时时间。
- */
-static void Delay_100ns(volatile uint16_t nsX100)
-{
-    while (nsX100)
-    {
-        nsX100--;
-    }
-    ((void)nsX100);
-}
+static void DumpProfile(void);
+
+#define MENU_STRINGIFY(x) #x
+#define MENU_TOSTRING(x) MENU_STRINGIFY(x)
+
+/* 设置页面的项目，依次为：标签，标签位置，行，标签字符间距，类型，数值位置，整数位数，小数位数，显示正号，单位，最小值，最大值，步长，光标类型，光标位置 */
+static const struct Menu_Field BuzzerFields[] = {
+    {GlyphRun_BuzzerState, 0, 4, 0, MENU_FIELD_SWITCH, 192, 0, 0, 0, "", 0, 1, 1, MENU_CURSOR_SELECT, 240},
+    {GlyphRun_BuzzerVolume, 0, 8, 0, MENU_FIELD_NUMBER, 144, 2, 0, 0, "/" MENU_TOSTRING(BUZZER_MAX_VOL), 1, BUZZER_MAX_VOL, 1, MENU_CURSOR_SELECT, 204}};
+
+static const struct Menu_Field BatteryFields[] = {
+    {GlyphRun_BatteryWarn, 0, 4, 0, MENU_FIELD_NUMBER, 120, 1, 2, 0, "V", (int16_t)(BAT_MIN_VOLTAGE * 100 + 0.5), (int16_t)(BAT_MAX_VOLTAGE * 100 + 0.5), 1, MENU_CURSOR_SELECT, 180},
+    {GlyphRun_BatteryStop, 0, 8, 0, MENU_FIELD_NUMBER, 120, 1, 2, 0, "V", (int16_t)(BAT_MIN_VOLTAGE * 100 + 0.5), (int16_t)(BAT_MAX_VOLTAGE * 100 + 0.5), 1, MENU_CURSOR_SELECT, 180}};
+
+static const struct Menu_Field SensorFields[] = {
+    {GlyphRun_TempOffset, 0, 4, 0, MENU_FIELD_NUMBER, 120, 2, 2, 1, "℃", -1000, 1000, 1, MENU_CURSOR_SELECT, 216},
+    {GlyphRun_RHOffset, 0, 8, 0, MENU_FIELD_NUMBER, 120, 2, 2, 1, "％", -1000, 1000, 1, MENU_CURSOR_SELECT, 216}};
+
+static const struct Menu_Field VrefintFields[] = {
+    {GlyphRun_OffsetValue, 0, 4, 0, MENU_FIELD_NUMBER, 120, 3, 0, 1, "", -127, 127, 1, MENU_CURSOR_SELECT, 168}};
+
+static const struct Menu_Field RTCAgingFields[] = {
+    {GlyphRun_OffsetValue, 0, 4, 0, MENU_FIELD_NUMBER, 120, 3, 0, 1, "", -127, 127, 1, MENU_CURSOR_SELECT, 168},
+    {GlyphRun_AgingHint, 0, 8, 1, MENU_FIELD_LABEL, 0, 0, 0, 0, "", 0, 0, 0, MENU_CURSOR_SELECT, 0}};
+
+static const struct Menu_Field HWVerFields[] = {
+    {GlyphRun_HWVer, 0, 4, 0, MENU_FIELD_NUMBER, 132, 1, 0, 0, "", 0, 9, 1, MENU_CURSOR_ARROW, 132},
+    {GlyphRun_Dot, 144, 4, 0, MENU_FIELD_NUMBER, 156, 1, 0, 0, "", 0, 9, 1, MENU_CURSOR_ARROW, 156},
+    {GlyphRun_HWVerHint1, 0, 8, 0, MENU_FIELD_LABEL, 0, 0, 0, 0, "", 0, 0, 0, MENU_CURSOR_SELECT, 0},
+    {GlyphRun_HWVerHint2, 0, 12, 0, MENU_FIELD_LABEL, 0, 0, 0, 0, "", 0, 0, 0, MENU_CURSOR_SELECT, 0}};
+
+static const struct Menu_Field AlarmSlotFields[] = {
+    {GlyphRun_AlarmSlot, 0, 4, 0, MENU_FIELD_NUMBER, 60, 1, 0, 0, "", 1, ALARM_COUNT, 1, MENU_CURSOR_SELECT, 84}};
+
+/* 日期参数按类型使用：一次性为日/月/年，按星期重复时第一项为星期掩码，农历为日/月，月为0时每月都响 */
+static const struct Menu_Field AlarmFields[] = {
+    {GlyphRun_AlarmType, 0, 4, 0, MENU_FIELD_NUMBER, 72, 1, 0, 0, "", ALARM_TYPE_NONE, ALARM_TYPE_LUNAR, 1, MENU_CURSOR_SELECT, 96},
+    {GlyphRun_AlarmTime, 0, 8, 0, MENU_FIELD_NUMBER, 72, 2, 0, 0, "", 0, 23, 1, MENU_CURSOR_ARROW, 78},
+    {GlyphRun_Colon, 96, 8, 0, MENU_FIELD_NUMBER, 108, 2, 0, 0, "", 0, 59, 1, MENU_CURSOR_ARROW, 114},
+    {GlyphRun_AlarmParam, 0, 12, 0, MENU_FIELD_NUMBER, 72, 3, 0, 0, "", 0, 127, 1, MENU_CURSOR_ARROW, 84},
+    {GlyphRun_Slash, 108, 12, 0, MENU_FIELD_NUMBER, 120, 2, 0, 0, "", 0, 12, 1, MENU_CURSOR_ARROW, 126},
+    {GlyphRun_Slash, 144, 12, 0, MENU_FIELD_NUMBER, 156, 2, 0, 0, "", 0, 99, 1, MENU_CURSOR_ARROW, 162}};
+
+/* 设置页面，依次为：标题，项目，项目数，数值变化时重绘附加信息，读取，立即生效，保存，附加信息 */
+static const struct Menu_Page BuzzerPage = {GlyphRun_SetBuzzer, BuzzerFields, sizeof(BuzzerFields) / sizeof(BuzzerFields[0]), 0, Page_LoadBuzzer, Page_ApplyBuzzer, Page_SaveBuzzer, NULL};
+static const struct Menu_Page BatteryPage = {GlyphRun_SetBattery, BatteryFields, sizeof(BatteryFields) / sizeof(BatteryFields[0]), 0, Page_LoadBattery, NULL, Page_SaveBattery, Page_DrawBatteryInfo};
+static const struct Menu_Page SensorPage = {GlyphRun_SetSensor, SensorFields, sizeof(SensorFields) / sizeof(SensorFields[0]), 0, Page_LoadSensor, NULL, Page_SaveSensor, NULL};
+static const struct Menu_Page VrefintPage = {GlyphRun_SetVrefint, VrefintFields, sizeof(VrefintFields) / sizeof(VrefintFields[0]), 1, Page_LoadVrefint, NULL, Page_SaveVrefint, Page_DrawVrefintInfo};
+static const struct Menu_Page RTCAgingPage = {GlyphRun_SetRTCAging, RTCAgingFields, sizeof(RTCAgingFields) / sizeof(RTCAgingFields[0]), 0, Page_LoadRTCAging, NULL, Page_SaveRTCAging, NULL};
+static const struct Menu_Page HWVerPage = {GlyphRun_SetHWVer, HWVerFields, sizeof(HWVerFields) / sizeof(HWVerFields[0]), 0, Page_LoadHWVer, NULL, Page_SaveHWVer, NULL};
+static const struct Menu_Page AlarmSlotPage = {GlyphRun_SetAlarm, AlarmSlotFields, sizeof(AlarmSlotFields) / sizeof(AlarmSlotFields[0]), 1, Page_LoadAlarmSlot, NULL, Page_SaveAlarmSlot, Page_DrawAlarmSlotInfo};
+static const struct Menu_Page AlarmPage = {GlyphRun_SetAlarm, AlarmFields, sizeof(AlarmFields) / sizeof(AlarmFields[0]), 1, Page_LoadAlarm, NULL, Page_SaveAlarm, Page_DrawAlarmInfo};
 
 /* ==================== 主函数 ==================== */
 
 void Init(void) /* 系统复位后首先进入此函数并执行一次 */
 {
+    PROF_Boot();                   /* 记录启动时刻，用于统计启动延迟 */
     ResetInfo = LP_GetResetInfo(); /* 获取复位信息并保存 */
+    BUTTON_Init();                 /* 读取按钮状态，打开按钮外部中断 */
 
-    Power_Enable_SHT30_I2C(); /* 默认打开SHT30和I2C电源 */
-    Power_EnableADC();        /* 默认打开ADC电源 */
-    Power_EnableBUZZER();     /* 默认打开蜂鸣器定时器 */
+    ReadBusStat(RTC_I2C_ADDR, EEPROM_ADDR_WORD_BUSSTAT_RTC); /* 恢复之前累计的I2C统计，擦除全部数据时清零 */
+    ReadBusStat(TH_I2C_ADDR, EEPROM_ADDR_WORD_BUSSTAT_TH);
 
-    Power_DisableUSART();     /* 默认关闭串口 */
+    Power_Enable_SHT30_I2C(); /* 每次唤醒都需要读取时间和温湿度 */
     Power_DisableGDEH029A1(); /* 默认关闭电子纸电源 */
 
+    /* ADC、蜂鸣器定时器和串口在main()中不初始化，需要时由Power_EnableXXX()初始化，闹钟唤醒时只在需要测量电池电压时打开ADC */
+
     /* 如果同时按了“上”和“下”键，在复位以后擦除全部数据 */
-    if (ResetInfo == LP_RESET_NORMALRESET && ((BTN_ReadUP() == 0 && BTN_ReadDOWN() == 0) || BKPR_ReadByte(BKPR_ADDR_BYTE_REQINIT) == REQUEST_RESET_ALL_FLAG))
+    if (ResetInfo == LP_RESET_NORMALRESET && ((BUTTON_IsPressed(BUTTON_UP) != 0 && BUTTON_IsPressed(BUTTON_DOWN) != 0) || BKPR_ReadByte(BKPR_ADDR_BYTE_REQINIT) == REQUEST_RESET_ALL_FLAG))
     {
         FullInit();
     }
@@ -109,6 +229,8 @@ void Init(void) /* 系统复位后首先进入此函数并执行一次 */
     TH_SetTemperatureOffset(Setting.sensor_temp_offset);
     TH_SetHumidityOffset(Setting.sensor_rh_offset);
     ADC_SetVrefintOffset(Setting.vrefint_offset);
+
+    RTC_LoadShadow(); /* 一次读取实时时钟的全部寄存器，之后在缓存中读写，更新主界面前一次写回 */
     if (RTC_GetAging() != Setting.rtc_aging_offset)
     {
         RTC_ModifyAging(Setting.rtc_aging_offset);
@@ -124,7 +246,11 @@ void Loop(void) /* 在Init()执行完成后循环执行，这里只执行一次
         BKPR_ResetAll();                                                      /* 复位备份寄存器 */
         if (RTC_GetOSF() != 0 || Setting.available != SETTING_AVALIABLE_FLAG) /* 根据RTC的振荡器停止标志和设定完成标志决定是否显示欢迎界面 */
         {
+            RTC_FlushShadow(); /* 菜单中需要实时读写实时时钟 */
             Power_EnableGDEH029A1();
+            Power_EnableADC(); /* 菜单中需要显示电压和提示音 */
+            Power_EnableBUZZER();
+            EVENT_Init(0); /* 首次设置不自动退出 */
             if (EEPROM_ReadDWORD(EEPROM_ADDR_DWORD_HWVERSION) == 0x00000000) /* 如果EEPROM的硬件版本地址全为0则显示硬件版本设置界面，用于新芯片首次使用 */
             {
                 Menu_SetHWVer();
@@ -134,16 +260,42 @@ void Loop(void) /* 在Init()执行完成后循环执行，这里只执行一次
             Setting.available = SETTING_AVALIABLE_FLAG; /* 设置完成以后标记设置已完成并保存 */
             SaveSetting(&Setting);                      /* 设置完成以后标记设置已完成并保存 */
         }
+        RTC_GetTime(&Time);
+        ALARM_Schedule(&Time); /* 时间可能已修改，重新设置闹钟1 */
         break;
     case LP_RESET_WKUPSTANDBY:                                               /* 由“设置”按钮或RTC闹钟从Standby模式唤醒 */
-        if (RTC_GetA2F() != 0 || (BTN_ReadUP() != 0 && BTN_ReadDOWN() == 0)) /* 同时按下“菜单”和“上”按钮立刻更新显示 */
+        if (RTC_GetA1F() != 0 && ALARM_IsArmed() != 0) /* 闹钟表中的闹钟到期 */
+        {
+            RTC_ClearA1F();
+            Alarm_Ring(1);
+        }
+        else if (HOME_PRERENDER_LEAD_S != 0 && RTC_GetA1F() != 0 && RTC_GetA2F() == 0) /* 闹钟1在整分钟前唤醒，提前准备下一分钟的画面 */
+        {
+            RTC_ClearA1F();
+            Wake.prerender = 1;
+        }
+        else if (RTC_GetA2F() != 0 || (BUTTON_IsPressed(BUTTON_UP) == 0 && BUTTON_IsPressed(BUTTON_DOWN) != 0)) /* 同时按下“菜单”和“上”按钮立刻更新显示 */
         {
             RTC_ClearA2F(); /* 清除RTC闹钟中断 */
         }
         else /* 单独按下菜单键则显示主菜单 */
         {
+            Home_ClearState(); /* 菜单覆盖了主界面，下次不能使用局部刷新 */
+            RTC_FlushShadow(); /* 菜单中需要实时读写实时时钟 */
             Power_EnableGDEH029A1();
+            Power_EnableADC(); /* 菜单中需要显示电压和提示音 */
+            Power_EnableBUZZER();
             Menu_MainMenu();
+            RTC_GetTime(&Time);
+            if (RTC_GetA1F() != 0 && ALARM_IsArmed() != 0) /* 退出菜单前刚到期，菜单中还没有响铃，返回后补响 */
+            {
+                RTC_ClearA1F();
+                Alarm_Ring(1);
+            }
+            else
+            {
+                ALARM_Schedule(&Time); /* 菜单中可能修改了时间 */
+            }
         }
         break;
     }
@@ -152,12 +304,16 @@ void Loop(void) /* 在Init()执行完成后循环执行，这里只执行一次
 
     UpdateHomeDisplay(); /* 更新主界面显示内容 */
 
+    SaveBusStat(RTC_I2C_ADDR, EEPROM_ADDR_WORD_BUSSTAT_RTC); /* Standby模式下RAM不保持，I2C统计存入EEPROM，只在有变化时写入 */
+    SaveBusStat(TH_I2C_ADDR, EEPROM_ADDR_WORD_BUSSTAT_TH);
+
     Power_DisableGDEH029A1(); /* 关闭电源，准备在“设置”按钮释放以后进入Standby模式 */
     Power_Disable_I2C_SHT30();
     Power_DisableADC();
     Power_DisableBUZZER();
 
     BTN_WaitSET(); /* 等待“设置”按钮释放 */
+    BUTTON_Deinit();
 
     LP_EnterStandby(); /* 进入Standby模式，等待下一次唤醒 */
 
@@ -173,42 +329,66 @@ void Loop(void) /* 在Init()执行完成后循环执行，这里只执行一次
 static void UpdateHomeDisplay(void) /* 更新主界面显示内容 */
 {
     uint32_t battery_stor;
-    float battery_voltage, cel_tmp, rh_tmp;
-    int8_t temp_value[2], rh_value[2];
+    float battery_voltage;
+    struct RTC_Alarm alarm = {0};
+    struct TASK tasks[2] = {{Home_SensorTask, 0, 0, 0, 0, 0, 0}, {Home_DisplayTask, 0, 0, 0, 0, 0, 0}};
+
+    PROF_Begin(); /* 记录各阶段的时间 */
 
+    RTC_LoadShadow();   /* 从菜单返回时缓存已经写回，需要重新读取 */
     RTC_GetTime(&Time); /* 获取当前时间 */
+    if (Wake.prerender != 0)
+    {
+        if (Time.Seconds + HOME_PRERENDER_LEAD_S < 60 || Time.Seconds > 59) /* 不在提前量之内时按当前时间更新，整分钟时闹钟2会再次唤醒 */
+        {
+            Wake.prerender = 0;
+        }
+        else
+        {
+            Wake.wake_tick = LP_GetTick(); /* 闹钟1在整秒唤醒，读取时间时距离整分钟的时间基本准确 */
+            Wake.boundary_ms = (60 - Time.Seconds) * 1000U;
+            Home_NextMinute(&Time); /* 之后全部按下一分钟绘制和保存 */
+        }
+    }
 
     RTC_ModifyAM2Mask(0x07); /* 设置闹钟2每分钟产生中断 */
     RTC_ModifyA2IE(1);       /* 打开闹钟2中断 */
     RTC_ClearA2F();          /* 清除闹钟2中断标志 */
-    RTC_ModifyA1IE(0);       /* 关闭闹钟1中断 */
-    RTC_ClearA1F();          /* 清除闹钟1中断标志 */
+    if (ALARM_IsArmed() == 0)
+    {
+        RTC_ClearA1F(); /* 清除闹钟1中断标志，由闹钟表设置时保留，刚到期的闹钟在进入Standby后立即唤醒 */
+    }
     RTC_ModifyINTCN(1);      /* 打开中断输出 */
-
-    TH_GetValue_SingleShotWithCS(TH_ACC_HIGH, &Sensor); /* 获取当前温度 */
-
-    EPD_Init(EPD_UPDATE_MODE_FAST); /* 电子纸快速全局刷新模式 */
-    EPD_ClearRAM();
+    PROF_Mark(PROF_PHASE_RTC);
 
     battery_stor = BKPR_ReadDWORD(BKPR_ADDR_DWORD_ADCVAL); /* 读取上次屏幕刷新完成后的电量 */
     battery_voltage = *(float *)&battery_stor;             /* 存储的uint32_t转float */
+    Wake.battery_due = (ResetInfo != LP_RESET_WKUPSTANDBY || Time.Minutes % BAT_SAMPLE_INTERVAL_MIN == 0);
     if (battery_voltage < 0.1 || battery_voltage > 3.6)    /* 超出此范围则判断为备份寄存器数据失效，重新读取当前电池数据 */
     {
+        Power_EnableADC();
         battery_voltage = ADC_GetChannel(ADC_CHANNEL_BATTERY);
+        Wake.battery_due = 1;
     }
     if (battery_voltage < Setting.battery_stop) /* 电池已经低于最低工作电压，显示电量不足标志并停止更新 */
     {
-        if (RTC_ReadREG(RTC_REG_AL1_DDT) != 0xAA) /* 借用RTC未使用的寄存器，存储低电量画面已显示标志 */
+        if (BKPR_ReadByte(BKPR_ADDR_BYTE_BATLOW) != BATTERY_LOW_SHOWN_FLAG) /* 低电量画面只显示一次 */
         {
-            EPD_DrawImage(0, 0, EPD_Image_BatteryLow_296x128);
+            EPD_Init(EPD_UPDATE_MODE_FAST);
+            EPD_BeginFrame(0xFF);
+            EPD_DrawPackedImage(0, 0, EPD_PackedImage_BatteryLow_296x128);
+            EPD_SendFrame(EPD_RAM_NEW);
             EPD_Show(0);
             LP_EnterStop(EPD_TIMEOUT_MS); /* 进入Stop模式，由电子纸BUSY引脚上升沿唤醒 */
             EPD_EnterDeepSleep();
-            RTC_WriteREG(RTC_REG_AL1_DDT, 0xAA); /* 借用RTC未使用的寄存器，存储低电量画面已显示标志 */
+            BKPR_WriteByte(BKPR_ADDR_BYTE_BATLOW, BATTERY_LOW_SHOWN_FLAG);
         }
 
-        RTC_ModifyA2IE(0); /* 关闭闹钟2中断，防止中断引脚消耗电流 */
-        RTC_ClearA2F();    /* 清除闹钟2中断标志 */
+        RTC_ModifyA2IE(0); /* 关闭闹钟中断，防止中断引脚消耗电流 */
+        RTC_ClearA2F();
+        RTC_ModifyA1IE(0);
+        RTC_ClearA1F();
+        RTC_FlushShadow();
 
         Power_DisableGDEH029A1(); /* 尽可能关闭电源 */
         Power_DisableADC();
@@ -223,50 +403,257 @@ static void UpdateHomeDisplay(void) /* 更新主界面显示内容 */
             LP_DelayStop(5000);
         }
     }
-    RTC_WriteREG(RTC_REG_AL1_DDT, 0x00); /* 电量高于设定值，清除低电量画面已显示标志并正常执行 */
+    BKPR_WriteByte(BKPR_ADDR_BYTE_BATLOW, 0x00); /* 电量高于设定值，清除低电量画面已显示标志并正常执行 */
+    if (HOME_PRERENDER_LEAD_S != 0 && ALARM_IsArmed() == 0) /* 闹钟1没有被闹钟表使用时才用于提前唤醒 */
+    {
+        alarm.Seconds = 60 - HOME_PRERENDER_LEAD_S;
+        RTC_SetAlarm1(&alarm);
+        RTC_ModifyAM1Mask(0x0E); /* 设置闹钟1每分钟在秒数匹配时产生中断 */
+        RTC_ModifyA1IE(1);       /* 打开闹钟1中断 */
+    }
+
+    /* 有帧缓冲且上次画面有效时，重新绘制上次画面作为旧数据，使用局部刷新；每小时整点全局刷新一次，清除残影 */
+    Wake.partial = (EPD_GetFrame() != NULL && Time.Minutes != 0 && Home_LoadState(&Wake.last_state) == 0);
+    Wake.battery_voltage = battery_voltage;
+    Wake.sensor_ready = 0;
+    RTC_FlushShadow(); /* 写回本次修改的寄存器，之后等待整分钟时需要实时读取闹钟标志 */
+
+    TASK_Run(tasks, sizeof(tasks) / sizeof(struct TASK)); /* 温湿度测量和电子纸更新同时进行，全部在等待时进入Stop模式 */
+
+    /* 只在闹钟唤醒时每30分钟保存一次统计数据，一年约17520次，不会超过EEPROM擦写寿命 */
+    if (ResetInfo == LP_RESET_WKUPSTANDBY && Time.Minutes % PROF_SAVE_INTERVAL_MIN == 0)
+    {
+        PROF_Save();
+    }
+}
+
+static void Alarm_Ring(uint8_t show) /* 闹钟到期后响铃，按“设置”按钮关闭，按“上”或“下”按钮稍后提醒，之后设置下一个闹钟，show为0时只响铃，不覆盖菜单画面 */
+{
+    uint8_t i, snooze;
+    uint16_t sleep_ms, deadline;
+    uint32_t melody_ms;
+    struct RTC_Time now, due;
+    struct BUTTON_Event event;
+
+    RTC_FlushShadow(); /* 响铃期间时间继续变化，之后需要实时读取 */
+    RTC_GetTime(&now);
+    if (ALARM_GetDue(&now, &due) != 0) /* 按闹钟1的到期时间匹配，从菜单返回时可能已经过了几分钟 */
+    {
+        due = now;
+    }
+    if (ALARM_Fire(&due) == 0) /* 到期时间在一个月以后时中间月份也会唤醒，没有闹钟匹配时只重新设置 */
+    {
+        ALARM_Schedule(&now);
+        return;
+    }
+
+    if (show != 0)
+    {
+        Home_ClearState(); /* 响铃画面覆盖了主界面，下次不能使用局部刷新 */
+        Power_EnableGDEH029A1();
+        EPD_Init(EPD_UPDATE_MODE_FAST);
+        EPD_ClearRAM();
+        snprintf(String, sizeof(String), "%02u:%02u %s", due.Hours, due.Minutes, due.Is_12hr == 0 ? "" : (due.PM != 0 ? "PM" : "AM"));
+        EPD_DrawUTF8(0, 2, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+        EPD_DrawUTF8(0, 8, 0, "SET: stop", EPD_FontAscii_8x16, EPD_FontUTF8_16x16); /* 字库中没有这些汉字，使用英文 */
+        snprintf(String, sizeof(String), "UP/DOWN: snooze %u min", ALARM_SNOOZE_MIN);
+        EPD_DrawUTF8(0, 10, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+        EPD_Show(0); /* 不等待刷新完成，刷新期间已经开始响铃 */
+    }
+
+    Power_EnableBUZZER();
+    BUZZER_SetVolume(Setting.buzzer_volume);
+    melody_ms = 0;
+    for (i = 0; i < sizeof(AlarmMelody) / sizeof(AlarmMelody[0]); i++)
+    {
+        melody_ms += AlarmMelody[i].ms;
+    }
+    BUZZER_Play(AlarmMelody, sizeof(AlarmMelody) / sizeof(AlarmMelody[0]), ALARM_RING_S * 1000UL / melody_ms);
+    snooze = 0;
+    while (BUZZER_IsPlaying() != 0) /* 序列播放完毕即为超时，按关闭处理 */
+    {
+        if (BUTTON_GetEvent(&event) == 0 && event.type == BUTTON_EVENT_PRESS)
+        {
+            snooze = (event.button != BUTTON_SET);
+            break;
+        }
+        sleep_ms = BUZZER_Poll();
+        deadline = BUTTON_GetDeadline();
+        if (sleep_ms > deadline)
+        {
+            sleep_ms = deadline;
+        }
+        if (sleep_ms != 0 && sleep_ms != 0xFFFF)
+        {
+            LP_EnterSleepEXTI(BUTTON_EXTI_LINES, sleep_ms); /* Stop模式下蜂鸣器定时器会停止 */
+        }
+    }
+    BUZZER_Cancel();
+    EPD_WaitBusy();
 
-    LUNAR_SolarToLunar(&Lunar, Time.Year + 2000, Time.Month, Time.Date); /* RTC读出的年份省去了2000，计算农历前要手动加上 */
+    RTC_GetTime(&now);
+    if (snooze != 0)
+    {
+        ALARM_Snooze(&now);
+    }
+    ALARM_Schedule(&now);
+}
+
+/* ==================== 主界面状态 ==================== */
 
-    /* 将浮点温度分为两个整数温度 */
-    if (Sensor.CEL > 0)
+static uint8_t Home_SensorTask(struct TASK *task) /* 温湿度测量任务，转换期间让出CPU */
+{
+    TASK_BEGIN(task);
+    PROF_MarkTrack(PROF_TRACK_SENSOR, PROF_PHASE_NONE); /* 与电子纸更新同时进行，从任务开始单独计时 */
+    if (TH_StartConv_SingleShotWithoutCS(TH_ACC_HIGH) == 0)
+    {
+        TASK_DELAY(task, TH_CONV_MS_HIGH);
+        if (TH_GetValue_SingleShotWithoutCS(&Sensor) != 0)
+        {
+            TH_GetValue_SingleShotWithCS(TH_ACC_HIGH, &Sensor); /* 读取失败时重新以等待模式测量一次 */
+        }
+    }
+    else
     {
-        cel_tmp = Sensor.CEL + 0.05;
+        TH_GetValue_SingleShotWithCS(TH_ACC_HIGH, &Sensor); /* 转换未能开始时以等待模式测量 */
+    }
+    Wake.sensor_ready = 1;
+    PROF_MarkTrack(PROF_TRACK_SENSOR, PROF_PHASE_SENSOR);
+    TASK_END(task);
+}
+
+static uint8_t Home_DisplayTask(struct TASK *task) /* 电子纸更新任务，等待BUSY引脚时让出CPU */
+{
+    TASK_BEGIN(task);
+    PROF_MarkStartup(); /* 电子纸初始化是唤醒后的第一次SPI通信 */
+    EPD_StartInit(Wake.partial != 0 ? EPD_UPDATE_MODE_PART : EPD_UPDATE_MODE_FAST);
+    WAIT_DelayUs(1); /* 等待BUSY引脚变为高电平 */
+    TASK_WAIT_WKUP(task, EPD_GetBusy() == 0, EPD_TIMEOUT_MS);
+    EPD_FinishInit(Wake.partial != 0 ? EPD_UPDATE_MODE_PART : EPD_UPDATE_MODE_FAST);
+    if (Wake.partial != 0)
+    {
+        /* 局部刷新只驱动新旧RAM不同的像素，两个RAM填充相同数据后只需发送有变化的区域 */
+        EPD_FillRAM(EPD_RAM_OLD, 0xFF);
+        EPD_FillRAM(EPD_RAM_NEW, 0xFF);
+    }
+    PROF_Mark(PROF_PHASE_EPDINIT);
+
+    TASK_WAIT_UNTIL(task, Wake.sensor_ready != 0, EPD_TIMEOUT_MS);
+    Home_GetState(&Wake.state, Wake.battery_voltage);
+    if (Wake.partial != 0)
+    {
+        Wake.dirty = Home_GetDirty(&Wake.last_state, &Wake.state);
+        EPD_BeginFrame(0xFF);
+        Home_Draw(&Wake.last_state);
+        Home_SendArea(EPD_RAM_OLD, Wake.dirty);
+        EPD_BeginFrame(0xFF);
+        Home_Draw(&Wake.state);
+        Home_SendArea(EPD_RAM_NEW, Wake.dirty);
     }
     else
     {
-        cel_tmp = Sensor.CEL - 0.05;
+        Wake.dirty = 0xFF;
+        EPD_BeginFrame(0xFF); /* 先在帧缓冲中绘制，完成后一次性发送 */
+        Home_Draw(&Wake.state);
+        EPD_SendFrame(EPD_RAM_NEW);
+    }
+    Home_SaveState(&Wake.state);
+    PROF_Mark(PROF_PHASE_DRAW);
+
+    if (Wake.prerender != 0) /* 画面已经发送，先在Stop模式中等到接近整分钟，再连续读取闹钟2标志，整分钟时立即刷新 */
+    {
+        TASK_DELAY(task, Home_GetPrerenderDelay());
+        Home_WaitMinute();
+        PROF_Mark(PROF_PHASE_NONE); /* 等待整分钟的时间不计入任何阶段 */
+    }
+    if (Wake.dirty != 0) /* 画面没有变化时不需要刷新 */
+    {
+        EPD_Show(0);
+        PROF_MarkRefresh();
+        WAIT_DelayUs(1); /* 等待BUSY引脚变为高电平 */
+        TASK_WAIT_WKUP(task, EPD_GetBusy() == 0, EPD_TIMEOUT_MS);
+    }
+    PROF_Mark(PROF_PHASE_SHOW);
+
+    /* 读取电子纸刚刷新完成后的电池电压并存入备份寄存器，供下次唤醒后使用，电压变化很慢，不需要每分钟测量 */
+    if (Wake.battery_due != 0)
+    {
+        Power_EnableADC();
+        Wake.battery_voltage = ADC_GetChannel(ADC_CHANNEL_BATTERY);
+        BKPR_WriteDWORD(BKPR_ADDR_DWORD_ADCVAL, *(uint32_t *)&Wake.battery_voltage);
+    }
+
+    EPD_EnterDeepSleep();
+    PROF_Mark(PROF_PHASE_ADC);
+    TASK_END(task);
+}
+
+static void Home_GetState(struct Home_State *state, float battery_voltage) /* 获取主界面需要显示的全部内容 */
+{
+    float value;
+
+    state->time = Time;
+    state->time.Seconds = 0;
+
+    /* 温度和湿度保存为四舍五入后的0.1倍整数 */
+    value = Sensor.CEL * 10;
+    value += (value > 0) ? 0.5 : -0.5;
+    if (value > 2047)
+    {
+        value = 2047;
+    }
+    else if (value < -2048)
+    {
+        value = -2048;
+    }
+    state->temp_x10 = (int16_t)value;
+
+    value = Sensor.RH * 10 + 0.5;
+    if (value > 1000)
+    {
+        value = 1000;
     }
-    temp_value[0] = (int8_t)cel_tmp;
-    temp_value[1] = abs((int8_t)((cel_tmp - temp_value[0]) * 10));
+    else if (value < 0)
+    {
+        value = 0;
+    }
+    state->rh_x10 = (uint16_t)value;
+
+    state->battery_level = GetBatteryLevel(BAT_MAX_VOLTAGE, Setting.battery_warn, battery_voltage);
+}
 
-    /* 将浮点湿度分为两个整数 */
-    rh_tmp = Sensor.RH + 0.05;
-    rh_value[0] = (int8_t)rh_tmp;
-    rh_value[1] = (int8_t)((rh_tmp - rh_value[0]) * 10);
+static void Home_Draw(const struct Home_State *state) /* 绘制主界面，画面只由状态记录决定 */
+{
+    uint16_t x;
+    struct Lunar_Date lunar;
+
+    LUNAR_SolarToLunar(&lunar, state->time.Year + 2000, state->time.Month, state->time.Date); /* RTC读出的年份省去了2000，计算农历前要手动加上 */
 
     EPD_DrawHLine(0, 28, 296, 2);
     EPD_DrawHLine(0, 104, 296, 2);
     EPD_DrawHLine(213, 67, 76, 2);
     EPD_DrawVLine(202, 39, 56, 2);
-    EPD_DrawBattery(258, 0, BAT_MAX_VOLTAGE, Setting.battery_warn, battery_voltage); /* 根据电量绘制电池标志 */
+    EPD_DrawBattery(258, 0, state->battery_level); /* 根据电量绘制电池标志 */
 
-    snprintf(String, sizeof(String), "2%03d/%02d/%02d 星期%s", Time.Year, Time.Month, Time.Date, Lunar_DayString[Time.Day]);
-    EPD_DrawUTF8(0, 0, 1, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+    snprintf(String, sizeof(String), "2%03d/%02d/%02d", state->time.Year, state->time.Month, state->time.Date);
+    x = EPD_DrawUTF8(0, 0, 1, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+    x += EPD_DrawGlyphRun(x, 0, 1, GlyphRun_Week, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+    EPD_DrawGlyphRun(x, 0, 1, EPD_GetGlyphRun(GlyphRun_Day, state->time.Day), EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
 
-    if (Time.Is_12hr != 0)
+    if (state->time.Is_12hr != 0)
     {
-        if (Time.PM != 0)
+        if (state->time.PM != 0)
         {
-            EPD_DrawUTF8(0, 9, 2, "PM", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+            EPD_DrawGlyphRun(0, 9, 2, GlyphRun_PM, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
         }
         else
         {
-            EPD_DrawUTF8(0, 5, 2, "AM", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+            EPD_DrawGlyphRun(0, 5, 2, GlyphRun_AM, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
         }
     }
-    snprintf(String, sizeof(String), "%02d:%02d", Time.Hours, Time.Minutes);
+    snprintf(String, sizeof(String), "%02d:%02d", state->time.Hours, state->time.Minutes);
 
-    if (Time.Is_12hr != 0)
+    if (state->time.Is_12hr != 0)
     {
         EPD_DrawUTF8(34, 5, 6, String, EPD_FontAscii_27x56, EPD_FontUTF8_24x24_B);
     }
@@ -275,52 +662,194 @@ static void UpdateHomeDisplay(void) /* 更新主界面显示内容 */
         EPD_DrawUTF8(22, 5, 6, String, EPD_FontAscii_27x56, EPD_FontUTF8_24x24_B);
     }
 
-    if (cel_tmp <= -10.0)
+    if (state->temp_x10 <= -100)
     {
-        snprintf(String, sizeof(String), "%02d ℃", temp_value[0]);
+        snprintf(String, sizeof(String), "%02d ℃", state->temp_x10 / 10);
     }
-    else if (cel_tmp < 0 && cel_tmp > -1.0)
+    else if (state->temp_x10 < 0 && state->temp_x10 > -10)
     {
-        snprintf(String, sizeof(String), "-%01d.%d℃", temp_value[0], temp_value[1]);
+        snprintf(String, sizeof(String), "-0.%d℃", -state->temp_x10);
     }
-    else if (cel_tmp >= 100.0)
+    else if (state->temp_x10 >= 1000)
     {
-        snprintf(String, sizeof(String), "%03d ℃", temp_value[0]);
+        snprintf(String, sizeof(String), "%03d ℃", state->temp_x10 / 10);
     }
     else
     {
-        snprintf(String, sizeof(String), "%02d.%d℃", temp_value[0], temp_value[1]);
+        snprintf(String, sizeof(String), "%02d.%d℃", state->temp_x10 / 10, abs(state->temp_x10 % 10));
     }
     EPD_DrawUTF8(213, 5, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
 
-    if (rh_tmp < 100)
+    if (state->rh_x10 < 1000)
     {
-        snprintf(String, sizeof(String), "%02d.%d％", rh_value[0], rh_value[1]);
+        snprintf(String, sizeof(String), "%02d.%d％", state->rh_x10 / 10, state->rh_x10 % 10);
     }
     else
     {
-        snprintf(String, sizeof(String), "%03d ％", rh_value[0]);
+        snprintf(String, sizeof(String), "%03d ％", state->rh_x10 / 10);
     }
     EPD_DrawUTF8(213, 9, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
 
-    snprintf(String, sizeof(String), "农历：%s%s%s", Lunar_MonthLeapString[Lunar.IsLeap], Lunar_MonthString[Lunar.Month], Lunar_DateString[Lunar.Date]);
-    EPD_DrawUTF8(0, 14, 2, String, NULL, EPD_FontUTF8_16x16_B);
+    x = EPD_DrawGlyphRun(0, 14, 2, GlyphRun_LunarTitle, NULL, EPD_FontUTF8_16x16_B); /* 农历：润X月X日 */
+    x += EPD_DrawGlyphRun(x, 14, 2, EPD_GetGlyphRun(GlyphRun_LunarMonthLeap, lunar.IsLeap), NULL, EPD_FontUTF8_16x16_B);
+    x += EPD_DrawGlyphRun(x, 14, 2, EPD_GetGlyphRun(GlyphRun_LunarMonth, lunar.Month), NULL, EPD_FontUTF8_16x16_B);
+    EPD_DrawGlyphRun(x, 14, 2, EPD_GetGlyphRun(GlyphRun_LunarDate, lunar.Date), NULL, EPD_FontUTF8_16x16_B);
+
+    x = 172; /* 天干地支年【生肖年】 */
+    x += EPD_DrawGlyphRun(x, 14, 2, EPD_GetGlyphRun(GlyphRun_LunarStem, LUNAR_GetStem(&lunar)), EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+    x += EPD_DrawGlyphRun(x, 14, 2, EPD_GetGlyphRun(GlyphRun_LunarBranch, LUNAR_GetBranch(&lunar)), EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+    x += EPD_DrawGlyphRun(x, 14, 2, GlyphRun_LunarYear, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+    x += EPD_DrawGlyphRun(x, 14, 2, EPD_GetGlyphRun(GlyphRun_LunarZodiac, LUNAR_GetZodiac(&lunar)), EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+    EPD_DrawGlyphRun(x, 14, 2, GlyphRun_LunarYearEnd, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+}
 
-    snprintf(String, sizeof(String), "%s%s年【%s年】", Lunar_StemStrig[LUNAR_GetStem(&Lunar)], Lunar_BranchStrig[LUNAR_GetBranch(&Lunar)], Lunar_ZodiacString[LUNAR_GetZodiac(&Lunar)]);
-    EPD_DrawUTF8(172, 14, 2, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+static void Home_SaveState(const struct Home_State *state) /* 将主界面状态压缩后存入备份寄存器 */
+{
+    uint32_t dword;
+
+    dword = (uint32_t)state->time.Minutes;
+    dword |= (uint32_t)state->time.Hours << 6;
+    dword |= (uint32_t)(state->time.Is_12hr != 0) << 11;
+    dword |= (uint32_t)(state->time.PM != 0) << 12;
+    dword |= (uint32_t)state->time.Date << 13;
+    dword |= (uint32_t)state->time.Month << 18;
+    dword |= (uint32_t)state->time.Year << 22;
+    BKPR_WriteDWORD(BKPR_ADDR_DWORD_HOMESTATE_TIME, dword);
+
+    dword = (uint32_t)state->temp_x10 & 0x0FFF;
+    dword |= (uint32_t)state->rh_x10 << 12;
+    dword |= (uint32_t)state->battery_level << 22;
+    dword |= (uint32_t)state->time.Day << 27;
+    dword |= HOME_STATE_VALID;
+    BKPR_WriteDWORD(BKPR_ADDR_DWORD_HOMESTATE_VALUE, dword);
+}
 
-    EPD_Show(0);
-    LP_EnterStop(EPD_TIMEOUT_MS);
+static uint8_t Home_LoadState(struct Home_State *state) /* 从备份寄存器读取上次的主界面状态，返回1表示没有有效记录 */
+{
+    uint32_t dword;
 
-    /* 读取电子纸刚刷新完成后的电池电压并存入备份寄存器，供下次唤醒后使用 */
-    battery_voltage = ADC_GetChannel(ADC_CHANNEL_BATTERY);
-    BKPR_WriteDWORD(BKPR_ADDR_DWORD_ADCVAL, *(uint32_t *)&battery_voltage);
+    dword = BKPR_ReadDWORD(BKPR_ADDR_DWORD_HOMESTATE_VALUE);
+    if ((dword & HOME_STATE_VALID) == 0)
+    {
+        return 1;
+    }
+    state->temp_x10 = dword & 0x0FFF;
+    if (state->temp_x10 & 0x0800) /* 12位有符号数扩展 */
+    {
+        state->temp_x10 -= 0x1000;
+    }
+    state->rh_x10 = (dword >> 12) & 0x03FF;
+    state->battery_level = (dword >> 22) & 0x1F;
+    state->time.Day = (dword >> 27) & 0x07;
 
-    EPD_EnterDeepSleep();
+    dword = BKPR_ReadDWORD(BKPR_ADDR_DWORD_HOMESTATE_TIME);
+    state->time.Seconds = 0;
+    state->time.Minutes = dword & 0x3F;
+    state->time.Hours = (dword >> 6) & 0x1F;
+    state->time.Is_12hr = (dword >> 11) & 0x01;
+    state->time.PM = (dword >> 12) & 0x01;
+    state->time.Date = (dword >> 13) & 0x1F;
+    state->time.Month = (dword >> 18) & 0x0F;
+    state->time.Year = (dword >> 22) & 0xFF;
+    return 0;
+}
+
+static void Home_ClearState(void) /* 屏幕被其他界面覆盖后清除记录，下次使用全局刷新 */
+{
+    BKPR_WriteDWORD(BKPR_ADDR_DWORD_HOMESTATE_VALUE, 0x00000000);
+}
+
+static uint8_t Home_GetDirty(const struct Home_State *last_state, const struct Home_State *state) /* 比较两个状态，返回有变化的区域标志 */
+{
+    uint8_t dirty;
+
+    dirty = 0;
+    if (last_state->time.Year != state->time.Year || last_state->time.Month != state->time.Month || last_state->time.Date != state->time.Date)
+    {
+        dirty |= (1 << HOME_AREA_DATE) | (1 << HOME_AREA_LUNAR);
+    }
+    if (last_state->time.Day != state->time.Day)
+    {
+        dirty |= (1 << HOME_AREA_DATE);
+    }
+    if (last_state->battery_level != state->battery_level)
+    {
+        dirty |= (1 << HOME_AREA_BATTERY);
+    }
+    if (last_state->time.Is_12hr != state->time.Is_12hr) /* 12/24小时制的时间位置不同 */
+    {
+        dirty |= (1 << HOME_AREA_HOUR) | (1 << HOME_AREA_MINUTE);
+    }
+    if (last_state->time.Hours != state->time.Hours || last_state->time.PM != state->time.PM)
+    {
+        dirty |= (1 << HOME_AREA_HOUR);
+    }
+    if (last_state->time.Minutes != state->time.Minutes)
+    {
+        dirty |= (1 << HOME_AREA_MINUTE);
+    }
+    if (last_state->temp_x10 != state->temp_x10)
+    {
+        dirty |= (1 << HOME_AREA_TEMP);
+    }
+    if (last_state->rh_x10 != state->rh_x10)
+    {
+        dirty |= (1 << HOME_AREA_RH);
+    }
+    return dirty;
+}
+
+static void Home_SendArea(uint8_t ram, uint8_t dirty) /* 将帧缓冲中有变化的区域发送至电子纸 */
+{
+    uint8_t i;
+
+    for (i = 0; i < HOME_AREA_COUNT; i++)
+    {
+        if ((dirty & (1 << i)) != 0)
+        {
+            EPD_SendFrameArea(ram, HomeAreas[i].x, HomeAreas[i].y_x8, HomeAreas[i].x_size, HomeAreas[i].y_size_x8);
+        }
+    }
+}
+
+static void Home_NextMinute(struct RTC_Time *time) /* 时间加1分钟并清除秒，日期和星期的进位由时间库处理 */
+{
+    EPOCH_ToTime(EPOCH_FromTime(time) - time->Seconds + 60, time->Is_12hr, time);
+}
+
+static uint16_t Home_GetPrerenderDelay(void) /* 提前唤醒后还需要在Stop模式中等待的时间，低功耗定时器误差较大，留出余量 */
+{
+    uint16_t elapsed, margin;
+
+    elapsed = LP_GetElapsedMs(Wake.wake_tick);
+    margin = Wake.boundary_ms / 8 + HOME_PRERENDER_MARGIN_MS;
+    if (elapsed + margin >= Wake.boundary_ms)
+    {
+        return 0;
+    }
+    return Wake.boundary_ms - margin - elapsed;
+}
+
+static void Home_WaitMinute(void) /* 连续读取闹钟2标志直到整分钟，并记录整分钟时刻，低功耗定时器偏快或偏慢一个余量时都能等到 */
+{
+    uint16_t tick, limit;
+
+    limit = (Wake.boundary_ms / 8 + HOME_PRERENDER_MARGIN_MS) * 2; /* 与Home_GetPrerenderDelay()的余量相同 */
+    tick = LP_GetTick();
+    while (RTC_GetA2F() == 0)
+    {
+        if (LP_GetElapsedMs(tick) >= limit) /* 超时不作为整分钟时刻，刷新延迟从唤醒时开始计算，在最大值中可以看出 */
+        {
+            return;
+        }
+    }
+    PROF_MarkBoundary();
+    RTC_ClearA2F(); /* 清除后中断引脚恢复，下一次闹钟才能从Standby模式唤醒 */
 }
 
 static void FullInit(void) /* 清除除硬件版本外的全部数据 */
 {
+    Power_EnableBUZZER();
     BUZZER_SetFrqe(4000);
     BUZZER_SetVolume(DefaultSetting.buzzer_volume);
 
@@ -358,7 +887,7 @@ static void FullInit(void) /* 清除除硬件版本外的全部数据 */
 
 /* ==================== 主菜单 ==================== */
 
-static void Menu_DrawMenuFrame(char *title, uint8_t button_style)
+static void Menu_DrawMenuFrame(const uint8_t *title, uint8_t button_style)
 {
     uint8_t i;
 
@@ -366,37 +895,37 @@ static void Menu_DrawMenuFrame(char *title, uint8_t button_style)
     EPD_ClearRAM();
     for (i = 0; i < 2; i++)
     {
-        EPD_DrawUTF8(0, 0, 0, title, NULL, EPD_FontUTF8_24x24_B);
+        EPD_DrawGlyphRun(0, 0, 0, title, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B); /* 标题可以包含ASCII字符 */
         EPD_DrawImage(164, 0, EPD_Image_ArrowUp_8x8);
         EPD_DrawImage(212, 0, EPD_Image_ArrowUp_8x8);
         EPD_DrawImage(260, 0, EPD_Image_ArrowUp_8x8);
         switch (button_style)
         {
         case 0:
-            EPD_DrawUTF8(152, 1, 0, "移动", NULL, EPD_FontUTF8_16x16_B);
-            EPD_DrawUTF8(208, 1, 0, "加", NULL, EPD_FontUTF8_16x16_B);
-            EPD_DrawUTF8(256, 1, 0, "减", NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(152, 1, 0, GlyphRun_Move, NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(208, 1, 0, GlyphRun_Add, NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(256, 1, 0, GlyphRun_Sub, NULL, EPD_FontUTF8_16x16_B);
             /* 右下角 */
-            EPD_DrawUTF8(211, 13, 0, "保存", NULL, EPD_FontUTF8_16x16_B);
-            EPD_DrawUTF8(258, 13, 0, "取消", NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(211, 13, 0, GlyphRun_Save, NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(258, 13, 0, GlyphRun_Cancel, NULL, EPD_FontUTF8_16x16_B);
             break;
         case 1:
-            EPD_DrawUTF8(152, 1, 0, "移动", NULL, EPD_FontUTF8_16x16_B);
-            EPD_DrawUTF8(200, 1, 0, "取消", EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
-            EPD_DrawUTF8(256, 1, 0, "--", EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(152, 1, 0, GlyphRun_Move, NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(200, 1, 0, GlyphRun_Cancel, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(256, 1, 0, GlyphRun_None, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
             /* 右下角 */
-            EPD_DrawUTF8(211, 13, 0, "继续", NULL, EPD_FontUTF8_16x16_B);
-            EPD_DrawUTF8(258, 13, 0, "取消", NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(211, 13, 0, GlyphRun_Continue, NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(258, 13, 0, GlyphRun_Cancel, NULL, EPD_FontUTF8_16x16_B);
             break;
         case 2:
-            EPD_DrawUTF8(152, 1, 0, "继续", NULL, EPD_FontUTF8_16x16_B);
-            EPD_DrawUTF8(208, 1, 0, "--", EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
-            EPD_DrawUTF8(256, 1, 0, "--", EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(152, 1, 0, GlyphRun_Continue, NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(208, 1, 0, GlyphRun_None, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(256, 1, 0, GlyphRun_None, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
             break;
         case 3:
-            EPD_DrawUTF8(152, 1, 0, "进入", NULL, EPD_FontUTF8_16x16_B);
-            EPD_DrawUTF8(208, 1, 0, "上", NULL, EPD_FontUTF8_16x16_B);
-            EPD_DrawUTF8(256, 1, 0, "下", NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(152, 1, 0, GlyphRun_Enter, NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(208, 1, 0, GlyphRun_Up, NULL, EPD_FontUTF8_16x16_B);
+            EPD_DrawGlyphRun(256, 1, 0, GlyphRun_Down, NULL, EPD_FontUTF8_16x16_B);
             break;
         }
         EPD_DrawHLine(0, 27, 296, 2);
@@ -416,24 +945,24 @@ static void Menu_DrawSubmenuSaveSelect(uint8_t select)
     switch (select)
     {
     case 0:
-        EPD_DrawUTF8(200, 1, 0, "保存", NULL, EPD_FontUTF8_16x16_B);
-        EPD_DrawUTF8(256, 1, 0, "--", EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+        EPD_DrawGlyphRun(200, 1, 0, GlyphRun_Save, NULL, EPD_FontUTF8_16x16_B);
+        EPD_DrawGlyphRun(256, 1, 0, GlyphRun_None, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
         EPD_DrawImage(221, 15, EPD_Image_ArrowUp_12x8);
         break;
     case 1:
-        EPD_DrawUTF8(200, 1, 0, "取消", NULL, EPD_FontUTF8_16x16_B);
-        EPD_DrawUTF8(256, 1, 0, "--", EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+        EPD_DrawGlyphRun(200, 1, 0, GlyphRun_Cancel, NULL, EPD_FontUTF8_16x16_B);
+        EPD_DrawGlyphRun(256, 1, 0, GlyphRun_None, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
         EPD_DrawImage(268, 15, EPD_Image_ArrowUp_12x8);
         break;
     case 2:
-        EPD_DrawUTF8(200, 1, 0, "继续", NULL, EPD_FontUTF8_16x16_B);
-        EPD_DrawUTF8(256, 1, 0, "--", EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+        EPD_DrawGlyphRun(200, 1, 0, GlyphRun_Continue, NULL, EPD_FontUTF8_16x16_B);
+        EPD_DrawGlyphRun(256, 1, 0, GlyphRun_None, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
         EPD_DrawImage(221, 15, EPD_Image_ArrowUp_12x8);
         break;
     default:
         EPD_ClearArea(200, 1, 33, 2, 0xFF);
-        EPD_DrawUTF8(208, 1, 0, "加", NULL, EPD_FontUTF8_16x16_B);
-        EPD_DrawUTF8(256, 1, 0, "减", NULL, EPD_FontUTF8_16x16_B);
+        EPD_DrawGlyphRun(208, 1, 0, GlyphRun_Add, NULL, EPD_FontUTF8_16x16_B);
+        EPD_DrawGlyphRun(256, 1, 0, GlyphRun_Sub, NULL, EPD_FontUTF8_16x16_B);
         break;
     }
 }
@@ -442,19 +971,22 @@ static void Menu_MainMenu(void)
 {
     uint8_t select, exit, full_update, wait_btn, update_display;
 
+    EVENT_Init(MENU_IDLE_TIMEOUT_S); /* 长时间无操作时自动返回主界面 */
+    Menu_Idle = 0;
     BEEP_OK();
     exit = 0;
     full_update = 1;
     select = 0;
     wait_btn = 0;
     update_display = 0;
-    while (exit == 0)
+    while (exit == 0 && Menu_Idle == 0)
     {
         if (full_update == 0)
         {
+            Menu_WaitEvent(update_display); /* 没有待刷新的内容时进入Stop模式等待事件 */
             if (BTN_ReadDOWN() == 0)
             {
-                if (select < 9)
+                if (select < 10)
                 {
                     select += 1;
                 }
@@ -472,7 +1004,7 @@ static void Menu_MainMenu(void)
                 }
                 else
                 {
-                    select = 9;
+                    select = 10;
                 }
                 wait_btn = 1;
             }
@@ -527,7 +1059,7 @@ static void Menu_MainMenu(void)
                     BEEP_OK();
                     break;
                 case 10:
-                    /* code */
+                    Menu_SetAlarm();
                     break;
                 case 11:
                     /* code */
@@ -547,7 +1079,7 @@ static void Menu_MainMenu(void)
                     EPD_ClearArea(0, 4, 24, 12, 0xFF);
                     snprintf(String, sizeof(String), "▶");
                     EPD_DrawUTF8(0, 4 + ((select % 4) * 3), 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                    snprintf(String, sizeof(String), "%d/%d页", (select / 4) + 1, (8 / 4) + 1);
+                    snprintf(String, sizeof(String), "%d/%d页", (select / 4) + 1, (10 / 4) + 1);
                     EPD_DrawUTF8(236, 13, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
                     if (select <= 3)
                     {
@@ -577,7 +1109,7 @@ static void Menu_MainMenu(void)
                         EPD_DrawUTF8(25, 4, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
                         snprintf(String, sizeof(String), "10.清除屏幕   ");
                         EPD_DrawUTF8(25, 7, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                        snprintf(String, sizeof(String), "              ");
+                        snprintf(String, sizeof(String), "11.ALARM      "); /* 字库中没有“闹”字，使用英文 */
                         EPD_DrawUTF8(25, 10, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
                         snprintf(String, sizeof(String), "              ");
                         EPD_DrawUTF8(25, 13, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
@@ -596,37 +1128,72 @@ static void Menu_MainMenu(void)
         {
             full_update = 0;
             update_display = 1;
-            Menu_DrawMenuFrame("主菜单", 3);
+            Menu_DrawMenuFrame(GlyphRun_MainMenu, 3);
             BTN_WaitAll();
         }
     }
 }
 
-/* ==================== 子菜单 ==================== */
+static uint8_t Menu_WaitEvent(uint8_t update_display) /* 进入Stop模式等待按钮、电子纸刷新完成、闹钟或无操作超时，返回事件类型 */
+{
+    struct EVENT event;
 
-static void Menu_SetTime(void) /* 时间设置页面 */
+    if (BTN_Clicked != 0 || (update_display != 0 && EPD_GetBusy() == 0)) /* 还有未读取的按钮，或可以立即刷新 */
+    {
+        return EVENT_TYPE_NONE;
+    }
+    EVENT_Wait(&event);
+    if (event.type == EVENT_TYPE_BUTTON && (event.button.type == BUTTON_EVENT_PRESS || event.button.type == BUTTON_EVENT_REPEAT))
+    {
+        BTN_Clicked |= 1 << event.button.button;
+    }
+    else if (event.type == EVENT_TYPE_IDLE)
+    {
+        Menu_Idle = 1;
+    }
+    else if (event.type == EVENT_TYPE_ALARM) /* 菜单打开期间闹钟到期，包括没有无操作超时的首次设置，立即响铃 */
+    {
+        Alarm_Ring(0);
+        EVENT_ResetIdle(); /* 关闭响铃的按钮也算操作 */
+    }
+    return event.type;
+}
+
+static void Menu_RunPage(const struct Menu_Page *page) /* 按页面描述执行设置页面，数值变化时只重绘该项目，选择变化时只移动光标 */
 {
-    struct RTC_Time new_time;
-    uint8_t select, save, update_display, wait_btn, time_check, arrow_y;
-    uint16_t arrow_x;
+    int16_t values[MENU_FIELD_MAX], original[MENU_FIELD_MAX];
+    uint8_t order[MENU_FIELD_MAX]; /* 可以选择的项目编号，之后依次为保存和取消 */
+    uint8_t count, select, shown, save, wait_btn, repeat, redraw, i;
+    const struct Menu_Field *field;
 
-    Menu_DrawMenuFrame("时间设置", 0);
+    Menu_DrawMenuFrame(page->title, 0);
     BTN_WaitAll();
-    RTC_GetTime(&new_time);
-    if (RTC_GetOSF() != 0 || new_time.Month == 0)
+    page->load(values);
+    memcpy(original, values, sizeof(values));
+    count = 0;
+    for (i = 0; i < page->field_count; i++)
     {
-        memcpy(&new_time, &DefaultTime, sizeof(struct RTC_Time));
+        if (page->fields[i].type != MENU_FIELD_LABEL)
+        {
+            order[count] = i;
+            count += 1;
+        }
     }
+    redraw = MENU_REDRAW_LABEL | MENU_REDRAW_INFO | ((1 << page->field_count) - 1);
+    shown = 0xFF; /* 还没有显示光标 */
     select = 0;
-    update_display = 1;
-    time_check = 0;
     wait_btn = 0;
+    repeat = 0;
     save = 0;
-    while (save == 0)
+    while (save == 0 && Menu_Idle == 0)
     {
+        if (Menu_WaitEvent(redraw != 0 || shown != select) == EVENT_TYPE_RTC && page->draw_info != NULL) /* 没有待刷新的内容时进入Stop模式等待事件 */
+        {
+            redraw |= MENU_REDRAW_INFO; /* 每分钟更新一次附加信息，例如实时电压 */
+        }
         if (BTN_ReadSET() == 0)
         {
-            if (select < 17)
+            if (select < count + 1)
             {
                 select += 1;
             }
@@ -634,743 +1201,221 @@ static void Menu_SetTime(void) /* 时间设置页面 */
             {
                 select = 0;
             }
-            if (select == 9 && new_time.Is_12hr == 0)
+            wait_btn = 1;
+        }
+        else if (select < count)
+        {
+            i = order[select];
+            field = &page->fields[i];
+            if (BTN_ReadUP() == 0)
             {
-                select += 1;
+                wait_btn = 1;
+                if (Menu_StepField(field, &values[i], 1) != 0)
+                {
+                    redraw |= 1 << i;
+                }
             }
-            if (time_check != 0)
+            else if (BTN_ReadDOWN() == 0)
             {
-                RTC_CheckTimeRange(&new_time);
-                time_check = 0;
+                wait_btn = 1;
+                if (Menu_StepField(field, &values[i], -1) != 0)
+                {
+                    redraw |= 1 << i;
+                }
             }
-            wait_btn = 1;
-        }
-        else
-        {
-            switch (select)
+            if ((redraw & (1 << i)) != 0)
             {
-            case 0:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Year, 2, 1, 0);
-                break;
-            case 1:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Year, 1, 9, 0);
-                break;
-            case 2:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Year, 0, 9, 0);
-                time_check = 1;
-                break;
-            case 3:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Month, 1, 1, 0);
-                break;
-            case 4:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Month, 0, 9, 0);
-                time_check = 1;
-                break;
-            case 5:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Date, 1, 3, 0);
-                break;
-            case 6:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Date, 0, 9, 0);
-                time_check = 1;
-                break;
-            case 7:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Day, 0, 7, 1);
-                break;
-            case 8:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Is_12hr, 0, 1, 0);
-                time_check = 1;
-                break;
-            case 9:
-                wait_btn = BTN_ModifySingleDigit(&new_time.PM, 0, 1, 0);
-                break;
-            case 10:
-                if (new_time.Is_12hr == 0)
+                if (page->info_on_change != 0)
                 {
-                    wait_btn = BTN_ModifySingleDigit(&new_time.Hours, 1, 2, 0);
+                    redraw |= MENU_REDRAW_INFO;
                 }
-                else
+                if (page->apply != NULL)
                 {
-                    wait_btn = BTN_ModifySingleDigit(&new_time.Hours, 1, 1, 0);
-                }
-                break;
-            case 11:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Hours, 0, 9, 0);
-                time_check = 1;
-                break;
-            case 12:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Minutes, 1, 5, 0);
-                break;
-            case 13:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Minutes, 0, 9, 0);
-                time_check = 1;
-                break;
-            case 14:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Seconds, 1, 5, 0);
-                break;
-            case 15:
-                wait_btn = BTN_ModifySingleDigit(&new_time.Seconds, 0, 9, 0);
-                time_check = 1;
-                break;
-            case 16:
-                if (BTN_ReadUPFast() == 0)
-                {
-                    save = 2;
-                    wait_btn = 0;
-                    update_display = 0;
-                }
-                break;
-            case 17:
-                if (BTN_ReadUP() == 0)
-                {
-                    save = 1;
-                    wait_btn = 0;
-                    update_display = 0;
-                }
-                break;
-            }
-        }
-        if (wait_btn != 0)
-        {
-            update_display = 1;
-        }
-        if (update_display != 0)
-        {
-            if (EPD_GetBusy() == 0)
-            {
-                update_display = 0;
-                snprintf(String, sizeof(String), "2%03d年%02d月%02d日 周%d", new_time.Year, new_time.Month, new_time.Date, new_time.Day);
-                EPD_DrawUTF8(7, 4, 5, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                if (new_time.Is_12hr != 0)
-                {
-                    snprintf(String, sizeof(String), "时间格式：12小时制");
-                }
-                else
-                {
-                    snprintf(String, sizeof(String), "时间格式：24小时制");
-                }
-                EPD_DrawUTF8(5, 8, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                if (new_time.Is_12hr != 0)
-                {
-                    if (new_time.PM != 0)
-                    {
-                        snprintf(String, sizeof(String), "下午");
-                    }
-                    else
-                    {
-                        snprintf(String, sizeof(String), "上午");
-                    }
-                }
-                else
-                {
-                    snprintf(String, sizeof(String), "    ");
-                }
-                EPD_DrawUTF8(5, 12, 0, String, NULL, EPD_FontUTF8_24x24_B);
-                snprintf(String, sizeof(String), "%02d:%02d:%02d", new_time.Hours, new_time.Minutes, new_time.Seconds);
-                EPD_DrawUTF8(58, 12, 5, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                if (select <= 2)
-                {
-                    arrow_x = 24 + (select * 17);
-                    arrow_y = 7;
-                }
-                else if (select >= 3 && select <= 4)
-                {
-                    arrow_x = 104 + ((select - 3) * 17);
-                    arrow_y = 7;
-                }
-                else if (select >= 5 && select <= 6)
-                {
-                    arrow_x = 167 + ((select - 5) * 17);
-                    arrow_y = 7;
-                }
-                else if (select >= 7 && select <= 7)
-                {
-                    arrow_x = 276 + ((select - 7) * 17);
-                    arrow_y = 7;
-                }
-                else if (select >= 8 && select <= 8)
-                {
-                    arrow_x = 132;
-                    arrow_y = 11;
-                }
-                else if (select >= 9 && select <= 9)
-                {
-                    arrow_x = 23;
-                    arrow_y = 15;
-                }
-                else if (select >= 10 && select <= 11)
-                {
-                    arrow_x = 58 + ((select - 10) * 17);
-                    arrow_y = 15;
-                }
-                else if (select >= 12 && select <= 13)
-                {
-                    arrow_x = 109 + ((select - 12) * 17);
-                    arrow_y = 15;
-                }
-                else if (select >= 14 && select <= 15)
-                {
-                    arrow_x = 160 + ((select - 14) * 17);
-                    arrow_y = 15;
-                }
-                EPD_ClearArea(5, 7, 283, 1, 0xFF);
-                EPD_ClearArea(5, 11, 283, 1, 0xFF);
-                EPD_ClearArea(5, 15, 283, 1, 0xFF);
-
-                if (select == 16 || select == 17)
-                {
-                    Menu_DrawSubmenuSaveSelect(select - 16);
-                }
-                else
-                {
-                    EPD_DrawImage(arrow_x, arrow_y, EPD_Image_ArrowUp_12x8);
-                    Menu_DrawSubmenuSaveSelect(3);
-                }
-
-                EPD_Show(0);
-            }
-        }
-        if (save == 2)
-        {
-            RTC_SetTime(&new_time);
-        }
-        if (wait_btn != 0)
-        {
-            BEEP_Button();
-            BTN_WaitAll();
-            wait_btn = 0;
-        }
-    }
-    BEEP_OK();
-}
-
-static void Menu_Guide(void) /* 首次使用时的引导 */
-{
-    Menu_DrawMenuFrame("欢迎使用", 2);
-    BTN_WaitAll();
-    EPD_DrawImage(0, 4, EPD_Image_Welcome_296x96);
-    EPD_Show(0);
-    LP_EnterStop(EPD_TIMEOUT_MS);
-    while (BTN_ReadSET() != 0)
-    {
-        LP_DelayStop(50);
-    }
-    BEEP_OK();
-}
-
-static void Menu_SetBuzzer(void) /* 设置蜂鸣器状态 */
-{
-    uint8_t select, save, update_display, wait_btn, volume, enable;
-
-    Menu_DrawMenuFrame("铃声设置", 0);
-    BTN_WaitAll();
-    update_display = 1;
-    wait_btn = 0;
-    save = 0;
-    select = 0;
-    enable = Setting.buzzer_enable;
-    volume = Setting.buzzer_volume;
-    while (save == 0)
-    {
-        if (BTN_ReadSET() == 0)
-        {
-            if (select < 3)
-            {
-                select += 1;
-            }
-            else
-            {
-                select = 0;
-            }
-            wait_btn = 1;
-        }
-        else
-        {
-            switch (select)
-            {
-            case 0:
-                if (BTN_ReadUP() == 0 || BTN_ReadDOWN() == 0)
-                {
-                    if (Setting.buzzer_enable == 0)
-                    {
-                        Setting.buzzer_enable = 1;
-                    }
-                    else
-                    {
-                        Setting.buzzer_enable = 0;
-                    }
-                    wait_btn = 1;
-                }
-                break;
-            case 1:
-                if (BTN_ReadUP() == 0)
-                {
-                    if (Setting.buzzer_volume < BUZZER_MAX_VOL)
-                    {
-                        Setting.buzzer_volume += 1;
-                    }
-                    wait_btn = 1;
-                }
-                else if (BTN_ReadDOWN() == 0)
-                {
-                    if (Setting.buzzer_volume > 1)
-                    {
-                        Setting.buzzer_volume -= 1;
-                    }
-                    wait_btn = 1;
-                }
-                break;
-            case 2:
-                if (BTN_ReadUP() == 0)
-                {
-                    wait_btn = 0;
-                    update_display = 0;
-                    save = 2;
-                }
-                break;
-            case 3:
-                if (BTN_ReadUP() == 0)
-                {
-                    wait_btn = 0;
-                    update_display = 0;
-                    save = 1;
-                }
-                break;
-            }
-        }
-        if (wait_btn != 0)
-        {
-            update_display = 1;
-        }
-        if (update_display != 0)
-        {
-            if (EPD_GetBusy() == 0)
-            {
-                update_display = 0;
-                EPD_DrawUTF8(0, 4, 0, "蜂鸣器开启状态：", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                if (Setting.buzzer_enable != 0)
-                {
-                    EPD_DrawUTF8(192, 4, 0, "开启", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                }
-                else
-                {
-                    EPD_DrawUTF8(192, 4, 0, "关闭", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                }
-                snprintf(String, sizeof(String), "蜂鸣器音量：%02d/%02d", Setting.buzzer_volume, BUZZER_MAX_VOL);
-                EPD_DrawUTF8(0, 8, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                EPD_ClearArea(240, 4, 24, 3, 0xFF);
-                EPD_ClearArea(204, 8, 24, 3, 0xFF);
-                switch (select)
-                {
-                case 0:
-                    EPD_DrawUTF8(240, 4, 0, "◀", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                    break;
-                case 1:
-                    EPD_DrawUTF8(204, 8, 0, "◀", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                    break;
-                }
-                if (select == 2 || select == 3)
-                {
-                    Menu_DrawSubmenuSaveSelect(select - 2);
-                }
-                else
-                {
-                    Menu_DrawSubmenuSaveSelect(3);
-                }
-                EPD_Show(0);
-            }
-        }
-        if (save == 2)
-        {
-            SaveSetting(&Setting);
-        }
-        else if (save == 1)
-        {
-            Setting.buzzer_enable = enable;
-            Setting.buzzer_volume = volume;
-        }
-        if (wait_btn != 0)
-        {
-            wait_btn = 0;
-            BEEP_Button();
-            BTN_WaitAll();
-        }
-    }
-    BEEP_OK();
-}
-
-static void Menu_SetBattery(void) /* 设置电池信息 */
-{
-    uint8_t select, save, update_display, wait_btn, long_press;
-    float bat_warn, bat_stop, tmp;
-
-    Menu_DrawMenuFrame("电池设置", 0);
-    BTN_WaitAll();
-    update_display = 1;
-    wait_btn = 0;
-    save = 0;
-    select = 0;
-    long_press = 0;
-    bat_warn = Setting.battery_warn;
-    bat_stop = Setting.battery_stop;
-    while (save == 0)
-    {
-        if (BTN_ReadSET() == 0)
-        {
-            if (select < 3)
-            {
-                select += 1;
-            }
-            else
-            {
-                select = 0;
-            }
-            long_press = 255;
-            wait_btn = 1;
-        }
-        else
-        {
-            if (BTN_ReadSET() != 0 && BTN_ReadUP() != 0 && BTN_ReadDOWN() != 0)
-            {
-                long_press = 6;
-            }
-            switch (select)
-            {
-            case 0:
-                if (BTN_ReadUP() == 0)
-                {
-                    if ((bat_warn + 0.005) < BAT_MAX_VOLTAGE)
-                    {
-                        bat_warn += 0.01;
-                    }
-                    wait_btn = 1;
-                }
-                else if (BTN_ReadDOWN() == 0)
-                {
-                    if ((bat_warn - 0.005) > BAT_MIN_VOLTAGE)
-                    {
-                        bat_warn -= 0.01;
-                    }
-                    wait_btn = 1;
-                }
-                break;
-            case 1:
-                if (BTN_ReadUP() == 0)
-                {
-                    if ((bat_stop + 0.005) < BAT_MAX_VOLTAGE)
-                    {
-                        bat_stop += 0.01;
-                    }
-                    wait_btn = 1;
-                }
-                else if (BTN_ReadDOWN() == 0)
-                {
-                    if ((bat_stop - 0.005) > BAT_MIN_VOLTAGE)
-                    {
-                        bat_stop -= 0.01;
-                    }
-                    wait_btn = 1;
-                }
-                break;
-            case 2:
-                if (BTN_ReadUP() == 0)
-                {
-                    wait_btn = 0;
-                    update_display = 0;
-                    save = 2;
-                }
-                break;
-            case 3:
-                if (BTN_ReadUP() == 0)
-                {
-                    wait_btn = 0;
-                    update_display = 0;
-                    save = 1;
-                }
-                break;
-            }
-        }
-        if (wait_btn != 0)
-        {
-            update_display = 1;
-        }
-        if (update_display != 0)
-        {
-            if (EPD_GetBusy() == 0)
-            {
-                update_display = 0;
-                tmp = bat_warn + 0.005;
-                snprintf(String, sizeof(String), "警告电压：%d.%02dV", (int8_t)tmp, (uint16_t)((tmp - (int8_t)tmp) * 100));
-                EPD_DrawUTF8(0, 4, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                tmp = bat_stop + 0.005;
-                snprintf(String, sizeof(String), "截止电压：%d.%02dV", (int8_t)(tmp), (uint16_t)(((tmp) - (int8_t)(tmp)) * 100));
-                EPD_DrawUTF8(0, 8, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                tmp = ADC_GetChannel(ADC_CHANNEL_BATTERY) + 0.005;
-                snprintf(String, sizeof(String), "[实时电压：%d.%02dV]", (int8_t)(tmp), (uint16_t)(((tmp) - (int8_t)(tmp)) * 100));
-                EPD_DrawUTF8(0, 12, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                EPD_ClearArea(180, 4, 24, 3, 0xFF);
-                EPD_ClearArea(180, 8, 24, 3, 0xFF);
-                switch (select)
-                {
-                case 0:
-                    EPD_DrawUTF8(180, 4, 0, "◀", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                    break;
-                case 1:
-                    EPD_DrawUTF8(180, 8, 0, "◀", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                    break;
-                }
-
-                if (select == 2 || select == 3)
-                {
-                    Menu_DrawSubmenuSaveSelect(select - 2);
-                }
-                else
-                {
-                    Menu_DrawSubmenuSaveSelect(3);
-                }
-                EPD_Show(0);
-            }
-        }
-        if (save == 2)
-        {
-            Setting.battery_warn = bat_warn;
-            Setting.battery_stop = bat_stop;
-            SaveSetting(&Setting);
-        }
-        if (wait_btn != 0)
-        {
-            wait_btn = 0;
-            if (long_press != 0)
-            {
-                BEEP_Button();
-            }
-            else
-            {
-                BEEP_Fast();
-            }
-            while (long_press != 0 && (BTN_ReadDOWN() == 0 || BTN_ReadUP() == 0 || BTN_ReadSET() == 0))
-            {
-                LL_mDelay(0);
-                if (long_press != 255)
-                {
-                    long_press -= 1;
+                    page->apply(values);
                 }
             }
         }
-    }
-    BEEP_OK();
-}
-
-static void Menu_SetSensor(void) /* 设置传感器信息 */
-{
-    uint8_t select, save, update_display, wait_btn, long_press;
-    float temp_offset, rh_offset, tmp;
-
-    Menu_DrawMenuFrame("传感器设置", 0);
-    BTN_WaitAll();
-    update_display = 1;
-    wait_btn = 0;
-    save = 0;
-    select = 0;
-    long_press = 0;
-    temp_offset = Setting.sensor_temp_offset;
-    rh_offset = Setting.sensor_rh_offset;
-    while (save == 0)
-    {
-        if (BTN_ReadSET() == 0)
+        else if (BTN_ReadUP() == 0)
         {
-            if (select < 3)
+            if (select == count)
             {
-                select += 1;
+                save = 2;
             }
             else
             {
-                select = 0;
+                save = 1;
             }
-            wait_btn = 1;
-            long_press = 255;
+            wait_btn = 0;
         }
-        else
+        if (save == 0 && (redraw != 0 || shown != select) && EPD_GetBusy() == 0)
         {
-            if (BTN_ReadSET() != 0 && BTN_ReadUP() != 0 && BTN_ReadDOWN() != 0)
-            {
-                long_press = 6;
-            }
-            switch (select)
+            for (i = 0; i < page->field_count; i++)
             {
-            case 0:
-                if (BTN_ReadUP() == 0)
-                {
-                    if ((temp_offset + 0.005) < 10.00)
-                    {
-                        temp_offset += 0.01;
-                    }
-                    wait_btn = 1;
-                }
-                else if (BTN_ReadDOWN() == 0)
-                {
-                    if ((temp_offset - 0.005) > -10.00)
-                    {
-                        temp_offset -= 0.01;
-                    }
-                    wait_btn = 1;
-                }
-                break;
-            case 1:
-                if (BTN_ReadUP() == 0)
-                {
-                    if ((rh_offset + 0.005) < 10.00)
-                    {
-                        rh_offset += 0.01;
-                    }
-                    wait_btn = 1;
-                }
-                else if (BTN_ReadDOWN() == 0)
-                {
-                    if ((rh_offset - 0.005) > -10.00)
-                    {
-                        rh_offset -= 0.01;
-                    }
-                    wait_btn = 1;
-                }
-                break;
-            case 2:
-                if (BTN_ReadUP() == 0)
+                field = &page->fields[i];
+                if ((redraw & MENU_REDRAW_LABEL) != 0 && field->label != NULL)
                 {
-                    wait_btn = 0;
-                    update_display = 0;
-                    save = 2;
+                    EPD_DrawGlyphRun(field->label_x, field->y_x8, field->gap, field->label, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
                 }
-                break;
-            case 3:
-                if (BTN_ReadUP() == 0)
+                if ((redraw & (1 << i)) != 0 && field->type != MENU_FIELD_LABEL)
                 {
-                    wait_btn = 0;
-                    update_display = 0;
-                    save = 1;
+                    Menu_DrawField(field, values[i]);
                 }
-                break;
             }
-        }
-        if (wait_btn != 0)
-        {
-            update_display = 1;
-        }
-        if (update_display != 0)
-        {
-            if (EPD_GetBusy() == 0)
+            if ((redraw & MENU_REDRAW_INFO) != 0 && page->draw_info != NULL)
             {
-                update_display = 0;
-
-                if (temp_offset > 0)
-                {
-                    tmp = temp_offset + 0.005;
-                }
-                else
-                {
-                    tmp = temp_offset - 0.005;
-                }
-                if (tmp > -1.0 && tmp <= -0.01)
-                {
-                    snprintf(String, sizeof(String), "温度偏移：-%02d.%02d℃", (int8_t)tmp, abs((int16_t)((tmp - (int8_t)tmp) * 100)));
-                }
-                else
-                {
-                    snprintf(String, sizeof(String), "温度偏移：%+03d.%02d℃", (int8_t)tmp, abs((int16_t)((tmp - (int8_t)tmp) * 100)));
-                }
-                EPD_DrawUTF8(0, 4, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-
-                if (rh_offset > 0)
-                {
-                    tmp = rh_offset + 0.005;
-                }
-                else
-                {
-                    tmp = rh_offset - 0.005;
-                }
-                if (tmp >= -1.0 && tmp <= -0.01)
-                {
-                    snprintf(String, sizeof(String), "湿度偏移：-%02d.%02d％", (int8_t)tmp, abs((int16_t)((tmp - (int8_t)tmp) * 100)));
-                }
-                else
-                {
-                    snprintf(String, sizeof(String), "湿度偏移：%+03d.%02d％", (int8_t)tmp, abs((int16_t)((tmp - (int8_t)tmp) * 100)));
-                }
-                EPD_DrawUTF8(0, 8, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                EPD_ClearArea(216, 4, 24, 3, 0xFF);
-                EPD_ClearArea(216, 8, 24, 3, 0xFF);
-                switch (select)
+                page->draw_info(values);
+            }
+            if (shown != select)
+            {
+                if (shown < count)
                 {
-                case 0:
-                    EPD_DrawUTF8(216, 4, 0, "◀", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                    break;
-                case 1:
-                    EPD_DrawUTF8(216, 8, 0, "◀", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                    break;
+                    Menu_DrawCursor(&page->fields[order[shown]], 0);
                 }
-
-                if (select == 2 || select == 3)
+                if (select < count)
                 {
-                    Menu_DrawSubmenuSaveSelect(select - 2);
+                    Menu_DrawCursor(&page->fields[order[select]], 1);
                 }
-                else
+                if (select >= count || (shown >= count && shown != 0xFF)) /* 进入或离开保存和取消时才重绘右上角的提示 */
                 {
-                    Menu_DrawSubmenuSaveSelect(3);
+                    Menu_DrawSubmenuSaveSelect(select >= count ? select - count : 3);
                 }
-
-                EPD_Show(0);
+                shown = select;
             }
-        }
-        if (save == 2)
-        {
-            Setting.sensor_temp_offset = temp_offset;
-            Setting.sensor_rh_offset = rh_offset;
-            TH_SetTemperatureOffset(temp_offset);
-            TH_SetHumidityOffset(rh_offset);
-            SaveSetting(&Setting);
+            redraw = 0;
+            EPD_Show(0);
         }
         if (wait_btn != 0)
         {
             wait_btn = 0;
-            if (long_press != 0)
+            if (repeat == 0)
             {
                 BEEP_Button();
             }
             else
             {
-                BEEP_Fast();
-            }
-            while (long_press != 0 && (BTN_ReadDOWN() == 0 || BTN_ReadUP() == 0 || BTN_ReadSET() == 0))
-            {
-                LL_mDelay(0);
-                if (long_press != 255)
-                {
-                    long_press -= 1;
-                }
+                BEEP_Fast(); /* 按住连发时使用短提示音 */
             }
+            repeat = BTN_WaitAll();
         }
     }
+    if (save == 2)
+    {
+        page->save(values);
+    }
+    else if (page->apply != NULL)
+    {
+        page->apply(original); /* 取消或超时退出时恢复已经生效的设置 */
+    }
     BEEP_OK();
 }
 
-static void Menu_SetVrefint(void) /* 设置参考电压偏移 */
+static void Menu_DrawField(const struct Menu_Field *field, int16_t value) /* 绘制项目的数值 */
 {
-    uint8_t select, save, update_display, wait_btn;
-    int16_t offset;
-    float vrefint_factory;
+    uint8_t i;
+    uint16_t divisor, abs_value;
+    const char *sign;
+
+    if (field->type == MENU_FIELD_SWITCH)
+    {
+        EPD_DrawGlyphRun(field->value_x, field->y_x8, 0, value != 0 ? GlyphRun_On : GlyphRun_Off, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+        return;
+    }
+    divisor = 1;
+    for (i = 0; i < field->scale; i++)
+    {
+        divisor *= 10;
+    }
+    abs_value = value < 0 ? -value : value;
+    if (value < 0)
+    {
+        sign = "-";
+    }
+    else if (field->sign != 0)
+    {
+        sign = "+";
+    }
+    else
+    {
+        sign = "";
+    }
+    if (field->scale == 0)
+    {
+        snprintf(String, sizeof(String), "%s%0*d%s", sign, field->digits, abs_value, field->unit);
+    }
+    else
+    {
+        snprintf(String, sizeof(String), "%s%0*d.%0*d%s", sign, field->digits, abs_value / divisor, field->scale, abs_value % divisor, field->unit);
+    }
+    EPD_DrawUTF8(field->value_x, field->y_x8, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+}
+
+static void Menu_DrawCursor(const struct Menu_Field *field, uint8_t show) /* 显示或清除项目的光标 */
+{
+    if (field->cursor == MENU_CURSOR_ARROW)
+    {
+        EPD_ClearArea(field->cursor_x, field->y_x8 + 3, 12, 1, 0xFF);
+        if (show != 0)
+        {
+            EPD_DrawImage(field->cursor_x, field->y_x8 + 3, EPD_Image_ArrowUp_12x8);
+        }
+    }
+    else
+    {
+        EPD_ClearArea(field->cursor_x, field->y_x8, 24, 3, 0xFF);
+        if (show != 0)
+        {
+            EPD_DrawGlyphRun(field->cursor_x, field->y_x8, 0, GlyphRun_Select, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+        }
+    }
+}
+
+static uint8_t Menu_StepField(const struct Menu_Field *field, int16_t *value, int8_t direction) /* 按步长修改数值，到达范围边界时不变，返回1表示有变化 */
+{
+    int16_t last_value;
+
+    last_value = *value;
+    if (field->type == MENU_FIELD_SWITCH)
+    {
+        *value = *value == 0;
+    }
+    else if (direction > 0 && *value + field->step <= field->max)
+    {
+        *value += field->step;
+    }
+    else if (direction < 0 && *value - field->step >= field->min)
+    {
+        *value -= field->step;
+    }
+    return *value != last_value;
+}
+
+/* ==================== 子菜单 ==================== */
+
+static void Menu_SetTime(void) /* 时间设置页面 */
+{
+    struct RTC_Time new_time;
+    uint8_t select, shown, save, redraw, wait_btn, time_check, arrow_y;
+    uint16_t arrow_x;
 
-    Menu_DrawMenuFrame("参考电压设置", 0);
+    Menu_DrawMenuFrame(GlyphRun_SetTime, 0);
     BTN_WaitAll();
-    update_display = 1;
+    RTC_GetTime(&new_time);
+    if (RTC_GetOSF() != 0 || new_time.Month == 0)
+    {
+        memcpy(&new_time, &DefaultTime, sizeof(struct RTC_Time));
+    }
+    select = 0;
+    shown = 0xFF; /* 还没有显示箭头 */
+    redraw = 0x07; /* 1：日期行，2：时间格式行，4：时间行 */
+    time_check = 0;
     wait_btn = 0;
     save = 0;
-    select = 0;
-    offset = Setting.vrefint_offset;
-    ADC_EnableVrefintOutput();
-    while (save == 0)
+    while (save == 0 && Menu_Idle == 0)
     {
+        Menu_WaitEvent(redraw != 0 || shown != select); /* 没有待刷新的内容时进入Stop模式等待事件 */
         if (BTN_ReadSET() == 0)
         {
-            if (select < 2)
+            if (select < 17)
             {
                 select += 1;
             }
@@ -1378,6 +1423,16 @@ static void Menu_SetVrefint(void) /* 设置参考电压偏移 */
             {
                 select = 0;
             }
+            if (select == 9 && new_time.Is_12hr == 0)
+            {
+                select += 1;
+            }
+            if (time_check != 0)
+            {
+                RTC_CheckTimeRange(&new_time); /* 可能修改任意一项 */
+                time_check = 0;
+                redraw = 0x07;
+            }
             wait_btn = 1;
         }
         else
@@ -1385,101 +1440,343 @@ static void Menu_SetVrefint(void) /* 设置参考电压偏移 */
             switch (select)
             {
             case 0:
-                if (BTN_ReadUP() == 0)
+                wait_btn = BTN_ModifySingleDigit(&new_time.Year, 2, 1, 0);
+                break;
+            case 1:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Year, 1, 9, 0);
+                break;
+            case 2:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Year, 0, 9, 0);
+                time_check = 1;
+                break;
+            case 3:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Month, 1, 1, 0);
+                break;
+            case 4:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Month, 0, 9, 0);
+                time_check = 1;
+                break;
+            case 5:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Date, 1, 3, 0);
+                break;
+            case 6:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Date, 0, 9, 0);
+                time_check = 1;
+                break;
+            case 7:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Day, 0, 7, 1);
+                break;
+            case 8:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Is_12hr, 0, 1, 0);
+                time_check = 1;
+                break;
+            case 9:
+                wait_btn = BTN_ModifySingleDigit(&new_time.PM, 0, 1, 0);
+                break;
+            case 10:
+                if (new_time.Is_12hr == 0)
                 {
-                    if (offset < 127)
-                    {
-                        offset += 1;
-                    }
-                    wait_btn = 1;
+                    wait_btn = BTN_ModifySingleDigit(&new_time.Hours, 1, 2, 0);
                 }
-                else if (BTN_ReadDOWN() == 0)
+                else
                 {
-                    if (offset > -127)
-                    {
-                        offset -= 1;
-                    }
-                    wait_btn = 1;
+                    wait_btn = BTN_ModifySingleDigit(&new_time.Hours, 1, 1, 0);
                 }
                 break;
-            case 1:
+            case 11:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Hours, 0, 9, 0);
+                time_check = 1;
+                break;
+            case 12:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Minutes, 1, 5, 0);
+                break;
+            case 13:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Minutes, 0, 9, 0);
+                time_check = 1;
+                break;
+            case 14:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Seconds, 1, 5, 0);
+                break;
+            case 15:
+                wait_btn = BTN_ModifySingleDigit(&new_time.Seconds, 0, 9, 0);
+                time_check = 1;
+                break;
+            case 16:
                 if (BTN_ReadUP() == 0)
                 {
-                    wait_btn = 0;
-                    update_display = 0;
                     save = 2;
+                    wait_btn = 0;
                 }
                 break;
-            case 2:
+            case 17:
                 if (BTN_ReadUP() == 0)
                 {
-                    wait_btn = 0;
-                    update_display = 0;
                     save = 1;
+                    wait_btn = 0;
                 }
                 break;
             }
         }
-        if (wait_btn != 0)
+        if (wait_btn != 0 && select <= 15) /* 只重绘修改的一行 */
         {
-            update_display = 1;
+            if (select <= 7)
+            {
+                redraw |= 0x01;
+            }
+            else if (select == 8)
+            {
+                redraw |= 0x06;
+            }
+            else
+            {
+                redraw |= 0x04;
+            }
         }
-        if (update_display != 0)
+        if (save == 0 && (redraw != 0 || shown != select) && EPD_GetBusy() == 0)
         {
-            if (EPD_GetBusy() == 0)
+            if ((redraw & 0x01) != 0)
             {
-                update_display = 0;
-                snprintf(String, sizeof(String), "偏移数值：%+04d", offset);
-                EPD_DrawUTF8(0, 4, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                vrefint_factory = ADC_GetVrefintFactory() + (ADC_GetVrefintStep() * offset) + 0.0005;
-                snprintf(String, sizeof(String), "[实际电压：%04d.%03dmV]", (int16_t)vrefint_factory, (int16_t)((vrefint_factory - (int16_t)vrefint_factory) * 1000));
-                EPD_DrawUTF8(0, 8, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                EPD_ClearArea(168, 4, 24, 3, 0xFF);
-                switch (select)
+                snprintf(String, sizeof(String), "2%03d年%02d月%02d日 周%d", new_time.Year, new_time.Month, new_time.Date, new_time.Day);
+                EPD_DrawUTF8(7, 4, 5, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+            }
+            if ((redraw & 0x02) != 0)
+            {
+                if (new_time.Is_12hr != 0)
                 {
-                case 0:
-                    EPD_DrawUTF8(168, 4, 0, "◀", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                    break;
+                    snprintf(String, sizeof(String), "时间格式：12小时制");
                 }
-
-                if (select == 1 || select == 2)
+                else
+                {
+                    snprintf(String, sizeof(String), "时间格式：24小时制");
+                }
+                EPD_DrawUTF8(5, 8, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+            }
+            if ((redraw & 0x04) != 0)
+            {
+                if (new_time.Is_12hr != 0)
                 {
-                    Menu_DrawSubmenuSaveSelect(select - 1);
+                    if (new_time.PM != 0)
+                    {
+                        snprintf(String, sizeof(String), "下午");
+                    }
+                    else
+                    {
+                        snprintf(String, sizeof(String), "上午");
+                    }
                 }
                 else
                 {
-                    Menu_DrawSubmenuSaveSelect(3);
+                    snprintf(String, sizeof(String), "    ");
                 }
-
-                EPD_Show(0);
+                EPD_DrawUTF8(5, 12, 0, String, NULL, EPD_FontUTF8_24x24_B);
+                snprintf(String, sizeof(String), "%02d:%02d:%02d", new_time.Hours, new_time.Minutes, new_time.Seconds);
+                EPD_DrawUTF8(58, 12, 5, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+            }
+            if (shown != select) /* 只清除原来的箭头并在新位置绘制 */
+            {
+                if (shown <= 15)
+                {
+                    Menu_GetTimeArrow(shown, &arrow_x, &arrow_y);
+                    EPD_ClearArea(arrow_x, arrow_y, 12, 1, 0xFF);
+                }
+                if (select <= 15)
+                {
+                    Menu_GetTimeArrow(select, &arrow_x, &arrow_y);
+                    EPD_DrawImage(arrow_x, arrow_y, EPD_Image_ArrowUp_12x8);
+                }
+                if (select >= 16 || (shown >= 16 && shown != 0xFF))
+                {
+                    Menu_DrawSubmenuSaveSelect(select >= 16 ? select - 16 : 3);
+                }
+                shown = select;
             }
+            redraw = 0;
+            EPD_Show(0);
         }
         if (save == 2)
         {
-            Setting.vrefint_offset = offset;
-            ADC_SetVrefintOffset(offset);
-            SaveSetting(&Setting);
+            RTC_SetTime(&new_time);
         }
         if (wait_btn != 0)
         {
-            wait_btn = 0;
             BEEP_Button();
             BTN_WaitAll();
+            wait_btn = 0;
         }
     }
-    ADC_DisableVrefintOutput();
     BEEP_OK();
 }
 
+static void Menu_GetTimeArrow(uint8_t select, uint16_t *x, uint8_t *y_x8) /* 时间设置页面中各项目下方箭头的位置 */
+{
+    if (select <= 2)
+    {
+        *x = 24 + (select * 17);
+        *y_x8 = 7;
+    }
+    else if (select >= 3 && select <= 4)
+    {
+        *x = 104 + ((select - 3) * 17);
+        *y_x8 = 7;
+    }
+    else if (select >= 5 && select <= 6)
+    {
+        *x = 167 + ((select - 5) * 17);
+        *y_x8 = 7;
+    }
+    else if (select == 7)
+    {
+        *x = 276;
+        *y_x8 = 7;
+    }
+    else if (select == 8)
+    {
+        *x = 132;
+        *y_x8 = 11;
+    }
+    else if (select == 9)
+    {
+        *x = 23;
+        *y_x8 = 15;
+    }
+    else if (select >= 10 && select <= 11)
+    {
+        *x = 58 + ((select - 10) * 17);
+        *y_x8 = 15;
+    }
+    else if (select >= 12 && select <= 13)
+    {
+        *x = 109 + ((select - 12) * 17);
+        *y_x8 = 15;
+    }
+    else
+    {
+        *x = 160 + ((select - 14) * 17);
+        *y_x8 = 15;
+    }
+}
+
+static void Menu_Guide(void) /* 首次使用时的引导 */
+{
+    Menu_DrawMenuFrame(GlyphRun_Guide, 2);
+    BTN_WaitAll();
+    EPD_DrawPackedImage(0, 4, EPD_PackedImage_Welcome_296x96);
+    EPD_Show(0);
+    LP_EnterStop(EPD_TIMEOUT_MS);
+    while (BTN_ReadSET() != 0)
+    {
+        Menu_WaitEvent(0);
+    }
+    BEEP_OK();
+}
+
+static void Menu_SetBuzzer(void) /* 设置蜂鸣器状态 */
+{
+    Menu_RunPage(&BuzzerPage);
+}
+
+static void Page_LoadBuzzer(int16_t *values)
+{
+    values[0] = Setting.buzzer_enable;
+    values[1] = Setting.buzzer_volume;
+}
+
+static void Page_ApplyBuzzer(const int16_t *values) /* 修改后立即生效，按键提示音使用新的设置 */
+{
+    Setting.buzzer_enable = values[0];
+    Setting.buzzer_volume = values[1];
+}
+
+static void Page_SaveBuzzer(const int16_t *values)
+{
+    Page_ApplyBuzzer(values);
+    SaveSetting(&Setting);
+}
+
+static void Menu_SetBattery(void) /* 设置电池信息 */
+{
+    Menu_RunPage(&BatteryPage);
+}
+
+static void Page_LoadBattery(int16_t *values)
+{
+    values[0] = (int16_t)(Setting.battery_warn * 100 + 0.5);
+    values[1] = (int16_t)(Setting.battery_stop * 100 + 0.5);
+}
+
+static void Page_SaveBattery(const int16_t *values)
+{
+    Setting.battery_warn = values[0] / 100.0;
+    Setting.battery_stop = values[1] / 100.0;
+    SaveSetting(&Setting);
+}
+
+static void Page_DrawBatteryInfo(const int16_t *values) /* 实时电压，每分钟更新一次 */
+{
+    float tmp;
+
+    tmp = ADC_GetChannel(ADC_CHANNEL_BATTERY) + 0.005;
+    snprintf(String, sizeof(String), "[实时电压：%d.%02dV]", (int8_t)(tmp), (uint16_t)(((tmp) - (int8_t)(tmp)) * 100));
+    EPD_DrawUTF8(0, 12, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+}
+
+static void Menu_SetSensor(void) /* 设置传感器信息 */
+{
+    Menu_RunPage(&SensorPage);
+}
+
+static void Page_LoadSensor(int16_t *values)
+{
+    values[0] = (int16_t)(Setting.sensor_temp_offset * 100 + (Setting.sensor_temp_offset < 0 ? -0.5 : 0.5));
+    values[1] = (int16_t)(Setting.sensor_rh_offset * 100 + (Setting.sensor_rh_offset < 0 ? -0.5 : 0.5));
+}
+
+static void Page_SaveSensor(const int16_t *values)
+{
+    Setting.sensor_temp_offset = values[0] / 100.0;
+    Setting.sensor_rh_offset = values[1] / 100.0;
+    TH_SetTemperatureOffset(Setting.sensor_temp_offset);
+    TH_SetHumidityOffset(Setting.sensor_rh_offset);
+    SaveSetting(&Setting);
+}
+
+static void Menu_SetVrefint(void) /* 设置参考电压偏移 */
+{
+    ADC_EnableVrefintOutput();
+    Menu_RunPage(&VrefintPage);
+    ADC_DisableVrefintOutput();
+}
+
+static void Page_LoadVrefint(int16_t *values)
+{
+    values[0] = Setting.vrefint_offset;
+}
+
+static void Page_SaveVrefint(const int16_t *values)
+{
+    Setting.vrefint_offset = values[0];
+    ADC_SetVrefintOffset(Setting.vrefint_offset);
+    SaveSetting(&Setting);
+}
+
+static void Page_DrawVrefintInfo(const int16_t *values) /* 按偏移数值计算的实际电压 */
+{
+    float vrefint_factory;
+
+    vrefint_factory = ADC_GetVrefintFactory() + (ADC_GetVrefintStep() * values[0]) + 0.0005;
+    snprintf(String, sizeof(String), "[实际电压：%04d.%03dmV]", (int16_t)vrefint_factory, (int16_t)((vrefint_factory - (int16_t)vrefint_factory) * 1000));
+    EPD_DrawUTF8(0, 8, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+}
+
 static void Menu_Info(void) /* 系统信息 */
 {
     uint32_t eeprom_tmp;
     float mcu_temp, rtc_temp;
     struct TH_Value th_value;
     char date_tmp[sizeof(__DATE__)], sig[2];
-    uint8_t i, btn_cnt;
+    uint8_t i, btn_cnt, page;
 
-    Menu_DrawMenuFrame("系统信息", 2);
+    Menu_DrawMenuFrame(GlyphRun_Info, 2);
     BTN_WaitAll();
     mcu_temp = ADC_GetTemp();
     eeprom_tmp = EEPROM_ReadDWORD(EEPROM_ADDR_DWORD_HWVERSION) & 0x00FFFFFF;
@@ -1566,25 +1863,32 @@ static void Menu_Info(void) /* 系统信息 */
         }
     }
     btn_cnt = 0;
-    while (BTN_ReadSET() != 0)
+    page = 0;
+    while (BTN_ReadSET() != 0 && Menu_Idle == 0)
     {
         if (BTN_ReadDOWN() == 0)
         {
             btn_cnt += 1;
             BTN_WaitAll();
         }
+        else if (BTN_ReadUP() == 0) /* 按“上”键依次显示各阶段的时间统计、电量消耗估算、I2C总线统计和等待统计 */
+        {
+            Info_DrawPage(page);
+            page = (page + 1) % 4;
+            BTN_WaitAll();
+        }
         else
         {
-            LP_DelayStop(50);
+            Menu_WaitEvent(0);
         }
         if (btn_cnt >= 8)
         {
-            EPD_DrawImage(207, 0, EPD_Image_Info_89x128);
+            EPD_DrawPackedImage(207, 0, EPD_PackedImage_Info_89x128);
             EPD_Show(0);
             LP_EnterStop(EPD_TIMEOUT_MS);
-            while (BTN_ReadSET() != 0)
+            while (BTN_ReadSET() != 0 && Menu_Idle == 0)
             {
-                LP_DelayStop(50);
+                Menu_WaitEvent(0);
             }
             break;
         }
@@ -1592,132 +1896,128 @@ static void Menu_Info(void) /* 系统信息 */
     BEEP_OK();
 }
 
-static void Menu_SetRTCAging(void) /* 设置实时时钟老化偏移 */
-{
-    uint8_t select, save, update_display, wait_btn;
-    int8_t offset;
-
-    Menu_DrawMenuFrame("时钟老化设置", 0);
-    BTN_WaitAll();
-    update_display = 1;
-    wait_btn = 0;
-    save = 0;
-    select = 0;
-    offset = Setting.rtc_aging_offset;
-    while (save == 0)
-    {
-        if (BTN_ReadSET() == 0)
-        {
-            if (select < 2)
-            {
-                select += 1;
-            }
-            else
-            {
-                select = 0;
-            }
-            wait_btn = 1;
-        }
-        else
-        {
-            switch (select)
-            {
-            case 0:
-                if (BTN_ReadUP() == 0)
-                {
-                    if (offset < 127)
-                    {
-                        offset += 1;
-                    }
-                    wait_btn = 1;
-                }
-                else if (BTN_ReadDOWN() == 0)
-                {
-                    if (offset > -127)
-                    {
-                        offset -= 1;
-                    }
-                    wait_btn = 1;
-                }
-                break;
-            case 1:
-                if (BTN_ReadUP() == 0)
-                {
-                    wait_btn = 0;
-                    update_display = 0;
-                    save = 2;
-                }
-                break;
-            case 2:
-                if (BTN_ReadUP() == 0)
-                {
-                    wait_btn = 0;
-                    update_display = 0;
-                    save = 1;
-                }
-                break;
-            }
-        }
-        if (wait_btn != 0)
-        {
-            update_display = 1;
-        }
-        if (update_display != 0)
-        {
-            if (EPD_GetBusy() == 0)
-            {
-                update_display = 0;
-                snprintf(String, sizeof(String), "偏移数值：%+04d", offset);
-                EPD_DrawUTF8(0, 4, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                EPD_DrawUTF8(0, 8, 1, "[每个偏移约为0.1ppm]", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                EPD_ClearArea(168, 4, 24, 3, 0xFF);
-                switch (select)
-                {
-                case 0:
-                    EPD_DrawUTF8(168, 4, 0, "◀", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                    break;
-                }
-
-                if (select == 1 || select == 2)
-                {
-                    Menu_DrawSubmenuSaveSelect(select - 1);
-                }
-                else
-                {
-                    Menu_DrawSubmenuSaveSelect(3);
-                }
+static void Info_DrawPage(uint8_t page) /* 绘制系统信息的附加页面，0：各阶段时间和刷新延迟统计，1：电量消耗估算，2：I2C总线统计，3：本次唤醒的等待统计 */
+{
+    uint8_t i, j;
+    uint16_t phase_ms[PROF_PHASE_COUNT];
+    uint32_t battery_stor;
+    float battery_voltage;
+    struct PROF_Stat stat;
+    struct I2C_Stat bus_stat;
+    struct WAIT_Stat wait_stat;
+    struct ENERGY_Result result;
 
-                EPD_Show(0);
-            }
-        }
-        if (save == 2)
+    for (i = 0; i < PROF_PHASE_COUNT; i++)
+    {
+        PROF_GetStat(i, &stat);
+        phase_ms[i] = stat.avg_ms;
+    }
+    battery_stor = BKPR_ReadDWORD(BKPR_ADDR_DWORD_ADCVAL); /* 使用上次屏幕刷新完成后的电量，与主界面一致 */
+    battery_voltage = *(float *)&battery_stor;
+    if (battery_voltage < 0.1 || battery_voltage > 3.6)
+    {
+        battery_voltage = ADC_GetChannel(ADC_CHANNEL_BATTERY);
+    }
+    ENERGY_Estimate(&ENERGY_DefaultModel, phase_ms, HOME_WAKES_PER_DAY, battery_voltage,
+                    BAT_MAX_VOLTAGE, Setting.battery_warn, Setting.battery_stop, &result);
+
+    for (j = 0; j < 2; j++) /* 局部刷新需要两个RAM都写入相同的数据 */
+    {
+        EPD_ClearArea(0, 4, 296, 12, 0xFF);
+        if (page == 0) /* 各阶段和刷新延迟分两列显示，每项为名称的前4个字符和最小/平均/最大值，字库中没有“最小”等汉字，使用英文 */
         {
-            Setting.rtc_aging_offset = offset;
-            RTC_ModifyAging(offset);
-            SaveSetting(&Setting);
+            EPD_DrawUTF8(0, 4, 0, "ms   MIN/ AVG/ MAX      MIN/ AVG/ MAX", EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            for (i = 0; i <= PROF_STAT_LATENCY; i++)
+            {
+                PROF_GetStat(i, &stat);
+                snprintf(String, sizeof(String), "%-4.4s%4u/%4u/%4u", i < PROF_PHASE_COUNT ? ProfPhaseName[i] : "LAT", stat.min_ms, stat.avg_ms, stat.max_ms);
+                EPD_DrawUTF8((i % 2) * 152, 6 + (i / 2) * 2, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            }
+            if (PROF_GetLatency() == 0xFFFF) /* 菜单唤醒时没有刷新主界面，只有统计值 */
+            {
+                snprintf(String, sizeof(String), "LAT: minute to refresh, last --");
+            }
+            else
+            {
+                snprintf(String, sizeof(String), "LAT: minute to refresh, last %u", PROF_GetLatency());
+            }
+            EPD_DrawUTF8(0, 14, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+        }
+        else if (page == 1) /* 字库中没有这些汉字，使用英文 */
+        {
+            snprintf(String, sizeof(String), "SAMPLES   : %u", PROF_GetCount());
+            EPD_DrawUTF8(0, 4, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            snprintf(String, sizeof(String), "PER WAKE  : %luuC", (unsigned long)(result.wake_uc + 0.5));
+            EPD_DrawUTF8(0, 6, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            snprintf(String, sizeof(String), "PER DAY   : %u.%03umAh", (uint16_t)result.daily_mah, (uint16_t)((result.daily_mah - (uint16_t)result.daily_mah) * 1000));
+            EPD_DrawUTF8(0, 8, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            snprintf(String, sizeof(String), "REMAINING : %umAh %u.%02uV", (uint16_t)result.remaining_mah, (uint8_t)battery_voltage, (uint8_t)((battery_voltage - (uint8_t)battery_voltage) * 100));
+            EPD_DrawUTF8(0, 10, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            snprintf(String, sizeof(String), "WARN IN   : %lu days", (unsigned long)result.days_to_warn);
+            EPD_DrawUTF8(0, 12, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            snprintf(String, sizeof(String), "RUNTIME   : %lu days", (unsigned long)result.days_to_stop);
+            EPD_DrawUTF8(0, 14, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+        }
+        else if (page == 2)
+        {
+            EPD_DrawUTF8(0, 4, 0, "I2C      NACK TOUT RCVR  CRC   MAX", EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            I2C_GetStat(RTC_I2C_ADDR, &bus_stat);
+            snprintf(String, sizeof(String), "DS3231   %4u %4u %4u %4u %4ums", bus_stat.nacks, bus_stat.timeouts, bus_stat.recoveries, bus_stat.crc_errors, bus_stat.max_ms);
+            EPD_DrawUTF8(0, 6, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            I2C_GetStat(TH_I2C_ADDR, &bus_stat);
+            snprintf(String, sizeof(String), "SHT30    %4u %4u %4u %4u %4ums", bus_stat.nacks, bus_stat.timeouts, bus_stat.recoveries, bus_stat.crc_errors, bus_stat.max_ms);
+            EPD_DrawUTF8(0, 8, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            EPD_DrawUTF8(0, 12, 0, "Kept in EEPROM: count<=255,", EPD_FontAscii_8x16, EPD_FontUTF8_16x16); /* 字库中没有这些汉字，使用英文 */
+            EPD_DrawUTF8(0, 14, 0, "cleared when erasing all data", EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+        }
+        else /* 等待统计在RAM中，只包括本次唤醒，分三列显示每个位置的最长等待时间和超时次数 */
+        {
+            EPD_DrawUTF8(0, 4, 0, "WAIT ms/TO  WAIT ms/TO  WAIT ms/TO", EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            for (i = 0; i < WAIT_SITE_COUNT; i++)
+            {
+                WAIT_GetStat(i, &wait_stat);
+                snprintf(String, sizeof(String), "%-4.4s%4u/%-2u", WaitSiteName[i], wait_stat.max_ms > 9999 ? 9999 : wait_stat.max_ms, wait_stat.timeouts > 99 ? 99 : wait_stat.timeouts);
+                EPD_DrawUTF8((i % 3) * 96, 6 + (i / 3) * 2, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+            }
         }
-        if (wait_btn != 0)
+        if (j == 0)
         {
-            wait_btn = 0;
-            BEEP_Button();
-            BTN_WaitAll();
+            EPD_Show(0);
+            LP_EnterStop(EPD_TIMEOUT_MS);
         }
     }
-    BEEP_OK();
+}
+
+static void Menu_SetRTCAging(void) /* 设置实时时钟老化偏移 */
+{
+    Menu_RunPage(&RTCAgingPage);
+}
+
+static void Page_LoadRTCAging(int16_t *values)
+{
+    values[0] = Setting.rtc_aging_offset;
+}
+
+static void Page_SaveRTCAging(const int16_t *values)
+{
+    Setting.rtc_aging_offset = (int8_t)values[0];
+    RTC_ModifyAging(Setting.rtc_aging_offset);
+    SaveSetting(&Setting);
 }
 
 static void Menu_ResetAll(void) /* 恢复初始设置 */
 {
     uint8_t select, save, update_display, wait_btn;
 
-    Menu_DrawMenuFrame("恢复设置", 1);
+    Menu_DrawMenuFrame(GlyphRun_ResetAll, 1);
     BTN_WaitAll();
     update_display = 1;
     wait_btn = 0;
     save = 0;
     select = 1;
-    while (save == 0)
+    while (save == 0 && Menu_Idle == 0)
     {
+        Menu_WaitEvent(update_display); /* 没有待刷新的内容时进入Stop模式等待事件 */
         if (BTN_ReadSET() == 0)
         {
             if (select < 1)
@@ -1762,10 +2062,10 @@ static void Menu_ResetAll(void) /* 恢复初始设置 */
             {
                 update_display = 0;
                 Menu_DrawSubmenuSaveSelect(2 - select);
-                EPD_DrawUTF8(0, 4, 0, "清除数据并恢复到初始设置", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                EPD_DrawUTF8(0, 10, 0, "*同时按住\"上\"和\"下\"键", EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
-                EPD_DrawUTF8(0, 12, 0, " 并按\"复位\"键", EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
-                EPD_DrawUTF8(0, 14, 0, " 可以强制擦除全部数据", EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+                EPD_DrawGlyphRun(0, 4, 0, GlyphRun_ResetHint, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+                EPD_DrawGlyphRun(0, 10, 0, GlyphRun_EraseHint1, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+                EPD_DrawGlyphRun(0, 12, 0, GlyphRun_EraseHint2, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
+                EPD_DrawGlyphRun(0, 14, 0, GlyphRun_EraseHint3, EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B);
                 EPD_Show(0);
             }
         }
@@ -1785,8 +2085,8 @@ static void Menu_ResetAll(void) /* 恢复初始设置 */
             }
             EPD_WaitBusy();
             EPD_ClearArea(0, 4, 296, 12, 0xFF);
-            EPD_DrawUTF8(0, 4, 0, "恢复完成", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-            EPD_DrawUTF8(0, 8, 0, "三秒后返回主菜单", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+            EPD_DrawGlyphRun(0, 4, 0, GlyphRun_ResetDone, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+            EPD_DrawGlyphRun(0, 8, 0, GlyphRun_ReturnHint, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
             EPD_Show(0);
             if (Setting.buzzer_enable != 0)
             {
@@ -1810,156 +2110,188 @@ static void Menu_ResetAll(void) /* 恢复初始设置 */
 
 static void Menu_SetHWVer(void) /* 设置硬件版本 */
 {
-    uint8_t select, save, update_display, wait_btn, hwver_1, hwver_2;
+    Menu_RunPage(&HWVerPage);
+}
+
+static void Page_LoadHWVer(int16_t *values)
+{
+    values[0] = 0;
+    values[1] = 0;
+}
+
+static void Page_SaveHWVer(const int16_t *values) /* 以ASCII字符保存，例如“1.0” */
+{
     uint32_t hwver_stor;
 
-    Menu_DrawMenuFrame("硬件版本设置", 0);
-    BTN_WaitAll();
-    update_display = 1;
-    wait_btn = 0;
-    save = 0;
-    select = 0;
-    hwver_1 = 0;
-    hwver_2 = 0;
-    while (save == 0)
+    hwver_stor = 0x00002E00;
+    hwver_stor |= (uint32_t)(values[1] + 48) << 16;
+    hwver_stor |= (values[0] + 48);
+    EEPROM_WriteDWORD(EEPROM_ADDR_DWORD_HWVERSION, hwver_stor);
+}
+
+static void Menu_SetAlarm(void) /* 闹钟设置，先选择闹钟位置，确认后修改该闹钟，之后返回选择页面 */
+{
+    Alarm_Slot = 0;
+    while (Menu_Idle == 0)
     {
-        if (BTN_ReadSET() == 0)
-        {
-            if (select < 3)
-            {
-                select += 1;
-            }
-            else
-            {
-                select = 0;
-            }
-            wait_btn = 1;
-        }
-        else
-        {
-            switch (select)
-            {
-            case 0:
-                if (BTN_ReadUP() == 0)
-                {
-                    if (hwver_1 < 9)
-                    {
-                        hwver_1 += 1;
-                    }
-                    wait_btn = 1;
-                }
-                else if (BTN_ReadDOWN() == 0)
-                {
-                    if (hwver_1 > 0)
-                    {
-                        hwver_1 -= 1;
-                    }
-                    wait_btn = 1;
-                }
-                break;
-            case 1:
-                if (BTN_ReadUP() == 0)
-                {
-                    if (hwver_2 < 9)
-                    {
-                        hwver_2 += 1;
-                    }
-                    wait_btn = 1;
-                }
-                else if (BTN_ReadDOWN() == 0)
-                {
-                    if (hwver_2 > 0)
-                    {
-                        hwver_2 -= 1;
-                    }
-                    wait_btn = 1;
-                }
-                break;
-            case 2:
-                if (BTN_ReadUP() == 0)
-                {
-                    wait_btn = 0;
-                    update_display = 0;
-                    save = 2;
-                }
-                break;
-            case 3:
-                if (BTN_ReadUP() == 0)
-                {
-                    wait_btn = 0;
-                    update_display = 0;
-                    save = 1;
-                }
-                break;
-            }
-        }
-        if (wait_btn != 0)
+        Alarm_Edit = 0;
+        Menu_RunPage(&AlarmSlotPage);
+        if (Alarm_Edit == 0) /* 选择页面中取消时退出 */
         {
-            update_display = 1;
+            break;
         }
-        if (update_display != 0)
-        {
-            if (EPD_GetBusy() == 0)
-            {
-                update_display = 0;
-                snprintf(String, sizeof(String), "硬件版本：V%d.%d", hwver_1, hwver_2);
-                EPD_DrawUTF8(0, 4, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                EPD_DrawUTF8(0, 8, 0, "[注意：设置保存后不会再", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                EPD_DrawUTF8(0, 12, 0, "显示此菜单]", EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
-                EPD_ClearArea(132, 7, 36, 1, 0xFF);
-                switch (select)
-                {
-                case 0:
-                    EPD_DrawImage(132, 7, EPD_Image_ArrowUp_12x8);
-                    break;
-                case 1:
-                    EPD_DrawImage(156, 7, EPD_Image_ArrowUp_12x8);
-                    break;
-                }
-                if (select == 2 || select == 3)
-                {
-                    Menu_DrawSubmenuSaveSelect(select - 2);
-                }
-                else
-                {
-                    Menu_DrawSubmenuSaveSelect(6);
-                }
+        Menu_RunPage(&AlarmPage);
+    }
+}
 
-                EPD_Show(0);
-            }
+static void Page_LoadAlarmSlot(int16_t *values)
+{
+    values[0] = Alarm_Slot + 1;
+}
+
+static void Page_SaveAlarmSlot(const int16_t *values) /* “保存”用于确认选择 */
+{
+    Alarm_Slot = values[0] - 1;
+    Alarm_Edit = 1;
+}
+
+static void Page_DrawAlarmSlotInfo(const int16_t *values) /* 所选闹钟的当前设置 */
+{
+    char param[16];
+    struct ALARM_Entry entry;
+
+    ALARM_Read(values[0] - 1, &entry);
+    if (entry.type == ALARM_TYPE_NONE)
+    {
+        snprintf(String, sizeof(String), "%-24s", AlarmTypeName[ALARM_TYPE_NONE]);
+    }
+    else
+    {
+        Alarm_FormatParam(param, sizeof(param), &entry);
+        snprintf(String, sizeof(String), "%02u:%02u %-7s %-10s", entry.hours, entry.minutes, AlarmTypeName[entry.type], param);
+    }
+    EPD_DrawUTF8(0, 8, 0, String, EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B);
+}
+
+static void Page_LoadAlarm(int16_t *values)
+{
+    struct ALARM_Entry entry;
+
+    ALARM_Read(Alarm_Slot, &entry);
+    RTC_GetTime(&Time);
+    values[0] = entry.type;
+    values[1] = entry.hours;
+    values[2] = entry.minutes;
+    values[3] = Time.Date; /* 没有日期参数的闹钟默认使用今天，改为一次性闹钟时不需要从头修改 */
+    values[4] = Time.Month;
+    values[5] = Time.Year % 100;
+    switch (entry.type)
+    {
+    case ALARM_TYPE_ONCE:
+        values[3] = entry.date;
+        values[4] = entry.month;
+        values[5] = entry.year % 100;
+        break;
+    case ALARM_TYPE_WEEKDAY:
+        values[3] = entry.days >> 1;
+        break;
+    case ALARM_TYPE_LUNAR:
+        values[3] = entry.date;
+        values[4] = entry.month;
+        break;
+    }
+}
+
+static void Page_SaveAlarm(const int16_t *values) /* 保存后立即重新设置闹钟1 */
+{
+    struct ALARM_Entry entry;
+
+    Alarm_FromValues(values, &entry);
+    ALARM_Write(Alarm_Slot, &entry);
+    RTC_GetTime(&Time);
+    ALARM_Schedule(&Time);
+}
+
+static void Page_DrawAlarmInfo(const int16_t *values) /* 类型名称和按类型解释后的日期参数 */
+{
+    char param[16];
+    struct ALARM_Entry entry;
+
+    Alarm_FromValues(values, &entry);
+    Alarm_FormatParam(param, sizeof(param), &entry);
+    snprintf(String, sizeof(String), "%-20s", AlarmTypeName[entry.type]);
+    EPD_DrawUTF8(132, 4, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+    snprintf(String, sizeof(String), "%-20s", param);
+    EPD_DrawUTF8(132, 6, 0, String, EPD_FontAscii_8x16, EPD_FontUTF8_16x16);
+}
+
+static void Alarm_FromValues(const int16_t *values, struct ALARM_Entry *entry) /* 按类型将页面数值转换为闹钟，超出范围的日期修正到有效值 */
+{
+    uint8_t max_date;
+
+    memset(entry, 0, sizeof(struct ALARM_Entry));
+    entry->type = values[0];
+    entry->hours = values[1];
+    entry->minutes = values[2];
+    switch (entry->type)
+    {
+    case ALARM_TYPE_ONCE:
+        entry->month = values[4] < 1 ? 1 : values[4];
+        entry->year = values[5];
+        max_date = EPOCH_GetMonthDays(entry->year, entry->month);
+        entry->date = values[3] < 1 ? 1 : (values[3] > max_date ? max_date : values[3]);
+        break;
+    case ALARM_TYPE_WEEKDAY:
+        entry->days = (values[3] << 1) & 0xFE; /* 第n位为星期n，页面中的数值从星期一开始 */
+        break;
+    case ALARM_TYPE_LUNAR:
+        entry->month = values[4];
+        entry->date = values[3] < 1 ? 1 : (values[3] > 30 ? 30 : values[3]);
+        break;
+    }
+}
+
+static void Alarm_FormatParam(char *text, uint8_t size, const struct ALARM_Entry *entry) /* 日期参数的文字，例如“2026-10-18”、“MTWTF--”或农历“08/15”，每月时月份显示为** */
+{
+    uint8_t i;
+
+    text[0] = '\0';
+    switch (entry->type)
+    {
+    case ALARM_TYPE_ONCE:
+        snprintf(text, size, "%04u-%02u-%02u", 2000 + entry->year, entry->month, entry->date);
+        break;
+    case ALARM_TYPE_WEEKDAY:
+        for (i = 0; i < 7 && i + 1 < size; i++)
+        {
+            text[i] = (entry->days & (1 << (i + 1))) != 0 ? "MTWTFSS"[i] : '-';
+            text[i + 1] = '\0';
         }
-        if (save == 2)
+        break;
+    case ALARM_TYPE_LUNAR:
+        if (entry->month == 0)
         {
-            hwver_stor = 0x00002E00;
-            hwver_stor |= (hwver_2 + 48) << 16;
-            hwver_stor |= (hwver_1 + 48);
-            EEPROM_WriteDWORD(EEPROM_ADDR_DWORD_HWVERSION, hwver_stor);
+            snprintf(text, size, "**/%02u", entry->date);
         }
-        if (wait_btn != 0)
+        else
         {
-            wait_btn = 0;
-            BEEP_Button();
-            BTN_WaitAll();
+            snprintf(text, size, "%02u/%02u", entry->month, entry->date);
         }
+        break;
     }
-    BEEP_OK();
 }
 
 /* ==================== 电池图标绘制 ==================== */
 
-static void EPD_DrawBattery(uint16_t x, uint8_t y_x8, float max_voltage, float min_voltage, float voltage)
+static uint8_t GetBatteryLevel(float max_voltage, float min_voltage, float voltage) /* 计算电池图标填充格数，返回0表示显示电量警告 */
 {
-    uint8_t dis_ram[sizeof(EPD_Image_BattWarn)];
-    uint8_t i, bar_size, bar_size_max, bar_end_pos;
+    uint8_t bar_size, bar_size_max;
 
     if ((voltage < min_voltage) || ((max_voltage - min_voltage) < 0.001))
     {
-        EPD_DrawImage(x, y_x8, EPD_Image_BattWarn);
-        return;
+        return 0;
     }
-    memcpy(dis_ram, EPD_Image_BattWarn, sizeof(dis_ram));
-    bar_end_pos = (dis_ram[2] / 8) * (dis_ram[0] - 5) + 3;
-    bar_size_max = dis_ram[0] - 12;
+    bar_size_max = EPD_Image_BattWarn[0] - 12;
     if (voltage < max_voltage)
     {
         voltage -= min_voltage;
@@ -1977,6 +2309,22 @@ static void EPD_DrawBattery(uint16_t x, uint8_t y_x8, float max_voltage, float m
     {
         bar_size = bar_size_max;
     }
+    return bar_size;
+}
+
+static void EPD_DrawBattery(uint16_t x, uint8_t y_x8, uint8_t bar_size)
+{
+    uint8_t dis_ram[sizeof(EPD_Image_BattWarn)];
+    uint8_t i, bar_size_max, bar_end_pos;
+
+    if (bar_size == 0)
+    {
+        EPD_DrawImage(x, y_x8, EPD_Image_BattWarn);
+        return;
+    }
+    memcpy(dis_ram, EPD_Image_BattWarn, sizeof(dis_ram));
+    bar_end_pos = (dis_ram[2] / 8) * (dis_ram[0] - 5) + 3;
+    bar_size_max = dis_ram[0] - 12;
     for (i = 0; i < bar_size_max; i++) /* 清空电池图标内部 */
     {
         dis_ram[bar_end_pos - (i * 3) + 0] |= 0x07;
@@ -2028,122 +2376,143 @@ static void ReadSetting(struct Func_Setting *setting)
     }
 }
 
+static void SaveBusStat(uint8_t addr, uint16_t word_addr) /* 将一个从机的I2C统计存入EEPROM，数据相同的WORD跳过，正常时每次唤醒都不需要擦写 */
+{
+    uint8_t i;
+    uint16_t words[3];
+    struct I2C_Stat stat;
+
+    I2C_GetStat(addr, &stat);
+    words[0] = stat.nacks | (uint16_t)stat.timeouts << 8;
+    words[1] = stat.recoveries | (uint16_t)stat.crc_errors << 8;
+    words[2] = stat.max_ms;
+    for (i = 0; i < 3; i++)
+    {
+        if (EEPROM_ReadWORD(word_addr + i) != words[i])
+        {
+            EEPROM_WriteWORD(word_addr + i, words[i]);
+        }
+    }
+}
+
+static void ReadBusStat(uint8_t addr, uint16_t word_addr) /* 从EEPROM恢复一个从机的I2C统计 */
+{
+    uint16_t word;
+    struct I2C_Stat stat;
+
+    stat.addr = addr;
+    word = EEPROM_ReadWORD(word_addr);
+    stat.nacks = word & 0xFF;
+    stat.timeouts = word >> 8;
+    word = EEPROM_ReadWORD(word_addr + 1);
+    stat.recoveries = word & 0xFF;
+    stat.crc_errors = word >> 8;
+    stat.max_ms = EEPROM_ReadWORD(word_addr + 2);
+    I2C_SetStat(&stat);
+}
+
 /* ==================== 按键读取 ==================== */
 
-static uint8_t BTN_ReadUP(void)
+static void BTN_Update(void) /* 取出所有按钮事件，按下和连发记为一次点击 */
 {
-    if (LL_GPIO_IsInputPinSet(BTN_UP_GPIO_Port, BTN_UP_Pin) == 0)
+    struct BUTTON_Event event;
+
+    while (BUTTON_GetEvent(&event) == 0)
     {
-        LL_mDelay(BTN_DEBOUNCE_MS);
-        if (LL_GPIO_IsInputPinSet(BTN_UP_GPIO_Port, BTN_UP_Pin) == 0)
+        EVENT_ResetIdle();
+        if (event.type == BUTTON_EVENT_PRESS || event.type == BUTTON_EVENT_REPEAT)
         {
-            return 0;
+            BTN_Clicked |= 1 << event.button;
         }
     }
-    return 1;
 }
 
-static uint8_t BTN_ReadUPFast(void)
+static uint8_t BTN_ReadClick(uint8_t button) /* 读取并清除一次点击，不等待 */
 {
-    if (LL_GPIO_IsInputPinSet(BTN_UP_GPIO_Port, BTN_UP_Pin) == 0)
+    BTN_Update();
+    if ((BTN_Clicked & (1 << button)) != 0)
     {
+        BTN_Clicked &= ~(1 << button);
         return 0;
     }
     return 1;
 }
 
+static uint8_t BTN_ReadUP(void)
+{
+    return BTN_ReadClick(BUTTON_UP);
+}
+
 static uint8_t BTN_ReadDOWN(void)
 {
-    if (LL_GPIO_IsInputPinSet(BTN_DOWN_GPIO_Port, BTN_DOWN_Pin) == 0)
-    {
-        LL_mDelay(BTN_DEBOUNCE_MS);
-        if (LL_GPIO_IsInputPinSet(BTN_DOWN_GPIO_Port, BTN_DOWN_Pin) == 0)
-        {
-            return 0;
-        }
-    }
-    return 1;
+    return BTN_ReadClick(BUTTON_DOWN);
 }
 
 static uint8_t BTN_ReadSET(void)
 {
-    if (LL_GPIO_IsInputPinSet(BTN_SET_GPIO_Port, BTN_SET_Pin) == 0)
-    {
-        LL_mDelay(BTN_DEBOUNCE_MS);
-        if (LL_GPIO_IsInputPinSet(BTN_SET_GPIO_Port, BTN_SET_Pin) == 0)
-        {
-            return 0;
-        }
-    }
-    return 1;
+    return BTN_ReadClick(BUTTON_SET);
 }
 
 static void BTN_WaitSET(void)
 {
-    while (1)
+    struct BUTTON_Event event;
+
+    BUTTON_Poll();
+    while (BUTTON_IsPressed(BUTTON_SET) != 0)
     {
-        if (LL_GPIO_IsInputPinSet(BTN_SET_GPIO_Port, BTN_SET_Pin) != 0)
-        {
-            LL_mDelay(BTN_DEBOUNCE_MS);
-            if (LL_GPIO_IsInputPinSet(BTN_SET_GPIO_Port, BTN_SET_Pin) != 0)
-            {
-                return;
-            }
-        }
+        BUTTON_WaitEvent(&event, 0); /* 在Stop模式中等待 */
     }
+    BTN_Clicked = 0;
 }
 
-static void BTN_WaitAll(void)
+static uint8_t BTN_WaitAll(void) /* 等待所有按钮释放，“上”和“下”按住时收到连发事件也返回，用于快速修改数值，返回1表示连发 */
 {
-    while (1)
+    struct BUTTON_Event event;
+
+    BTN_Clicked = 0;
+    BUTTON_Poll();
+    while (BUTTON_IsAnyPressed() != 0)
     {
-        if (LL_GPIO_IsInputPinSet(BTN_SET_GPIO_Port, BTN_SET_Pin) != 0 &&
-            LL_GPIO_IsInputPinSet(BTN_UP_GPIO_Port, BTN_UP_Pin) != 0 &&
-            LL_GPIO_IsInputPinSet(BTN_DOWN_GPIO_Port, BTN_DOWN_Pin) != 0)
+        if (BUTTON_WaitEvent(&event, 0) == 0 && event.type == BUTTON_EVENT_REPEAT)
         {
-            LL_mDelay(BTN_DEBOUNCE_MS);
-            if (LL_GPIO_IsInputPinSet(BTN_SET_GPIO_Port, BTN_SET_Pin) != 0 &&
-                LL_GPIO_IsInputPinSet(BTN_UP_GPIO_Port, BTN_UP_Pin) != 0 &&
-                LL_GPIO_IsInputPinSet(BTN_DOWN_GPIO_Port, BTN_DOWN_Pin) != 0)
-            {
-                return;
-            }
+            BTN_Clicked |= 1 << event.button;
+            return 1;
         }
     }
+    BTN_Clicked = 0;
+    return 0;
 }
 
 static uint8_t BTN_ModifySingleDigit(uint8_t *number, uint8_t modify_digit, uint8_t max_val, uint8_t min_val)
 {
-    double pow_tmp;
+    static const uint8_t pow10[3] = {1, 10, 100};
     uint8_t digit_value;
 
     if (BTN_ReadUP() == 0)
     {
-        pow_tmp = pow(10, modify_digit);
-        digit_value = (uint32_t)(*number / pow_tmp) % 10;
+        digit_value = (*number / pow10[modify_digit]) % 10;
         if (digit_value < max_val)
         {
-            *number += (uint32_t)pow_tmp;
+            *number += pow10[modify_digit];
         }
         else
         {
-            *number -= (uint32_t)pow_tmp * digit_value;
-            *number += (uint32_t)pow_tmp * min_val;
+            *number -= pow10[modify_digit] * digit_value;
+            *number += pow10[modify_digit] * min_val;
         }
         return 1;
     }
     else if (BTN_ReadDOWN() == 0)
     {
-        pow_tmp = pow(10, modify_digit);
-        digit_value = (uint32_t)(*number / pow_tmp) % 10;
+        digit_value = (*number / pow10[modify_digit]) % 10;
         if (digit_value > min_val)
         {
-            *number -= (uint32_t)pow_tmp;
+            *number -= pow10[modify_digit];
         }
         else
         {
-            *number -= (uint32_t)pow_tmp * digit_value;
-            *number += (uint32_t)pow_tmp * max_val;
+            *number -= pow10[modify_digit] * digit_value;
+            *number += pow10[modify_digit] * max_val;
         }
         return 1;
     }
@@ -2193,7 +2562,7 @@ static void Power_EnableGDEH029A1(void)
     LL_GPIO_SetOutputPin(EPD_CS_PORT, EPD_CS_PIN);
     LL_GPIO_SetOutputPin(EPD_DC_PORT, EPD_DC_PIN);
     LL_GPIO_SetOutputPin(EPD_RST_PORT, EPD_RST_PIN);
-    Delay_100ns(100); /* 10us，未要求，短暂延时 */
+    WAIT_DelayUs(10); /* 未要求，短暂延时 */
     if (LL_SPI_IsEnabled(SPI1) == 0)
     {
         LL_SPI_Enable(SPI1);
@@ -2205,9 +2574,9 @@ static void Power_Enable_SHT30_I2C(void)
     LL_GPIO_ResetOutputPin(SHT30_POWER_GPIO_Port, SHT30_POWER_Pin); /* 打开SHT30电源 */
     LL_GPIO_SetOutputPin(I2C1_PULLUP_GPIO_Port, I2C1_PULLUP_Pin);   /* 打开I2C上拉电阻 */
     LL_GPIO_SetOutputPin(SHT30_RST_GPIO_Port, SHT30_RST_Pin);       /* 释放SHT30复位引脚 */
-    Delay_100ns(20);                                                /* 最少1us宽度，设置为2us */
+    WAIT_DelayUs(2);                                                /* 最少1us宽度，设置为2us */
     LL_GPIO_ResetOutputPin(SHT30_RST_GPIO_Port, SHT30_RST_Pin);     /* SHT30硬复位 */
-    Delay_100ns(20);                                                /* 最少1us宽度，设置为2us */
+    WAIT_DelayUs(2);                                                /* 最少1us宽度，设置为2us */
     LL_GPIO_SetOutputPin(SHT30_RST_GPIO_Port, SHT30_RST_Pin);       /* SHT30硬复位 */
     LL_mDelay(1);                                                   /* SHT30复位后需要最少1ms启动时间，设置为2ms */
     if (LL_I2C_IsEnabled(I2C1) == 0)                                /* 打开I2C */
@@ -2216,15 +2585,23 @@ static void Power_Enable_SHT30_I2C(void)
     }
 }
 
-static uint8_t Power_EnableADC(void)
+static uint8_t Power_EnableADC(void) /* 第一次使用时初始化ADC，从Standby唤醒后时钟为关闭状态 */
 {
+    if (LL_APB2_GRP1_IsEnabledClock(LL_APB2_GRP1_PERIPH_ADC1) == 0)
+    {
+        MX_ADC_Init();
+    }
     ADC_Disable();
     ADC_StartCal();
     return ADC_Enable();
 }
 
-static void Power_EnableBUZZER(void)
+static void Power_EnableBUZZER(void) /* 第一次使用时初始化蜂鸣器定时器 */
 {
+    if (LL_APB1_GRP1_IsEnabledClock(LL_APB1_GRP1_PERIPH_TIM2) == 0)
+    {
+        MX_TIM2_Init();
+    }
     BUZZER_Enable();
 }
 
@@ -2261,6 +2638,11 @@ static void Power_DisableBUZZER(void)
     BUZZER_Disable();
 }
 
+static void Power_EnableUSART(void) /* 初始化并打开串口，调试输出前调用 */
+{
+    MX_USART1_UART_Init();
+}
+
 static void Power_DisableUSART(void) /* 关闭串口，下次使用需要重新初始化 */
 {
     LL_USART_Disable(SERIAL_NUM);
@@ -2277,6 +2659,7 @@ static void DumpRTCReg(void)
     uint8_t i, j, reg_tmp;
     char byte_str[9];
 
+    Power_EnableUSART(); /* 串口只在输出时打开 */
     SERIAL_SendStringRN("");
     SERIAL_SendStringRN("DS3231 REG DUMP:");
     for (i = 0; i < 19; i++)
@@ -2300,6 +2683,7 @@ static void DumpRTCReg(void)
     }
     SERIAL_SendStringRN("DS3231 REG DUMP END");
     SERIAL_SendStringRN("");
+    Power_DisableUSART();
 }
 
 static void DumpEEPROM(void)
@@ -2307,6 +2691,7 @@ static void DumpEEPROM(void)
     uint16_t i;
     char str_buffer[10];
 
+    Power_EnableUSART();
     SERIAL_SendStringRN("");
     SERIAL_SendStringRN("EEPROM DUMP:");
     SERIAL_SendStringRN("INDEX:    00   01   02   03   04   05   06   07   08   09   0A   0B   0C   0D   0E   0F");
@@ -2327,6 +2712,7 @@ static void DumpEEPROM(void)
     SERIAL_SendStringRN("");
     SERIAL_SendStringRN("EEPROM DUMP END");
     SERIAL_SendStringRN("");
+    Power_DisableUSART();
 }
 
 static void DumpBKPR(void)
@@ -2334,6 +2720,7 @@ static void DumpBKPR(void)
     uint16_t i;
     char str_buffer[10];
 
+    Power_EnableUSART();
     SERIAL_SendStringRN("");
     SERIAL_SendStringRN("BKPR DUMP:");
     SERIAL_SendStringRN("INDEX:    00   01   02   03   04   05   06   07   08   09   0A   0B   0C   0D   0E   0F");
@@ -2354,4 +2741,33 @@ static void DumpBKPR(void)
     SERIAL_SendStringRN("");
     SERIAL_SendStringRN("BKPR DUMP END");
     SERIAL_SendStringRN("");
+    Power_DisableUSART();
+}
+
+static void DumpProfile(void)
+{
+    uint8_t i;
+    struct PROF_Stat stat;
+    char str_buffer[48];
+
+    Power_EnableUSART();
+    SERIAL_SendStringRN("");
+    SERIAL_SendStringRN("PROFILE DUMP:");
+    snprintf(str_buffer, sizeof(str_buffer), "COUNT: %u", PROF_GetCount());
+    SERIAL_SendStringRN(str_buffer);
+    snprintf(str_buffer, sizeof(str_buffer), "STARTUP: %u", PROF_GetStartup()); /* 从Init()到第一次SPI通信 */
+    SERIAL_SendStringRN(str_buffer);
+    SERIAL_SendStringRN("PHASE     LAST   MIN   AVG   MAX (ms)");
+    for (i = 0; i < PROF_PHASE_COUNT; i++)
+    {
+        PROF_GetStat(i, &stat);
+        snprintf(str_buffer, sizeof(str_buffer), "%-7s %6u %5u %5u %5u", ProfPhaseName[i], PROF_GetLast(i), stat.min_ms, stat.avg_ms, stat.max_ms);
+        SERIAL_SendStringRN(str_buffer);
+    }
+    PROF_GetStat(PROF_STAT_LATENCY, &stat);
+    snprintf(str_buffer, sizeof(str_buffer), "%-7s %6u %5u %5u %5u", "LATENCY", PROF_GetLatency(), stat.min_ms, stat.avg_ms, stat.max_ms); /* 从整分钟到开始刷新 */
+    SERIAL_SendStringRN(str_buffer);
+    SERIAL_SendStringRN("PROFILE DUMP END");
+    SERIAL_SendStringRN("");
+    Power_DisableUSART();
 }
@@ -4,6 +4,9 @@
 #include "main.h"
 
 #include "lowpower.h"
+#include "wait.h"
+#include "button.h"
+#include "event.h"
 #include "analog.h"
 #include "bkpr.h"
 #include "eeprom.h"
@@ -12,24 +15,54 @@
 #include "ds3231.h"
 #include "sht30.h"
 #include "gdeh029A1.h"
+#include "glyphrun.h"
+#include "packimage.h"
 #include "buzzer.h"
 #include "lunar.h"
+#include "prof.h"
+#include "energy.h"
+#include "epoch.h"
+#include "task.h"
+#include "alarm.h"
 
 /* 可修改 */
 #define SOFT_VERSION "L051_1.05_MELANTHA"
-#define BTN_DEBOUNCE_MS 24
+#define MENU_IDLE_TIMEOUT_S 60 /* 菜单无操作超过此时间后返回主界面 */
 #define BAT_MIN_VOLTAGE 0.80
 #define BAT_MAX_VOLTAGE 3.00
+#define BAT_SAMPLE_INTERVAL_MIN 10 /* 闹钟唤醒时每隔多少分钟测量一次电池电压，其他时间使用备份寄存器中的上次结果 */
+#define HOME_PRERENDER_LEAD_S 0    /* 闹钟1在整分钟前多少秒唤醒，提前发送下一分钟的画面，整分钟时立即刷新，0为不使用，最大20，有闹钟时不使用 */
+#define ALARM_RING_S 60            /* 闹钟响铃时间，无操作时到时自动关闭 */
 /* 结束 */
 
 #define BKPR_ADDR_DWORD_ADCVAL 0x00
 #define BKPR_ADDR_BYTE_REQINIT 0x04
+#define BKPR_ADDR_DWORD_HOMESTATE_TIME 0x02
+#define BKPR_ADDR_DWORD_HOMESTATE_VALUE 0x03
+#define BKPR_ADDR_BYTE_BATLOW 0x07 /* 低电量画面已显示标志 */
 
 #define EEPROM_ADDR_BYTE_SETTING 0x00
 #define EEPROM_ADDR_DWORD_HWVERSION 0x01FF
+#define EEPROM_ADDR_WORD_BUSSTAT_RTC 0x0220 /* 实时时钟的I2C统计，在PROF统计之后，占用3个WORD */
+#define EEPROM_ADDR_WORD_BUSSTAT_TH 0x0224  /* 温湿度传感器的I2C统计，占用3个WORD */
 
 #define REQUEST_RESET_ALL_FLAG 0x55
 #define SETTING_AVALIABLE_FLAG 0xAA
+#define BATTERY_LOW_SHOWN_FLAG 0xAA
+#define HOME_STATE_VALID 0x80000000
+
+#define HOME_AREA_DATE 0 /* 主界面上各部分的区域编号，同时是变化标志的位号 */
+#define HOME_AREA_BATTERY 1
+#define HOME_AREA_HOUR 2
+#define HOME_AREA_MINUTE 3
+#define HOME_AREA_TEMP 4
+#define HOME_AREA_RH 5
+#define HOME_AREA_LUNAR 6
+#define HOME_AREA_COUNT 7
+
+#define HOME_WAKES_PER_DAY (24 * 60) /* 闹钟2每分钟唤醒一次并更新主界面 */
+
+#define HOME_PRERENDER_MARGIN_MS 100 /* 提前唤醒时在此余量加上剩余时间的1/8之前结束Stop模式，覆盖低功耗定时器的误差，之后最多连续读取闹钟2标志2倍余量的时间 */
 
 struct Func_Setting
 {
@@ -44,6 +77,78 @@ struct Func_Setting
     int8_t rtc_aging_offset;
 };
 
+struct Home_State
+{
+    struct RTC_Time time;  /* 不包括秒 */
+    int16_t temp_x10;      /* 温度乘10 */
+    uint16_t rh_x10;       /* 湿度乘10 */
+    uint8_t battery_level; /* 电池图标填充格数，0为电量警告 */
+};
+
+struct Home_Area
+{
+    uint16_t x;
+    uint8_t y_x8;
+    uint16_t x_size;
+    uint8_t y_size_x8;
+};
+
+struct Home_Wake
+{
+    struct Home_State state;
+    struct Home_State last_state;
+    float battery_voltage;
+    uint8_t partial;      /* 是否使用局部刷新 */
+    uint8_t dirty;        /* 有变化的区域 */
+    uint8_t sensor_ready; /* 温湿度测量已完成 */
+    uint8_t battery_due;  /* 本次唤醒需要测量电池电压 */
+    uint8_t prerender;    /* 由闹钟1提前唤醒，显示下一分钟并等到整分钟再刷新 */
+    uint16_t wake_tick;   /* 读取时间时的低功耗定时器计数值 */
+    uint16_t boundary_ms; /* 读取时间时距离整分钟的时间 */
+};
+
+#define MENU_FIELD_LABEL 0  /* 只显示标签，不能选择 */
+#define MENU_FIELD_NUMBER 1 /* 定点数，按小数位数放大后以整数保存 */
+#define MENU_FIELD_SWITCH 2 /* 开关，显示“开启”或“关闭” */
+
+#define MENU_CURSOR_SELECT 0 /* 在光标位置显示“◀” */
+#define MENU_CURSOR_ARROW 1  /* 在光标位置的下方显示向上箭头 */
+
+#define MENU_FIELD_MAX 6       /* 设置页面最多的项目数，包括只显示标签的项目，同时是重绘标志的位号，不能超过6 */
+#define MENU_REDRAW_INFO 0x40  /* 重绘附加信息 */
+#define MENU_REDRAW_LABEL 0x80 /* 重绘全部标签 */
+
+struct Menu_Field /* 设置页面的一个项目，进入页面时绘制标签，之后只重绘数值 */
+{
+    const uint8_t *label; /* 标签字形串，NULL为没有标签 */
+    uint16_t label_x;
+    uint8_t y_x8;      /* 标签和数值所在的行 */
+    uint8_t gap;       /* 标签的字符间距 */
+    uint8_t type;      /* MENU_FIELD_xxx */
+    uint16_t value_x;  /* 数值的位置，数值宽度固定，直接覆盖旧内容 */
+    uint8_t digits;    /* 整数部分的位数，不足时补0 */
+    uint8_t scale;     /* 小数位数 */
+    uint8_t sign;      /* 1：正数也显示符号 */
+    const char *unit;  /* 数值后面的单位 */
+    int16_t min;       /* 放大后的最小值 */
+    int16_t max;       /* 放大后的最大值 */
+    int16_t step;      /* 每次按键的变化量 */
+    uint8_t cursor;    /* MENU_CURSOR_xxx */
+    uint16_t cursor_x;
+};
+
+struct Menu_Page /* 设置页面，由Menu_RunPage()执行 */
+{
+    const uint8_t *title;
+    const struct Menu_Field *fields;
+    uint8_t field_count;
+    uint8_t info_on_change;                   /* 1：数值变化时重绘附加信息，否则只在进入页面和每分钟重绘 */
+    void (*load)(int16_t *values);            /* 读取设置，按项目顺序放大为整数 */
+    void (*apply)(const int16_t *values);     /* 数值变化后立即生效，取消时使用原值再调用一次，NULL为不需要 */
+    void (*save)(const int16_t *values);      /* 保存设置 */
+    void (*draw_info)(const int16_t *values); /* 绘制附加信息，NULL为没有 */
+};
+
 void Init(void);
 void Loop(void);
 
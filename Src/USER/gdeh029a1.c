@@ -1,4 +1,7 @@
 #include "gdeh029a1.h"
+#include "lowpower.h"
+#include "wait.h"
+#include <string.h>
 
 /* 全屏刷新LUT */
 static const uint8_t LUT_Full[30] = {
@@ -30,61 +33,119 @@ static const uint8_t LUT_Fast[30] = {
     0x00, 0x00, 0x00, 0x00, 0x77,
     0x17, 0x77, 0x77, 0x77, 0x77};
 
+/* 初始化命令表，格式为：命令, 参数大小, 参数... */
+static const uint8_t CMD_Init[] = {
+    0x01, 3, 0x27, 0x01, 0x00, /* 驱动输出控制 */
+    0x0C, 3, 0xD7, 0xD6, 0x9D, /* 升压软启动控制 */
+    0x11, 1, 0x01,             /* 数据输入模式 */
+    0x2C, 1, 0x9A,             /* VCOM */
+    0x3A, 1, 0x1A,             /* 虚拟行周期 */
+    0x3B, 1, 0x08,             /* 门线宽度 */
+    0x3C, 1, 0x33};            /* 边框波形 */
+
+/* 更新显示命令表，更新完成后自动关闭DC-DC转换器 */
+static const uint8_t CMD_Show[] = {
+    0x22, 1, 0xC6,
+    0x20, 0};
+
+/* 关闭DC-DC转换器命令表 */
+static const uint8_t CMD_Sleep[] = {
+    0x22, 1, 0x02,
+    0x20, 0};
+
+/* 关闭DC-DC转换器和时钟命令表 */
+static const uint8_t CMD_DeepSleepPowerOff[] = {
+    0x22, 1, 0x03,
+    0x20, 0};
+
+#ifdef EPD_USE_FRAMEBUFFER
+/* 帧缓冲，按控制器RAM顺序存放：每列16字节，下标为 x * 16 + y_x8 */
+static uint8_t FrameBuffer[EPD_FRAME_SIZE];
+static uint8_t FrameActive;
+
+/* 当前绘制块的窗口和写入位置，BlockShift为块在Y方向相对字节的像素偏移 */
+static uint16_t BlockX, BlockXEnd;
+static uint8_t BlockY, BlockYStart, BlockYEnd, BlockShift;
+static uint8_t RasterOp;
+#endif
+
 /**
- * @brief  延时100ns的倍数（不准确，只是大概）。
- * @param  nsX100 延时时间。
+ * @brief  使用DMA通过硬件SPI发送指定大小的数据，传输期间CPU进入Sleep模式。
+ * @param  tx_data 要发送数据的指针。
+ * @param  data_size 要发送数据的大小。
+ * @param  repeat 0：依次发送数据，1：重复发送tx_data指向的第一个字节。
+ * @return 1：传输超时或出错，0：DMA传输完成。
+ * @note   返回时最后的数据可能还在SPI移位寄存器中，需要等待SPI空闲。
+ * @note   DMA在Stop模式下不工作，所以只能使用Sleep模式等待。
  */
-static void delay_100ns(volatile uint16_t nsX100)
+static uint8_t spi_send_data_dma(const uint8_t *tx_data, uint16_t data_size, uint8_t repeat)
 {
-    while (nsX100)
+    uint8_t ret;
+
+    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+    LL_DMA_ConfigTransfer(EPD_DMA, EPD_DMA_CHANNEL,
+                          LL_DMA_DIRECTION_MEMORY_TO_PERIPH | LL_DMA_PRIORITY_LOW | LL_DMA_MODE_NORMAL |
+                              LL_DMA_PERIPH_NOINCREMENT | (repeat ? LL_DMA_MEMORY_NOINCREMENT : LL_DMA_MEMORY_INCREMENT) |
+                              LL_DMA_PDATAALIGN_BYTE | LL_DMA_MDATAALIGN_BYTE);
+    LL_DMA_SetPeriphRequest(EPD_DMA, EPD_DMA_CHANNEL, EPD_DMA_REQUEST);
+    LL_DMA_ConfigAddresses(EPD_DMA, EPD_DMA_CHANNEL, (uint32_t)tx_data, LL_SPI_DMA_GetRegAddr(EPD_SPI), LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+    LL_DMA_SetDataLength(EPD_DMA, EPD_DMA_CHANNEL, data_size);
+    LL_DMA_EnableIT_TC(EPD_DMA, EPD_DMA_CHANNEL);
+    LL_DMA_EnableIT_TE(EPD_DMA, EPD_DMA_CHANNEL);
+    LL_DMA_EnableChannel(EPD_DMA, EPD_DMA_CHANNEL);
+    LL_SPI_EnableDMAReq_TX(EPD_SPI); /* 开始传输 */
+
+    LP_EnterSleepIRQ(EPD_DMA_IRQ, SPI_TIMEOUT_MS); /* 由DMA传输完成或出错中断唤醒，超时由低功耗定时器唤醒 */
+
+    ret = 0;
+    if (LL_DMA_GetDataLength(EPD_DMA, EPD_DMA_CHANNEL) != 0) /* 未全部传输 */
     {
-        nsX100--;
+        ret = 1;
     }
-    ((void)nsX100);
+    LL_SPI_DisableDMAReq_TX(EPD_SPI);
+    LL_DMA_DisableChannel(EPD_DMA, EPD_DMA_CHANNEL);
+    LL_DMA_DisableIT_TC(EPD_DMA, EPD_DMA_CHANNEL);
+    LL_DMA_DisableIT_TE(EPD_DMA, EPD_DMA_CHANNEL);
+    WRITE_REG(EPD_DMA->IFCR, DMA_IFCR_CGIF1 << ((EPD_DMA_CHANNEL - 1) * 4)); /* 清除该通道全部中断标志 */
+    LL_AHB1_GRP1_DisableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+    return ret;
 }
 
 /**
  * @brief  使用硬件SPI发送指定大小的数据。
  * @param  tx_data 要发送数据的指针。
  * @param  data_size 要发送数据的大小。
+ * @param  repeat 0：依次发送数据，1：重复发送tx_data指向的第一个字节。
  * @return 1：传输超时，0：传输完成。
  */
-static uint8_t spi_send_data(const uint8_t *tx_data, uint16_t data_size)
+static uint8_t spi_send(const uint8_t *tx_data, uint16_t data_size, uint8_t repeat)
 {
-    uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    struct WAIT_Context wait;
 
     LL_SPI_ClearFlag_OVR(EPD_SPI);
-    while (data_size--)
+    if (data_size >= SPI_DMA_MIN_SIZE)
     {
-        timeout = SPI_TIMEOUT_MS;
-        systick_tmp = SysTick->CTRL;
-        ((void)systick_tmp);
-        while (timeout != 0 && LL_SPI_IsActiveFlag_TXE(EPD_SPI) == RESET)
+        if (spi_send_data_dma(tx_data, data_size, repeat) != 0)
         {
-            if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
-            {
-                timeout -= 1;
-            }
+            return 1;
         }
-        if (timeout == 0)
+        data_size = 0;
+    }
+    while (data_size--)
+    {
+        WAIT_WHILE(wait, LL_SPI_IsActiveFlag_TXE(EPD_SPI) == RESET, SPI_TIMEOUT_MS, WAIT_SITE_SPI_TXE);
+        if (wait.timeout != 0)
         {
             return 1;
         }
         LL_SPI_TransmitData8(EPD_SPI, *tx_data);
-        tx_data += 1;
-    }
-    timeout = SPI_TIMEOUT_MS;
-    systick_tmp = SysTick->CTRL;
-    ((void)systick_tmp);
-    while (timeout != 0 && LL_SPI_IsActiveFlag_BSY(EPD_SPI) == SET)
-    {
-        if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
+        if (repeat == 0)
         {
-            timeout -= 1;
+            tx_data += 1;
         }
     }
-    if (timeout == 0 || LL_SPI_IsActiveFlag_OVR(EPD_SPI) != 0)
+    WAIT_WHILE(wait, LL_SPI_IsActiveFlag_BSY(EPD_SPI) == SET, SPI_TIMEOUT_MS, WAIT_SITE_SPI_BSY);
+    if (wait.timeout != 0 || LL_SPI_IsActiveFlag_OVR(EPD_SPI) != 0)
     {
         return 1;
     }
@@ -92,31 +153,64 @@ static uint8_t spi_send_data(const uint8_t *tx_data, uint16_t data_size)
 }
 
 /**
- * @brief  向EPD控制器发送命令。
+ * @brief  使用硬件SPI发送指定大小的数据。
+ * @param  tx_data 要发送数据的指针。
+ * @param  data_size 要发送数据的大小。
+ * @return 1：传输超时，0：传输完成。
+ */
+static uint8_t spi_send_data(const uint8_t *tx_data, uint16_t data_size)
+{
+    return spi_send(tx_data, data_size, 0);
+}
+
+/**
+ * @brief  使用硬件SPI将同一个字节重复发送指定次数。
+ * @param  data 要发送的数据。
+ * @param  data_size 发送次数。
+ * @return 1：传输超时，0：传输完成。
+ */
+static uint8_t spi_send_repeat(uint8_t data, uint16_t data_size)
+{
+    return spi_send(&data, data_size, 1);
+}
+
+/**
+ * @brief  向EPD控制器发送一条命令及其参数，整个过程只选中一次芯片。
  * @param  cmd 要发送的命令。
+ * @param  params 命令参数的指针，没有参数时可以为NULL。
+ * @param  params_size 命令参数的大小。
+ * @note   SPI发送完成后才会切换DC引脚，命令字节和参数在同一帧内。
  */
-static void epd_send_cmd(uint8_t cmd)
+static void epd_send_packet(uint8_t cmd, const uint8_t *params, uint16_t params_size)
 {
     LL_GPIO_ResetOutputPin(EPD_DC_PORT, EPD_DC_PIN);
     LL_GPIO_ResetOutputPin(EPD_CS_PORT, EPD_CS_PIN);
-    delay_100ns(1);
-    spi_send_data((uint8_t *)&cmd, 1);
-    delay_100ns(1);
+    WAIT_DelayUs(1);
+    spi_send_data(&cmd, 1);
+    if (params_size != 0)
+    {
+        LL_GPIO_SetOutputPin(EPD_DC_PORT, EPD_DC_PIN);
+        spi_send_data(params, params_size);
+    }
+    WAIT_DelayUs(1);
     LL_GPIO_SetOutputPin(EPD_CS_PORT, EPD_CS_PIN);
 }
 
 /**
- * @brief  向EPD控制器发送数据。
- * @param  data 要发送的数据。
+ * @brief  依次发送命令表中的全部命令。
+ * @param  table 命令表的指针，格式为：命令, 参数大小, 参数...。
+ * @param  table_size 命令表的大小。
  */
-static void epd_send_data(uint8_t data)
+static void epd_send_packets(const uint8_t *table, uint16_t table_size)
 {
-    LL_GPIO_SetOutputPin(EPD_DC_PORT, EPD_DC_PIN);
-    LL_GPIO_ResetOutputPin(EPD_CS_PORT, EPD_CS_PIN);
-    delay_100ns(1);
-    spi_send_data((uint8_t *)&data, 1);
-    delay_100ns(1);
-    LL_GPIO_SetOutputPin(EPD_CS_PORT, EPD_CS_PIN);
+    const uint8_t *table_end;
+
+    table_end = table + table_size;
+    while (table + 2 <= table_end)
+    {
+        epd_send_packet(table[0], table + 2, table[1]);
+        table += 2 + table[1];
+    }
 }
 
 /**
@@ -128,9 +222,24 @@ static void epd_send_data_multi(const uint8_t *data, uint16_t data_size)
 {
     LL_GPIO_SetOutputPin(EPD_DC_PORT, EPD_DC_PIN);
     LL_GPIO_ResetOutputPin(EPD_CS_PORT, EPD_CS_PIN);
-    delay_100ns(1);
+    WAIT_DelayUs(1);
     spi_send_data(data, data_size);
-    delay_100ns(1);
+    WAIT_DelayUs(1);
+    LL_GPIO_SetOutputPin(EPD_CS_PORT, EPD_CS_PIN);
+}
+
+/**
+ * @brief  向EPD控制器重复发送同一个数据，整个过程只选中一次芯片。
+ * @param  data 要发送的数据。
+ * @param  data_size 发送次数。
+ */
+static void epd_send_data_repeat(uint8_t data, uint16_t data_size)
+{
+    LL_GPIO_SetOutputPin(EPD_DC_PORT, EPD_DC_PIN);
+    LL_GPIO_ResetOutputPin(EPD_CS_PORT, EPD_CS_PIN);
+    WAIT_DelayUs(1);
+    spi_send_repeat(data, data_size);
+    WAIT_DelayUs(1);
     LL_GPIO_SetOutputPin(EPD_CS_PORT, EPD_CS_PIN);
 }
 
@@ -140,25 +249,11 @@ static void epd_send_data_multi(const uint8_t *data, uint16_t data_size)
  */
 uint8_t EPD_WaitBusy(void)
 {
-    uint16_t timeout;
-    volatile uint32_t systick_tmp;
+    struct WAIT_Context wait;
 
-    delay_100ns(10); /* 1us 未要求时间，短暂延时 */
-    timeout = EPD_TIMEOUT_MS;
-    systick_tmp = SysTick->CTRL;
-    ((void)systick_tmp);
-    while (timeout != 0 && LL_GPIO_IsInputPinSet(EPD_BUSY_PORT, EPD_BUSY_PIN))
-    {
-        if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
-        {
-            timeout -= 1;
-        }
-    }
-    if (timeout == 0)
-    {
-        return 1;
-    }
-    return 0;
+    WAIT_DelayUs(1); /* 1us 未要求时间，短暂延时 */
+    WAIT_WHILE(wait, LL_GPIO_IsInputPinSet(EPD_BUSY_PORT, EPD_BUSY_PIN), EPD_TIMEOUT_MS, WAIT_SITE_EPD_BUSY); /* 由BUSY引脚下降沿提前唤醒 */
+    return wait.timeout;
 }
 
 /**
@@ -168,13 +263,14 @@ uint8_t EPD_WaitBusy(void)
  */
 void EPD_SetCursor(uint16_t x, uint8_t y_x8)
 {
+    uint8_t params[2];
+
     x = 296 - 1 - x;
 
-    epd_send_cmd(0x4E); /* 设置X（短边）地址计数器 */
-    epd_send_data(y_x8);
-    epd_send_cmd(0x4F); /* 设置Y（长边）地址计数器 */
-    epd_send_data(x & 0xFF);
-    epd_send_data((x >> 8) & 0x01);
+    epd_send_packet(0x4E, &y_x8, 1); /* 设置X（短边）地址计数器 */
+    params[0] = x & 0xFF;
+    params[1] = (x >> 8) & 0x01;
+    epd_send_packet(0x4F, params, 2); /* 设置Y（长边）地址计数器 */
 }
 
 /**
@@ -187,59 +283,212 @@ void EPD_SetCursor(uint16_t x, uint8_t y_x8)
  */
 void EPD_SetWindow(uint16_t x, uint8_t y_x8, uint16_t x_size, uint8_t y_size_x8)
 {
+    uint8_t params[4];
+
     x = 296 - 1 - x;
     x_size = x - x_size + 1;          /* x_size已变为x结束地址 */
     y_size_x8 = y_size_x8 + y_x8 - 1; /* y_size已变为y结束地址 */
 
-    epd_send_cmd(0x44); /* 设置X（短边）起始地址和结束地址，根据扫描方式不同，地址设置也不同 */
-    epd_send_data(y_x8);
-    epd_send_data(y_size_x8 & 0x1F);
-    epd_send_cmd(0x45); /* 设置Y（长边）起始地址和结束地址，根据扫描方式不同，地址设置也不同 */
-    epd_send_data(x & 0xFF);
-    epd_send_data((x >> 8) & 0x01);
-    epd_send_data(x_size & 0xFF);
-    epd_send_data((x_size >> 8) & 0x01);
+    params[0] = y_x8;
+    params[1] = y_size_x8 & 0x1F;
+    epd_send_packet(0x44, params, 2); /* 设置X（短边）起始地址和结束地址，根据扫描方式不同，地址设置也不同 */
+    params[0] = x & 0xFF;
+    params[1] = (x >> 8) & 0x01;
+    params[2] = x_size & 0xFF;
+    params[3] = (x_size >> 8) & 0x01;
+    epd_send_packet(0x45, params, 4); /* 设置Y（长边）起始地址和结束地址，根据扫描方式不同，地址设置也不同 */
 
-    epd_send_cmd(0x4E); /* 设置X（短边）地址计数器 */
-    epd_send_data(y_x8);
-    epd_send_cmd(0x4F); /* 设置Y（长边）地址计数器 */
-    epd_send_data(x & 0xFF);
-    epd_send_data((x >> 8) & 0x01);
+    epd_send_packet(0x4E, &y_x8, 1);  /* 设置X（短边）地址计数器 */
+    epd_send_packet(0x4F, params, 2); /* 设置Y（长边）地址计数器 */
 }
 
 /**
- * @brief  清除EPD控制器内全部显示RAM。
- * @note   执行完成后窗口会恢复至全屏幕。
+ * @brief  开始写入一块显示数据，帧缓冲模式下写入帧缓冲，否则直接写入控制器。
+ * @param  x 块起始X位置。
+ * @param  y 块起始Y位置，单位为像素。
+ * @param  x_size 块X方向大小。
+ * @param  y_size_x8 块Y方向大小，设置1等于8像素。
+ * @note   数据顺序与控制器RAM相同，先Y方向后X方向。
+ * @note   只有帧缓冲模式支持任意Y位置，直接写入控制器时Y位置向下取整至8的倍数。
  */
-void EPD_ClearRAM(void)
+static void epd_begin_block_at(uint16_t x, uint8_t y, uint16_t x_size, uint8_t y_size_x8)
 {
-    uint16_t i;
+#ifdef EPD_USE_FRAMEBUFFER
+    if (FrameActive != 0)
+    {
+        BlockX = x;
+        BlockXEnd = x + x_size;
+        BlockY = y / 8;
+        BlockYStart = y / 8;
+        BlockYEnd = y / 8 + y_size_x8;
+        BlockShift = y % 8;
+        return;
+    }
+#endif
+    EPD_SetWindow(x, y / 8, x_size, y_size_x8);
+    epd_send_packet(0x24, NULL, 0);
+}
 
-    EPD_SetWindow(0, 0, 296, 16);
-    epd_send_cmd(0x24);
-    for (i = 0; i < 4736; i++)
+/**
+ * @brief  开始写入一块显示数据，Y位置对齐至8像素。
+ * @param  x 块起始X位置。
+ * @param  y_x8 块起始Y位置，设置1等于8像素。
+ * @param  x_size 块X方向大小。
+ * @param  y_size_x8 块Y方向大小，设置1等于8像素。
+ */
+static void epd_begin_block(uint16_t x, uint8_t y_x8, uint16_t x_size, uint8_t y_size_x8)
+{
+    epd_begin_block_at(x, y_x8 * 8, x_size, y_size_x8);
+}
+
+#ifdef EPD_USE_FRAMEBUFFER
+/**
+ * @brief  按当前光栅操作将数据写入帧缓冲的一个字节。
+ * @param  x 字节所在X位置。
+ * @param  y_x8 字节所在Y位置，设置1等于8像素。
+ * @param  data 已移位至目标位置的数据。
+ * @param  mask 数据中有效的位。
+ * @note   光栅操作以黑色像素（数据位为0）为1计算。
+ */
+static void epd_rop_byte(uint16_t x, uint8_t y_x8, uint8_t data, uint8_t mask)
+{
+    uint8_t *dst;
+
+    if (x >= 296 || y_x8 >= 16)
     {
-        epd_send_data(0xFF);
+        return;
     }
+    dst = &FrameBuffer[x * 16 + y_x8];
+    switch (RasterOp)
+    {
+    case EPD_ROP_OR: /* 叠加黑色像素 */
+        *dst &= data | (uint8_t)~mask;
+        break;
+    case EPD_ROP_AND: /* 只保留两者都为黑色的像素 */
+        *dst |= data & mask;
+        break;
+    case EPD_ROP_XOR: /* 反转源数据为黑色的像素 */
+        *dst ^= (uint8_t)~data & mask;
+        break;
+    default: /* EPD_ROP_COPY */
+        *dst = (*dst & (uint8_t)~mask) | (data & mask);
+        break;
+    }
+}
+#endif
+
+/**
+ * @brief  写入当前块的显示数据，可以分多次调用。
+ * @param  data 要写入数据的指针。
+ * @param  data_size 要写入数据的大小。
+ * @note   帧缓冲模式下超出屏幕范围的数据会被丢弃，并按EPD_SetRasterOp()设置的方式与原有内容组合。
+ */
+static void epd_write_block(const uint8_t *data, uint16_t data_size)
+{
+#ifdef EPD_USE_FRAMEBUFFER
+    if (FrameActive != 0)
+    {
+        while (data_size-- && BlockX < BlockXEnd)
+        {
+            if (BlockShift == 0 && RasterOp == EPD_ROP_COPY)
+            {
+                if (BlockX < 296 && BlockY < 16)
+                {
+                    FrameBuffer[BlockX * 16 + BlockY] = *data;
+                }
+            }
+            else /* 一个字节跨越帧缓冲中上下两个字节 */
+            {
+                epd_rop_byte(BlockX, BlockY, *data >> BlockShift, 0xFF >> BlockShift);
+                if (BlockShift != 0)
+                {
+                    epd_rop_byte(BlockX, BlockY + 1, *data << (8 - BlockShift), 0xFF << (8 - BlockShift));
+                }
+            }
+            data += 1;
+            BlockY += 1;
+            if (BlockY >= BlockYEnd)
+            {
+                BlockY = BlockYStart;
+                BlockX += 1;
+            }
+        }
+        return;
+    }
+#endif
+    epd_send_data_multi(data, data_size);
+}
+
+/**
+ * @brief  用指定数据填充当前块。
+ * @param  color 填充数据。
+ * @param  data_size 填充数据的大小。
+ * @note   直接写入控制器时只选中一次芯片，重复数据由DMA发送。
+ */
+static void epd_fill_block(uint8_t color, uint16_t data_size)
+{
+    uint8_t fill[16];
+    uint16_t size;
+
+#ifdef EPD_USE_FRAMEBUFFER
+    if (FrameActive == 0)
+#endif
+    {
+        epd_send_data_repeat(color, data_size);
+        return;
+    }
+    memset(fill, color, sizeof(fill));
+    while (data_size != 0)
+    {
+        size = (data_size > sizeof(fill)) ? sizeof(fill) : data_size;
+        epd_write_block(fill, size);
+        data_size -= size;
+    }
+}
+
+/**
+ * @brief  结束当前块的写入，直接写入控制器时将窗口恢复至全屏幕。
+ */
+static void epd_end_block(void)
+{
+#ifdef EPD_USE_FRAMEBUFFER
+    if (FrameActive != 0)
+    {
+        return;
+    }
+#endif
     EPD_SetWindow(0, 0, 296, 16);
 }
 
+/**
+ * @brief  清除EPD控制器内全部显示RAM。
+ * @note   执行完成后窗口会恢复至全屏幕。
+ */
+void EPD_ClearRAM(void)
+{
+    EPD_ClearArea(0, 0, 296, 16, 0xFF);
+}
+
 /**
  * @brief  清除EPD控制器指定区域显示RAM。
  * @note   执行完成后窗口会恢复至全屏幕。
+ * @note   直接写入控制器且区域为全屏幕时，使用EPD_FillRAM()由控制器自行填充。
  */
 void EPD_ClearArea(uint16_t x, uint8_t y_x8, uint16_t x_size, uint8_t y_size_x8, uint8_t color)
 {
-    uint16_t i, data_size;
-
-    data_size = x_size * y_size_x8;
-    EPD_SetWindow(x, y_x8, x_size, y_size_x8);
-    epd_send_cmd(0x24);
-    for (i = 0; i < data_size; i++)
+#ifdef EPD_USE_FRAMEBUFFER
+    if (FrameActive == 0)
+#endif
     {
-        epd_send_data(color);
+        if (x == 0 && y_x8 == 0 && x_size >= 296 && y_size_x8 >= 16)
+        {
+            EPD_FillRAM(EPD_RAM_NEW, color);
+            return;
+        }
     }
-    EPD_SetWindow(0, 0, 296, 16);
+    epd_begin_block(x, y_x8, x_size, y_size_x8);
+    epd_fill_block(color, x_size * y_size_x8);
+    epd_end_block();
 }
 
 /**
@@ -249,8 +498,144 @@ void EPD_ClearArea(uint16_t x, uint8_t y_x8, uint16_t x_size, uint8_t y_size_x8,
  */
 void EPD_SendRAM(const uint8_t *data, uint16_t data_size)
 {
-    epd_send_cmd(0x24);
-    epd_send_data_multi(data, data_size);
+    epd_send_packet(0x24, data, data_size);
+}
+
+/**
+ * @brief  开始在帧缓冲中绘制新的一帧，之后的绘制函数都只写入帧缓冲。
+ * @param  color 帧缓冲初始填充数据，0xFF为全白。
+ * @note   未定义EPD_USE_FRAMEBUFFER时直接填充控制器显示RAM。
+ */
+void EPD_BeginFrame(uint8_t color)
+{
+#ifdef EPD_USE_FRAMEBUFFER
+    memset(FrameBuffer, color, sizeof(FrameBuffer));
+    FrameActive = 1;
+    RasterOp = EPD_ROP_COPY;
+#else
+    EPD_ClearArea(0, 0, 296, 16, color);
+#endif
+}
+
+/**
+ * @brief  将帧缓冲一次性发送至EPD控制器，并结束帧缓冲绘制。
+ * @param  ram 目标RAM，可设置为：EPD_RAM_NEW、EPD_RAM_OLD。
+ * @note   执行完成后窗口为全屏幕，之后的绘制函数恢复为直接写入控制器。
+ */
+void EPD_SendFrame(uint8_t ram)
+{
+    EPD_SendFrameArea(ram, 0, 0, 296, 16);
+}
+
+/**
+ * @brief  将帧缓冲中指定区域发送至EPD控制器相同位置，并结束帧缓冲绘制。
+ * @param  ram 目标RAM，可设置为：EPD_RAM_NEW、EPD_RAM_OLD。
+ * @param  x 区域起始X位置。
+ * @param  y_x8 区域起始Y位置，设置1等于8像素。
+ * @param  x_size 区域X方向大小。
+ * @param  y_size_x8 区域Y方向大小，设置1等于8像素。
+ * @note   整个区域只选中一次芯片，可以多次调用发送不同区域。
+ * @note   执行完成后窗口为全屏幕，之后的绘制函数恢复为直接写入控制器。
+ */
+void EPD_SendFrameArea(uint8_t ram, uint16_t x, uint8_t y_x8, uint16_t x_size, uint8_t y_size_x8)
+{
+#ifdef EPD_USE_FRAMEBUFFER
+    uint16_t x_end;
+
+    FrameActive = 0;
+    if (x >= 296 || y_x8 >= 16)
+    {
+        return;
+    }
+    if (x_size > 296 - x)
+    {
+        x_size = 296 - x;
+    }
+    if (y_size_x8 > 16 - y_x8)
+    {
+        y_size_x8 = 16 - y_x8;
+    }
+    EPD_SetWindow(x, y_x8, x_size, y_size_x8);
+    if (y_size_x8 == 16) /* 整列数据在帧缓冲中是连续的 */
+    {
+        epd_send_packet(ram, FrameBuffer + x * 16, x_size * 16);
+    }
+    else
+    {
+        LL_GPIO_ResetOutputPin(EPD_DC_PORT, EPD_DC_PIN);
+        LL_GPIO_ResetOutputPin(EPD_CS_PORT, EPD_CS_PIN);
+        WAIT_DelayUs(1);
+        spi_send_data(&ram, 1);
+        LL_GPIO_SetOutputPin(EPD_DC_PORT, EPD_DC_PIN);
+        for (x_end = x + x_size; x < x_end; x++)
+        {
+            spi_send_data(FrameBuffer + x * 16 + y_x8, y_size_x8);
+        }
+        WAIT_DelayUs(1);
+        LL_GPIO_SetOutputPin(EPD_CS_PORT, EPD_CS_PIN);
+    }
+    EPD_SetWindow(0, 0, 296, 16);
+#else
+    ((void)ram);
+    ((void)x);
+    ((void)y_x8);
+    ((void)x_size);
+    ((void)y_size_x8);
+#endif
+}
+
+/**
+ * @brief  用指定数据填充EPD控制器整个RAM。
+ * @param  ram 目标RAM，可设置为：EPD_RAM_NEW、EPD_RAM_OLD。
+ * @param  color 填充数据。
+ * @note   定义EPD_USE_AUTOWRITE时，全白或全黑使用控制器的自动写RAM命令，不需要发送显示数据；其他情况只选中一次芯片发送。
+ * @note   局部刷新只驱动新旧RAM不同的像素，两个RAM填充相同数据后，只需发送有变化的区域。
+ */
+void EPD_FillRAM(uint8_t ram, uint8_t color)
+{
+    EPD_SetWindow(0, 0, 296, 16);
+#ifdef EPD_USE_AUTOWRITE
+    if (color == 0xFF || color == 0x00)
+    {
+        color = (color == 0xFF) ? 0xF7 : 0x77; /* 填充值和整个RAM大小的步长 */
+        epd_send_packet((ram == EPD_RAM_OLD) ? 0x46 : 0x47, &color, 1); /* 0x46填充0x26旧画面RAM，0x47填充0x24新画面RAM */
+        EPD_WaitBusy();
+    }
+    else
+#endif
+    {
+        epd_send_packet(ram, NULL, 0);
+        epd_send_data_repeat(color, EPD_FRAME_SIZE);
+    }
+    EPD_SetWindow(0, 0, 296, 16);
+}
+
+/**
+ * @brief  获取帧缓冲。
+ * @return 帧缓冲指针，大小为EPD_FRAME_SIZE，未定义EPD_USE_FRAMEBUFFER时返回NULL。
+ */
+const uint8_t *EPD_GetFrame(void)
+{
+#ifdef EPD_USE_FRAMEBUFFER
+    return FrameBuffer;
+#else
+    return NULL;
+#endif
+}
+
+/**
+ * @brief  设置帧缓冲模式下绘制数据与原有内容的组合方式，EPD_BeginFrame()会将其恢复为EPD_ROP_COPY。
+ * @param  rop 光栅操作，可设置为：EPD_ROP_COPY、EPD_ROP_OR、EPD_ROP_AND、EPD_ROP_XOR。
+ * @note   以黑色像素为1计算，例如EPD_ROP_OR只叠加黑色像素，不会清除周围内容。
+ * @note   直接写入控制器时无法读取原有内容，始终为EPD_ROP_COPY。
+ */
+void EPD_SetRasterOp(uint8_t rop)
+{
+#ifdef EPD_USE_FRAMEBUFFER
+    RasterOp = rop;
+#else
+    ((void)rop);
+#endif
 }
 
 /**
@@ -260,9 +645,7 @@ void EPD_SendRAM(const uint8_t *data, uint16_t data_size)
  */
 uint8_t EPD_Show(uint8_t wait_busy)
 {
-    epd_send_cmd(0x22);
-    epd_send_data(0xC6); /* 更新完成后自动关闭DC-DC转换器 */
-    epd_send_cmd(0x20);
+    epd_send_packets(CMD_Show, sizeof(CMD_Show));
     if (wait_busy != 0)
     {
         return EPD_WaitBusy();
@@ -290,9 +673,7 @@ uint8_t EPD_GetBusy(void)
  */
 void EPD_EnterSleep(void)
 {
-    epd_send_cmd(0x22);
-    epd_send_data(0x02);
-    epd_send_cmd(0x20);
+    epd_send_packets(CMD_Sleep, sizeof(CMD_Sleep));
     EPD_WaitBusy();
 }
 
@@ -302,12 +683,12 @@ void EPD_EnterSleep(void)
  */
 void EPD_EnterDeepSleep(void)
 {
-    epd_send_cmd(0x22);
-    epd_send_data(0x03);
-    epd_send_cmd(0x20);
+    uint8_t param;
+
+    epd_send_packets(CMD_DeepSleepPowerOff, sizeof(CMD_DeepSleepPowerOff));
     EPD_WaitBusy();
-    epd_send_cmd(0x10);
-    epd_send_data(0x01);
+    param = 0x01;
+    epd_send_packet(0x10, &param, 1);
 }
 
 /**
@@ -315,6 +696,21 @@ void EPD_EnterDeepSleep(void)
  * @param  update_mode 显示更新模式，可设置为：EPD_UPDATE_MODE_FULL、EPD_UPDATE_MODE_PART、EPD_UPDATE_MODE_FAST。
  */
 void EPD_Init(uint8_t update_mode)
+{
+    EPD_StartInit(update_mode);
+    if (update_mode != EPD_UPDATE_MODE_PART)
+    {
+        EPD_WaitBusy();
+    }
+    EPD_FinishInit(update_mode);
+}
+
+/**
+ * @brief  开始EPD初始化，复位控制器后立即返回，不等待软复位完成。
+ * @param  update_mode 显示更新模式，可设置为：EPD_UPDATE_MODE_FULL、EPD_UPDATE_MODE_PART、EPD_UPDATE_MODE_FAST。
+ * @note   EPD_GetBusy()返回0后再调用EPD_FinishInit()，等待期间可以执行其他工作。
+ */
+void EPD_StartInit(uint8_t update_mode)
 {
     LL_GPIO_ResetOutputPin(EPD_RST_PORT, EPD_RST_PIN);
     LL_mDelay(0); /* 1ms，未要求，短暂延时 */
@@ -323,67 +719,99 @@ void EPD_Init(uint8_t update_mode)
 
     if (update_mode != EPD_UPDATE_MODE_PART) /* 局部刷新需要上次的旧RAM数据（自动保存在控制器里），不能执行软复位和进入DeepSleep模式 */
     {
-        epd_send_cmd(0x12);
-        EPD_WaitBusy();
+        epd_send_packet(0x12, NULL, 0);
     }
+}
 
-    epd_send_cmd(0x01);
-    epd_send_data(0x27);
-    epd_send_data(0x01);
-    epd_send_data(0x00);
-
-    epd_send_cmd(0x0C);
-    epd_send_data(0xD7);
-    epd_send_data(0xD6);
-    epd_send_data(0x9D);
-
-    epd_send_cmd(0x11);
-    epd_send_data(0x01);
-
-    epd_send_cmd(0x2C); /* VCOM */
-    epd_send_data(0x9A);
-
-    epd_send_cmd(0x3A);
-    epd_send_data(0x1A);
-
-    epd_send_cmd(0x3B);
-    epd_send_data(0x08);
-
-    epd_send_cmd(0x3C);
-    epd_send_data(0x33);
+/**
+ * @brief  完成EPD初始化，发送设置和波形表。
+ * @param  update_mode 显示更新模式，需要与EPD_StartInit()相同。
+ */
+void EPD_FinishInit(uint8_t update_mode)
+{
+    epd_send_packets(CMD_Init, sizeof(CMD_Init));
 
     switch (update_mode)
     {
     case EPD_UPDATE_MODE_FULL:
-        epd_send_cmd(0x32);
-        epd_send_data_multi(LUT_Full, sizeof(LUT_Full));
+        epd_send_packet(0x32, LUT_Full, sizeof(LUT_Full));
         break;
     case EPD_UPDATE_MODE_PART:
-        epd_send_cmd(0x32);
-        epd_send_data_multi(LUT_Part, sizeof(LUT_Part));
+        epd_send_packet(0x32, LUT_Part, sizeof(LUT_Part));
         break;
     case EPD_UPDATE_MODE_FAST:
-        epd_send_cmd(0x32);
-        epd_send_data_multi(LUT_Fast, sizeof(LUT_Fast));
+        epd_send_packet(0x32, LUT_Fast, sizeof(LUT_Fast));
         break;
     }
 }
 
+/**
+ * @brief  在UTF8字体中查找字符。
+ * @param  utf8_font UTF8字符字模指针。
+ * @param  unicode 要查找字符的UNICODE。
+ * @return 字符字模数据的指针，未找到时返回NULL。
+ * @note   首字节为EPD_FONT_SORTED的字体使用二分查找，否则逐个查找。
+ */
+static const uint8_t *epd_find_glyph(const uint8_t *utf8_font, uint32_t unicode)
+{
+    uint16_t entry_size;
+    int16_t low, high, mid;
+    uint32_t unicode_temp;
+    const uint8_t *entry;
+
+    entry_size = utf8_font[1] * utf8_font[2] / 8 + 3;
+    if (utf8_font[0] == EPD_FONT_SORTED)
+    {
+        low = 0;
+        high = utf8_font[3] - 1;
+        while (low <= high)
+        {
+            mid = (low + high) / 2;
+            entry = utf8_font + 4 + entry_size * mid;
+            unicode_temp = ((uint32_t)entry[0] << 16) | ((uint32_t)entry[1] << 8) | entry[2];
+            if (unicode_temp == unicode)
+            {
+                return entry + 3;
+            }
+            if (unicode_temp < unicode)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid - 1;
+            }
+        }
+        return NULL;
+    }
+    for (mid = 0; mid < utf8_font[3]; mid++) /* 限制数组范围 */
+    {
+        entry = utf8_font + 4 + entry_size * mid;
+        unicode_temp = ((uint32_t)entry[0] << 16) | ((uint32_t)entry[1] << 8) | entry[2];
+        if (unicode_temp == unicode)
+        {
+            return entry + 3;
+        }
+    }
+    return NULL;
+}
+
 /**
  * @brief  绘制UTF8字符串。
  * @param  x 绘制起始X位置。
- * @param  y_x8 绘制起始Y位置，设置1等于8像素。
+ * @param  y 绘制起始Y位置，单位为像素。
  * @param  gap 字符间额外间距。
  * @param  str 要绘制的字符串指针。
  * @param  ascii_font ASCII字符字模指针。
  * @param  utf8_font UTF8字符字模指针。
+ * @return 绘制的总宽度（包括字符间距）。
  */
-void EPD_DrawUTF8(uint16_t x, uint8_t y_x8, uint8_t gap, const char *str, const uint8_t *ascii_font, const uint8_t *utf8_font)
+static uint16_t epd_draw_utf8(uint16_t x, uint8_t y, uint8_t gap, const char *str, const uint8_t *ascii_font, const uint8_t *utf8_font)
 {
     uint8_t i, utf8_size;
     uint16_t x_count, font_size;
-    uint32_t unicode, unicode_temp;
-    const uint8_t *ascii_base_addr;
+    uint32_t unicode;
+    const uint8_t *ascii_base_addr, *glyph;
 
     x_count = 0;
     while (*str != '\0')
@@ -396,20 +824,16 @@ void EPD_DrawUTF8(uint16_t x, uint8_t y_x8, uint8_t gap, const char *str, const
                 ascii_base_addr = ascii_font + (*str - ascii_font[0]) * font_size + 4;
                 if (ascii_base_addr + font_size <= ascii_font + 4 + font_size * ascii_font[3]) /* 限制数组范围 */
                 {
-                    EPD_SetWindow(x + x_count, y_x8, ascii_font[1], ascii_font[2] / 8);
-                    EPD_SendRAM(ascii_base_addr, font_size);
+                    epd_begin_block_at(x + x_count, y, ascii_font[1], ascii_font[2] / 8);
+                    epd_write_block(ascii_base_addr, font_size);
                 }
                 x_count += ascii_font[1] + gap;
             }
             else if (*str == ' ' && utf8_font != NULL) /* 未指定ASCII字体时空格为UTF8字体宽度除2 */
             {
                 font_size = (utf8_font[1] / 2) * (utf8_font[2] / 8);
-                EPD_SetWindow(x + x_count, y_x8, utf8_font[1] / 2, utf8_font[2] / 8);
-                for (i = 0; i < font_size; i++)
-                {
-                    utf8_size = 0xFF; /* 借用变量 */
-                    EPD_SendRAM(&utf8_size, 1);
-                }
+                epd_begin_block_at(x + x_count, y, utf8_font[1] / 2, utf8_font[2] / 8);
+                epd_fill_block(0xFF, font_size);
                 x_count += utf8_font[1] / 2 + gap;
             }
         }
@@ -464,23 +888,145 @@ void EPD_DrawUTF8(uint16_t x, uint8_t y_x8, uint8_t gap, const char *str, const
             if (unicode != 0)
             {
                 font_size = utf8_font[1] * utf8_font[2] / 8;
-                for (i = 0; i < utf8_font[3]; i++) /* 限制数组范围 */
+                glyph = epd_find_glyph(utf8_font, unicode);
+                if (glyph != NULL)
                 {
-                    unicode_temp = utf8_font[4 + (font_size + 3) * i] << 16;
-                    unicode_temp |= utf8_font[5 + (font_size + 3) * i] << 8;
-                    unicode_temp |= utf8_font[6 + (font_size + 3) * i];
-                    if (unicode_temp == unicode)
-                    {
-                        EPD_SetWindow(x + x_count, y_x8, utf8_font[1], utf8_font[2] / 8);
-                        EPD_SendRAM(utf8_font + 7 + (font_size + 3) * i, font_size);
-                        break;
-                    }
+                    epd_begin_block_at(x + x_count, y, utf8_font[1], utf8_font[2] / 8);
+                    epd_write_block(glyph, font_size);
                 }
             }
             x_count += utf8_font[1] + gap;
         }
         str += 1;
     }
+    return x_count;
+}
+
+/**
+ * @brief  绘制UTF8字符串。
+ * @param  x 绘制起始X位置。
+ * @param  y_x8 绘制起始Y位置，设置1等于8像素。
+ * @param  gap 字符间额外间距。
+ * @param  str 要绘制的字符串指针。
+ * @param  ascii_font ASCII字符字模指针。
+ * @param  utf8_font UTF8字符字模指针。
+ * @return 绘制的总宽度（包括字符间距）。
+ */
+uint16_t EPD_DrawUTF8(uint16_t x, uint8_t y_x8, uint8_t gap, const char *str, const uint8_t *ascii_font, const uint8_t *utf8_font)
+{
+    return epd_draw_utf8(x, y_x8 * 8, gap, str, ascii_font, utf8_font);
+}
+
+/**
+ * @brief  在任意Y位置绘制UTF8字符串，按EPD_SetRasterOp()设置的方式与原有内容组合。
+ * @param  x 绘制起始X位置。
+ * @param  y 绘制起始Y位置，单位为像素。
+ * @param  gap 字符间额外间距。
+ * @param  str 要绘制的字符串指针。
+ * @param  ascii_font ASCII字符字模指针。
+ * @param  utf8_font UTF8字符字模指针。
+ * @return 绘制的总宽度（包括字符间距）。
+ * @note   只有帧缓冲模式支持任意Y位置，直接写入控制器时Y位置向下取整至8的倍数。
+ */
+uint16_t EPD_BlitUTF8(uint16_t x, uint8_t y, uint8_t gap, const char *str, const uint8_t *ascii_font, const uint8_t *utf8_font)
+{
+    return epd_draw_utf8(x, y, gap, str, ascii_font, utf8_font);
+}
+
+/**
+ * @brief  绘制由glyphrun.py预先生成的字形串，不需要UTF8解码和查找字模。
+ * @param  x 绘制起始X位置。
+ * @param  y 绘制起始Y位置，单位为像素。
+ * @param  gap 字符间额外间距。
+ * @param  run 要绘制的字形串指针。
+ * @param  ascii_font ASCII字符字模指针，必须与生成时使用的字体相同。
+ * @param  utf8_font UTF8字符字模指针，必须与生成时使用的字体相同。
+ * @return 绘制的总宽度（包括字符间距）。
+ */
+static uint16_t epd_draw_glyph_run(uint16_t x, uint8_t y, uint8_t gap, const uint8_t *run, const uint8_t *ascii_font, const uint8_t *utf8_font)
+{
+    uint8_t i, glyph;
+    uint16_t x_count, font_size;
+
+    x_count = 0;
+    for (i = 1; i <= run[0]; i++)
+    {
+        glyph = run[i];
+        if (glyph >= EPD_GLYPHRUN_ASCII)
+        {
+            if (ascii_font != NULL)
+            {
+                font_size = ascii_font[1] * ascii_font[2] / 8;
+                epd_begin_block_at(x + x_count, y, ascii_font[1], ascii_font[2] / 8);
+                epd_write_block(ascii_font + 4 + (glyph - EPD_GLYPHRUN_ASCII) * font_size, font_size);
+                x_count += ascii_font[1] + gap;
+            }
+        }
+        else if (glyph == EPD_GLYPHRUN_SPACE)
+        {
+            font_size = (utf8_font[1] / 2) * (utf8_font[2] / 8);
+            epd_begin_block_at(x + x_count, y, utf8_font[1] / 2, utf8_font[2] / 8);
+            epd_fill_block(0xFF, font_size);
+            x_count += utf8_font[1] / 2 + gap;
+        }
+        else
+        {
+            if (glyph != EPD_GLYPHRUN_MISSING)
+            {
+                font_size = utf8_font[1] * utf8_font[2] / 8;
+                epd_begin_block_at(x + x_count, y, utf8_font[1], utf8_font[2] / 8);
+                epd_write_block(utf8_font + 4 + (font_size + 3) * glyph + 3, font_size);
+            }
+            x_count += utf8_font[1] + gap;
+        }
+    }
+    return x_count;
+}
+
+/**
+ * @brief  绘制由glyphrun.py预先生成的字形串，不需要UTF8解码和查找字模。
+ * @param  x 绘制起始X位置。
+ * @param  y_x8 绘制起始Y位置，设置1等于8像素。
+ * @param  gap 字符间额外间距。
+ * @param  run 要绘制的字形串指针。
+ * @param  ascii_font ASCII字符字模指针，必须与生成时使用的字体相同。
+ * @param  utf8_font UTF8字符字模指针，必须与生成时使用的字体相同。
+ * @return 绘制的总宽度（包括字符间距）。
+ */
+uint16_t EPD_DrawGlyphRun(uint16_t x, uint8_t y_x8, uint8_t gap, const uint8_t *run, const uint8_t *ascii_font, const uint8_t *utf8_font)
+{
+    return epd_draw_glyph_run(x, y_x8 * 8, gap, run, ascii_font, utf8_font);
+}
+
+/**
+ * @brief  在任意Y位置绘制字形串，按EPD_SetRasterOp()设置的方式与原有内容组合。
+ * @param  x 绘制起始X位置。
+ * @param  y 绘制起始Y位置，单位为像素。
+ * @param  gap 字符间额外间距。
+ * @param  run 要绘制的字形串指针。
+ * @param  ascii_font ASCII字符字模指针，必须与生成时使用的字体相同。
+ * @param  utf8_font UTF8字符字模指针，必须与生成时使用的字体相同。
+ * @return 绘制的总宽度（包括字符间距）。
+ * @note   只有帧缓冲模式支持任意Y位置，直接写入控制器时Y位置向下取整至8的倍数。
+ */
+uint16_t EPD_BlitGlyphRun(uint16_t x, uint8_t y, uint8_t gap, const uint8_t *run, const uint8_t *ascii_font, const uint8_t *utf8_font)
+{
+    return epd_draw_glyph_run(x, y, gap, run, ascii_font, utf8_font);
+}
+
+/**
+ * @brief  在字符串表中查找字形串。
+ * @param  runs 由glyphrun.py生成的字符串表指针。
+ * @param  index 字形串在表中的序号。
+ * @return 字形串指针。
+ */
+const uint8_t *EPD_GetGlyphRun(const uint8_t *runs, uint8_t index)
+{
+    while (index--)
+    {
+        runs += runs[0] + 1;
+    }
+    return runs;
 }
 
 /**
@@ -494,8 +1040,136 @@ void EPD_DrawImage(uint16_t x, uint8_t y_x8, const uint8_t *image)
     uint8_t y_size;
     
     y_size = image[2] / 8;
-    EPD_SetWindow(x, y_x8, image[0] + image[1], y_size);
-    EPD_SendRAM(image + 3, (image[0] + image[1]) * y_size);
+    epd_begin_block(x, y_x8, image[0] + image[1], y_size);
+    epd_write_block(image + 3, (image[0] + image[1]) * y_size);
+}
+
+/**
+ * @brief  从压缩数据中读取一位。
+ * @param  data 压缩数据指针的指针，读完一个字节后自动后移。
+ * @param  mask 当前位掩码的指针。
+ * @return 读取的位。
+ */
+static uint8_t epd_read_bit(const uint8_t **data, uint8_t *mask)
+{
+    uint8_t bit;
+
+    bit = ((**data & *mask) != 0) ? 1 : 0;
+    *mask >>= 1;
+    if (*mask == 0)
+    {
+        *mask = 0x80;
+        *data += 1;
+    }
+    return bit;
+}
+
+/**
+ * @brief  从压缩数据中读取一个Elias gamma编码的游程长度。
+ * @param  data 压缩数据指针的指针。
+ * @param  mask 当前位掩码的指针。
+ * @return 游程长度，0表示数据错误。
+ */
+static uint16_t epd_read_run(const uint8_t **data, uint8_t *mask)
+{
+    uint8_t zeros;
+    uint16_t run;
+
+    zeros = 0;
+    while (epd_read_bit(data, mask) == 0)
+    {
+        zeros += 1;
+        if (zeros >= 16)
+        {
+            return 0;
+        }
+    }
+    run = 1;
+    while (zeros--)
+    {
+        run = (run << 1) | epd_read_bit(data, mask);
+    }
+    return run;
+}
+
+/**
+ * @brief  绘制由packimage.py生成的压缩图像，边解码边写入帧缓冲或控制器。
+ * @param  x 绘制起始X位置。
+ * @param  y_x8 绘制起始Y位置，设置1等于8像素。
+ * @param  image 要绘制的压缩图像指针。
+ * @note   只使用16字节的解码缓冲。
+ */
+void EPD_DrawPackedImage(uint16_t x, uint8_t y_x8, const uint8_t *image)
+{
+    uint8_t buf[16];
+    uint8_t y_size, mask, color, out, out_bits, buf_size;
+    uint16_t run, remain;
+    const uint8_t *data;
+
+    y_size = image[2] / 8;
+    remain = (image[0] + image[1]) * y_size * 8; /* 剩余像素数 */
+    epd_begin_block(x, y_x8, image[0] + image[1], y_size);
+
+    data = image + 3;
+    mask = 0x80;
+    color = epd_read_bit(&data, &mask); /* 首个像素的颜色 */
+    out = 0;
+    out_bits = 0;
+    buf_size = 0;
+    while (remain != 0)
+    {
+        run = epd_read_run(&data, &mask);
+        if (run == 0 || run > remain) /* 数据错误 */
+        {
+            break;
+        }
+        remain -= run;
+        while (run != 0)
+        {
+            if (out_bits == 0 && run >= 8) /* 整字节直接写入 */
+            {
+                buf[buf_size++] = (color != 0) ? 0xFF : 0x00;
+                run -= 8;
+            }
+            else
+            {
+                out = (out << 1) | color;
+                out_bits += 1;
+                run -= 1;
+                if (out_bits == 8)
+                {
+                    buf[buf_size++] = out;
+                    out_bits = 0;
+                }
+            }
+            if (buf_size == sizeof(buf))
+            {
+                epd_write_block(buf, buf_size);
+                buf_size = 0;
+            }
+        }
+        color ^= 1;
+    }
+    if (buf_size != 0)
+    {
+        epd_write_block(buf, buf_size);
+    }
+}
+
+/**
+ * @brief  在任意Y位置绘制图像，按EPD_SetRasterOp()设置的方式与原有内容组合。
+ * @param  x 绘制起始X位置。
+ * @param  y 绘制起始Y位置，单位为像素。
+ * @param  str 要绘制的图像指针。
+ * @note   只有帧缓冲模式支持任意Y位置，直接写入控制器时Y位置向下取整至8的倍数。
+ */
+void EPD_BlitImage(uint16_t x, uint8_t y, const uint8_t *image)
+{
+    uint8_t y_size;
+
+    y_size = image[2] / 8;
+    epd_begin_block_at(x, y, image[0] + image[1], y_size);
+    epd_write_block(image + 3, (image[0] + image[1]) * y_size);
 }
 
 /**
@@ -504,15 +1178,25 @@ void EPD_DrawImage(uint16_t x, uint8_t y_x8, const uint8_t *image)
  * @param  y 绘制起始Y位置。
  * @param  x_size 绘制长度。
  * @param  width 线宽度。
- * @note   Y方向始终会占用8的倍数的像素，例如在0,0位置绘制一条1像素宽高的线，会清除Y方向8像素内的显示数据。
+ * @note   直接写入控制器时Y方向始终会占用8的倍数的像素，例如在0,0位置绘制一条1像素宽高的线，会清除Y方向8像素内的显示数据。
+ * @note   帧缓冲模式下只改变线条上的像素。
  */
 void EPD_DrawHLine(uint16_t x, uint8_t y, uint16_t x_size, uint8_t width)
 {
     uint16_t i;
     uint8_t j, k, block, height, y_temp, width_temp;
+#ifdef EPD_USE_FRAMEBUFFER
+    uint8_t rop;
+
+    rop = RasterOp; /* 帧缓冲模式下只叠加线条像素，不清除同一字节内的其他内容 */
+    if (RasterOp == EPD_ROP_COPY)
+    {
+        RasterOp = EPD_ROP_OR;
+    }
+#endif
 
     height = (y % 8 + width - 1) / 8 + 1;
-    EPD_SetWindow(x, y / 8, x_size, height);
+    epd_begin_block(x, y / 8, x_size, height);
     for (i = 0; i < x_size; i++)
     {
         y_temp = y;
@@ -531,9 +1215,12 @@ void EPD_DrawHLine(uint16_t x, uint8_t y, uint16_t x_size, uint8_t width)
             }
             y_temp = 0;
             block = ~block;
-            EPD_SendRAM((uint8_t *)&block, 1);
+            epd_write_block(&block, 1);
         }
     }
+#ifdef EPD_USE_FRAMEBUFFER
+    RasterOp = rop;
+#endif
 }
 
 /**
@@ -542,15 +1229,25 @@ void EPD_DrawHLine(uint16_t x, uint8_t y, uint16_t x_size, uint8_t width)
  * @param  y 绘制起始Y位置。
  * @param  y_size 绘制长度。
  * @param  width 线宽度。
- * @note   Y方向始终会占用8的倍数的像素，例如在0,0位置绘制一条1像素宽高的线，会清除Y方向8像素内的显示数据。
+ * @note   直接写入控制器时Y方向始终会占用8的倍数的像素，例如在0,0位置绘制一条1像素宽高的线，会清除Y方向8像素内的显示数据。
+ * @note   帧缓冲模式下只改变线条上的像素。
  */
 void EPD_DrawVLine(uint16_t x, uint8_t y, uint8_t y_size, uint16_t width)
 {
     uint16_t i;
     uint8_t j, k, block, height, y_temp, width_temp;
+#ifdef EPD_USE_FRAMEBUFFER
+    uint8_t rop;
+
+    rop = RasterOp; /* 帧缓冲模式下只叠加线条像素，不清除同一字节内的其他内容 */
+    if (RasterOp == EPD_ROP_COPY)
+    {
+        RasterOp = EPD_ROP_OR;
+    }
+#endif
 
     height = (y % 8 + y_size - 1) / 8 + 1;
-    EPD_SetWindow(x, y / 8, width, height);
+    epd_begin_block(x, y / 8, width, height);
     for (i = 0; i < width; i++)
     {
         y_temp = y;
@@ -569,7 +1266,10 @@ void EPD_DrawVLine(uint16_t x, uint8_t y, uint8_t y_size, uint16_t width)
             }
             y_temp = 0;
             block = ~block;
-            EPD_SendRAM((uint8_t *)&block, 1);
+            epd_write_block(&block, 1);
         }
     }
+#ifdef EPD_USE_FRAMEBUFFER
+    RasterOp = rop;
+#endif
 }
@@ -13,31 +13,68 @@
 #define EPD_DC_PIN EPD_DC_Pin
 #define EPD_CS_PORT EPD_CS_GPIO_Port
 #define EPD_CS_PIN EPD_CS_Pin
+#define EPD_DMA DMA1
+#define EPD_DMA_CHANNEL LL_DMA_CHANNEL_3
+#define EPD_DMA_REQUEST LL_DMA_REQUEST_1
+#define EPD_DMA_IRQ DMA1_Channel2_3_IRQn
+#define EPD_USE_FRAMEBUFFER /* 使用MCU内存作为帧缓冲（占用4736字节），不需要时注释掉 */
+/* #define EPD_USE_AUTOWRITE */ /* 使用控制器的自动写RAM命令（0x46、0x47）填充，IL3820尚未确认支持，确认后再打开 */
 /* 结束 */
 
 #define SPI_TIMEOUT_MS 100
+#define SPI_DMA_MIN_SIZE 32 /* 数据量不小于此值时使用DMA发送 */
 #define EPD_TIMEOUT_MS 10000
 
+#define EPD_FRAME_SIZE (296 * 128 / 8)
+
+#define EPD_RAM_NEW 0x24 /* 新画面RAM */
+#define EPD_RAM_OLD 0x26 /* 旧画面RAM，局部刷新时与新画面比较 */
+
 #define EPD_UPDATE_MODE_FULL 0x00
 #define EPD_UPDATE_MODE_PART 0x01
 #define EPD_UPDATE_MODE_FAST 0x02
 
+#define EPD_ROP_COPY 0x00 /* 覆盖原有内容 */
+#define EPD_ROP_OR 0x01   /* 以黑色像素为1，与原有内容按位或，即只叠加黑色像素 */
+#define EPD_ROP_AND 0x02  /* 以黑色像素为1，与原有内容按位与 */
+#define EPD_ROP_XOR 0x03  /* 以黑色像素为1，与原有内容按位异或，即反转黑色像素位置的内容 */
+
+#define EPD_FONT_SORTED 0x01 /* UTF8字体的首字节，表示UNICODE索引已从小到大排序，查找时使用二分法 */
+
+#define EPD_GLYPHRUN_ASCII 0x80   /* 字形串中0x80及以上为ASCII字符索引 */
+#define EPD_GLYPHRUN_SPACE 0x7F   /* 字形串中未指定ASCII字体时的半宽空格 */
+#define EPD_GLYPHRUN_MISSING 0x7E /* 字形串中字体不存在的字符，只占位不绘制 */
+
 #ifndef NULL
 #define NULL 0
 #endif
 
 void EPD_Init(uint8_t update_mode);
+void EPD_StartInit(uint8_t update_mode);
+void EPD_FinishInit(uint8_t update_mode);
 void EPD_ClearRAM(void);
 void EPD_ClearArea(uint16_t x, uint8_t y_x8, uint16_t x_size, uint8_t y_size_x8, uint8_t color);
 void EPD_SetWindow(uint16_t x, uint8_t y_x8, uint16_t x_size, uint8_t y_size_x8);
 void EPD_SetCursor(uint16_t x, uint8_t y_x8);
 void EPD_SendRAM(const uint8_t *data, uint16_t data_size);
+void EPD_BeginFrame(uint8_t color);
+void EPD_SendFrame(uint8_t ram);
+void EPD_SendFrameArea(uint8_t ram, uint16_t x, uint8_t y_x8, uint16_t x_size, uint8_t y_size_x8);
+void EPD_FillRAM(uint8_t ram, uint8_t color);
+const uint8_t *EPD_GetFrame(void);
+void EPD_SetRasterOp(uint8_t rop);
 uint8_t EPD_Show(uint8_t wait_busy);
 uint8_t EPD_WaitBusy(void);
 uint8_t EPD_GetBusy(void);
 
-void EPD_DrawUTF8(uint16_t x, uint8_t y_x8, uint8_t gap, const char *str, const uint8_t *ascii_font, const uint8_t *utf8_font);
+uint16_t EPD_DrawUTF8(uint16_t x, uint8_t y_x8, uint8_t gap, const char *str, const uint8_t *ascii_font, const uint8_t *utf8_font);
+uint16_t EPD_DrawGlyphRun(uint16_t x, uint8_t y_x8, uint8_t gap, const uint8_t *run, const uint8_t *ascii_font, const uint8_t *utf8_font);
+const uint8_t *EPD_GetGlyphRun(const uint8_t *runs, uint8_t index);
 void EPD_DrawImage(uint16_t x, uint8_t y_x8, const uint8_t *image);
+void EPD_DrawPackedImage(uint16_t x, uint8_t y_x8, const uint8_t *image);
+uint16_t EPD_BlitUTF8(uint16_t x, uint8_t y, uint8_t gap, const char *str, const uint8_t *ascii_font, const uint8_t *utf8_font);
+uint16_t EPD_BlitGlyphRun(uint16_t x, uint8_t y, uint8_t gap, const uint8_t *run, const uint8_t *ascii_font, const uint8_t *utf8_font);
+void EPD_BlitImage(uint16_t x, uint8_t y, const uint8_t *image);
 void EPD_DrawHLine(uint16_t x, uint8_t y, uint16_t x_size, uint8_t width);
 void EPD_DrawVLine(uint16_t x, uint8_t y, uint8_t y_size, uint16_t width);
 
@@ -45,325 +82,283 @@ void EPD_EnterSleep(void);
 void EPD_EnterDeepSleep(void);
 
 static const uint8_t EPD_FontUTF8_24x24_B[] = {
-    0, 24, 24, 115,   /* 起始字符，字体宽度，字体高度，字体个数 */
-    0x00, 0x65, 0xF6, /* UNICODE索引 - 时 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF7, 0xDF, 0xBF, 0xF7,
-    0xDF, 0xBF, 0xF7, 0xDF, 0xBF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFE, 0xFF,
-    0xFF, 0xFE, 0xEF, 0xFF, 0xFE, 0xE3, 0xFF, 0xFE, 0xF1, 0xF7, 0xFE, 0xF1, 0xF3, 0xFE, 0xFF, 0xFB,
-    0xFE, 0xFF, 0xF9, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x95, 0xF4, /* UNICODE索引 - 间 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0x9B,
-    0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE6, 0x00, 0x3F, 0xEE, 0x00, 0x3F, 0xEE, 0xF7,
-    0x7F, 0xEE, 0xF7, 0x7F, 0xEE, 0xF7, 0x7F, 0xEE, 0xF7, 0x7F, 0xEE, 0x00, 0x3F, 0xEE, 0x00, 0x3F,
-    0xEE, 0xFE, 0x37, 0xEF, 0xFF, 0xF3, 0xEF, 0xFF, 0xF9, 0xEF, 0xFF, 0xF1, 0xE0, 0x00, 0x01, 0xE0,
-    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x8B, 0xBE, /* UNICODE索引 - 设 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xDF, 0xBF, 0xFF, 0xC3,
-    0x80, 0x07, 0xE3, 0x80, 0x07, 0xF3, 0xAF, 0xC5, 0xFF, 0xCF, 0x9D, 0xFF, 0x9F, 0x39, 0xFF, 0x2F,
-    0x7B, 0xC0, 0x27, 0xF3, 0xC0, 0xE1, 0xF7, 0xC3, 0xE8, 0x67, 0xDF, 0xEE, 0x0F, 0xDF, 0xEF, 0x8F,
-    0xDF, 0xEF, 0x0F, 0xC0, 0x28, 0x27, 0xC0, 0x00, 0xE7, 0xEF, 0x81, 0xF3, 0xFF, 0xAF, 0xF3, 0xFF,
-    0xBF, 0xFB, 0xFF, 0xBF, 0xFB, 0xFF, 0xBF, 0xFF,
-    0x00, 0x7F, 0x6E, /* UNICODE索引 - 置 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFB, 0xC0, 0xBF, 0xFB, 0xC0,
-    0xBF, 0xFB, 0xDD, 0xA0, 0x03, 0xDD, 0xA0, 0x03, 0xDD, 0xAD, 0x5B, 0xC1, 0xAD, 0x5B, 0xC1, 0xAD,
-    0x5B, 0xDC, 0x0D, 0x5B, 0xDC, 0x0D, 0x5B, 0xDD, 0xAD, 0x5B, 0xC1, 0xAD, 0x5B, 0xC1, 0xAD, 0x5B,
-    0xDD, 0xAD, 0x5B, 0xDD, 0x80, 0x03, 0xDD, 0x80, 0x03, 0xC0, 0x2F, 0xFB, 0xC0, 0x3F, 0xFB, 0xFF,
-    0xBF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB,
-    0x00, 0x66, 0x1F, /* UNICODE索引 - 星 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBB, 0xFF, 0xFF, 0x3B, 0xFF, 0xFC, 0x7B, 0xC0,
-    0x30, 0xBB, 0xC0, 0x21, 0xBB, 0xC0, 0x63, 0xBB, 0xDB, 0x7B, 0xBB, 0xDB, 0x7B, 0xBB, 0xDB, 0x7B,
-    0xBB, 0xDB, 0x40, 0x03, 0xDB, 0x40, 0x03, 0xDB, 0x60, 0x03, 0xDB, 0x7B, 0xBB, 0xDB, 0x7B, 0xBB,
-    0xDB, 0x7B, 0xBB, 0xDB, 0x7B, 0x3B, 0xC0, 0x33, 0x3B, 0xC0, 0x33, 0xBB, 0xFF, 0xFB, 0xF3, 0xFF,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-    0x00, 0x67, 0x1F, /* UNICODE索引 - 期 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xFB, 0xFB, 0xFE, 0xF3, 0xFB, 0xFE, 0xE7, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFB, 0x6E, 0xBF, 0xFB, 0x6E, 0xFF, 0xFB, 0x6E, 0xBF, 0xC0, 0x00,
-    0x9D, 0xC0, 0x00, 0xC9, 0xFB, 0xFE, 0xC3, 0xFB, 0xFE, 0xC7, 0xE7, 0xF0, 0x0F, 0xE0, 0x00, 0x1F,
-    0xE0, 0x00, 0xFF, 0xEF, 0x7B, 0xF7, 0xEF, 0x7B, 0xF3, 0xEF, 0x7B, 0xFB, 0xE0, 0x00, 0x03, 0xE0,
-    0x00, 0x03, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    EPD_FONT_SORTED, 24, 24, 113, /* 索引已排序，字体宽度，字体高度，字体个数 */
+    0x00, 0x21, 0x03, /* UNICODE索引 - ℃（手动修改） */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF3,
+    0x9F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFE, 0x00,
+    0x0F, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0xC7, 0xF9, 0xFF, 0xE3, 0xF1, 0xFF, 0xF3, 0xF3, 0xFF, 0xF3,
+    0xF3, 0xFF, 0xF3, 0xF3, 0xFF, 0xF3, 0xF3, 0xFF, 0xF3, 0xF9, 0xFF, 0xE3, 0xFC, 0xFF, 0xE7, 0xFC,
+    0x1F, 0xCF, 0xFC, 0x1F, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x25, 0xB6, /* UNICODE索引 - ▶（手动修改） */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
+    0x07, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0xFF,
+    0xFF, 0x81, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x25, 0xC0, /* UNICODE索引 - ◀（手动修改） */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE7, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFC, 0x00,
+    0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07,
+    0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
     0x00, 0x4E, 0x00, /* UNICODE索引 - 一（手动加粗） */
     0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF,
     0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7,
     0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF,
     0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF,
     0xC7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4E, 0x8C, /* UNICODE索引 - 二（手动加粗） */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC,
-    0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF,
-    0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7,
-    0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xF8, 0xFF, 0xE7, 0xF8, 0xFF, 0xE7, 0xFC, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xC7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
     0x00, 0x4E, 0x09, /* UNICODE索引 - 三（手动加粗） */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xF3, 0xFF, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
     0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
     0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3, 0xF3,
     0xF3, 0xF3, 0xF3, 0xF3, 0xE3, 0xF3, 0xF3, 0xE3, 0xF3, 0xE3, 0xF3, 0xF3, 0xE3, 0xFF, 0xE3, 0xF3,
     0xFF, 0xE3, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF3,
-    0x00, 0x56, 0xDB, /* UNICODE索引 - 四 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0,
-    0x00, 0x01, 0xEF, 0xFF, 0x97, 0xEF, 0xFE, 0x37, 0xEF, 0xF0, 0x77, 0xE0, 0x01, 0xF7, 0xE0, 0x07,
-    0xF7, 0xEF, 0xFF, 0xF7, 0xEF, 0xFF, 0xF7, 0xEF, 0xFF, 0xF7, 0xE0, 0x00, 0xF7, 0xE0, 0x00, 0xF7,
-    0xEF, 0xFE, 0xF7, 0xEF, 0xFE, 0xF7, 0xEF, 0xFE, 0xF7, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0,
-    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x4E, 0x0A, /* UNICODE索引 - 上 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF,
+    0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xC0, 0x00,
+    0x07, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xFF, 0xBF, 0xF7, 0xFF, 0xBF, 0xF7, 0xFF, 0xBF, 0xF7,
+    0xFF, 0xBF, 0xF7, 0xFF, 0xBF, 0xF7, 0xFF, 0x3F, 0xF7, 0xFF, 0x3F, 0xF7, 0xFF, 0xBF, 0xE7, 0xFF,
+    0xFF, 0xE7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x00, 0x4E, 0x0B, /* UNICODE索引 - 下 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF,
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xEF, 0xBF, 0xFF, 0xEF, 0x9F, 0xFF, 0xEF, 0xDF, 0xFF,
+    0xEF, 0xCF, 0xFF, 0xEF, 0xC7, 0xFF, 0xEF, 0xE3, 0xFF, 0xEF, 0xE3, 0xFF, 0xCF, 0xFB, 0xFF, 0xCF,
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x4E, 0x0D, /* UNICODE索引 - 不 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xEF, 0xFF, 0x3F, 0xEF, 0xFF, 0x7F, 0xEF, 0xFE, 0x7F, 0xEF,
+    0xFC, 0xFF, 0xEF, 0xF9, 0xFF, 0xEF, 0xF3, 0xFF, 0xEF, 0xC7, 0xFF, 0xEF, 0x8F, 0xFF, 0xEE, 0x1F,
+    0xFF, 0xE8, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE3, 0x00, 0x03, 0xE7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFF,
+    0xEF, 0xDF, 0xFF, 0xEF, 0xCF, 0xFF, 0xEF, 0xE7, 0xFF, 0xEF, 0xF3, 0xFF, 0xCF, 0xF0, 0xFF, 0xCF,
+    0xF8, 0x7F, 0xEF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x4E, 0x2A, /* UNICODE索引 - 个 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
+    0xCF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF,
+    0xFF, 0x83, 0x00, 0x01, 0x8F, 0x00, 0x01, 0xC3, 0x00, 0x03, 0xF1, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
+    0xFE, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+    0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x4E, 0x3A, /* UNICODE索引 - 为 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFD, 0xFF, 0x7F, 0xF9, 0xFF, 0x7F, 0xF3, 0xEF,
+    0x7F, 0xE7, 0xE3, 0x7F, 0xCF, 0xF1, 0x7F, 0x8F, 0xF1, 0x7E, 0x1F, 0xFF, 0x78, 0x3F, 0xFF, 0x40,
+    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0xC1, 0x77, 0xF7, 0xDF, 0x73, 0xF7, 0xFF, 0x79, 0xF7,
+    0xFF, 0x78, 0xF3, 0xFF, 0x7C, 0x79, 0xFF, 0x7E, 0x79, 0xFF, 0x7F, 0xE1, 0xFF, 0x00, 0x03, 0xFF,
+    0x00, 0x07, 0xFF, 0x01, 0xFF, 0xFF, 0x7F, 0xFF,
+    0x00, 0x4E, 0x3B, /* UNICODE索引 - 主 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0xFB, 0xFE, 0xFF, 0xFB, 0xFE,
+    0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xDE, 0xFD, 0xFB, 0xCE, 0xFD,
+    0xFB, 0xE2, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB,
+    0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xF9, 0xFB, 0xFC, 0xF9, 0xFB, 0xFC, 0xFD, 0xF3, 0xFE,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
+    0x00, 0x4E, 0x8C, /* UNICODE索引 - 二（手动加粗） */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC,
+    0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF,
+    0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7,
+    0xFC, 0xFF, 0xE7, 0xFC, 0xFF, 0xE7, 0xF8, 0xFF, 0xE7, 0xF8, 0xFF, 0xE7, 0xFC, 0xFF, 0xC7, 0xFF,
+    0xFF, 0xC7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
     0x00, 0x4E, 0x94, /* UNICODE索引 - 五 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xEF, 0xFF, 0xFB, 0xEF, 0xDF, 0xFB, 0xEF,
     0xDF, 0xFB, 0xEF, 0xDF, 0xFB, 0xEF, 0xDF, 0xFB, 0xEF, 0xDF, 0xC3, 0xEF, 0xC0, 0x03, 0xE0, 0x00,
     0x0B, 0xE0, 0x07, 0xFB, 0xE1, 0xDF, 0xFB, 0xEF, 0xDF, 0xFB, 0xEF, 0xDF, 0xFB, 0xEF, 0xDF, 0xFB,
     0xEF, 0xDF, 0x03, 0xEF, 0xC0, 0x03, 0xEF, 0xC0, 0x03, 0xCF, 0xDF, 0xFB, 0xCF, 0xFF, 0xF3, 0xEF,
     0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
+    0x00, 0x4E, 0xF6, /* UNICODE索引 - 件 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8,
+    0x00, 0x01, 0xC0, 0x00, 0x01, 0x83, 0xFF, 0xFF, 0x8F, 0xE3, 0xFF, 0xDF, 0x83, 0xFF, 0xF0, 0x1B,
+    0xFF, 0xF0, 0x7B, 0xFF, 0xF2, 0xFB, 0xFF, 0xFE, 0xFB, 0xFF, 0xFE, 0xFB, 0xFF, 0x80, 0x00, 0x01,
+    0x80, 0x00, 0x01, 0xFE, 0xFB, 0xFF, 0xFE, 0xFB, 0xFF, 0xFE, 0xFB, 0xFF, 0xFE, 0xFB, 0xFF, 0xFE,
+    0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x4F, 0x1A, /* UNICODE索引 - 会 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0xCD, 0xFF, 0xFF,
+    0x9D, 0xF8, 0xFF, 0x1D, 0xF0, 0xFE, 0x1D, 0xE5, 0xFC, 0x5D, 0x8D, 0xF0, 0xDD, 0x1D, 0xC3, 0xDC,
+    0x3D, 0x87, 0xDC, 0x7D, 0x87, 0xDD, 0xF9, 0xD3, 0xDD, 0xFB, 0xF9, 0xDD, 0xDB, 0xFC, 0x9D, 0xCB,
+    0xFE, 0x1D, 0xC3, 0xFE, 0x1D, 0xE3, 0xFF, 0x3D, 0xF0, 0xFF, 0x99, 0xF8, 0xFF, 0x99, 0xFD, 0xFF,
+    0x9D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x4F, 0x20, /* UNICODE索引 - 传 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC,
+    0x00, 0x00, 0xE0, 0x00, 0x00, 0x81, 0x00, 0x01, 0x87, 0xEF, 0xFF, 0xDD, 0xEF, 0xFF, 0xFD, 0xEF,
+    0xFF, 0xFD, 0xEE, 0xFF, 0xFD, 0xE0, 0x6F, 0xFC, 0x00, 0x67, 0x80, 0x02, 0xF7, 0x80, 0xEE, 0xF3,
+    0xDD, 0xEE, 0xE3, 0xFD, 0xEE, 0x89, 0xFD, 0xEE, 0x18, 0xFD, 0xEC, 0x3C, 0xFD, 0xEC, 0x7F, 0xFD,
+    0xEE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x4F, 0x7F, /* UNICODE索引 - 使 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8,
+    0x00, 0x01, 0xC0, 0x00, 0x01, 0x83, 0x7F, 0xFD, 0x8B, 0xFF, 0xFD, 0xFB, 0xFB, 0xF9, 0xFB, 0x01,
+    0xFB, 0xFB, 0x00, 0xF3, 0xFB, 0x76, 0x67, 0xFB, 0x77, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
+    0xC0, 0x03, 0xE7, 0xFB, 0x77, 0xE3, 0xFB, 0x77, 0xF3, 0xFB, 0x03, 0xF3, 0xFB, 0x03, 0xF9, 0xFB,
+    0x03, 0xF9, 0xFB, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB,
+    0x00, 0x4F, 0xDD, /* UNICODE索引 - 保 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8,
+    0x00, 0x01, 0xC0, 0x00, 0x01, 0x83, 0xF7, 0xFB, 0x9F, 0xF7, 0xF3, 0xFF, 0xF7, 0xE7, 0xE0, 0x37,
+    0xCF, 0xE0, 0x37, 0x1F, 0xEF, 0x74, 0x3F, 0xEF, 0x70, 0x7F, 0xEF, 0x00, 0x01, 0xEF, 0x00, 0x01,
+    0xEF, 0x71, 0xF3, 0xEF, 0x70, 0xFF, 0xEF, 0x76, 0x3F, 0xE0, 0x37, 0x1F, 0xE0, 0x37, 0xC7, 0xEF,
+    0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xF7, 0xFF,
+    0x00, 0x4F, 0xE1, /* UNICODE索引 - 信 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8,
+    0x00, 0x01, 0xC1, 0x00, 0x01, 0xC7, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFB, 0x6F, 0xFF, 0xFB, 0x6E,
+    0x01, 0xFB, 0x6E, 0x01, 0xFB, 0x6E, 0xF7, 0xBB, 0x6E, 0xF7, 0x83, 0x6E, 0xF7, 0xC3, 0x6E, 0xF7,
+    0xE3, 0x6E, 0xF7, 0xFB, 0x6E, 0xF7, 0xFB, 0x6E, 0xF7, 0xFA, 0x4E, 0x01, 0xF2, 0x4E, 0x01, 0xF3,
+    0x6E, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x50, 0x3C, /* UNICODE索引 - 值 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x00, 0x01, 0xF0,
+    0x00, 0x01, 0x81, 0x00, 0x01, 0x87, 0xFF, 0xFB, 0xD7, 0xFF, 0xFB, 0xF6, 0xFF, 0xFB, 0xF6, 0x00,
+    0x03, 0xF6, 0x00, 0x03, 0xF6, 0xED, 0xDB, 0x80, 0xED, 0xDB, 0x80, 0xED, 0xDB, 0xC0, 0xED, 0xDB,
+    0xF6, 0xED, 0xDB, 0xF6, 0xED, 0xDB, 0xF6, 0x00, 0x03, 0xF6, 0x00, 0x03, 0xF6, 0xFF, 0xFB, 0xF7,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB,
+    0x00, 0x50, 0x4F, /* UNICODE索引 - 偏 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0,
+    0x00, 0x01, 0x80, 0x00, 0x01, 0x87, 0xFF, 0xE7, 0xDF, 0xFF, 0x0F, 0xF7, 0x80, 0x1F, 0xF0, 0x00,
+    0xFF, 0xF0, 0x00, 0x03, 0xF6, 0xE0, 0x03, 0xB6, 0xEE, 0xFF, 0x96, 0xE0, 0x07, 0xC6, 0xE0, 0x07,
+    0xC6, 0xEE, 0xFF, 0xF6, 0xEE, 0xEF, 0xF6, 0xE0, 0x07, 0xF6, 0xE0, 0x13, 0xF0, 0x6E, 0xF3, 0xF0,
+    0x60, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF,
     0x00, 0x51, 0x6D, /* UNICODE索引 - 六 */
     0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFD, 0xFF, 0x7F, 0xF9, 0xFF, 0x7F, 0xF3, 0xFF, 0x7F, 0xE7, 0xFF,
     0x7F, 0x8F, 0xFF, 0x7F, 0x1F, 0xFF, 0x7C, 0x3F, 0xFF, 0x60, 0x7F, 0xBF, 0x61, 0xFF, 0x9F, 0x67,
     0xFF, 0xC7, 0x7F, 0xFF, 0xC1, 0x7F, 0xFF, 0xE1, 0x7F, 0xFF, 0xFF, 0x77, 0xFF, 0xFF, 0x73, 0xFF,
     0xFF, 0x79, 0xFF, 0xFF, 0x7C, 0x7F, 0xFF, 0x7E, 0x3F, 0xFF, 0x7F, 0x07, 0xFE, 0x7F, 0x83, 0xFE,
     0x7F, 0xC3, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x65, 0xE5, /* UNICODE索引 - 日 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-    0x00, 0x01, 0xC0, 0x00, 0x01, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF,
-    0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF,
-    0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x5E, 0x74, /* UNICODE索引 - 年 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x3E, 0xFF, 0xFE, 0x7E, 0xFF, 0xFC, 0xFE, 0xFF, 0xF1,
-    0xC0, 0xFF, 0xC3, 0xC0, 0xFF, 0x87, 0xC0, 0xFF, 0x97, 0xDE, 0xFF, 0xF7, 0xDE, 0xFF, 0xF7, 0xDE,
-    0xFF, 0xF7, 0xDE, 0xFF, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF7, 0xDE, 0xFF,
-    0xF7, 0xDE, 0xFF, 0xF7, 0xDE, 0xFF, 0xF7, 0x9E, 0xFF, 0xF7, 0x9E, 0xFF, 0xE7, 0xDE, 0xFF, 0xE7,
-    0xFE, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x67, 0x08, /* UNICODE索引 - 月 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xC7, 0xE7, 0xF0, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xEF, 0x7B, 0xFF, 0xEF, 0x7B,
-    0xFF, 0xEF, 0x7B, 0xFF, 0xEF, 0x7B, 0xFF, 0xEF, 0x7B, 0xF7, 0xEF, 0x7B, 0xF7, 0xEF, 0x7B, 0xF3,
-    0xEF, 0x7B, 0xF9, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x54, 0x68, /* UNICODE索引 - 周 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xC3, 0xC0, 0x00, 0x0F, 0xC0,
-    0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xDE, 0xDF, 0xFF, 0xDE, 0xDB, 0xCF, 0xDE, 0xD8, 0x0F, 0xDE, 0xD8,
-    0x1F, 0xDE, 0xDB, 0xBF, 0xD0, 0x1B, 0xBF, 0xD0, 0x1B, 0xBF, 0xDE, 0xDB, 0xBF, 0xDE, 0xD8, 0x1F,
-    0xDE, 0xD8, 0x1B, 0xDE, 0xDB, 0xFB, 0xDF, 0xDF, 0xF9, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x68, 0x3C, /* UNICODE索引 - 格 */
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x7F, 0xFD, 0xFC, 0x7F, 0xFD, 0xF0, 0xFF, 0xFD, 0x03, 0xFF, 0x80,
-    0x00, 0x01, 0x80, 0x00, 0x01, 0xFD, 0x8E, 0xFF, 0xF9, 0xC4, 0xFF, 0xF9, 0x65, 0xFF, 0xFC, 0x79,
-    0xFF, 0xF8, 0xF8, 0x01, 0xC1, 0xF0, 0x01, 0x80, 0xE5, 0xF7, 0x94, 0x0D, 0xF7, 0xF7, 0x1D, 0xF7,
-    0xF6, 0x0D, 0xF7, 0xF4, 0x65, 0xF7, 0xF0, 0xE4, 0x01, 0xF1, 0xF0, 0x01, 0xF7, 0xF1, 0xFF, 0xFF,
-    0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x5F, 0x0F, /* UNICODE索引 - 式 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xEF, 0xF3, 0xFD, 0xEF, 0xF3, 0xFD, 0xEF, 0xF3, 0xFD,
-    0xEF, 0xF7, 0xFD, 0xEF, 0xE7, 0xFD, 0xE0, 0x0F, 0xFD, 0xE0, 0x0F, 0xFD, 0xEF, 0xCF, 0xFD, 0xEF,
-    0xDF, 0xFD, 0xEF, 0xDF, 0xFD, 0xEF, 0xDF, 0x80, 0x7F, 0xDF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0x7F,
-    0xFD, 0xF8, 0x1F, 0xDD, 0xFF, 0x0F, 0xC5, 0xFF, 0xC7, 0xE1, 0xFF, 0xE3, 0xE1, 0xFF, 0xF3, 0xF9,
-    0xFF, 0x81, 0xFD, 0xFF, 0x81, 0xFF, 0xFF, 0xFD,
-    0x00, 0x5C, 0x0F, /* UNICODE索引 - 小 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xF1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xF7, 0xFF, 0xBF, 0xF3, 0xFF, 0xFF,
-    0xF9, 0xCF, 0xFF, 0xF1, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
-    0xFF, 0x3F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
-    0xF0, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x51, 0x73, /* UNICODE索引 - 关 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFD, 0xFD, 0xF7, 0xF9, 0xFD, 0xF7, 0xFB, 0xFD,
+    0xF7, 0xF3, 0xFD, 0xF7, 0xF7, 0xDD, 0xF7, 0xE7, 0xCD, 0xF7, 0xCF, 0xC1, 0xF7, 0x1F, 0xE1, 0xF4,
+    0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xFC, 0x31, 0xFF, 0xF1, 0xF0, 0x7F, 0x81, 0xF6, 0x3F,
+    0x8D, 0xF7, 0x1F, 0xDD, 0xF7, 0xCF, 0xFD, 0xF7, 0xE7, 0xFD, 0xF7, 0xE3, 0xFD, 0xE7, 0xF1, 0xFD,
+    0xE7, 0xF1, 0xFF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFB,
+    0x00, 0x51, 0x8D, /* UNICODE索引 - 再 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFE, 0xFF, 0xEF, 0xFE, 0xFF, 0xEF, 0xFE, 0xFF, 0xEE,
+    0x00, 0x01, 0xEE, 0x00, 0x01, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE,
+    0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFB,
+    0xEE, 0xEE, 0xFB, 0xEE, 0x00, 0x01, 0xEE, 0x00, 0x01, 0xCE, 0x00, 0x03, 0xCF, 0xFE, 0xFF, 0xEF,
+    0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x52, 0x1D, /* UNICODE索引 - 初 */
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xFB, 0xF9, 0xFF, 0xFB, 0xF3, 0xFF, 0xFB, 0xE7, 0xFF, 0xBB,
+    0xC7, 0xFF, 0x83, 0x00, 0x01, 0xC2, 0x00, 0x01, 0xE0, 0x73, 0xFD, 0xF9, 0xC1, 0xF9, 0xFB, 0x88,
+    0xF3, 0xF7, 0x9C, 0xC7, 0xF7, 0xFF, 0x0F, 0xF7, 0xF0, 0x1F, 0xF0, 0x00, 0x7F, 0xF0, 0x03, 0xF7,
+    0xF7, 0xFF, 0xF7, 0xF7, 0xFF, 0xF3, 0xF7, 0xFF, 0xF9, 0xF7, 0xFF, 0xE1, 0xF4, 0x00, 0x03, 0xF0,
+    0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x52, 0x30, /* UNICODE索引 - 到 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFB, 0xEF, 0x9D, 0xF3, 0xEF, 0x1D, 0xF3, 0xEE,
+    0x1D, 0xF3, 0xEC, 0xBD, 0xF7, 0xE1, 0x80, 0x07, 0xE3, 0x80, 0x07, 0xE3, 0x80, 0x0F, 0xEE, 0xBD,
+    0xEF, 0xEE, 0x3D, 0xEF, 0xCE, 0x19, 0xEF, 0xCF, 0x09, 0xCF, 0xEF, 0x8D, 0xDF, 0xFF, 0xFF, 0xFF,
+    0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3B, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF9, 0xC0, 0x00, 0x01, 0xC0,
+    0x00, 0x01, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
     0x00, 0x52, 0x36, /* UNICODE索引 - 制 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x3F, 0xFF, 0xF8, 0x30, 0x0F, 0xF0, 0xB0, 0x0F, 0xF1,
     0xB7, 0xFF, 0xFD, 0xB7, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0xDD, 0xB7, 0xDF, 0xFD, 0xB7,
     0xDF, 0xF9, 0xB7, 0xCF, 0xF9, 0xB0, 0x0F, 0xFD, 0xB0, 0x1F, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
     0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x7B, 0xFB, 0xFF, 0xFB, 0xFF, 0xFF, 0xF9, 0x80, 0x00, 0x01, 0x80,
     0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4E, 0x0A, /* UNICODE索引 - 上 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xC0, 0x00,
-    0x07, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xFF, 0xBF, 0xF7, 0xFF, 0xBF, 0xF7, 0xFF, 0xBF, 0xF7,
-    0xFF, 0xBF, 0xF7, 0xFF, 0xBF, 0xF7, 0xFF, 0x3F, 0xF7, 0xFF, 0x3F, 0xF7, 0xFF, 0xBF, 0xE7, 0xFF,
-    0xFF, 0xE7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4E, 0x0B, /* UNICODE索引 - 下 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xEF, 0xBF, 0xFF, 0xEF, 0x9F, 0xFF, 0xEF, 0xDF, 0xFF,
-    0xEF, 0xCF, 0xFF, 0xEF, 0xC7, 0xFF, 0xEF, 0xE3, 0xFF, 0xEF, 0xE3, 0xFF, 0xCF, 0xFB, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x53, 0x16, /* UNICODE索引 - 化 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8,
+    0x00, 0x01, 0xE0, 0x00, 0x01, 0x81, 0x00, 0x03, 0x8F, 0xFF, 0x7F, 0xDF, 0xFE, 0x7F, 0xFF, 0xFE,
+    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF9, 0xFF, 0x80, 0x00, 0x07, 0x80, 0x00, 0x03, 0xDF, 0xC7, 0xF3,
+    0xFF, 0x8F, 0xFB, 0xFF, 0x1F, 0xFB, 0xFE, 0x3F, 0xFB, 0xFC, 0x7F, 0xFB, 0xFC, 0xFF, 0xF3, 0xFF,
+    0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF7,
     0x00, 0x53, 0x48, /* UNICODE索引 - 午 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0x97, 0xFF, 0xFE, 0x37, 0xFF, 0xF8,
     0x77, 0xFF, 0xE1, 0xF7, 0xFF, 0x83, 0xF7, 0xFF, 0x8B, 0xF7, 0xFF, 0xDB, 0xF7, 0xFF, 0xFB, 0xF7,
     0xFF, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xFB, 0xF7, 0xFF, 0xFB, 0xF7, 0xFF,
     0xFB, 0xF7, 0xFF, 0xFB, 0xF7, 0xFF, 0xF3, 0xF7, 0xFF, 0xF3, 0xF7, 0xFF, 0xFB, 0xE7, 0xFF, 0xFF,
     0xE7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x6B, 0x22, /* UNICODE索引 - 欢 */
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFB, 0xFB, 0x7F, 0xE3, 0xFB, 0x3F, 0xC7, 0xFB, 0x9F, 0x1F, 0xFB,
-    0xC4, 0x3F, 0xFB, 0xE0, 0x7F, 0xFB, 0x80, 0xFD, 0xF8, 0x04, 0x3D, 0xF8, 0x3E, 0x09, 0xF9, 0xF7,
-    0x03, 0xFF, 0xC7, 0xE7, 0xFF, 0x0F, 0xC7, 0xF0, 0x3F, 0x0F, 0xC0, 0xF8, 0x1F, 0xC6, 0x00, 0x7F,
-    0xFE, 0x03, 0xFF, 0xFE, 0x80, 0x3F, 0xFE, 0xFC, 0x0F, 0xFE, 0xDF, 0x87, 0xFE, 0x1F, 0xE3, 0xFE,
-    0x3F, 0xF3, 0xFE, 0x7F, 0xFB, 0xFF, 0xFF, 0xFB,
-    0x00, 0x8F, 0xCE, /* UNICODE索引 - 迎 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xEF, 0xFF, 0xBF, 0xE7, 0xFF, 0xBF, 0xC7, 0xE7, 0xBF, 0xDF, 0xE3,
-    0x80, 0x1F, 0xF3, 0x80, 0x1F, 0xFF, 0xBF, 0xCF, 0xFF, 0xFF, 0xE7, 0xF0, 0x00, 0x67, 0xF0, 0x00,
-    0x77, 0xF7, 0xFC, 0xF3, 0xE7, 0xFD, 0xF3, 0xEF, 0xF9, 0xF3, 0xCF, 0xFB, 0xF3, 0xC8, 0x00, 0x0B,
-    0xE8, 0x00, 0x0B, 0xFB, 0xFE, 0xFB, 0xFB, 0xFE, 0xF3, 0xFB, 0xFE, 0x73, 0xF8, 0x00, 0x73, 0xF8,
-    0x00, 0x73, 0xFB, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7,
-    0x00, 0x4F, 0x7F, /* UNICODE索引 - 使 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8,
-    0x00, 0x01, 0xC0, 0x00, 0x01, 0x83, 0x7F, 0xFD, 0x8B, 0xFF, 0xFD, 0xFB, 0xFB, 0xF9, 0xFB, 0x01,
-    0xFB, 0xFB, 0x00, 0xF3, 0xFB, 0x76, 0x67, 0xFB, 0x77, 0x07, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F,
-    0xC0, 0x03, 0xE7, 0xFB, 0x77, 0xE3, 0xFB, 0x77, 0xF3, 0xFB, 0x03, 0xF3, 0xFB, 0x03, 0xF9, 0xFB,
-    0x03, 0xF9, 0xFB, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB,
-    0x00, 0x75, 0x28, /* UNICODE索引 - 用 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x83, 0xE0, 0x00, 0x0F, 0xE0,
-    0x00, 0x3F, 0xE0, 0x3D, 0xFF, 0xEF, 0x7D, 0xFF, 0xEF, 0x7D, 0xFF, 0xEF, 0x7D, 0xFF, 0xEF, 0x7D,
-    0xFF, 0xEF, 0x7D, 0xE1, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xEF, 0x7D, 0xFF, 0xEF, 0x7D, 0xFF,
-    0xEF, 0x7D, 0xF7, 0xEF, 0x7D, 0xF3, 0xEF, 0x7D, 0xF9, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4E, 0x3B, /* UNICODE索引 - 主 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xFE, 0xFF, 0xFB, 0xFE, 0xFF, 0xFB, 0xFE,
-    0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xDE, 0xFD, 0xFB, 0xCE, 0xFD,
-    0xFB, 0xE2, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB,
-    0xFE, 0xFD, 0xFB, 0xFE, 0xFD, 0xFB, 0xFE, 0xF9, 0xFB, 0xFC, 0xF9, 0xFB, 0xFC, 0xFD, 0xF3, 0xFE,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-    0x00, 0x83, 0xDC, /* UNICODE索引 - 菜 */
-    0xFF, 0xFF, 0xFF, 0xF7, 0xFD, 0xFD, 0xF7, 0xFD, 0xF9, 0xF7, 0x7D, 0xFB, 0xF7, 0x7D, 0xF3, 0xF7,
-    0x5D, 0xE7, 0xF7, 0x45, 0xE7, 0xF7, 0x65, 0xCF, 0x81, 0x75, 0x9F, 0x81, 0x7C, 0x3F, 0xC1, 0x3C,
-    0x7F, 0xF7, 0x10, 0x01, 0xF6, 0x40, 0x01, 0xF6, 0xC8, 0x03, 0x80, 0xFC, 0x7F, 0x80, 0xF9, 0x3F,
-    0xF6, 0xE1, 0x9F, 0xF6, 0xC5, 0xCF, 0xF4, 0xCD, 0xE7, 0xF4, 0xDD, 0xE7, 0xE6, 0xF9, 0xF3, 0xE7,
-    0xF9, 0xF3, 0xF7, 0xFD, 0xF7, 0xFF, 0xFF, 0xF7,
     0x00, 0x53, 0x55, /* UNICODE索引 - 单 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x7F, 0xF8,
     0x00, 0x7F, 0xF8, 0x01, 0x7F, 0xBB, 0xBB, 0x7F, 0x8B, 0xBB, 0x7F, 0xC3, 0xBB, 0x7F, 0xE3, 0xBB,
     0x7F, 0xF8, 0x00, 0x01, 0xF8, 0x00, 0x01, 0xFB, 0xBB, 0x7F, 0xE3, 0xBB, 0x7F, 0x83, 0xBB, 0x7F,
     0x8B, 0xBB, 0x7F, 0xDB, 0xBB, 0x7F, 0xF8, 0x01, 0x7F, 0xF8, 0x01, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF,
     0xFE, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x98, 0x75, /* UNICODE索引 - 页 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFD, 0xEF, 0xFF, 0xFD, 0xEF, 0xFF, 0xFD, 0xEE,
-    0x00, 0x39, 0xEE, 0x00, 0x3B, 0xEE, 0x00, 0x73, 0xEE, 0xFF, 0xE7, 0xEE, 0xFF, 0xC7, 0xE0, 0xFF,
-    0x0F, 0xE0, 0x80, 0x1F, 0xE2, 0x80, 0x3F, 0xEE, 0xDF, 0xBF, 0xEE, 0xFF, 0xBF, 0xEE, 0xFF, 0x9F,
-    0xEE, 0xFF, 0xCF, 0xEC, 0x00, 0x4F, 0xEC, 0x00, 0x67, 0xCE, 0xFF, 0xE3, 0xCF, 0xFF, 0xF3, 0xEF,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x8F, 0xD4, /* UNICODE索引 - 返 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xDF, 0xF9, 0xFF, 0xDF, 0xF1, 0xEF, 0xDF, 0xE7, 0xE1,
-    0xC0, 0x0F, 0xF1, 0xC0, 0x0F, 0xFB, 0xDF, 0xC7, 0xFF, 0xFF, 0x13, 0xFF, 0xF0, 0x2B, 0xF0, 0x00,
-    0xEB, 0xF0, 0x03, 0xC9, 0xF7, 0x6F, 0xD9, 0xF7, 0x67, 0x99, 0xE7, 0x73, 0x39, 0xEF, 0x7A, 0x79,
-    0xEF, 0x78, 0xF9, 0xEF, 0x60, 0xF9, 0xCF, 0x00, 0x79, 0xCF, 0x0E, 0x39, 0xEF, 0x3F, 0x19, 0xFF,
-    0xFF, 0x99, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB,
+    0x00, 0x53, 0x8B, /* UNICODE索引 - 压 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xC3, 0xE0, 0x00, 0x07, 0xE0,
+    0x00, 0x17, 0xE0, 0x01, 0xF7, 0xEF, 0xEF, 0xF7, 0xEF, 0xEF, 0xF7, 0xEF, 0xEF, 0xF7, 0xEF, 0xEF,
+    0xF7, 0xEF, 0xEF, 0xF7, 0xE8, 0x00, 0x07, 0xE8, 0x00, 0x07, 0xE8, 0x00, 0x07, 0xEF, 0xEF, 0xF7,
+    0xEF, 0xED, 0xF7, 0xEF, 0xEC, 0x77, 0xEF, 0xEE, 0x17, 0xEF, 0xEF, 0x17, 0xCF, 0xEF, 0xB7, 0xCF,
+    0xFF, 0xF7, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x00, 0x53, 0xC2, /* UNICODE索引 - 参 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0x7C, 0xFF, 0xFF, 0x7D, 0xFD, 0xFF, 0x79, 0x7D, 0xF9,
+    0x73, 0x6D, 0xF9, 0x66, 0x6D, 0xF1, 0x46, 0xCD, 0xE5, 0x0C, 0xD9, 0xEC, 0x19, 0x9B, 0xCC, 0x33,
+    0xBB, 0xDC, 0x63, 0x33, 0xD9, 0x46, 0x77, 0xFB, 0x4C, 0x67, 0xEB, 0x38, 0xE7, 0xEB, 0x19, 0xCF,
+    0xE3, 0x4D, 0xCF, 0xF3, 0x67, 0x9F, 0xF1, 0x73, 0x9F, 0xF8, 0x73, 0xBF, 0xFC, 0x79, 0xFF, 0xFF,
+    0x79, 0xFF, 0xFF, 0x7B, 0xFF, 0xFF, 0xFB, 0xFF,
+    0x00, 0x54, 0x0E, /* UNICODE索引 - 后 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x07, 0xF0,
+    0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xF7, 0x7F, 0xFF, 0xF7, 0x7B, 0xE3, 0xF7, 0x78, 0x03, 0xF7, 0x78,
+    0x03, 0xF7, 0x7B, 0xEF, 0xF7, 0x7B, 0xEF, 0xF7, 0x7B, 0xEF, 0xE7, 0x7B, 0xEF, 0xEF, 0x7B, 0xEF,
+    0xEF, 0x7B, 0xEF, 0xEF, 0x7B, 0xEF, 0xEF, 0x78, 0x03, 0xCF, 0x78, 0x03, 0xCE, 0x78, 0x07, 0xEE,
+    0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x54, 0x2F, /* UNICODE索引 - 启 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x07, 0xF0,
+    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xF7, 0xBF, 0xFF, 0xF7, 0xB8, 0x01, 0xF7, 0xB8, 0x01, 0xF7, 0xBB,
+    0xF7, 0xB7, 0xBB, 0xF7, 0x87, 0xBB, 0xF7, 0xC7, 0xBB, 0xF7, 0xE7, 0xBB, 0xF7, 0xF7, 0xBB, 0xF7,
+    0xF7, 0xBB, 0xF7, 0xF7, 0xBB, 0xF7, 0xF0, 0x18, 0x01, 0xF0, 0x18, 0x01, 0xF0, 0x18, 0x03, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x54, 0x4A, /* UNICODE索引 - 告 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFE, 0x5F, 0xFF, 0xF8,
+    0xDF, 0xFF, 0xC1, 0xDC, 0x01, 0xC3, 0xDC, 0x01, 0xCB, 0xDD, 0xF7, 0xFB, 0xDD, 0xF7, 0xFB, 0xDD,
+    0xF7, 0x80, 0x1D, 0xF7, 0x80, 0x1D, 0xF7, 0xC0, 0x1D, 0xF7, 0xFB, 0xDD, 0xF7, 0xFB, 0xDD, 0xF7,
+    0xFB, 0xDD, 0xF7, 0xFB, 0xDC, 0x01, 0xFB, 0xDC, 0x01, 0xFB, 0xDD, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x54, 0x68, /* UNICODE索引 - 周 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xC3, 0xC0, 0x00, 0x0F, 0xC0,
+    0x00, 0x3F, 0xC0, 0x03, 0xFF, 0xDE, 0xDF, 0xFF, 0xDE, 0xDB, 0xCF, 0xDE, 0xD8, 0x0F, 0xDE, 0xD8,
+    0x1F, 0xDE, 0xDB, 0xBF, 0xD0, 0x1B, 0xBF, 0xD0, 0x1B, 0xBF, 0xDE, 0xDB, 0xBF, 0xDE, 0xD8, 0x1F,
+    0xDE, 0xD8, 0x1B, 0xDE, 0xDB, 0xFB, 0xDF, 0xDF, 0xF9, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xEF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x56, 0x68, /* UNICODE索引 - 器 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x7F, 0xFF, 0xDF, 0x7F, 0xC0, 0x1E, 0x7D, 0xC0,
+    0x1C, 0x01, 0xC0, 0x5C, 0x03, 0xDE, 0xD8, 0xF7, 0xDE, 0xD2, 0xF7, 0xC0, 0x46, 0x01, 0xC0, 0x0E,
+    0x01, 0xE0, 0x1E, 0x03, 0xFF, 0x1F, 0xFF, 0xC0, 0x5E, 0x01, 0xC0, 0x4E, 0x01, 0xC0, 0x46, 0xF7,
+    0xDE, 0x12, 0xF7, 0xDE, 0x18, 0xF7, 0xC0, 0x1C, 0x01, 0xC0, 0x5C, 0x01, 0xC0, 0x1C, 0x03, 0xFF,
+    0x9E, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x56, 0xDB, /* UNICODE索引 - 四 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0,
+    0x00, 0x01, 0xEF, 0xFF, 0x97, 0xEF, 0xFE, 0x37, 0xEF, 0xF0, 0x77, 0xE0, 0x01, 0xF7, 0xE0, 0x07,
+    0xF7, 0xEF, 0xFF, 0xF7, 0xEF, 0xFF, 0xF7, 0xEF, 0xFF, 0xF7, 0xE0, 0x00, 0xF7, 0xE0, 0x00, 0xF7,
+    0xEF, 0xFE, 0xF7, 0xEF, 0xFE, 0xF7, 0xEF, 0xFE, 0xF7, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0,
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
     0x00, 0x56, 0xDE, /* UNICODE索引 - 回 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0,
     0x00, 0x01, 0xEF, 0xFF, 0xF7, 0xEF, 0xFF, 0xF7, 0xEF, 0x00, 0x77, 0xEF, 0x00, 0x77, 0xEF, 0x7D,
     0xF7, 0xEF, 0x7D, 0xF7, 0xEF, 0x7D, 0xF7, 0xEF, 0x7D, 0xF7, 0xEF, 0x7D, 0xF7, 0xEF, 0x00, 0xF7,
     0xEF, 0x00, 0xF7, 0xEF, 0x7F, 0xF7, 0xEF, 0xFF, 0xF7, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xC0,
     0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x75, 0x35, /* UNICODE索引 - 电 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFC,
-    0x00, 0x3F, 0xFD, 0xDE, 0xFF, 0xFD, 0xDE, 0xFF, 0xFD, 0xDE, 0xFF, 0xFD, 0xDE, 0xFF, 0xFD, 0xDE,
-    0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0xFD, 0xDE, 0xFD, 0xFD, 0xDE, 0xFD, 0xFD, 0xDE, 0xFD,
-    0xFD, 0xDE, 0xFD, 0xFD, 0xDE, 0xFD, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xFD, 0xFF, 0xF9, 0xFF,
-    0xFF, 0xC1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF,
-    0x00, 0x6C, 0x60, /* UNICODE索引 - 池 */
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x3F, 0x7F, 0xDF, 0x1F, 0x03, 0xCF, 0x9C, 0x03, 0xE3,
-    0xE0, 0x03, 0xE3, 0x03, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFC, 0x00,
-    0x03, 0xFC, 0x00, 0x03, 0xFF, 0xBF, 0xFB, 0xFF, 0xBF, 0xFB, 0xC0, 0x00, 0x1B, 0xC0, 0x00, 0x1B,
-    0xFF, 0x7E, 0xFB, 0xFF, 0x7E, 0xFB, 0xFF, 0x7E, 0x7B, 0xFE, 0x00, 0x7B, 0xFE, 0x00, 0xFB, 0xFE,
-    0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF7,
-    0x00, 0x94, 0xC3, /* UNICODE索引 - 铃 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x1B, 0xFF, 0xF0, 0x3B, 0xFF, 0xC0,
-    0x80, 0x03, 0xC1, 0x80, 0x03, 0xED, 0xBB, 0xC7, 0xFD, 0xBB, 0xCF, 0xFD, 0xB3, 0x9F, 0xFD, 0xE1,
-    0xBF, 0xFF, 0x89, 0xFF, 0xFF, 0x1B, 0xFF, 0xFC, 0x3B, 0xBF, 0xE0, 0xBB, 0x9F, 0xC1, 0x9B, 0xCF,
-    0xC3, 0xC3, 0xC7, 0xE0, 0xC3, 0x01, 0xFC, 0x78, 0x31, 0xFF, 0x18, 0xFB, 0xFF, 0x89, 0xFF, 0xFF,
-    0x8F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
     0x00, 0x58, 0xF0, /* UNICODE索引 - 声 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF7, 0xFF, 0xF9, 0xF7, 0xFF, 0xF3, 0xF6, 0xFF, 0xC7, 0xF6,
     0xC0, 0x0F, 0xF6, 0xC0, 0x3F, 0xF6, 0xDD, 0xFF, 0xF6, 0xDD, 0xFF, 0xF6, 0xDD, 0xFF, 0xF6, 0xDD,
     0xFF, 0xF6, 0xDD, 0xFF, 0x80, 0xC1, 0xFF, 0x80, 0xC1, 0xFF, 0xF6, 0xDD, 0xFF, 0xF6, 0xDD, 0xFF,
     0xF6, 0xDD, 0xFF, 0xF6, 0xDD, 0xFF, 0xF4, 0xDD, 0xFF, 0xF4, 0xC0, 0xFF, 0xE6, 0xC0, 0xFF, 0xE7,
     0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4F, 0x20, /* UNICODE索引 - 传 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x0F, 0xFF, 0xFC,
-    0x00, 0x00, 0xE0, 0x00, 0x00, 0x81, 0x00, 0x01, 0x87, 0xEF, 0xFF, 0xDD, 0xEF, 0xFF, 0xFD, 0xEF,
-    0xFF, 0xFD, 0xEE, 0xFF, 0xFD, 0xE0, 0x6F, 0xFC, 0x00, 0x67, 0x80, 0x02, 0xF7, 0x80, 0xEE, 0xF3,
-    0xDD, 0xEE, 0xE3, 0xFD, 0xEE, 0x89, 0xFD, 0xEE, 0x18, 0xFD, 0xEC, 0x3C, 0xFD, 0xEC, 0x7F, 0xFD,
-    0xEE, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x61, 0x1F, /* UNICODE索引 - 感 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0x73, 0xFF, 0xF0, 0xE3, 0xF0, 0x03, 0x87, 0xF0,
-    0x0F, 0x8F, 0xF6, 0xFF, 0xFF, 0xF6, 0xC1, 0x81, 0xF6, 0xC1, 0x81, 0xF6, 0xDB, 0xFD, 0xF6, 0xDB,
-    0xFD, 0xF6, 0xDB, 0x3D, 0xF6, 0xC0, 0x1D, 0xF6, 0xC0, 0x9D, 0x80, 0xF9, 0xDD, 0x80, 0x01, 0xFD,
-    0xF4, 0x03, 0xE1, 0xB7, 0xC3, 0xE1, 0x87, 0x01, 0xBF, 0xC4, 0x18, 0x9F, 0xF4, 0x7C, 0xC7, 0xF6,
-    0xF0, 0x47, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0x7F,
-    0x00, 0x56, 0x68, /* UNICODE索引 - 器 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x7F, 0xFF, 0xDF, 0x7F, 0xC0, 0x1E, 0x7D, 0xC0,
-    0x1C, 0x01, 0xC0, 0x5C, 0x03, 0xDE, 0xD8, 0xF7, 0xDE, 0xD2, 0xF7, 0xC0, 0x46, 0x01, 0xC0, 0x0E,
-    0x01, 0xE0, 0x1E, 0x03, 0xFF, 0x1F, 0xFF, 0xC0, 0x5E, 0x01, 0xC0, 0x4E, 0x01, 0xC0, 0x46, 0xF7,
-    0xDE, 0x12, 0xF7, 0xDE, 0x18, 0xF7, 0xC0, 0x1C, 0x01, 0xC0, 0x5C, 0x01, 0xC0, 0x1C, 0x03, 0xFF,
-    0x9E, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x53, 0xC2, /* UNICODE索引 - 参 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xFF, 0xFF, 0x7C, 0xFF, 0xFF, 0x7D, 0xFD, 0xFF, 0x79, 0x7D, 0xF9,
-    0x73, 0x6D, 0xF9, 0x66, 0x6D, 0xF1, 0x46, 0xCD, 0xE5, 0x0C, 0xD9, 0xEC, 0x19, 0x9B, 0xCC, 0x33,
-    0xBB, 0xDC, 0x63, 0x33, 0xD9, 0x46, 0x77, 0xFB, 0x4C, 0x67, 0xEB, 0x38, 0xE7, 0xEB, 0x19, 0xCF,
-    0xE3, 0x4D, 0xCF, 0xF3, 0x67, 0x9F, 0xF1, 0x73, 0x9F, 0xF8, 0x73, 0xBF, 0xFC, 0x79, 0xFF, 0xFF,
-    0x79, 0xFF, 0xFF, 0x7B, 0xFF, 0xFF, 0xFB, 0xFF,
-    0x00, 0x80, 0x03, /* UNICODE索引 - 考 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0x7F, 0xFF, 0x7F, 0x7F, 0xF7, 0x7E, 0x7F, 0xF7,
-    0x7C, 0xFF, 0xF7, 0x7D, 0xFF, 0xF7, 0x79, 0xFF, 0xF7, 0x73, 0xFF, 0xF7, 0x73, 0xFF, 0x80, 0x66,
-    0xFF, 0x80, 0x40, 0xF7, 0x80, 0x10, 0xF7, 0xF7, 0x32, 0xF3, 0xF6, 0x76, 0xF9, 0xF0, 0x76, 0xF9,
-    0xF1, 0x76, 0xF9, 0xE3, 0x76, 0xC1, 0xC7, 0x76, 0x03, 0xCF, 0x66, 0x0F, 0xFF, 0x66, 0xFF, 0xFE,
-    0x77, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF,
-    0x00, 0x53, 0x8B, /* UNICODE索引 - 压 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xC3, 0xE0, 0x00, 0x07, 0xE0,
-    0x00, 0x17, 0xE0, 0x01, 0xF7, 0xEF, 0xEF, 0xF7, 0xEF, 0xEF, 0xF7, 0xEF, 0xEF, 0xF7, 0xEF, 0xEF,
-    0xF7, 0xEF, 0xEF, 0xF7, 0xE8, 0x00, 0x07, 0xE8, 0x00, 0x07, 0xE8, 0x00, 0x07, 0xEF, 0xEF, 0xF7,
-    0xEF, 0xED, 0xF7, 0xEF, 0xEC, 0x77, 0xEF, 0xEE, 0x17, 0xEF, 0xEF, 0x17, 0xCF, 0xEF, 0xB7, 0xCF,
-    0xFF, 0xF7, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7C, 0xFB, /* UNICODE索引 - 系 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFB, 0xF7, 0xEF,
-    0x79, 0xE7, 0xEF, 0x39, 0xCF, 0xEE, 0x31, 0x9F, 0xEE, 0x30, 0x17, 0xEC, 0x22, 0x37, 0xE9, 0x6B,
-    0xF3, 0xE3, 0x4B, 0xF9, 0xE3, 0x58, 0x01, 0xC7, 0x18, 0x03, 0xD7, 0x38, 0x07, 0xDF, 0x3B, 0x7F,
-    0xDE, 0x7B, 0x7F, 0xDC, 0xEB, 0x3F, 0x9C, 0xE3, 0x9F, 0x9F, 0xF1, 0x8F, 0xDF, 0xF1, 0xC3, 0xFF,
-    0xF9, 0xE3, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7E, 0xDF, /* UNICODE索引 - 统 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0xCF, 0xFE, 0x39, 0xCF, 0xF8, 0x61, 0xCF, 0xE1,
-    0x41, 0xDF, 0x87, 0x0B, 0x9F, 0x8F, 0x1B, 0xBF, 0xDC, 0x7B, 0xBD, 0xFC, 0xFB, 0xB9, 0xF5, 0xEF,
-    0xFB, 0xF7, 0xCF, 0xF3, 0xF7, 0x8F, 0xC7, 0xF6, 0x20, 0x0F, 0xB0, 0x60, 0x1F, 0x81, 0xC7, 0xFF,
-    0xC1, 0xDF, 0xFF, 0xE7, 0xC0, 0x03, 0xF7, 0x40, 0x03, 0xF7, 0x1F, 0xFB, 0xF7, 0x8F, 0xFB, 0xF7,
-    0x8F, 0x83, 0xF7, 0xCF, 0x83, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4F, 0xE1, /* UNICODE索引 - 信 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8,
-    0x00, 0x01, 0xC1, 0x00, 0x01, 0xC7, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xFB, 0x6F, 0xFF, 0xFB, 0x6E,
-    0x01, 0xFB, 0x6E, 0x01, 0xFB, 0x6E, 0xF7, 0xBB, 0x6E, 0xF7, 0x83, 0x6E, 0xF7, 0xC3, 0x6E, 0xF7,
-    0xE3, 0x6E, 0xF7, 0xFB, 0x6E, 0xF7, 0xFB, 0x6E, 0xF7, 0xFA, 0x4E, 0x01, 0xF2, 0x4E, 0x01, 0xF3,
-    0x6E, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x60, 0x6F, /* UNICODE索引 - 息 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x07, 0xFF,
-    0xFF, 0x07, 0xE0, 0x03, 0xFF, 0xE0, 0x02, 0x0F, 0xED, 0xB6, 0x03, 0xED, 0xB7, 0x03, 0x8D, 0xB3,
-    0xFB, 0x8D, 0xB0, 0xFB, 0xAD, 0xB4, 0x3B, 0xED, 0xB6, 0x3B, 0xED, 0xB7, 0x3B, 0xED, 0xB7, 0xFB,
-    0xED, 0xB7, 0xF3, 0xE0, 0x03, 0xC3, 0xE0, 0x03, 0xC3, 0xEF, 0xF7, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF,
-    0xFF, 0x87, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
-    0x00, 0x60, 0x62, /* UNICODE索引 - 恢 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x80,
-    0x00, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x7F, 0x8F, 0xFA, 0x7F, 0x1D, 0xFB, 0x7C, 0x79, 0xFB, 0xE0,
-    0xFB, 0xFB, 0x01, 0xF3, 0x80, 0x09, 0xE7, 0x80, 0x41, 0x8F, 0xC3, 0xC6, 0x1F, 0xFA, 0x00, 0x3F,
-    0xFA, 0x00, 0xFF, 0xFA, 0x00, 0x7F, 0xFB, 0xF8, 0x1F, 0xFB, 0xF3, 0x87, 0xFB, 0xC7, 0xC3, 0xFB,
-    0xCF, 0xE3, 0xFB, 0xEF, 0xF3, 0xFF, 0xFF, 0xFF,
     0x00, 0x59, 0x0D, /* UNICODE索引 - 复 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFD, 0xFE, 0x7F, 0xED, 0xFC, 0xFF, 0xCD, 0xF9,
     0xFF, 0x9D, 0xE3, 0xFF, 0x39, 0x84, 0x06, 0x7B, 0x8C, 0x00, 0x7B, 0xCD, 0xB0, 0xF3, 0xED, 0xB0,
     0x37, 0xED, 0xB5, 0x07, 0xED, 0xB5, 0x8F, 0xED, 0xB5, 0xCF, 0xED, 0xB5, 0x87, 0xED, 0xB5, 0x17,
     0xED, 0xB4, 0x33, 0xEC, 0x00, 0x73, 0xEC, 0x00, 0xFB, 0xED, 0xF7, 0xF9, 0xEF, 0xFF, 0xF9, 0xEF,
     0xFF, 0xF9, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB,
-    0x00, 0x9E, 0xD8, /* UNICODE索引 - 默 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x37, 0xB1, 0xE0, 0x37, 0x31, 0xEC, 0x77, 0x3F, 0xEC,
-    0x77, 0x63, 0xE0, 0x00, 0x63, 0xE0, 0x00, 0x53, 0xE9, 0x76, 0x47, 0xE0, 0x36, 0xE6, 0xE0, 0x36,
-    0xBC, 0xE0, 0x36, 0x89, 0xFF, 0x7F, 0xC3, 0xFF, 0x7F, 0xC7, 0xFF, 0x7E, 0x0F, 0x80, 0x00, 0x1F,
-    0x80, 0x00, 0xFF, 0xDF, 0x00, 0xFF, 0xEF, 0x40, 0x1F, 0xE3, 0x7F, 0x07, 0xF1, 0x7F, 0xC1, 0xF0,
-    0x7F, 0xF1, 0xFE, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF,
-    0x00, 0x8B, 0xA4, /* UNICODE索引 - 认 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xE7,
-    0x80, 0x03, 0xE0, 0x80, 0x01, 0xF0, 0xDF, 0xC1, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x33, 0xFF, 0xFE,
-    0x67, 0xFF, 0xFE, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0x3F, 0xC0, 0x00, 0xFF, 0xC0, 0x07, 0xFF,
-    0xEE, 0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
-    0x00, 0x6E, 0x05, /* UNICODE索引 - 清 */
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0xFE, 0x7F, 0x7F, 0xDF, 0x1F, 0x03, 0xCF, 0x9C, 0x03, 0xC3,
-    0xE0, 0x03, 0xE3, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xF7, 0xBF, 0xFF, 0xF5, 0xB0, 0x01, 0xF5, 0xB0,
-    0x01, 0xF5, 0xB0, 0x03, 0xF5, 0xB5, 0xBF, 0xF5, 0xB5, 0xBF, 0x80, 0x35, 0xBF, 0x80, 0x35, 0xBF,
-    0xF5, 0xB5, 0xBB, 0xF5, 0xB5, 0xBB, 0xF1, 0xB5, 0xB9, 0xF1, 0xB0, 0x01, 0xE5, 0xB0, 0x03, 0xE7,
-    0xB7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x96, 0x64, /* UNICODE索引 - 除 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xEF,
-    0x3F, 0x7F, 0xEC, 0x0F, 0x3F, 0xE0, 0xC0, 0x3F, 0xE3, 0xD0, 0x77, 0xE7, 0x98, 0xC7, 0xFF, 0x3B,
-    0x8F, 0xFC, 0x3A, 0x1F, 0xF8, 0xBA, 0x3B, 0xE1, 0xBB, 0x7B, 0x83, 0xBB, 0xF1, 0x8F, 0x80, 0x01,
-    0xC3, 0x80, 0x03, 0xF1, 0x3B, 0x7F, 0xF8, 0x3B, 0x3F, 0xFC, 0x3B, 0x9F, 0xFE, 0x3B, 0x87, 0xFF,
-    0x3B, 0xC7, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x59, 0xCB, /* UNICODE索引 - 始 */
+    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD, 0xFD, 0xFD, 0xF9, 0xFD, 0xC0, 0xFB, 0xFC, 0x02, 0xE3, 0x80,
+    0x1E, 0x47, 0x81, 0xFE, 0x0F, 0xCD, 0xF8, 0x1F, 0xFD, 0x00, 0x1F, 0xFC, 0x03, 0x8F, 0xFC, 0x3F,
+    0xCF, 0xFF, 0x9F, 0xFF, 0xFF, 0x18, 0x01, 0xFC, 0x18, 0x01, 0xE0, 0xD8, 0x03, 0x83, 0xDB, 0xF7,
+    0x8F, 0xDB, 0xF7, 0xDF, 0x9B, 0xF7, 0xFD, 0xBB, 0xF7, 0xFC, 0xBB, 0xF7, 0xFE, 0x38, 0x03, 0xFE,
+    0x08, 0x03, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x5B, 0x58, /* UNICODE索引 - 存 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFE, 0x7F, 0xF7, 0xFC, 0xFF, 0xF7, 0xF9, 0xFF, 0xF7,
+    0xE3, 0xFF, 0xF7, 0x80, 0x01, 0xF7, 0x00, 0x01, 0xF6, 0x3D, 0xFF, 0xF0, 0x7D, 0xFF, 0x80, 0xFD,
+    0xFF, 0x82, 0xFD, 0xFF, 0xD6, 0xFD, 0xFB, 0xF6, 0xFD, 0xFB, 0xF6, 0xFD, 0xF9, 0xF6, 0xE0, 0x01,
+    0xF6, 0xC0, 0x03, 0xF6, 0x8D, 0xFF, 0xF6, 0x3D, 0xFF, 0xF6, 0x7D, 0xFF, 0xE6, 0x7D, 0xFF, 0xE7,
+    0xFD, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x5B, 0x8C, /* UNICODE索引 - 完 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xF7, 0xFD, 0xFC, 0x77, 0xF9, 0xF8, 0x77, 0xFB, 0xF8,
+    0x77, 0xF3, 0xFB, 0x77, 0xE7, 0xFB, 0x77, 0xC7, 0xFB, 0x70, 0x0F, 0xFB, 0x70, 0x3F, 0xBB, 0x71,
+    0xFF, 0x9B, 0x77, 0xFF, 0xC3, 0x77, 0xFF, 0xC3, 0x70, 0x07, 0xFB, 0x70, 0x03, 0xFB, 0x77, 0xF3,
+    0xFA, 0x77, 0xFB, 0xFA, 0x77, 0xFB, 0xFB, 0x77, 0xFB, 0xFA, 0xE7, 0xFB, 0xF8, 0xE7, 0xF3, 0xF9,
+    0xF7, 0x83, 0xFB, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
+    0x00, 0x5B, 0x9E, /* UNICODE索引 - 实 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xFD, 0xFC, 0x7E, 0xFD, 0xF8, 0x7E, 0xFD, 0xFB,
+    0xEE, 0xF9, 0xFB, 0xE6, 0xFB, 0xFA, 0xE0, 0xFB, 0xFA, 0x70, 0xF3, 0xFB, 0x1E, 0xF7, 0xFB, 0x1E,
+    0xE7, 0x9B, 0xBE, 0x8F, 0x83, 0xF8, 0x1F, 0xC2, 0x00, 0x3F, 0xEA, 0x00, 0x9F, 0xFB, 0x7E, 0xDF,
+    0xFB, 0xFE, 0xCF, 0xFB, 0xFE, 0xEF, 0xFB, 0xFE, 0xE7, 0xFA, 0xFE, 0xE3, 0xF8, 0xFC, 0xF1, 0xF9,
+    0xFC, 0xF9, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x5C, 0x0F, /* UNICODE索引 - 小 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF,
+    0xF1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xF7, 0xFF, 0xBF, 0xF3, 0xFF, 0xFF,
+    0xF9, 0xCF, 0xFF, 0xF1, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF,
+    0xFF, 0x3F, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+    0xF0, 0x7F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
     0x00, 0x5C, 0x4F, /* UNICODE索引 - 屏 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x83, 0xC0, 0x00, 0x0F, 0xC0,
     0x00, 0x7F, 0xC0, 0x0E, 0xFD, 0xDD, 0xEE, 0xF9, 0xDD, 0xEE, 0xF3, 0xDD, 0xEE, 0xE7, 0xDD, 0x20,
@@ -376,132 +371,180 @@ static const uint8_t EPD_FontUTF8_24x24_B[] = {
     0x7F, 0xEB, 0x40, 0x00, 0xEB, 0x58, 0x00, 0xEB, 0x5A, 0x79, 0x83, 0x5B, 0x77, 0x83, 0x59, 0x73,
     0xEB, 0x58, 0x03, 0xE8, 0x0A, 0x03, 0xE8, 0x0A, 0x07, 0xEF, 0xFB, 0x3F, 0xCF, 0xFB, 0x3F, 0xCF,
     0xFB, 0x3F, 0xEF, 0xFB, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x50, 0x4F, /* UNICODE索引 - 偏 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF0,
-    0x00, 0x01, 0x80, 0x00, 0x01, 0x87, 0xFF, 0xE7, 0xDF, 0xFF, 0x0F, 0xF7, 0x80, 0x1F, 0xF0, 0x00,
-    0xFF, 0xF0, 0x00, 0x03, 0xF6, 0xE0, 0x03, 0xB6, 0xEE, 0xFF, 0x96, 0xE0, 0x07, 0xC6, 0xE0, 0x07,
-    0xC6, 0xEE, 0xFF, 0xF6, 0xEE, 0xEF, 0xF6, 0xE0, 0x07, 0xF6, 0xE0, 0x13, 0xF0, 0x6E, 0xF3, 0xF0,
-    0x60, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF,
-    0x00, 0x79, 0xFB, /* UNICODE索引 - 移 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xDF, 0xFF, 0xBF, 0x9F, 0xF7, 0xBE, 0x3F, 0xF7, 0xB8, 0x7F, 0xF7,
-    0x81, 0xFF, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE7, 0xB3, 0xFD, 0xEF, 0x38, 0xFD, 0xEF, 0x38,
-    0xBD, 0xFF, 0x3B, 0x39, 0xFE, 0x72, 0x7B, 0xF8, 0xF4, 0xFB, 0xE0, 0x60, 0x73, 0xC2, 0x01, 0x17,
-    0xCB, 0x03, 0x87, 0xFB, 0x03, 0xCF, 0xFA, 0x2B, 0x9F, 0xF8, 0x7B, 0x1F, 0xF8, 0xF8, 0x3F, 0xF9,
-    0xF8, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x65, 0x70, /* UNICODE索引 - 数 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFD, 0xFD, 0xE5, 0xFD, 0xDD, 0xED, 0xF9, 0xC1, 0xCD, 0xBB, 0xE1,
-    0x1C, 0x33, 0xF4, 0x38, 0x37, 0x80, 0x00, 0x87, 0x80, 0x01, 0xCF, 0xF9, 0x7D, 0x8F, 0xF1, 0x1C,
-    0x0D, 0xC5, 0x9C, 0x41, 0xCD, 0xCD, 0xE3, 0xFC, 0x0F, 0xF3, 0xF0, 0x0F, 0xE7, 0x80, 0x00, 0xC7,
-    0x85, 0xF0, 0x0F, 0xDD, 0xFE, 0x1F, 0xFD, 0xC0, 0x0F, 0xFC, 0x00, 0xC7, 0xFC, 0x07, 0xE3, 0xFD,
-    0xFF, 0xF3, 0xFD, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
-    0x00, 0x50, 0x3C, /* UNICODE索引 - 值 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x00, 0x01, 0xF0,
-    0x00, 0x01, 0x81, 0x00, 0x01, 0x87, 0xFF, 0xFB, 0xD7, 0xFF, 0xFB, 0xF6, 0xFF, 0xFB, 0xF6, 0x00,
-    0x03, 0xF6, 0x00, 0x03, 0xF6, 0xED, 0xDB, 0x80, 0xED, 0xDB, 0x80, 0xED, 0xDB, 0xC0, 0xED, 0xDB,
-    0xF6, 0xED, 0xDB, 0xF6, 0xED, 0xDB, 0xF6, 0x00, 0x03, 0xF6, 0x00, 0x03, 0xF6, 0xFF, 0xFB, 0xF7,
-    0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB,
-    0x00, 0x5B, 0x9E, /* UNICODE索引 - 实 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xFD, 0xFC, 0x7E, 0xFD, 0xF8, 0x7E, 0xFD, 0xFB,
-    0xEE, 0xF9, 0xFB, 0xE6, 0xFB, 0xFA, 0xE0, 0xFB, 0xFA, 0x70, 0xF3, 0xFB, 0x1E, 0xF7, 0xFB, 0x1E,
-    0xE7, 0x9B, 0xBE, 0x8F, 0x83, 0xF8, 0x1F, 0xC2, 0x00, 0x3F, 0xEA, 0x00, 0x9F, 0xFB, 0x7E, 0xDF,
-    0xFB, 0xFE, 0xCF, 0xFB, 0xFE, 0xEF, 0xFB, 0xFE, 0xE7, 0xFA, 0xFE, 0xE3, 0xF8, 0xFC, 0xF1, 0xF9,
-    0xFC, 0xF9, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x96, 0x45, /* UNICODE索引 - 际 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xDF,
-    0x7E, 0xFF, 0xDC, 0x3E, 0x7F, 0xC0, 0x8C, 0x77, 0xC3, 0xC0, 0x47, 0xCF, 0x70, 0x8F, 0xEF, 0x7C,
-    0x3F, 0xEF, 0x70, 0x77, 0xEF, 0x71, 0xF7, 0xEF, 0x73, 0xF3, 0xEF, 0x77, 0xF9, 0xEF, 0x00, 0x01,
-    0xEF, 0x00, 0x03, 0xEF, 0x7F, 0xFF, 0xEF, 0x7B, 0xFF, 0xEF, 0x79, 0xFF, 0xEF, 0x7C, 0x3F, 0xEE,
-    0x7E, 0x0F, 0xFE, 0x7F, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x5E, 0x74, /* UNICODE索引 - 年 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0x3E, 0xFF, 0xFE, 0x7E, 0xFF, 0xFC, 0xFE, 0xFF, 0xF1,
+    0xC0, 0xFF, 0xC3, 0xC0, 0xFF, 0x87, 0xC0, 0xFF, 0x97, 0xDE, 0xFF, 0xF7, 0xDE, 0xFF, 0xF7, 0xDE,
+    0xFF, 0xF7, 0xDE, 0xFF, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF7, 0xDE, 0xFF,
+    0xF7, 0xDE, 0xFF, 0xF7, 0xDE, 0xFF, 0xF7, 0x9E, 0xFF, 0xF7, 0x9E, 0xFF, 0xE7, 0xDE, 0xFF, 0xE7,
+    0xFE, 0xFF, 0xF7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x5E, 0x76, /* UNICODE索引 - 并 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFB, 0xFD, 0xFD, 0xFB, 0xF9, 0xFD,
+    0xFB, 0xF3, 0xFD, 0xFB, 0xE7, 0xBD, 0xFB, 0x87, 0x8C, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xE0, 0x01,
+    0xFF, 0xFD, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xF1, 0xFB, 0xFF, 0xC0, 0x00, 0x01,
+    0x8C, 0x00, 0x01, 0x9D, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xFD, 0xF3, 0xFF, 0xFD,
+    0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x5E, 0xA6, /* UNICODE索引 - 度 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE3, 0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x1F, 0xF0,
+    0x00, 0xFD, 0xF7, 0x7F, 0xFD, 0xF7, 0x7D, 0xFD, 0xF7, 0x7D, 0xF9, 0xF3, 0x7D, 0xFB, 0xF0, 0x04,
+    0x73, 0xB4, 0x04, 0x37, 0x87, 0x6D, 0x87, 0xC7, 0x6D, 0xCF, 0xC7, 0x6D, 0xCF, 0xF7, 0x6D, 0x87,
+    0xF0, 0x05, 0x37, 0xF0, 0x04, 0x73, 0xF5, 0x7C, 0xF3, 0xF7, 0x7D, 0xFB, 0xE6, 0x7F, 0xF9, 0xE6,
+    0x7F, 0xF9, 0xF7, 0x7F, 0xFB, 0xFF, 0xFF, 0xFB,
     0x00, 0x5F, 0x00, /* UNICODE索引 - 开 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xEF, 0xEF, 0xFD, 0xEF, 0xEF, 0xF9, 0xEF, 0xEF, 0xF3, 0xEF,
     0xEF, 0xE7, 0xEF, 0xEF, 0xC7, 0xEF, 0xEE, 0x0F, 0xE0, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0xEF, 0xEF,
     0xFF, 0xEF, 0xEF, 0xFF, 0xEF, 0xEF, 0xFF, 0xEF, 0xEF, 0xFF, 0xEF, 0xEF, 0xFF, 0xE0, 0x00, 0x01,
     0xE0, 0x00, 0x01, 0xEF, 0xEF, 0xFF, 0xEF, 0xEF, 0xFF, 0xCF, 0xEF, 0xFF, 0xCF, 0xCF, 0xFF, 0xEF,
     0xCF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x54, 0x2F, /* UNICODE索引 - 启 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x07, 0xF0,
-    0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xF7, 0xBF, 0xFF, 0xF7, 0xB8, 0x01, 0xF7, 0xB8, 0x01, 0xF7, 0xBB,
-    0xF7, 0xB7, 0xBB, 0xF7, 0x87, 0xBB, 0xF7, 0xC7, 0xBB, 0xF7, 0xE7, 0xBB, 0xF7, 0xF7, 0xBB, 0xF7,
-    0xF7, 0xBB, 0xF7, 0xF7, 0xBB, 0xF7, 0xF0, 0x18, 0x01, 0xF0, 0x18, 0x01, 0xF0, 0x18, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x87, 0x02, /* UNICODE索引 - 蜂 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x67, 0xFE, 0x00, 0x67, 0xFE, 0xFD, 0xEF, 0xC0,
-    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xDE, 0xFD, 0x4F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x87, 0xFE, 0xF7,
-    0xC7, 0xFC, 0xE6, 0xDF, 0xF1, 0xE6, 0xDF, 0x83, 0xC6, 0xDF, 0x81, 0x96, 0xDF, 0xCC, 0xB6, 0xDD,
-    0xEE, 0x00, 0x01, 0xEC, 0x00, 0x01, 0xE8, 0xB6, 0xDF, 0xE1, 0x96, 0xDF, 0xE7, 0xC6, 0xDF, 0xEF,
-    0xC6, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xDF, 0xFF,
-    0x00, 0x9E, 0x23, /* UNICODE索引 - 鸣 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF7, 0xFB, 0xFF, 0xF7,
-    0xFB, 0xFF, 0xF7, 0xFB, 0xFF, 0xF0, 0x01, 0xBF, 0xF0, 0x01, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB,
-    0xBF, 0xF0, 0x01, 0xBF, 0xF0, 0x01, 0xBF, 0xE3, 0xFB, 0xBF, 0x80, 0xFB, 0xBF, 0x94, 0x5B, 0xB7,
-    0xF6, 0x43, 0xB3, 0xF7, 0xE3, 0x3B, 0xF4, 0x0B, 0x39, 0xF0, 0x0B, 0xB1, 0xF0, 0x78, 0x03, 0xFF,
-    0xF8, 0x07, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x72, 0xB6, /* UNICODE索引 - 状 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFD, 0xFE, 0x7F, 0xFC, 0x7E, 0x7F, 0xFE, 0x3C, 0xFF, 0xFF,
-    0x39, 0xFF, 0xDF, 0xF3, 0xFD, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xFF, 0xBF, 0xF9, 0xFF, 0xBF,
-    0xF3, 0xFF, 0xBF, 0xC7, 0xFF, 0xBF, 0x0F, 0xFF, 0xB0, 0x1F, 0xC0, 0x00, 0x7F, 0xC0, 0x03, 0xFF,
-    0xFF, 0x81, 0xFF, 0xEF, 0xA0, 0x3F, 0xE7, 0xBE, 0x0F, 0xF1, 0xBF, 0x87, 0xF0, 0x3F, 0xC3, 0xF8,
-    0x3F, 0xE3, 0xFF, 0xBF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x00, 0x5F, 0x0F, /* UNICODE索引 - 式 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xEF, 0xF3, 0xFD, 0xEF, 0xF3, 0xFD, 0xEF, 0xF3, 0xFD,
+    0xEF, 0xF7, 0xFD, 0xEF, 0xE7, 0xFD, 0xE0, 0x0F, 0xFD, 0xE0, 0x0F, 0xFD, 0xEF, 0xCF, 0xFD, 0xEF,
+    0xDF, 0xFD, 0xEF, 0xDF, 0xFD, 0xEF, 0xDF, 0x80, 0x7F, 0xDF, 0x80, 0x01, 0xFF, 0xC0, 0x00, 0x7F,
+    0xFD, 0xF8, 0x1F, 0xDD, 0xFF, 0x0F, 0xC5, 0xFF, 0xC7, 0xE1, 0xFF, 0xE3, 0xE1, 0xFF, 0xF3, 0xF9,
+    0xFF, 0x81, 0xFD, 0xFF, 0x81, 0xFF, 0xFF, 0xFD,
     0x00, 0x60, 0x01, /* UNICODE索引 - 态 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFB, 0xFD, 0xE7, 0xFB, 0xF9, 0xC7, 0xFB, 0xFB, 0x07, 0xFB,
     0xF3, 0x0F, 0xFB, 0xF7, 0xFF, 0xFB, 0xE7, 0x03, 0xFB, 0xCF, 0x01, 0xFB, 0x1F, 0x79, 0xF0, 0x0E,
     0xFD, 0x80, 0x66, 0x7D, 0x81, 0xE2, 0x1D, 0xF8, 0x73, 0x1D, 0xFA, 0x3F, 0xFD, 0xFB, 0x9F, 0xFD,
     0xFB, 0xCF, 0xC1, 0xFB, 0xC7, 0xC1, 0xFB, 0xE7, 0x7F, 0xFB, 0xE3, 0x1F, 0xF3, 0xF3, 0x87, 0xF3,
     0xF3, 0x87, 0xFB, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x51, 0x73, /* UNICODE索引 - 关 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFD, 0xFD, 0xF7, 0xF9, 0xFD, 0xF7, 0xFB, 0xFD,
-    0xF7, 0xF3, 0xFD, 0xF7, 0xF7, 0xDD, 0xF7, 0xE7, 0xCD, 0xF7, 0xCF, 0xC1, 0xF7, 0x1F, 0xE1, 0xF4,
-    0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x01, 0xFF, 0xFC, 0x31, 0xFF, 0xF1, 0xF0, 0x7F, 0x81, 0xF6, 0x3F,
-    0x8D, 0xF7, 0x1F, 0xDD, 0xF7, 0xCF, 0xFD, 0xF7, 0xE7, 0xFD, 0xF7, 0xE3, 0xFD, 0xE7, 0xF1, 0xFD,
-    0xE7, 0xF1, 0xFF, 0xF7, 0xFB, 0xFF, 0xFF, 0xFB,
-    0x00, 0x95, 0xED, /* UNICODE索引 - 闭 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xB8,
-    0x00, 0x03, 0x9F, 0xBF, 0x9F, 0xC7, 0xBF, 0x3F, 0xC7, 0xBE, 0x7F, 0xFF, 0xBC, 0xFF, 0xEF, 0xB9,
-    0xFF, 0xEF, 0xA3, 0xEF, 0xEF, 0x87, 0xE7, 0xE8, 0x00, 0x07, 0xE8, 0x00, 0x0F, 0xED, 0xBF, 0xFF,
-    0xEF, 0xBF, 0xFF, 0xEF, 0xBF, 0xFB, 0xEF, 0xBF, 0xFB, 0xEF, 0xBF, 0xF9, 0xC0, 0x00, 0x01, 0xC0,
-    0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x97, 0xF3, /* UNICODE索引 - 音 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF7, 0xDF, 0xFF, 0xF7,
-    0xDF, 0xFF, 0xF7, 0xD8, 0x01, 0xF3, 0xD8, 0x01, 0xF0, 0xD8, 0x03, 0xF4, 0x1B, 0x77, 0xB6, 0x1B,
-    0x77, 0x87, 0xDB, 0x77, 0xC7, 0xDB, 0x77, 0xC7, 0xDB, 0x77, 0xF7, 0x1B, 0x77, 0xF0, 0x1B, 0x77,
-    0xF0, 0xDB, 0x77, 0xF5, 0xD8, 0x01, 0xE7, 0xD8, 0x01, 0xE7, 0xDB, 0xFF, 0xF7, 0x9F, 0xFF, 0xFF,
-    0x9F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x91, 0xCF, /* UNICODE索引 - 量 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xBF, 0xFB, 0xFF, 0xBF, 0xDB, 0xFF, 0xBF, 0xDB, 0xC0,
-    0x20, 0x1B, 0xC0, 0x20, 0x1B, 0xC0, 0x2B, 0x5B, 0xD6, 0xAB, 0x5B, 0xD6, 0xAB, 0x5B, 0xD6, 0xAB,
-    0x5B, 0xD6, 0xA0, 0x03, 0xD6, 0xA0, 0x03, 0xD6, 0xA0, 0x03, 0xD6, 0xAB, 0x5B, 0xD6, 0xAB, 0x5B,
-    0xD6, 0xAB, 0x5B, 0xC0, 0x20, 0x1B, 0xC0, 0x20, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xBF, 0xDB, 0xFF,
-    0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0xBF, 0xFF,
+    0x00, 0x60, 0x62, /* UNICODE索引 - 恢 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0x80,
+    0x00, 0x01, 0x80, 0x00, 0x03, 0xFC, 0x7F, 0x8F, 0xFA, 0x7F, 0x1D, 0xFB, 0x7C, 0x79, 0xFB, 0xE0,
+    0xFB, 0xFB, 0x01, 0xF3, 0x80, 0x09, 0xE7, 0x80, 0x41, 0x8F, 0xC3, 0xC6, 0x1F, 0xFA, 0x00, 0x3F,
+    0xFA, 0x00, 0xFF, 0xFA, 0x00, 0x7F, 0xFB, 0xF8, 0x1F, 0xFB, 0xF3, 0x87, 0xFB, 0xC7, 0xC3, 0xFB,
+    0xCF, 0xE3, 0xFB, 0xEF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x00, 0x60, 0x6F, /* UNICODE索引 - 息 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x07, 0xFF,
+    0xFF, 0x07, 0xE0, 0x03, 0xFF, 0xE0, 0x02, 0x0F, 0xED, 0xB6, 0x03, 0xED, 0xB7, 0x03, 0x8D, 0xB3,
+    0xFB, 0x8D, 0xB0, 0xFB, 0xAD, 0xB4, 0x3B, 0xED, 0xB6, 0x3B, 0xED, 0xB7, 0x3B, 0xED, 0xB7, 0xFB,
+    0xED, 0xB7, 0xF3, 0xE0, 0x03, 0xC3, 0xE0, 0x03, 0xC3, 0xEF, 0xF7, 0x7F, 0xFF, 0xFF, 0x1F, 0xFF,
+    0xFF, 0x87, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
+    0x00, 0x61, 0x0F, /* UNICODE索引 - 意 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFB, 0xFE, 0xFF, 0xE3, 0xEE, 0xFF, 0x83, 0xEE,
+    0x80, 0x87, 0xEE, 0x80, 0xFF, 0xEE, 0x81, 0x83, 0xE6, 0xB5, 0x83, 0xE0, 0xB5, 0xBB, 0xE8, 0xB4,
+    0xFB, 0x8E, 0xB4, 0x3B, 0x8E, 0xB5, 0x0B, 0xCE, 0xB5, 0x8B, 0xE0, 0xB5, 0xFB, 0xE0, 0xB5, 0xFB,
+    0xE6, 0xB5, 0xC3, 0xCE, 0x80, 0xC3, 0xCE, 0x80, 0x3F, 0xEE, 0xFF, 0x1F, 0xFC, 0xFF, 0x87, 0xFC,
+    0xFF, 0xC7, 0xFE, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
+    0x00, 0x61, 0x1F, /* UNICODE索引 - 感 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFC, 0x73, 0xFF, 0xF0, 0xE3, 0xF0, 0x03, 0x87, 0xF0,
+    0x0F, 0x8F, 0xF6, 0xFF, 0xFF, 0xF6, 0xC1, 0x81, 0xF6, 0xC1, 0x81, 0xF6, 0xDB, 0xFD, 0xF6, 0xDB,
+    0xFD, 0xF6, 0xDB, 0x3D, 0xF6, 0xC0, 0x1D, 0xF6, 0xC0, 0x9D, 0x80, 0xF9, 0xDD, 0x80, 0x01, 0xFD,
+    0xF4, 0x03, 0xE1, 0xB7, 0xC3, 0xE1, 0x87, 0x01, 0xBF, 0xC4, 0x18, 0x9F, 0xF4, 0x7C, 0xC7, 0xF6,
+    0xF0, 0x47, 0xF7, 0xF0, 0x7F, 0xFF, 0xFF, 0x7F,
+    0x00, 0x62, 0x10, /* UNICODE索引 - 成 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x83, 0xFC, 0x00, 0x0F, 0xFC,
+    0x00, 0x7F, 0xFD, 0xEF, 0xDF, 0xFD, 0xEF, 0xDF, 0xFD, 0xEF, 0xCF, 0xFD, 0xEE, 0x0F, 0xFD, 0xE0,
+    0x0B, 0xFD, 0xE0, 0x3B, 0xC5, 0xFF, 0xF3, 0xC0, 0x0F, 0xE7, 0xC0, 0x00, 0xCF, 0xFD, 0xC0, 0x0F,
+    0xDD, 0xFC, 0x1F, 0xCD, 0xF8, 0x0F, 0xE1, 0xE0, 0xC7, 0xF1, 0x81, 0xE3, 0xF9, 0x8F, 0xE3, 0xF9,
+    0xDF, 0xC3, 0xFD, 0xFF, 0x03, 0xFF, 0xFF, 0x3F,
     0x00, 0x62, 0x2A, /* UNICODE索引 - 截 */
     0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFE, 0xFC, 0xFF, 0xF6, 0xF9, 0xFF, 0xF6, 0xE0, 0x01, 0xF6,
     0x80, 0x01, 0xF6, 0x00, 0x03, 0xF6, 0x2D, 0xAF, 0x80, 0x2D, 0xAF, 0x80, 0x00, 0x0F, 0xD6, 0x80,
     0x0F, 0xF6, 0xCD, 0xAD, 0xF6, 0xED, 0xAD, 0xF6, 0xED, 0x89, 0xF6, 0xED, 0xC3, 0x80, 0x07, 0xE7,
     0x80, 0x00, 0x47, 0xFE, 0xE0, 0x0F, 0xDE, 0xFE, 0x0F, 0xC6, 0xE0, 0x47, 0xE2, 0xE1, 0xE3, 0xF0,
     0xE7, 0xC3, 0xFC, 0xFF, 0xC1, 0xFF, 0xFF, 0xFD,
+    0x00, 0x63, 0x6E, /* UNICODE索引 - 据 */
+    0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFC, 0xFB, 0xFE, 0xFC, 0xFB, 0xFE, 0xF9, 0xF9, 0xC0,
+    0x00, 0x01, 0xC0, 0x00, 0x01, 0xEE, 0xE7, 0xF3, 0xFC, 0xEF, 0xC7, 0xFC, 0xCE, 0x0F, 0xE0, 0x00,
+    0x3F, 0xE0, 0x00, 0xFF, 0xE0, 0x6E, 0x01, 0xEE, 0xEE, 0x01, 0xEE, 0xEE, 0xF7, 0xEE, 0xEE, 0xF7,
+    0xEE, 0x00, 0xF7, 0xEE, 0x00, 0xF7, 0xEE, 0xEE, 0xF7, 0xE0, 0x6E, 0x01, 0xE0, 0x6E, 0x01, 0xE0,
+    0x6E, 0x03, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x65, 0x70, /* UNICODE索引 - 数 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0xFD, 0xFD, 0xE5, 0xFD, 0xDD, 0xED, 0xF9, 0xC1, 0xCD, 0xBB, 0xE1,
+    0x1C, 0x33, 0xF4, 0x38, 0x37, 0x80, 0x00, 0x87, 0x80, 0x01, 0xCF, 0xF9, 0x7D, 0x8F, 0xF1, 0x1C,
+    0x0D, 0xC5, 0x9C, 0x41, 0xCD, 0xCD, 0xE3, 0xFC, 0x0F, 0xF3, 0xF0, 0x0F, 0xE7, 0x80, 0x00, 0xC7,
+    0x85, 0xF0, 0x0F, 0xDD, 0xFE, 0x1F, 0xFD, 0xC0, 0x0F, 0xFC, 0x00, 0xC7, 0xFC, 0x07, 0xE3, 0xFD,
+    0xFF, 0xF3, 0xFD, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x00, 0x65, 0xE5, /* UNICODE索引 - 日 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x01, 0xC0, 0x00, 0x01, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF,
+    0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF,
+    0xEF, 0xDF, 0xEF, 0xEF, 0xDF, 0xEF, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x65, 0xF6, /* UNICODE索引 - 时 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF7, 0xDF, 0xBF, 0xF7,
+    0xDF, 0xBF, 0xF7, 0xDF, 0xBF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xFE, 0xFF,
+    0xFF, 0xFE, 0xEF, 0xFF, 0xFE, 0xE3, 0xFF, 0xFE, 0xF1, 0xF7, 0xFE, 0xF1, 0xF3, 0xFE, 0xFF, 0xFB,
+    0xFE, 0xFF, 0xF9, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0xDE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE,
+    0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x66, 0x1F, /* UNICODE索引 - 星 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xBB, 0xFF, 0xFF, 0x3B, 0xFF, 0xFC, 0x7B, 0xC0,
+    0x30, 0xBB, 0xC0, 0x21, 0xBB, 0xC0, 0x63, 0xBB, 0xDB, 0x7B, 0xBB, 0xDB, 0x7B, 0xBB, 0xDB, 0x7B,
+    0xBB, 0xDB, 0x40, 0x03, 0xDB, 0x40, 0x03, 0xDB, 0x60, 0x03, 0xDB, 0x7B, 0xBB, 0xDB, 0x7B, 0xBB,
+    0xDB, 0x7B, 0xBB, 0xDB, 0x7B, 0x3B, 0xC0, 0x33, 0x3B, 0xC0, 0x33, 0xBB, 0xFF, 0xFB, 0xF3, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
+    0x00, 0x66, 0x3E, /* UNICODE索引 - 显 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFD, 0xF7, 0xFF, 0xFC, 0xF7, 0xFF,
+    0xFE, 0x37, 0xC0, 0x0E, 0x17, 0xC0, 0x0F, 0x17, 0xDD, 0xCF, 0xF7, 0xDD, 0xC0, 0x07, 0xDD, 0xD0,
+    0x07, 0xDD, 0xD7, 0xF7, 0xDD, 0xDF, 0xF7, 0xDD, 0xDF, 0xF7, 0xDD, 0xD0, 0x07, 0xDD, 0xD0, 0x07,
+    0xDD, 0xDF, 0x97, 0xC0, 0x0F, 0x37, 0xC0, 0x0E, 0x77, 0xEF, 0xF8, 0xF7, 0xFF, 0xF9, 0xE7, 0xFF,
+    0xFB, 0xE7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x00, 0x67, 0x08, /* UNICODE索引 - 月 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xF3, 0xFF,
+    0xFF, 0xC7, 0xE7, 0xF0, 0x0F, 0xE0, 0x00, 0x1F, 0xE0, 0x00, 0xFF, 0xEF, 0x7B, 0xFF, 0xEF, 0x7B,
+    0xFF, 0xEF, 0x7B, 0xFF, 0xEF, 0x7B, 0xFF, 0xEF, 0x7B, 0xF7, 0xEF, 0x7B, 0xF7, 0xEF, 0x7B, 0xF3,
+    0xEF, 0x7B, 0xF9, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x67, 0x1F, /* UNICODE索引 - 期 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0xFB, 0xFB, 0xFE, 0xF3, 0xFB, 0xFE, 0xE7, 0xC0,
+    0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xFB, 0x6E, 0xBF, 0xFB, 0x6E, 0xFF, 0xFB, 0x6E, 0xBF, 0xC0, 0x00,
+    0x9D, 0xC0, 0x00, 0xC9, 0xFB, 0xFE, 0xC3, 0xFB, 0xFE, 0xC7, 0xE7, 0xF0, 0x0F, 0xE0, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0xEF, 0x7B, 0xF7, 0xEF, 0x7B, 0xF3, 0xEF, 0x7B, 0xFB, 0xE0, 0x00, 0x03, 0xE0,
+    0x00, 0x03, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0x00, 0x67, 0x2C, /* UNICODE索引 - 本 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xCF, 0xFD, 0xFF, 0xDF, 0xFD, 0xFF, 0x9F, 0xFD,
+    0xFF, 0x3F, 0xFD, 0xFC, 0x3F, 0xFD, 0xF8, 0xBF, 0xFD, 0xE1, 0xBF, 0xFD, 0x83, 0xBF, 0xFC, 0x0F,
+    0xBF, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFC, 0x1F, 0xBF, 0xFD, 0x87, 0xBF,
+    0xFD, 0xE3, 0x3F, 0xFD, 0xF0, 0x3F, 0xFD, 0xFC, 0x3F, 0xFD, 0xFE, 0x3F, 0xF9, 0xFF, 0x1F, 0xF9,
+    0xFF, 0x1F, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF,
+    0x00, 0x68, 0x3C, /* UNICODE索引 - 格 */
+    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x7F, 0xFD, 0xFC, 0x7F, 0xFD, 0xF0, 0xFF, 0xFD, 0x03, 0xFF, 0x80,
+    0x00, 0x01, 0x80, 0x00, 0x01, 0xFD, 0x8E, 0xFF, 0xF9, 0xC4, 0xFF, 0xF9, 0x65, 0xFF, 0xFC, 0x79,
+    0xFF, 0xF8, 0xF8, 0x01, 0xC1, 0xF0, 0x01, 0x80, 0xE5, 0xF7, 0x94, 0x0D, 0xF7, 0xF7, 0x1D, 0xF7,
+    0xF6, 0x0D, 0xF7, 0xF4, 0x65, 0xF7, 0xF0, 0xE4, 0x01, 0xF1, 0xF0, 0x01, 0xF7, 0xF1, 0xFF, 0xFF,
+    0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x6B, 0x22, /* UNICODE索引 - 欢 */
+    0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFB, 0xFB, 0x7F, 0xE3, 0xFB, 0x3F, 0xC7, 0xFB, 0x9F, 0x1F, 0xFB,
+    0xC4, 0x3F, 0xFB, 0xE0, 0x7F, 0xFB, 0x80, 0xFD, 0xF8, 0x04, 0x3D, 0xF8, 0x3E, 0x09, 0xF9, 0xF7,
+    0x03, 0xFF, 0xC7, 0xE7, 0xFF, 0x0F, 0xC7, 0xF0, 0x3F, 0x0F, 0xC0, 0xF8, 0x1F, 0xC6, 0x00, 0x7F,
+    0xFE, 0x03, 0xFF, 0xFE, 0x80, 0x3F, 0xFE, 0xFC, 0x0F, 0xFE, 0xDF, 0x87, 0xFE, 0x1F, 0xE3, 0xFE,
+    0x3F, 0xF3, 0xFE, 0x7F, 0xFB, 0xFF, 0xFF, 0xFB,
     0x00, 0x6B, 0x62, /* UNICODE索引 - 止 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF,
     0xFF, 0xF7, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
     0xF7, 0xFF, 0xFF, 0xF7, 0x80, 0x00, 0x07, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFF, 0xBF, 0xF7,
     0xFF, 0xBF, 0xF7, 0xFF, 0xBF, 0xF7, 0xFF, 0xBF, 0xF7, 0xFF, 0x3F, 0xF7, 0xFF, 0x3F, 0xE7, 0xFF,
     0xBF, 0xE7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0x00, 0x8B, 0x66, /* UNICODE索引 - 警 */
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0x7B, 0xFF, 0xEC, 0x7B, 0xFF, 0xE0, 0x1B, 0xFF, 0x82,
-    0x19, 0x41, 0x82, 0xB9, 0x41, 0xC2, 0x99, 0x41, 0xEA, 0x19, 0x5B, 0x82, 0x09, 0x5B, 0x83, 0x89,
-    0x5B, 0xE8, 0x09, 0x5B, 0xE8, 0x21, 0x5B, 0xE8, 0xE1, 0x5B, 0xE0, 0xE9, 0x5B, 0x80, 0xC9, 0x5B,
-    0x80, 0x19, 0x41, 0xF7, 0x39, 0x41, 0xF0, 0x19, 0x43, 0xF0, 0xCB, 0xFF, 0xF3, 0xC3, 0xFF, 0xF7,
-    0xC3, 0xFF, 0xF7, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x54, 0x4A, /* UNICODE索引 - 告 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFE, 0x5F, 0xFF, 0xF8,
-    0xDF, 0xFF, 0xC1, 0xDC, 0x01, 0xC3, 0xDC, 0x01, 0xCB, 0xDD, 0xF7, 0xFB, 0xDD, 0xF7, 0xFB, 0xDD,
-    0xF7, 0x80, 0x1D, 0xF7, 0x80, 0x1D, 0xF7, 0xC0, 0x1D, 0xF7, 0xFB, 0xDD, 0xF7, 0xFB, 0xDD, 0xF7,
-    0xFB, 0xDD, 0xF7, 0xFB, 0xDC, 0x01, 0xFB, 0xDC, 0x01, 0xFB, 0xDD, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF,
-    0x9F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x5B, 0x9E, /* UNICODE索引 - 实 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0xFD, 0xFC, 0x7E, 0xFD, 0xF8, 0x7E, 0xFD, 0xFB,
-    0xEE, 0xF9, 0xFB, 0xE6, 0xFB, 0xFA, 0xE0, 0xFB, 0xFA, 0x70, 0xF3, 0xFB, 0x1E, 0xF7, 0xFB, 0x1E,
-    0xE7, 0x9B, 0xBE, 0x8F, 0x83, 0xF8, 0x1F, 0xC2, 0x00, 0x3F, 0xEA, 0x00, 0x9F, 0xFB, 0x7E, 0xDF,
-    0xFB, 0xFE, 0xCF, 0xFB, 0xFE, 0xEF, 0xFB, 0xFE, 0xE7, 0xFA, 0xFE, 0xE3, 0xF8, 0xFC, 0xF1, 0xF9,
-    0xFC, 0xF9, 0xF9, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x6B, 0x64, /* UNICODE索引 - 此 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFE, 0x00, 0x07, 0xFE,
+    0x00, 0x07, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xDF, 0xBF,
+    0x9F, 0xFF, 0xBF, 0xBF, 0xFF, 0xBF, 0xBF, 0xFF, 0xBF, 0xBF, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
+    0xDF, 0xCF, 0xFB, 0xFF, 0x9F, 0xFB, 0xFF, 0xBF, 0xFB, 0xFF, 0x3F, 0xFB, 0xFE, 0x7F, 0xFB, 0xFE,
+    0x7F, 0x03, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0xF7,
+    0x00, 0x6B, 0xCF, /* UNICODE索引 - 每 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xB7, 0xFF, 0xFE, 0x37, 0xFF, 0xFC, 0x77, 0xDF, 0xF0,
+    0xF0, 0x0F, 0xC0, 0x00, 0x0F, 0x86, 0x00, 0xDF, 0x86, 0xF7, 0xDF, 0xD6, 0xF7, 0xDF, 0xF6, 0x71,
+    0xDF, 0xF6, 0x30, 0xDF, 0xF6, 0x84, 0x1F, 0xF6, 0x86, 0x1F, 0xF6, 0xF7, 0xDB, 0xF6, 0xF7, 0xD9,
+    0xF6, 0xF7, 0xD9, 0xF6, 0x00, 0x01, 0xF6, 0x00, 0x03, 0xE6, 0x03, 0xDF, 0xE7, 0xF7, 0x9F, 0xF7,
+    0xF7, 0x9F, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x6C, 0x60, /* UNICODE索引 - 池 */
+    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x3F, 0x7F, 0xDF, 0x1F, 0x03, 0xCF, 0x9C, 0x03, 0xE3,
+    0xE0, 0x03, 0xE3, 0x03, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFC, 0x00,
+    0x03, 0xFC, 0x00, 0x03, 0xFF, 0xBF, 0xFB, 0xFF, 0xBF, 0xFB, 0xC0, 0x00, 0x1B, 0xC0, 0x00, 0x1B,
+    0xFF, 0x7E, 0xFB, 0xFF, 0x7E, 0xFB, 0xFF, 0x7E, 0x7B, 0xFE, 0x00, 0x7B, 0xFE, 0x00, 0xFB, 0xFE,
+    0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF7,
+    0x00, 0x6C, 0xE8, /* UNICODE索引 - 注 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xBF, 0xFF, 0x8F, 0x81, 0xE7, 0xCE, 0x01, 0xE1,
+    0xF8, 0x01, 0xF1, 0xC0, 0xFF, 0xFE, 0x07, 0xFB, 0xFE, 0x3F, 0xFB, 0xFE, 0xFB, 0xFB, 0xFE, 0xFB,
+    0xFB, 0xFE, 0xFB, 0xFB, 0xDE, 0xFB, 0xFB, 0xCE, 0xFB, 0xFB, 0xE2, 0x00, 0x03, 0xE2, 0x00, 0x03,
+    0xF6, 0xFB, 0xFB, 0xFE, 0xFB, 0xFB, 0xFE, 0xFB, 0xFB, 0xFE, 0xF3, 0xFB, 0xFC, 0xF3, 0xF3, 0xFC,
+    0xFB, 0xF3, 0xFE, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
+    0x00, 0x6E, 0x05, /* UNICODE索引 - 清 */
+    0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0xFE, 0x7F, 0x7F, 0xDF, 0x1F, 0x03, 0xCF, 0x9C, 0x03, 0xC3,
+    0xE0, 0x03, 0xE3, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xF7, 0xBF, 0xFF, 0xF5, 0xB0, 0x01, 0xF5, 0xB0,
+    0x01, 0xF5, 0xB0, 0x03, 0xF5, 0xB5, 0xBF, 0xF5, 0xB5, 0xBF, 0x80, 0x35, 0xBF, 0x80, 0x35, 0xBF,
+    0xF5, 0xB5, 0xBB, 0xF5, 0xB5, 0xBB, 0xF1, 0xB5, 0xB9, 0xF1, 0xB0, 0x01, 0xE5, 0xB0, 0x03, 0xE7,
+    0xB7, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
     0x00, 0x6E, 0x29, /* UNICODE索引 - 温 */
     0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0xFE, 0x7F, 0x7F, 0xDF, 0x1F, 0x03, 0xCF, 0x1E, 0x03, 0xE7,
     0xE0, 0x03, 0xE7, 0x01, 0xFB, 0xFC, 0x1F, 0xFB, 0xFC, 0xF8, 0x03, 0xE0, 0x08, 0x03, 0xE0, 0x0B,
@@ -514,227 +557,209 @@ static const uint8_t EPD_FontUTF8_24x24_B[] = {
     0x1B, 0xE0, 0x0F, 0xBB, 0xED, 0xC0, 0x03, 0xED, 0xC0, 0x03, 0xED, 0xDF, 0xFB, 0xED, 0xDF, 0xFB,
     0xED, 0xC0, 0x03, 0xED, 0xC0, 0x03, 0xED, 0xDF, 0x1B, 0xC0, 0x0E, 0x3B, 0xC0, 0x08, 0x7B, 0xEF,
     0xF8, 0xF3, 0xFF, 0xF9, 0xF3, 0xFF, 0xFF, 0xFB,
-    0x00, 0x5E, 0xA6, /* UNICODE索引 - 度 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE3, 0xFF, 0xFC, 0x07, 0xF0, 0x00, 0x1F, 0xF0,
-    0x00, 0xFD, 0xF7, 0x7F, 0xFD, 0xF7, 0x7D, 0xFD, 0xF7, 0x7D, 0xF9, 0xF3, 0x7D, 0xFB, 0xF0, 0x04,
-    0x73, 0xB4, 0x04, 0x37, 0x87, 0x6D, 0x87, 0xC7, 0x6D, 0xCF, 0xC7, 0x6D, 0xCF, 0xF7, 0x6D, 0x87,
-    0xF0, 0x05, 0x37, 0xF0, 0x04, 0x73, 0xF5, 0x7C, 0xF3, 0xF7, 0x7D, 0xFB, 0xE6, 0x7F, 0xF9, 0xE6,
-    0x7F, 0xF9, 0xF7, 0x7F, 0xFB, 0xFF, 0xFF, 0xFB,
-    0x00, 0x94, 0x9F, /* UNICODE索引 - 钟 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x1B, 0xFF, 0xFC, 0x3B, 0xFF, 0xC0, 0x7B, 0xFF, 0x81,
-    0x00, 0x03, 0x8B, 0x00, 0x03, 0xFB, 0x7B, 0xC7, 0xFA, 0x7B, 0xCF, 0xFA, 0x7B, 0x9F, 0xFB, 0xFB,
-    0xBF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFD, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xBD, 0xFB, 0xFD,
-    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0xFD, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xFC, 0x01, 0xFF, 0xFC,
-    0x01, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x80, 0x01, /* UNICODE索引 - 老 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xDF, 0xFF, 0xBF, 0xDF, 0xFF, 0xBF, 0x9F, 0xFF, 0xBF, 0xBF, 0xFB,
-    0xBF, 0x3F, 0xFB, 0xBF, 0x7F, 0xFB, 0xBE, 0x7F, 0xFB, 0xB8, 0x03, 0xFB, 0xB8, 0x01, 0x80, 0x39,
-    0x99, 0x80, 0x33, 0xBD, 0x80, 0x27, 0x3D, 0xFB, 0x87, 0x7D, 0xFB, 0x8E, 0x7D, 0xFB, 0x1C, 0xFD,
-    0xF8, 0x3C, 0xFD, 0xF8, 0xB8, 0xFD, 0xE1, 0xB9, 0xFD, 0xE3, 0xBD, 0x81, 0xE7, 0xBF, 0x81, 0xFF,
-    0xBF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x53, 0x16, /* UNICODE索引 - 化 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8,
-    0x00, 0x01, 0xE0, 0x00, 0x01, 0x81, 0x00, 0x03, 0x8F, 0xFF, 0x7F, 0xDF, 0xFE, 0x7F, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF9, 0xFF, 0x80, 0x00, 0x07, 0x80, 0x00, 0x03, 0xDF, 0xC7, 0xF3,
-    0xFF, 0x8F, 0xFB, 0xFF, 0x1F, 0xFB, 0xFE, 0x3F, 0xFB, 0xFC, 0x7F, 0xFB, 0xFC, 0xFF, 0xF3, 0xFF,
-    0xFF, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xF7,
-    0x00, 0x6B, 0xCF, /* UNICODE索引 - 每 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xB7, 0xFF, 0xFE, 0x37, 0xFF, 0xFC, 0x77, 0xDF, 0xF0,
-    0xF0, 0x0F, 0xC0, 0x00, 0x0F, 0x86, 0x00, 0xDF, 0x86, 0xF7, 0xDF, 0xD6, 0xF7, 0xDF, 0xF6, 0x71,
-    0xDF, 0xF6, 0x30, 0xDF, 0xF6, 0x84, 0x1F, 0xF6, 0x86, 0x1F, 0xF6, 0xF7, 0xDB, 0xF6, 0xF7, 0xD9,
-    0xF6, 0xF7, 0xD9, 0xF6, 0x00, 0x01, 0xF6, 0x00, 0x03, 0xE6, 0x03, 0xDF, 0xE7, 0xF7, 0x9F, 0xF7,
-    0xF7, 0x9F, 0xFF, 0xF7, 0xDF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4E, 0x2A, /* UNICODE索引 - 个 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE1, 0xFF,
-    0xFF, 0x83, 0x00, 0x01, 0x8F, 0x00, 0x01, 0xC3, 0x00, 0x03, 0xF1, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFE, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xCF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x7E, 0xA6, /* UNICODE索引 - 约 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x3B, 0xFF, 0x0E, 0x33, 0xFC, 0x1C, 0x33, 0xC0,
-    0xD1, 0x77, 0xC3, 0xC2, 0x77, 0xEF, 0x86, 0xE7, 0xFF, 0x1E, 0xEF, 0xFC, 0x36, 0xEF, 0xFC, 0x67,
-    0xCF, 0xFE, 0x8F, 0xDF, 0xFE, 0x1F, 0xFF, 0xF0, 0x77, 0xFF, 0xC0, 0xF1, 0xFF, 0xC6, 0xF8, 0xF7,
-    0xEE, 0xFC, 0xF3, 0xFE, 0xFF, 0xFB, 0xFE, 0xFF, 0xF9, 0xFE, 0xFF, 0xE1, 0xFE, 0x00, 0x03, 0xFE,
-    0x00, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4E, 0x3A, /* UNICODE索引 - 为 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFD, 0xFF, 0x7F, 0xF9, 0xFF, 0x7F, 0xF3, 0xEF,
-    0x7F, 0xE7, 0xE3, 0x7F, 0xCF, 0xF1, 0x7F, 0x8F, 0xF1, 0x7E, 0x1F, 0xFF, 0x78, 0x3F, 0xFF, 0x40,
-    0xFF, 0x80, 0x03, 0xFF, 0x80, 0x07, 0xFF, 0xC1, 0x77, 0xF7, 0xDF, 0x73, 0xF7, 0xFF, 0x79, 0xF7,
-    0xFF, 0x78, 0xF3, 0xFF, 0x7C, 0x79, 0xFF, 0x7E, 0x79, 0xFF, 0x7F, 0xE1, 0xFF, 0x00, 0x03, 0xFF,
-    0x00, 0x07, 0xFF, 0x01, 0xFF, 0xFF, 0x7F, 0xFF,
-    0x00, 0x52, 0x1D, /* UNICODE索引 - 初 */
-    0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFF, 0xFB, 0xF9, 0xFF, 0xFB, 0xF3, 0xFF, 0xFB, 0xE7, 0xFF, 0xBB,
-    0xC7, 0xFF, 0x83, 0x00, 0x01, 0xC2, 0x00, 0x01, 0xE0, 0x73, 0xFD, 0xF9, 0xC1, 0xF9, 0xFB, 0x88,
-    0xF3, 0xF7, 0x9C, 0xC7, 0xF7, 0xFF, 0x0F, 0xF7, 0xF0, 0x1F, 0xF0, 0x00, 0x7F, 0xF0, 0x03, 0xF7,
-    0xF7, 0xFF, 0xF7, 0xF7, 0xFF, 0xF3, 0xF7, 0xFF, 0xF9, 0xF7, 0xFF, 0xE1, 0xF4, 0x00, 0x03, 0xF0,
-    0x00, 0x07, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x59, 0xCB, /* UNICODE索引 - 始 */
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD, 0xFD, 0xFD, 0xF9, 0xFD, 0xC0, 0xFB, 0xFC, 0x02, 0xE3, 0x80,
-    0x1E, 0x47, 0x81, 0xFE, 0x0F, 0xCD, 0xF8, 0x1F, 0xFD, 0x00, 0x1F, 0xFC, 0x03, 0x8F, 0xFC, 0x3F,
-    0xCF, 0xFF, 0x9F, 0xFF, 0xFF, 0x18, 0x01, 0xFC, 0x18, 0x01, 0xE0, 0xD8, 0x03, 0x83, 0xDB, 0xF7,
-    0x8F, 0xDB, 0xF7, 0xDF, 0x9B, 0xF7, 0xFD, 0xBB, 0xF7, 0xFC, 0xBB, 0xF7, 0xFE, 0x38, 0x03, 0xFE,
-    0x08, 0x03, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x63, 0x6E, /* UNICODE索引 - 据 */
-    0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xFE, 0xFC, 0xFB, 0xFE, 0xFC, 0xFB, 0xFE, 0xF9, 0xF9, 0xC0,
-    0x00, 0x01, 0xC0, 0x00, 0x01, 0xEE, 0xE7, 0xF3, 0xFC, 0xEF, 0xC7, 0xFC, 0xCE, 0x0F, 0xE0, 0x00,
-    0x3F, 0xE0, 0x00, 0xFF, 0xE0, 0x6E, 0x01, 0xEE, 0xEE, 0x01, 0xEE, 0xEE, 0xF7, 0xEE, 0xEE, 0xF7,
-    0xEE, 0x00, 0xF7, 0xEE, 0x00, 0xF7, 0xEE, 0xEE, 0xF7, 0xE0, 0x6E, 0x01, 0xE0, 0x6E, 0x01, 0xE0,
-    0x6E, 0x03, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x5E, 0x76, /* UNICODE索引 - 并 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFD, 0xFD, 0xFB, 0xFD, 0xFD, 0xFB, 0xF9, 0xFD,
-    0xFB, 0xF3, 0xFD, 0xFB, 0xE7, 0xBD, 0xFB, 0x87, 0x8C, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0xE0, 0x01,
-    0xFF, 0xFD, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xF1, 0xFB, 0xFF, 0xC0, 0x00, 0x01,
-    0x8C, 0x00, 0x01, 0x9D, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xFD, 0xF3, 0xFF, 0xFD,
-    0xF3, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x52, 0x30, /* UNICODE索引 - 到 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFB, 0xEF, 0x9D, 0xF3, 0xEF, 0x1D, 0xF3, 0xEE,
-    0x1D, 0xF3, 0xEC, 0xBD, 0xF7, 0xE1, 0x80, 0x07, 0xE3, 0x80, 0x07, 0xE3, 0x80, 0x0F, 0xEE, 0xBD,
-    0xEF, 0xEE, 0x3D, 0xEF, 0xCE, 0x19, 0xEF, 0xCF, 0x09, 0xCF, 0xEF, 0x8D, 0xDF, 0xFF, 0xFF, 0xFF,
-    0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x3B, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF9, 0xC0, 0x00, 0x01, 0xC0,
-    0x00, 0x01, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-    0x00, 0x59, 0xCB, /* UNICODE索引 - 始 */
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD, 0xFD, 0xFD, 0xF9, 0xFD, 0xC0, 0xFB, 0xFC, 0x02, 0xE3, 0x80,
-    0x1E, 0x47, 0x81, 0xFE, 0x0F, 0xCD, 0xF8, 0x1F, 0xFD, 0x00, 0x1F, 0xFC, 0x03, 0x8F, 0xFC, 0x3F,
-    0xCF, 0xFF, 0x9F, 0xFF, 0xFF, 0x18, 0x01, 0xFC, 0x18, 0x01, 0xE0, 0xD8, 0x03, 0x83, 0xDB, 0xF7,
-    0x8F, 0xDB, 0xF7, 0xDF, 0x9B, 0xF7, 0xFD, 0xBB, 0xF7, 0xFC, 0xBB, 0xF7, 0xFE, 0x38, 0x03, 0xFE,
-    0x08, 0x03, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x5B, 0x8C, /* UNICODE索引 - 完 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xF7, 0xFD, 0xFC, 0x77, 0xF9, 0xF8, 0x77, 0xFB, 0xF8,
-    0x77, 0xF3, 0xFB, 0x77, 0xE7, 0xFB, 0x77, 0xC7, 0xFB, 0x70, 0x0F, 0xFB, 0x70, 0x3F, 0xBB, 0x71,
-    0xFF, 0x9B, 0x77, 0xFF, 0xC3, 0x77, 0xFF, 0xC3, 0x70, 0x07, 0xFB, 0x70, 0x03, 0xFB, 0x77, 0xF3,
-    0xFA, 0x77, 0xFB, 0xFA, 0x77, 0xFB, 0xFB, 0x77, 0xFB, 0xFA, 0xE7, 0xFB, 0xF8, 0xE7, 0xF3, 0xF9,
-    0xF7, 0x83, 0xFB, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
-    0x00, 0x62, 0x10, /* UNICODE索引 - 成 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x83, 0xFC, 0x00, 0x0F, 0xFC,
-    0x00, 0x7F, 0xFD, 0xEF, 0xDF, 0xFD, 0xEF, 0xDF, 0xFD, 0xEF, 0xCF, 0xFD, 0xEE, 0x0F, 0xFD, 0xE0,
-    0x0B, 0xFD, 0xE0, 0x3B, 0xC5, 0xFF, 0xF3, 0xC0, 0x0F, 0xE7, 0xC0, 0x00, 0xCF, 0xFD, 0xC0, 0x0F,
-    0xDD, 0xFC, 0x1F, 0xCD, 0xF8, 0x0F, 0xE1, 0xE0, 0xC7, 0xF1, 0x81, 0xE3, 0xF9, 0x8F, 0xE3, 0xF9,
-    0xDF, 0xC3, 0xFD, 0xFF, 0x03, 0xFF, 0xFF, 0x3F,
-    0x00, 0x79, 0xD2, /* UNICODE索引 - 秒 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xF7, 0x7E, 0x3F, 0xF7, 0x7C, 0x7F, 0xE7, 0x71, 0xFF, 0xEF,
-    0x03, 0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xCF, 0x63, 0xFD, 0xCF, 0x63, 0xF9, 0xDF, 0x73,
-    0xFB, 0xFF, 0xC3, 0xFB, 0xFC, 0x07, 0xF3, 0xFC, 0x1F, 0xF7, 0xFC, 0xFF, 0xE7, 0xFF, 0xFF, 0xCF,
-    0x80, 0x00, 0x8F, 0x80, 0x00, 0x1F, 0xFF, 0xFE, 0x3F, 0xFD, 0xF8, 0x7F, 0xFC, 0x70, 0xFF, 0xFE,
-    0x11, 0xFF, 0xFF, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x54, 0x0E, /* UNICODE索引 - 后 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0x07, 0xF0,
-    0x00, 0x1F, 0xF0, 0x00, 0x7F, 0xF7, 0x7F, 0xFF, 0xF7, 0x7B, 0xE3, 0xF7, 0x78, 0x03, 0xF7, 0x78,
-    0x03, 0xF7, 0x7B, 0xEF, 0xF7, 0x7B, 0xEF, 0xF7, 0x7B, 0xEF, 0xE7, 0x7B, 0xEF, 0xEF, 0x7B, 0xEF,
-    0xEF, 0x7B, 0xEF, 0xEF, 0x7B, 0xEF, 0xEF, 0x78, 0x03, 0xCF, 0x78, 0x03, 0xCE, 0x78, 0x07, 0xEE,
-    0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x78, 0x6C, /* UNICODE索引 - 硬 */
-    0xFF, 0xFF, 0xFF, 0xEF, 0xFB, 0xFF, 0xEF, 0xF3, 0xFF, 0xEF, 0x87, 0xFF, 0xEC, 0x00, 0x07, 0xE0,
-    0x00, 0x07, 0xE1, 0xBF, 0xBF, 0xEF, 0xBF, 0xBD, 0xCF, 0x80, 0x1D, 0xCF, 0x80, 0x19, 0xEF, 0xBF,
-    0xFB, 0xEC, 0x00, 0xF3, 0xEC, 0x00, 0x77, 0xED, 0xBB, 0x07, 0xED, 0xBB, 0x8F, 0xED, 0xB0, 0x0F,
-    0xE0, 0x00, 0x27, 0xE0, 0x01, 0xE7, 0xED, 0xBB, 0xF3, 0xED, 0xBB, 0xF3, 0xEC, 0x01, 0xFB, 0xCC,
-    0x01, 0xFB, 0xCD, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4E, 0xF6, /* UNICODE索引 - 件 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8,
-    0x00, 0x01, 0xC0, 0x00, 0x01, 0x83, 0xFF, 0xFF, 0x8F, 0xE3, 0xFF, 0xDF, 0x83, 0xFF, 0xF0, 0x1B,
-    0xFF, 0xF0, 0x7B, 0xFF, 0xF2, 0xFB, 0xFF, 0xFE, 0xFB, 0xFF, 0xFE, 0xFB, 0xFF, 0x80, 0x00, 0x01,
-    0x80, 0x00, 0x01, 0xFE, 0xFB, 0xFF, 0xFE, 0xFB, 0xFF, 0xFE, 0xFB, 0xFF, 0xFE, 0xFB, 0xFF, 0xFE,
-    0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF,
     0x00, 0x72, 0x48, /* UNICODE索引 - 版 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x81, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x3F, 0xFF,
     0x77, 0xFF, 0x80, 0x77, 0xFF, 0x80, 0x70, 0x07, 0xC0, 0x70, 0x05, 0xFF, 0x70, 0x01, 0xFF, 0x7F,
     0x81, 0xF0, 0x00, 0x09, 0xF0, 0x00, 0x7B, 0xF7, 0x3F, 0xF3, 0xF7, 0x03, 0xE7, 0xE7, 0x40, 0xCF,
     0xEF, 0x7C, 0x1F, 0xEF, 0x7E, 0x1F, 0xEF, 0x70, 0x0F, 0xCF, 0x01, 0xC7, 0xCF, 0x07, 0xE3, 0xCF,
     0x3F, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
-    0x00, 0x67, 0x2C, /* UNICODE索引 - 本 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xCF, 0xFD, 0xFF, 0xDF, 0xFD, 0xFF, 0x9F, 0xFD,
-    0xFF, 0x3F, 0xFD, 0xFC, 0x3F, 0xFD, 0xF8, 0xBF, 0xFD, 0xE1, 0xBF, 0xFD, 0x83, 0xBF, 0xFC, 0x0F,
-    0xBF, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFC, 0x1F, 0xBF, 0xFD, 0x87, 0xBF,
-    0xFD, 0xE3, 0x3F, 0xFD, 0xF0, 0x3F, 0xFD, 0xFC, 0x3F, 0xFD, 0xFE, 0x3F, 0xF9, 0xFF, 0x1F, 0xF9,
-    0xFF, 0x1F, 0xFD, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF,
-    0x00, 0x6C, 0xE8, /* UNICODE索引 - 注 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x3F, 0xBF, 0xFF, 0x8F, 0x81, 0xE7, 0xCE, 0x01, 0xE1,
-    0xF8, 0x01, 0xF1, 0xC0, 0xFF, 0xFE, 0x07, 0xFB, 0xFE, 0x3F, 0xFB, 0xFE, 0xFB, 0xFB, 0xFE, 0xFB,
-    0xFB, 0xFE, 0xFB, 0xFB, 0xDE, 0xFB, 0xFB, 0xCE, 0xFB, 0xFB, 0xE2, 0x00, 0x03, 0xE2, 0x00, 0x03,
-    0xF6, 0xFB, 0xFB, 0xFE, 0xFB, 0xFB, 0xFE, 0xFB, 0xFB, 0xFE, 0xF3, 0xFB, 0xFC, 0xF3, 0xF3, 0xFC,
-    0xFB, 0xF3, 0xFE, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
-    0x00, 0x61, 0x0F, /* UNICODE索引 - 意 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFB, 0xFE, 0xFF, 0xE3, 0xEE, 0xFF, 0x83, 0xEE,
-    0x80, 0x87, 0xEE, 0x80, 0xFF, 0xEE, 0x81, 0x83, 0xE6, 0xB5, 0x83, 0xE0, 0xB5, 0xBB, 0xE8, 0xB4,
-    0xFB, 0x8E, 0xB4, 0x3B, 0x8E, 0xB5, 0x0B, 0xCE, 0xB5, 0x8B, 0xE0, 0xB5, 0xFB, 0xE0, 0xB5, 0xFB,
-    0xE6, 0xB5, 0xC3, 0xCE, 0x80, 0xC3, 0xCE, 0x80, 0x3F, 0xEE, 0xFF, 0x1F, 0xFC, 0xFF, 0x87, 0xFC,
-    0xFF, 0xC7, 0xFE, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4F, 0xDD, /* UNICODE索引 - 保 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xF8,
-    0x00, 0x01, 0xC0, 0x00, 0x01, 0x83, 0xF7, 0xFB, 0x9F, 0xF7, 0xF3, 0xFF, 0xF7, 0xE7, 0xE0, 0x37,
-    0xCF, 0xE0, 0x37, 0x1F, 0xEF, 0x74, 0x3F, 0xEF, 0x70, 0x7F, 0xEF, 0x00, 0x01, 0xEF, 0x00, 0x01,
-    0xEF, 0x71, 0xF3, 0xEF, 0x70, 0xFF, 0xEF, 0x76, 0x3F, 0xE0, 0x37, 0x1F, 0xE0, 0x37, 0xC7, 0xEF,
-    0xE7, 0xE7, 0xFF, 0xE7, 0xE7, 0xFF, 0xF7, 0xFF,
-    0x00, 0x5B, 0x58, /* UNICODE索引 - 存 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0xFE, 0x7F, 0xF7, 0xFC, 0xFF, 0xF7, 0xF9, 0xFF, 0xF7,
-    0xE3, 0xFF, 0xF7, 0x80, 0x01, 0xF7, 0x00, 0x01, 0xF6, 0x3D, 0xFF, 0xF0, 0x7D, 0xFF, 0x80, 0xFD,
-    0xFF, 0x82, 0xFD, 0xFF, 0xD6, 0xFD, 0xFB, 0xF6, 0xFD, 0xFB, 0xF6, 0xFD, 0xF9, 0xF6, 0xE0, 0x01,
-    0xF6, 0xC0, 0x03, 0xF6, 0x8D, 0xFF, 0xF6, 0x3D, 0xFF, 0xF6, 0x7D, 0xFF, 0xE6, 0x7D, 0xFF, 0xE7,
-    0xFD, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4E, 0x0D, /* UNICODE索引 - 不 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xEF, 0xFF, 0x3F, 0xEF, 0xFF, 0x7F, 0xEF, 0xFE, 0x7F, 0xEF,
-    0xFC, 0xFF, 0xEF, 0xF9, 0xFF, 0xEF, 0xF3, 0xFF, 0xEF, 0xC7, 0xFF, 0xEF, 0x8F, 0xFF, 0xEE, 0x1F,
-    0xFF, 0xE8, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE3, 0x00, 0x03, 0xE7, 0xFF, 0xFF, 0xEF, 0xDF, 0xFF,
-    0xEF, 0xDF, 0xFF, 0xEF, 0xCF, 0xFF, 0xEF, 0xE7, 0xFF, 0xEF, 0xF3, 0xFF, 0xCF, 0xF0, 0xFF, 0xCF,
-    0xF8, 0x7F, 0xEF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4F, 0x1A, /* UNICODE索引 - 会 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF5, 0xFF, 0xFF, 0xE5, 0xFF, 0xFF, 0xCD, 0xFF, 0xFF,
-    0x9D, 0xF8, 0xFF, 0x1D, 0xF0, 0xFE, 0x1D, 0xE5, 0xFC, 0x5D, 0x8D, 0xF0, 0xDD, 0x1D, 0xC3, 0xDC,
-    0x3D, 0x87, 0xDC, 0x7D, 0x87, 0xDD, 0xF9, 0xD3, 0xDD, 0xFB, 0xF9, 0xDD, 0xDB, 0xFC, 0x9D, 0xCB,
-    0xFE, 0x1D, 0xC3, 0xFE, 0x1D, 0xE3, 0xFF, 0x3D, 0xF0, 0xFF, 0x99, 0xF8, 0xFF, 0x99, 0xFD, 0xFF,
-    0x9D, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x51, 0x8D, /* UNICODE索引 - 再 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xEF, 0xFE, 0xFF, 0xEF, 0xFE, 0xFF, 0xEF, 0xFE, 0xFF, 0xEE,
-    0x00, 0x01, 0xEE, 0x00, 0x01, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE,
-    0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFF, 0xEE, 0xEE, 0xFB,
-    0xEE, 0xEE, 0xFB, 0xEE, 0x00, 0x01, 0xEE, 0x00, 0x01, 0xCE, 0x00, 0x03, 0xCF, 0xFE, 0xFF, 0xEF,
-    0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x66, 0x3E, /* UNICODE索引 - 显 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFD, 0xF7, 0xFF, 0xFC, 0xF7, 0xFF,
-    0xFE, 0x37, 0xC0, 0x0E, 0x17, 0xC0, 0x0F, 0x17, 0xDD, 0xCF, 0xF7, 0xDD, 0xC0, 0x07, 0xDD, 0xD0,
-    0x07, 0xDD, 0xD7, 0xF7, 0xDD, 0xDF, 0xF7, 0xDD, 0xDF, 0xF7, 0xDD, 0xD0, 0x07, 0xDD, 0xD0, 0x07,
-    0xDD, 0xDF, 0x97, 0xC0, 0x0F, 0x37, 0xC0, 0x0E, 0x77, 0xEF, 0xF8, 0xF7, 0xFF, 0xF9, 0xE7, 0xFF,
-    0xFB, 0xE7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x00, 0x72, 0xB6, /* UNICODE索引 - 状 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFD, 0xFE, 0x7F, 0xFC, 0x7E, 0x7F, 0xFE, 0x3C, 0xFF, 0xFF,
+    0x39, 0xFF, 0xDF, 0xF3, 0xFD, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xFF, 0xBF, 0xF9, 0xFF, 0xBF,
+    0xF3, 0xFF, 0xBF, 0xC7, 0xFF, 0xBF, 0x0F, 0xFF, 0xB0, 0x1F, 0xC0, 0x00, 0x7F, 0xC0, 0x03, 0xFF,
+    0xFF, 0x81, 0xFF, 0xEF, 0xA0, 0x3F, 0xE7, 0xBE, 0x0F, 0xF1, 0xBF, 0x87, 0xF0, 0x3F, 0xC3, 0xF8,
+    0x3F, 0xE3, 0xFF, 0xBF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x00, 0x75, 0x28, /* UNICODE索引 - 用 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x83, 0xE0, 0x00, 0x0F, 0xE0,
+    0x00, 0x3F, 0xE0, 0x3D, 0xFF, 0xEF, 0x7D, 0xFF, 0xEF, 0x7D, 0xFF, 0xEF, 0x7D, 0xFF, 0xEF, 0x7D,
+    0xFF, 0xEF, 0x7D, 0xE1, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xEF, 0x7D, 0xFF, 0xEF, 0x7D, 0xFF,
+    0xEF, 0x7D, 0xF7, 0xEF, 0x7D, 0xF3, 0xEF, 0x7D, 0xF9, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xEF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x75, 0x35, /* UNICODE索引 - 电 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFC,
+    0x00, 0x3F, 0xFD, 0xDE, 0xFF, 0xFD, 0xDE, 0xFF, 0xFD, 0xDE, 0xFF, 0xFD, 0xDE, 0xFF, 0xFD, 0xDE,
+    0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0xFD, 0xDE, 0xFD, 0xFD, 0xDE, 0xFD, 0xFD, 0xDE, 0xFD,
+    0xFD, 0xDE, 0xFD, 0xFD, 0xDE, 0xFD, 0xFC, 0x00, 0x7D, 0xFC, 0x00, 0x7D, 0xFD, 0xFF, 0xF9, 0xFF,
+    0xFF, 0xC1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF,
+    0x00, 0x78, 0x6C, /* UNICODE索引 - 硬 */
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFB, 0xFF, 0xEF, 0xF3, 0xFF, 0xEF, 0x87, 0xFF, 0xEC, 0x00, 0x07, 0xE0,
+    0x00, 0x07, 0xE1, 0xBF, 0xBF, 0xEF, 0xBF, 0xBD, 0xCF, 0x80, 0x1D, 0xCF, 0x80, 0x19, 0xEF, 0xBF,
+    0xFB, 0xEC, 0x00, 0xF3, 0xEC, 0x00, 0x77, 0xED, 0xBB, 0x07, 0xED, 0xBB, 0x8F, 0xED, 0xB0, 0x0F,
+    0xE0, 0x00, 0x27, 0xE0, 0x01, 0xE7, 0xED, 0xBB, 0xF3, 0xED, 0xBB, 0xF3, 0xEC, 0x01, 0xFB, 0xCC,
+    0x01, 0xFB, 0xCD, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF,
     0x00, 0x79, 0x3A, /* UNICODE索引 - 示 */
     0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFF, 0xBF, 0xE7, 0xFF, 0xBF, 0xCF, 0xEF, 0xBF, 0x1F, 0xEF,
     0xBE, 0x3F, 0xEF, 0xB8, 0x7F, 0xEF, 0xB0, 0xF7, 0xEF, 0xB1, 0xF7, 0xEF, 0xBF, 0xF3, 0xEF, 0xBF,
     0xF1, 0xEF, 0x80, 0x01, 0xEF, 0x80, 0x03, 0xEF, 0x80, 0x07, 0xEF, 0xBF, 0xFF, 0xEF, 0xB7, 0xFF,
     0xEF, 0xB3, 0xFF, 0xEF, 0xB9, 0xFF, 0xCF, 0xBC, 0x7F, 0xCF, 0xBE, 0x3F, 0xEF, 0xBF, 0x0F, 0xFF,
     0x3F, 0x8F, 0xFF, 0x3F, 0xDF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x6B, 0x64, /* UNICODE索引 - 此 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xE3, 0xFE, 0x00, 0x07, 0xFE,
-    0x00, 0x07, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x1F, 0xDF, 0xBF,
-    0x9F, 0xFF, 0xBF, 0xBF, 0xFF, 0xBF, 0xBF, 0xFF, 0xBF, 0xBF, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03,
-    0xDF, 0xCF, 0xFB, 0xFF, 0x9F, 0xFB, 0xFF, 0xBF, 0xFB, 0xFF, 0x3F, 0xFB, 0xFE, 0x7F, 0xFB, 0xFE,
-    0x7F, 0x03, 0xFE, 0xFF, 0x03, 0xFF, 0xFF, 0xF7,
-    0x00, 0xFF, 0x1A, /* UNICODE索引 - ： */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xC7, 0xFF, 0xF1, 0xC7, 0xFF,
-    0xF1, 0xC7, 0xFF, 0xF1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x21, 0x03, /* UNICODE索引 - ℃（手动修改） */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF3, 0x9F, 0xFF, 0xF3,
-    0x9F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFE, 0x00,
-    0x0F, 0xFC, 0x00, 0x07, 0xF8, 0x7F, 0xC7, 0xF9, 0xFF, 0xE3, 0xF1, 0xFF, 0xF3, 0xF3, 0xFF, 0xF3,
-    0xF3, 0xFF, 0xF3, 0xF3, 0xFF, 0xF3, 0xF3, 0xFF, 0xF3, 0xF9, 0xFF, 0xE3, 0xFC, 0xFF, 0xE7, 0xFC,
-    0x1F, 0xCF, 0xFC, 0x1F, 0x9F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x79, 0xD2, /* UNICODE索引 - 秒 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xF7, 0x7E, 0x3F, 0xF7, 0x7C, 0x7F, 0xE7, 0x71, 0xFF, 0xEF,
+    0x03, 0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xCF, 0x63, 0xFD, 0xCF, 0x63, 0xF9, 0xDF, 0x73,
+    0xFB, 0xFF, 0xC3, 0xFB, 0xFC, 0x07, 0xF3, 0xFC, 0x1F, 0xF7, 0xFC, 0xFF, 0xE7, 0xFF, 0xFF, 0xCF,
+    0x80, 0x00, 0x8F, 0x80, 0x00, 0x1F, 0xFF, 0xFE, 0x3F, 0xFD, 0xF8, 0x7F, 0xFC, 0x70, 0xFF, 0xFE,
+    0x11, 0xFF, 0xFF, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x79, 0xFB, /* UNICODE索引 - 移 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xDF, 0xFF, 0xBF, 0x9F, 0xF7, 0xBE, 0x3F, 0xF7, 0xB8, 0x7F, 0xF7,
+    0x81, 0xFF, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE7, 0xB3, 0xFD, 0xEF, 0x38, 0xFD, 0xEF, 0x38,
+    0xBD, 0xFF, 0x3B, 0x39, 0xFE, 0x72, 0x7B, 0xF8, 0xF4, 0xFB, 0xE0, 0x60, 0x73, 0xC2, 0x01, 0x17,
+    0xCB, 0x03, 0x87, 0xFB, 0x03, 0xCF, 0xFA, 0x2B, 0x9F, 0xF8, 0x7B, 0x1F, 0xF8, 0xF8, 0x3F, 0xF9,
+    0xF8, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x7C, 0xFB, /* UNICODE索引 - 系 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xF3, 0xFF, 0xFB, 0xF7, 0xEF,
+    0x79, 0xE7, 0xEF, 0x39, 0xCF, 0xEE, 0x31, 0x9F, 0xEE, 0x30, 0x17, 0xEC, 0x22, 0x37, 0xE9, 0x6B,
+    0xF3, 0xE3, 0x4B, 0xF9, 0xE3, 0x58, 0x01, 0xC7, 0x18, 0x03, 0xD7, 0x38, 0x07, 0xDF, 0x3B, 0x7F,
+    0xDE, 0x7B, 0x7F, 0xDC, 0xEB, 0x3F, 0x9C, 0xE3, 0x9F, 0x9F, 0xF1, 0x8F, 0xDF, 0xF1, 0xC3, 0xFF,
+    0xF9, 0xE3, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x00, 0x7E, 0xA6, /* UNICODE索引 - 约 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x3B, 0xFF, 0x0E, 0x33, 0xFC, 0x1C, 0x33, 0xC0,
+    0xD1, 0x77, 0xC3, 0xC2, 0x77, 0xEF, 0x86, 0xE7, 0xFF, 0x1E, 0xEF, 0xFC, 0x36, 0xEF, 0xFC, 0x67,
+    0xCF, 0xFE, 0x8F, 0xDF, 0xFE, 0x1F, 0xFF, 0xF0, 0x77, 0xFF, 0xC0, 0xF1, 0xFF, 0xC6, 0xF8, 0xF7,
+    0xEE, 0xFC, 0xF3, 0xFE, 0xFF, 0xFB, 0xFE, 0xFF, 0xF9, 0xFE, 0xFF, 0xE1, 0xFE, 0x00, 0x03, 0xFE,
+    0x00, 0x07, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x7E, 0xDF, /* UNICODE索引 - 统 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0xCF, 0xFE, 0x39, 0xCF, 0xF8, 0x61, 0xCF, 0xE1,
+    0x41, 0xDF, 0x87, 0x0B, 0x9F, 0x8F, 0x1B, 0xBF, 0xDC, 0x7B, 0xBD, 0xFC, 0xFB, 0xB9, 0xF5, 0xEF,
+    0xFB, 0xF7, 0xCF, 0xF3, 0xF7, 0x8F, 0xC7, 0xF6, 0x20, 0x0F, 0xB0, 0x60, 0x1F, 0x81, 0xC7, 0xFF,
+    0xC1, 0xDF, 0xFF, 0xE7, 0xC0, 0x03, 0xF7, 0x40, 0x03, 0xF7, 0x1F, 0xFB, 0xF7, 0x8F, 0xFB, 0xF7,
+    0x8F, 0x83, 0xF7, 0xCF, 0x83, 0xFF, 0xFF, 0xFF,
+    0x00, 0x7F, 0x6E, /* UNICODE索引 - 置 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xFF, 0xBF, 0xFB, 0xC0, 0xBF, 0xFB, 0xC0,
+    0xBF, 0xFB, 0xDD, 0xA0, 0x03, 0xDD, 0xA0, 0x03, 0xDD, 0xAD, 0x5B, 0xC1, 0xAD, 0x5B, 0xC1, 0xAD,
+    0x5B, 0xDC, 0x0D, 0x5B, 0xDC, 0x0D, 0x5B, 0xDD, 0xAD, 0x5B, 0xC1, 0xAD, 0x5B, 0xC1, 0xAD, 0x5B,
+    0xDD, 0xAD, 0x5B, 0xDD, 0x80, 0x03, 0xDD, 0x80, 0x03, 0xC0, 0x2F, 0xFB, 0xC0, 0x3F, 0xFB, 0xFF,
+    0xBF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFB,
+    0x00, 0x80, 0x01, /* UNICODE索引 - 老 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xDF, 0xFF, 0xBF, 0xDF, 0xFF, 0xBF, 0x9F, 0xFF, 0xBF, 0xBF, 0xFB,
+    0xBF, 0x3F, 0xFB, 0xBF, 0x7F, 0xFB, 0xBE, 0x7F, 0xFB, 0xB8, 0x03, 0xFB, 0xB8, 0x01, 0x80, 0x39,
+    0x99, 0x80, 0x33, 0xBD, 0x80, 0x27, 0x3D, 0xFB, 0x87, 0x7D, 0xFB, 0x8E, 0x7D, 0xFB, 0x1C, 0xFD,
+    0xF8, 0x3C, 0xFD, 0xF8, 0xB8, 0xFD, 0xE1, 0xB9, 0xFD, 0xE3, 0xBD, 0x81, 0xE7, 0xBF, 0x81, 0xFF,
+    0xBF, 0xFB, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x80, 0x03, /* UNICODE索引 - 考 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7F, 0x7F, 0xFF, 0x7F, 0x7F, 0xF7, 0x7E, 0x7F, 0xF7,
+    0x7C, 0xFF, 0xF7, 0x7D, 0xFF, 0xF7, 0x79, 0xFF, 0xF7, 0x73, 0xFF, 0xF7, 0x73, 0xFF, 0x80, 0x66,
+    0xFF, 0x80, 0x40, 0xF7, 0x80, 0x10, 0xF7, 0xF7, 0x32, 0xF3, 0xF6, 0x76, 0xF9, 0xF0, 0x76, 0xF9,
+    0xF1, 0x76, 0xF9, 0xE3, 0x76, 0xC1, 0xC7, 0x76, 0x03, 0xCF, 0x66, 0x0F, 0xFF, 0x66, 0xFF, 0xFE,
+    0x77, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF,
+    0x00, 0x83, 0xDC, /* UNICODE索引 - 菜 */
+    0xFF, 0xFF, 0xFF, 0xF7, 0xFD, 0xFD, 0xF7, 0xFD, 0xF9, 0xF7, 0x7D, 0xFB, 0xF7, 0x7D, 0xF3, 0xF7,
+    0x5D, 0xE7, 0xF7, 0x45, 0xE7, 0xF7, 0x65, 0xCF, 0x81, 0x75, 0x9F, 0x81, 0x7C, 0x3F, 0xC1, 0x3C,
+    0x7F, 0xF7, 0x10, 0x01, 0xF6, 0x40, 0x01, 0xF6, 0xC8, 0x03, 0x80, 0xFC, 0x7F, 0x80, 0xF9, 0x3F,
+    0xF6, 0xE1, 0x9F, 0xF6, 0xC5, 0xCF, 0xF4, 0xCD, 0xE7, 0xF4, 0xDD, 0xE7, 0xE6, 0xF9, 0xF3, 0xE7,
+    0xF9, 0xF3, 0xF7, 0xFD, 0xF7, 0xFF, 0xFF, 0xF7,
+    0x00, 0x87, 0x02, /* UNICODE索引 - 蜂 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x67, 0xFE, 0x00, 0x67, 0xFE, 0xFD, 0xEF, 0xC0,
+    0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xDE, 0xFD, 0x4F, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x87, 0xFE, 0xF7,
+    0xC7, 0xFC, 0xE6, 0xDF, 0xF1, 0xE6, 0xDF, 0x83, 0xC6, 0xDF, 0x81, 0x96, 0xDF, 0xCC, 0xB6, 0xDD,
+    0xEE, 0x00, 0x01, 0xEC, 0x00, 0x01, 0xE8, 0xB6, 0xDF, 0xE1, 0x96, 0xDF, 0xE7, 0xC6, 0xDF, 0xEF,
+    0xC6, 0x9F, 0xFF, 0xCF, 0x9F, 0xFF, 0xDF, 0xFF,
+    0x00, 0x8B, 0x66, /* UNICODE索引 - 警 */
+    0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0x7B, 0xFF, 0xEC, 0x7B, 0xFF, 0xE0, 0x1B, 0xFF, 0x82,
+    0x19, 0x41, 0x82, 0xB9, 0x41, 0xC2, 0x99, 0x41, 0xEA, 0x19, 0x5B, 0x82, 0x09, 0x5B, 0x83, 0x89,
+    0x5B, 0xE8, 0x09, 0x5B, 0xE8, 0x21, 0x5B, 0xE8, 0xE1, 0x5B, 0xE0, 0xE9, 0x5B, 0x80, 0xC9, 0x5B,
+    0x80, 0x19, 0x41, 0xF7, 0x39, 0x41, 0xF0, 0x19, 0x43, 0xF0, 0xCB, 0xFF, 0xF3, 0xC3, 0xFF, 0xF7,
+    0xC3, 0xFF, 0xF7, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x8B, 0xA4, /* UNICODE索引 - 认 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xE7,
+    0x80, 0x03, 0xE0, 0x80, 0x01, 0xF0, 0xDF, 0xC1, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x33, 0xFF, 0xFE,
+    0x67, 0xFF, 0xFE, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0, 0x3F, 0xC0, 0x00, 0xFF, 0xC0, 0x07, 0xFF,
+    0xEE, 0x00, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xE3, 0xFF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF,
+    0x00, 0x8B, 0xBE, /* UNICODE索引 - 设 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xDF, 0xBF, 0xFF, 0xC3,
+    0x80, 0x07, 0xE3, 0x80, 0x07, 0xF3, 0xAF, 0xC5, 0xFF, 0xCF, 0x9D, 0xFF, 0x9F, 0x39, 0xFF, 0x2F,
+    0x7B, 0xC0, 0x27, 0xF3, 0xC0, 0xE1, 0xF7, 0xC3, 0xE8, 0x67, 0xDF, 0xEE, 0x0F, 0xDF, 0xEF, 0x8F,
+    0xDF, 0xEF, 0x0F, 0xC0, 0x28, 0x27, 0xC0, 0x00, 0xE7, 0xEF, 0x81, 0xF3, 0xFF, 0xAF, 0xF3, 0xFF,
+    0xBF, 0xFB, 0xFF, 0xBF, 0xFB, 0xFF, 0xBF, 0xFF,
+    0x00, 0x8F, 0xCE, /* UNICODE索引 - 迎 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xEF, 0xFF, 0xBF, 0xE7, 0xFF, 0xBF, 0xC7, 0xE7, 0xBF, 0xDF, 0xE3,
+    0x80, 0x1F, 0xF3, 0x80, 0x1F, 0xFF, 0xBF, 0xCF, 0xFF, 0xFF, 0xE7, 0xF0, 0x00, 0x67, 0xF0, 0x00,
+    0x77, 0xF7, 0xFC, 0xF3, 0xE7, 0xFD, 0xF3, 0xEF, 0xF9, 0xF3, 0xCF, 0xFB, 0xF3, 0xC8, 0x00, 0x0B,
+    0xE8, 0x00, 0x0B, 0xFB, 0xFE, 0xFB, 0xFB, 0xFE, 0xF3, 0xFB, 0xFE, 0x73, 0xF8, 0x00, 0x73, 0xF8,
+    0x00, 0x73, 0xFB, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7,
+    0x00, 0x8F, 0xD4, /* UNICODE索引 - 返 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xDF, 0xF9, 0xFF, 0xDF, 0xF1, 0xEF, 0xDF, 0xE7, 0xE1,
+    0xC0, 0x0F, 0xF1, 0xC0, 0x0F, 0xFB, 0xDF, 0xC7, 0xFF, 0xFF, 0x13, 0xFF, 0xF0, 0x2B, 0xF0, 0x00,
+    0xEB, 0xF0, 0x03, 0xC9, 0xF7, 0x6F, 0xD9, 0xF7, 0x67, 0x99, 0xE7, 0x73, 0x39, 0xEF, 0x7A, 0x79,
+    0xEF, 0x78, 0xF9, 0xEF, 0x60, 0xF9, 0xCF, 0x00, 0x79, 0xCF, 0x0E, 0x39, 0xEF, 0x3F, 0x19, 0xFF,
+    0xFF, 0x99, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB,
+    0x00, 0x91, 0xCF, /* UNICODE索引 - 量 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xBF, 0xFB, 0xFF, 0xBF, 0xDB, 0xFF, 0xBF, 0xDB, 0xC0,
+    0x20, 0x1B, 0xC0, 0x20, 0x1B, 0xC0, 0x2B, 0x5B, 0xD6, 0xAB, 0x5B, 0xD6, 0xAB, 0x5B, 0xD6, 0xAB,
+    0x5B, 0xD6, 0xA0, 0x03, 0xD6, 0xA0, 0x03, 0xD6, 0xA0, 0x03, 0xD6, 0xAB, 0x5B, 0xD6, 0xAB, 0x5B,
+    0xD6, 0xAB, 0x5B, 0xC0, 0x20, 0x1B, 0xC0, 0x20, 0x1B, 0xFF, 0xA0, 0x1B, 0xFF, 0xBF, 0xDB, 0xFF,
+    0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0xBF, 0xFF,
+    0x00, 0x94, 0x9F, /* UNICODE索引 - 钟 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0x1B, 0xFF, 0xFC, 0x3B, 0xFF, 0xC0, 0x7B, 0xFF, 0x81,
+    0x00, 0x03, 0x8B, 0x00, 0x03, 0xFB, 0x7B, 0xC7, 0xFA, 0x7B, 0xCF, 0xFA, 0x7B, 0x9F, 0xFB, 0xFB,
+    0xBF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFD, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xBD, 0xFB, 0xFD,
+    0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0xFD, 0xFB, 0xFF, 0xFD, 0xFB, 0xFF, 0xFC, 0x01, 0xFF, 0xFC,
+    0x01, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x94, 0xC3, /* UNICODE索引 - 铃 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0xFF, 0xFF, 0x8B, 0xFF, 0xFE, 0x1B, 0xFF, 0xF0, 0x3B, 0xFF, 0xC0,
+    0x80, 0x03, 0xC1, 0x80, 0x03, 0xED, 0xBB, 0xC7, 0xFD, 0xBB, 0xCF, 0xFD, 0xB3, 0x9F, 0xFD, 0xE1,
+    0xBF, 0xFF, 0x89, 0xFF, 0xFF, 0x1B, 0xFF, 0xFC, 0x3B, 0xBF, 0xE0, 0xBB, 0x9F, 0xC1, 0x9B, 0xCF,
+    0xC3, 0xC3, 0xC7, 0xE0, 0xC3, 0x01, 0xFC, 0x78, 0x31, 0xFF, 0x18, 0xFB, 0xFF, 0x89, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x95, 0xED, /* UNICODE索引 - 闭 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xB8,
+    0x00, 0x03, 0x9F, 0xBF, 0x9F, 0xC7, 0xBF, 0x3F, 0xC7, 0xBE, 0x7F, 0xFF, 0xBC, 0xFF, 0xEF, 0xB9,
+    0xFF, 0xEF, 0xA3, 0xEF, 0xEF, 0x87, 0xE7, 0xE8, 0x00, 0x07, 0xE8, 0x00, 0x0F, 0xED, 0xBF, 0xFF,
+    0xEF, 0xBF, 0xFF, 0xEF, 0xBF, 0xFB, 0xEF, 0xBF, 0xFB, 0xEF, 0xBF, 0xF9, 0xC0, 0x00, 0x01, 0xC0,
+    0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x95, 0xF4, /* UNICODE索引 - 间 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0x9B,
+    0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE6, 0x00, 0x3F, 0xEE, 0x00, 0x3F, 0xEE, 0xF7,
+    0x7F, 0xEE, 0xF7, 0x7F, 0xEE, 0xF7, 0x7F, 0xEE, 0xF7, 0x7F, 0xEE, 0x00, 0x3F, 0xEE, 0x00, 0x3F,
+    0xEE, 0xFE, 0x37, 0xEF, 0xFF, 0xF3, 0xEF, 0xFF, 0xF9, 0xEF, 0xFF, 0xF1, 0xE0, 0x00, 0x01, 0xE0,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x96, 0x45, /* UNICODE索引 - 际 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xDF,
+    0x7E, 0xFF, 0xDC, 0x3E, 0x7F, 0xC0, 0x8C, 0x77, 0xC3, 0xC0, 0x47, 0xCF, 0x70, 0x8F, 0xEF, 0x7C,
+    0x3F, 0xEF, 0x70, 0x77, 0xEF, 0x71, 0xF7, 0xEF, 0x73, 0xF3, 0xEF, 0x77, 0xF9, 0xEF, 0x00, 0x01,
+    0xEF, 0x00, 0x03, 0xEF, 0x7F, 0xFF, 0xEF, 0x7B, 0xFF, 0xEF, 0x79, 0xFF, 0xEF, 0x7C, 0x3F, 0xEE,
+    0x7E, 0x0F, 0xFE, 0x7F, 0x0F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x96, 0x64, /* UNICODE索引 - 除 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xEF,
+    0x3F, 0x7F, 0xEC, 0x0F, 0x3F, 0xE0, 0xC0, 0x3F, 0xE3, 0xD0, 0x77, 0xE7, 0x98, 0xC7, 0xFF, 0x3B,
+    0x8F, 0xFC, 0x3A, 0x1F, 0xF8, 0xBA, 0x3B, 0xE1, 0xBB, 0x7B, 0x83, 0xBB, 0xF1, 0x8F, 0x80, 0x01,
+    0xC3, 0x80, 0x03, 0xF1, 0x3B, 0x7F, 0xF8, 0x3B, 0x3F, 0xFC, 0x3B, 0x9F, 0xFE, 0x3B, 0x87, 0xFF,
+    0x3B, 0xC7, 0xFF, 0x7F, 0xEF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x97, 0xF3, /* UNICODE索引 - 音 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF7, 0xDF, 0xFF, 0xF7,
+    0xDF, 0xFF, 0xF7, 0xD8, 0x01, 0xF3, 0xD8, 0x01, 0xF0, 0xD8, 0x03, 0xF4, 0x1B, 0x77, 0xB6, 0x1B,
+    0x77, 0x87, 0xDB, 0x77, 0xC7, 0xDB, 0x77, 0xC7, 0xDB, 0x77, 0xF7, 0x1B, 0x77, 0xF0, 0x1B, 0x77,
+    0xF0, 0xDB, 0x77, 0xF5, 0xD8, 0x01, 0xE7, 0xD8, 0x01, 0xE7, 0xDB, 0xFF, 0xF7, 0x9F, 0xFF, 0xFF,
+    0x9F, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x98, 0x75, /* UNICODE索引 - 页 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFD, 0xEF, 0xFF, 0xFD, 0xEF, 0xFF, 0xFD, 0xEE,
+    0x00, 0x39, 0xEE, 0x00, 0x3B, 0xEE, 0x00, 0x73, 0xEE, 0xFF, 0xE7, 0xEE, 0xFF, 0xC7, 0xE0, 0xFF,
+    0x0F, 0xE0, 0x80, 0x1F, 0xE2, 0x80, 0x3F, 0xEE, 0xDF, 0xBF, 0xEE, 0xFF, 0xBF, 0xEE, 0xFF, 0x9F,
+    0xEE, 0xFF, 0xCF, 0xEC, 0x00, 0x4F, 0xEC, 0x00, 0x67, 0xCE, 0xFF, 0xE3, 0xCF, 0xFF, 0xF3, 0xEF,
+    0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x9E, 0x23, /* UNICODE索引 - 鸣 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF7, 0xFB, 0xFF, 0xF7,
+    0xFB, 0xFF, 0xF7, 0xFB, 0xFF, 0xF0, 0x01, 0xBF, 0xF0, 0x01, 0xBF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFB,
+    0xBF, 0xF0, 0x01, 0xBF, 0xF0, 0x01, 0xBF, 0xE3, 0xFB, 0xBF, 0x80, 0xFB, 0xBF, 0x94, 0x5B, 0xB7,
+    0xF6, 0x43, 0xB3, 0xF7, 0xE3, 0x3B, 0xF4, 0x0B, 0x39, 0xF0, 0x0B, 0xB1, 0xF0, 0x78, 0x03, 0xFF,
+    0xF8, 0x07, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x9E, 0xD8, /* UNICODE索引 - 默 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x37, 0xB1, 0xE0, 0x37, 0x31, 0xEC, 0x77, 0x3F, 0xEC,
+    0x77, 0x63, 0xE0, 0x00, 0x63, 0xE0, 0x00, 0x53, 0xE9, 0x76, 0x47, 0xE0, 0x36, 0xE6, 0xE0, 0x36,
+    0xBC, 0xE0, 0x36, 0x89, 0xFF, 0x7F, 0xC3, 0xFF, 0x7F, 0xC7, 0xFF, 0x7E, 0x0F, 0x80, 0x00, 0x1F,
+    0x80, 0x00, 0xFF, 0xDF, 0x00, 0xFF, 0xEF, 0x40, 0x1F, 0xE3, 0x7F, 0x07, 0xF1, 0x7F, 0xC1, 0xF0,
+    0x7F, 0xF1, 0xFE, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF,
     0x00, 0xFF, 0x05, /* UNICODE索引 - ％（手动修改） */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFC, 0x0F, 0xF3, 0xF8, 0xC7, 0xE3, 0xF9,
     0xE7, 0xC3, 0xF9, 0xE7, 0x87, 0xF8, 0xC7, 0x0F, 0xFC, 0x0E, 0x1F, 0xFE, 0x1C, 0x3F, 0xFF, 0xF8,
     0x7F, 0xFF, 0xF0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x87, 0x0F, 0xFF, 0x0E, 0x07,
     0xFE, 0x1C, 0x63, 0xFC, 0x3C, 0xF3, 0xF8, 0x7C, 0xF3, 0xF0, 0xFC, 0x63, 0xF1, 0xFE, 0x07, 0xFF,
     0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x25, 0xB6, /* UNICODE索引 - ▶（手动修改） */
+    0x00, 0xFF, 0x1A, /* UNICODE索引 - ： */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xC7, 0xFF, 0xF1, 0xC7, 0xFF,
+    0xF1, 0xC7, 0xFF, 0xF1, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00,
-    0x07, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0xFF,
-    0xFF, 0x81, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x25, 0xC0, /* UNICODE索引 - ◀（手动修改） */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE7, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFC, 0x00,
-    0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07,
-    0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
 static const uint8_t EPD_FontAscii_12x24_B[] = {
@@ -1027,349 +1052,346 @@ static const uint8_t EPD_FontAscii_12x24_B[] = {
 };
 
 static const uint8_t EPD_FontUTF8_16x16_B[] = {
-    0, 16, 16, 96,    /* 起始字符，字体宽度，字体高度，字体个数 */
-    0x00, 0x51, 0x9C, /* UNICODE索引 - 农 */
-    0xFB, 0xF7, 0xE3, 0xE7, 0xE7, 0xCF, 0xEF, 0x9F, 0xEF, 0x00, 0xEC, 0x00, 0xE0, 0xF9, 0x00, 0xFB,
-    0x0C, 0x3F, 0xEF, 0x1F, 0xEF, 0x8F, 0xEF, 0x27, 0xEA, 0x73, 0xE2, 0xF9, 0xE7, 0xFD, 0xFF, 0xFD,
-    0x00, 0x53, 0x86, /* UNICODE索引 - 历 */
-    0xFF, 0xFE, 0xFF, 0xF8, 0x80, 0x01, 0x80, 0x06, 0xBD, 0xFC, 0xBD, 0xF9, 0xBD, 0xE3, 0xBD, 0x87,
-    0xA0, 0x1F, 0xA0, 0x7F, 0xBD, 0xFD, 0xBD, 0xFC, 0xBD, 0xFC, 0xBC, 0x01, 0xBC, 0x03, 0xBF, 0xFF,
-    0x00, 0x6D, 0xA6, /* UNICODE索引 - 润 */
-    0xF7, 0xDF, 0xF1, 0xDF, 0xB9, 0x81, 0x8E, 0x01, 0xCE, 0x7F, 0xC0, 0x00, 0x40, 0x00, 0x17, 0x77,
-    0x97, 0x77, 0xB0, 0x07, 0xB0, 0x07, 0xB7, 0x75, 0xB7, 0x74, 0x80, 0x00, 0x80, 0x01, 0xFF, 0xFF,
-    0x00, 0x67, 0x2A, /* UNICODE索引 - 未 */
-    0xFE, 0xFB, 0xFE, 0xFB, 0xEE, 0xF3, 0xEE, 0xE7, 0xEE, 0xCF, 0xEE, 0x9F, 0xEE, 0x3F, 0x00, 0x00,
-    0x00, 0x00, 0xEE, 0x3F, 0xEE, 0x9F, 0xEE, 0xCF, 0xEE, 0xE7, 0xEE, 0xF3, 0xFE, 0xFB, 0xFE, 0xFB,
-    0x00, 0x77, 0xE5, /* UNICODE索引 - 知 */
-    0xFB, 0x7E, 0xE3, 0x7C, 0x07, 0x71, 0x0F, 0x43, 0xE0, 0x0F, 0xE0, 0x0F, 0xEF, 0x41, 0xEF, 0x71,
-    0xFF, 0x7F, 0xC0, 0x03, 0xC0, 0x03, 0xDF, 0xF7, 0xDF, 0xF7, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
-    0x00, 0x6B, 0x63, /* UNICODE索引 - 正 */
-    0xFF, 0xFD, 0xBF, 0xFD, 0xBF, 0xFD, 0xBC, 0x01, 0xBC, 0x01, 0xBF, 0xFD, 0xBF, 0xFD, 0x80, 0x01,
-    0x80, 0x01, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBF, 0xFD, 0xFF, 0xFD,
-    0x00, 0x51, 0xAC, /* UNICODE索引 - 冬 */
-    0xFF, 0xBF, 0xFB, 0xBF, 0xF3, 0x3F, 0xE7, 0x7F, 0xC6, 0x7B, 0x12, 0xDB, 0x18, 0xDB, 0xDD, 0xD9,
-    0xDD, 0xCD, 0xD8, 0xEC, 0xD2, 0xE6, 0xC6, 0x77, 0xCF, 0x7F, 0xFF, 0x3F, 0xFF, 0xBF, 0xFF, 0xBF,
-    0x00, 0x67, 0x08, /* UNICODE索引 - 月 */
-    0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xF1, 0x80, 0x03, 0x80, 0x0F, 0xBB, 0xBF, 0xBB, 0xBF, 0xBB, 0xBF,
-    0xBB, 0xBF, 0xBB, 0xBF, 0xBB, 0xBD, 0xBB, 0xBC, 0x80, 0x00, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x52, 0x1D, /* UNICODE索引 - 初 */
-    0xEF, 0xBF, 0xEF, 0x3F, 0x6E, 0x7F, 0x28, 0x00, 0xA0, 0x00, 0xE6, 0x1E, 0xEE, 0x9C, 0xDF, 0xF9,
-    0xDF, 0xE3, 0xC0, 0x07, 0xC0, 0x1D, 0xDF, 0xFC, 0xDF, 0xFC, 0xC0, 0x01, 0xC0, 0x03, 0xFF, 0xFF,
-    0x00, 0x5E, 0xFF, /* UNICODE索引 - 廿 */
-    0xFB, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFD, 0xFB, 0xFD,
-    0xFB, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF,
+    EPD_FONT_SORTED, 16, 16, 95, /* 索引已排序，字体宽度，字体高度，字体个数 */
+    0x00, 0x30, 0x10, /* UNICODE索引 - 【 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x83, 0xC1, 0x8F, 0xF1, 0x9F, 0xF9, 0xBF, 0xFD, 0xFF, 0xFF,
+    0x00, 0x30, 0x11, /* UNICODE索引 - 】 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFD, 0x9F, 0xF9, 0x8F, 0xF1, 0x83, 0xC1, 0x80, 0x01, 0x80, 0x01,
+    0x80, 0x01, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
     0x00, 0x4E, 0x00, /* UNICODE索引 - 一（手动加粗） */
     0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
     0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFF, 0xFF,
+    0x00, 0x4E, 0x01, /* UNICODE索引 - 丁 */
+    0xFF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFD, 0xBF, 0xFC, 0x80, 0x00,
+    0x80, 0x01, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x4E, 0x03, /* UNICODE索引 - 七 */
+    0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0x00, 0x03, 0x00, 0x01,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xF9, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFB, 0xE1, 0xFB, 0xE1, 0xFF, 0xFF,
+    0x00, 0x4E, 0x09, /* UNICODE索引 - 三（手动加粗） */
+    0xFF, 0xF9, 0xCF, 0xF9, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79,
+    0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFF,
+    0x00, 0x4E, 0x0A, /* UNICODE索引 - 上 */
+    0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0x00, 0x01, 0x00, 0x01,
+    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD,
+    0x00, 0x4E, 0x0B, /* UNICODE索引 - 下 */
+    0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0x80, 0x00, 0x80, 0x00,
+    0xBF, 0xFF, 0xBD, 0xFF, 0xBC, 0xFF, 0xBE, 0x7F, 0xBF, 0x1F, 0xBF, 0x9F, 0xBF, 0xFF, 0xBF, 0xFF,
+    0x00, 0x4E, 0x11, /* UNICODE索引 - 丑 */
+    0xFF, 0xFD, 0xFF, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0x01, 0x80, 0x01, 0x80, 0xFD,
+    0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0x80, 0x01, 0x80, 0x01, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD,
+    0x00, 0x4E, 0x19, /* UNICODE索引 - 丙 */
+    0xBF, 0xFF, 0xB8, 0x00, 0xB8, 0x00, 0xBB, 0xFF, 0xBB, 0xEF, 0xBB, 0xCF, 0xBB, 0x1F, 0x80, 0x3F,
+    0x80, 0x7F, 0xBB, 0x3F, 0xBB, 0x8F, 0xBB, 0xCD, 0xBB, 0xFC, 0xB8, 0x00, 0xB8, 0x01, 0xBF, 0xFF,
+    0x00, 0x4E, 0x59, /* UNICODE索引 - 乙 */
+    0xFF, 0xFF, 0xBF, 0xFF, 0xBF, 0xE3, 0xBF, 0x81, 0xBF, 0x1D, 0xBE, 0x7D, 0xBC, 0xFD, 0xB9, 0xFD,
+    0xB3, 0xFD, 0xA7, 0xFD, 0x8F, 0xFD, 0x9F, 0xFD, 0xBF, 0xFD, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xFF,
+    0x00, 0x4E, 0x5D, /* UNICODE索引 - 九 */
+    0xFF, 0xFE, 0xF7, 0xFC, 0xF7, 0xF9, 0xF7, 0xE3, 0xF7, 0x07, 0x00, 0x1F, 0x00, 0xFF, 0xF7, 0xFF,
+    0xF7, 0xFF, 0xF7, 0xFF, 0xF0, 0x03, 0xF0, 0x01, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xE1, 0xFF, 0xE1,
     0x00, 0x4E, 0x8C, /* UNICODE索引 - 二（手动加粗） */
     0xFF, 0xF3, 0xFF, 0xF3, 0xE7, 0xF3, 0xE7, 0xF3, 0xE7, 0xF3, 0xE7, 0xF3, 0xE7, 0xF3, 0xE7, 0xF3,
     0xE7, 0xF3, 0xE7, 0xF3, 0xE7, 0xF3, 0xE7, 0xF3, 0xE7, 0xF3, 0xFF, 0xF3, 0xFF, 0xF3, 0xFF, 0xFF,
-    0x00, 0x4E, 0x09, /* UNICODE索引 - 三（手动加粗） */
-    0xFF, 0xF9, 0xCF, 0xF9, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79,
-    0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCE, 0x79, 0xCF, 0xF9, 0xFF, 0xF9, 0xFF, 0xFF,
-    0x00, 0x56, 0xDB, /* UNICODE索引 - 四 */
-    0xFF, 0xFF, 0xC0, 0x01, 0xC0, 0x01, 0xDF, 0xCB, 0xDF, 0x1B, 0xC0, 0x3B, 0xC0, 0xFB, 0xDF, 0xFB,
-    0xDF, 0xFB, 0xC0, 0x7B, 0xC0, 0x3B, 0xDF, 0xBB, 0xDF, 0xBB, 0xC0, 0x01, 0xC0, 0x01, 0xFF, 0xFF,
     0x00, 0x4E, 0x94, /* UNICODE索引 - 五 */
     0xFF, 0xFD, 0xBF, 0xFD, 0xBD, 0xFD, 0xBD, 0xFD, 0xBD, 0xE1, 0xBC, 0x01, 0x80, 0x1D, 0x81, 0xFD,
     0xBD, 0xFD, 0xBD, 0xFD, 0xBD, 0xFD, 0xBC, 0x01, 0xBC, 0x01, 0xBF, 0xFD, 0xBF, 0xFD, 0xFF, 0xFD,
-    0x00, 0x51, 0x6D, /* UNICODE索引 - 六 */
-    0xFB, 0xFF, 0xFB, 0xFD, 0xFB, 0xF9, 0xFB, 0xF3, 0xFB, 0xC7, 0xFB, 0x0F, 0x7B, 0x3F, 0x3B, 0xFF,
-    0x8B, 0xFF, 0xCB, 0x7F, 0xFB, 0x3F, 0xFB, 0x9F, 0xFB, 0xC7, 0xFB, 0xE1, 0xFB, 0xF9, 0xFB, 0xFF,
-    0x00, 0x4E, 0x03, /* UNICODE索引 - 七 */
-    0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0x00, 0x03, 0x00, 0x01,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xF9, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0xFB, 0xE1, 0xFB, 0xE1, 0xFF, 0xFF,
+    0x00, 0x4E, 0xA5, /* UNICODE索引 - 亥 */
+    0xFF, 0xFF, 0xEF, 0xF6, 0xEF, 0x76, 0xEE, 0x66, 0xEC, 0x6C, 0xE9, 0x4D, 0x63, 0x59, 0x27, 0x1B,
+    0xAF, 0x33, 0xEE, 0x67, 0xEC, 0xC7, 0xED, 0x93, 0xEF, 0x39, 0xEF, 0x7C, 0xEF, 0xFE, 0xFF, 0xFF,
+    0x00, 0x4E, 0xE5, /* UNICODE索引 - 以 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xE7, 0xBF, 0xCE, 0x9F, 0xDC, 0xC7, 0xF9,
+    0xE7, 0xF3, 0xFF, 0xC7, 0xFE, 0x0F, 0x00, 0x2F, 0x01, 0xE7, 0xFF, 0xF3, 0xFF, 0xF8, 0xFF, 0xFC,
+    0x00, 0x4F, 0x4D, /* UNICODE索引 - 位 */
+    0xFF, 0x7F, 0xFE, 0x7F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x17, 0xFD, 0xF6, 0x7D, 0xF6, 0x05,
+    0x77, 0x85, 0x17, 0xFD, 0x97, 0xF1, 0xF7, 0x81, 0xF4, 0x0D, 0xF4, 0x7D, 0xF7, 0xFD, 0xFF, 0xFD,
+    0x00, 0x4F, 0x4F, /* UNICODE索引 - 住 */
+    0xFF, 0x7F, 0xFE, 0x7F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D,
+    0x6F, 0x7D, 0x20, 0x01, 0xA0, 0x01, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xFF, 0xFD,
+    0x00, 0x4F, 0xDD, /* UNICODE索引 - 保 */
+    0xFF, 0x7F, 0xFE, 0x7F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x73, 0x83, 0x67, 0x83, 0x4F,
+    0xBB, 0x1F, 0xB8, 0x00, 0xB8, 0x00, 0xBB, 0x1F, 0x83, 0x4F, 0x83, 0x67, 0xFF, 0x73, 0xFF, 0xFB,
+    0x00, 0x51, 0x54, /* UNICODE索引 - 兔 */
+    0xFD, 0xFE, 0xF9, 0xFE, 0xF0, 0x1C, 0xE0, 0x19, 0x0B, 0xB3, 0x1B, 0xA7, 0xDB, 0x8F, 0xD8, 0x1F,
+    0xD8, 0x01, 0xD3, 0x80, 0xC3, 0xAE, 0xCB, 0xA2, 0xF8, 0x12, 0xF8, 0x1E, 0xFF, 0xF8, 0xFF, 0xF8,
+    0x00, 0x51, 0x65, /* UNICODE索引 - 入 */
+    0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xF9, 0xFF, 0xF3, 0xFF, 0xC7, 0x7F, 0x0F, 0x38, 0x3F, 0x80, 0xFF,
+    0xC0, 0xFF, 0xF8, 0x3F, 0xFF, 0x0F, 0xFF, 0xC3, 0xFF, 0xF1, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xFE,
+    0x00, 0x51, 0x68, /* UNICODE索引 - 全 */
+    0xFE, 0xFF, 0xFE, 0xFD, 0xFC, 0xFD, 0xF9, 0xDD, 0xF1, 0xDD, 0xE5, 0xDD, 0xCD, 0xDD, 0x1C, 0x01,
+    0x1C, 0x01, 0xCD, 0xDD, 0xE5, 0xDD, 0xF1, 0xDD, 0xF9, 0xDD, 0xFC, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF,
     0x00, 0x51, 0x6B, /* UNICODE索引 - 八 */
     0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF8, 0xFF, 0xE1, 0xFF, 0x07, 0xC0, 0x1F, 0xC0, 0xFF, 0xFF, 0xFF,
     0xFF, 0xFF, 0x81, 0xFF, 0x80, 0x3F, 0xFE, 0x0F, 0xFF, 0xC3, 0xFF, 0xF1, 0xFF, 0xFC, 0xFF, 0xFE,
-    0x00, 0x4E, 0x5D, /* UNICODE索引 - 九 */
-    0xFF, 0xFE, 0xF7, 0xFC, 0xF7, 0xF9, 0xF7, 0xE3, 0xF7, 0x07, 0x00, 0x1F, 0x00, 0xFF, 0xF7, 0xFF,
-    0xF7, 0xFF, 0xF7, 0xFF, 0xF0, 0x03, 0xF0, 0x01, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xE1, 0xFF, 0xE1,
+    0x00, 0x51, 0x6D, /* UNICODE索引 - 六 */
+    0xFB, 0xFF, 0xFB, 0xFD, 0xFB, 0xF9, 0xFB, 0xF3, 0xFB, 0xC7, 0xFB, 0x0F, 0x7B, 0x3F, 0x3B, 0xFF,
+    0x8B, 0xFF, 0xCB, 0x7F, 0xFB, 0x3F, 0xFB, 0x9F, 0xFB, 0xC7, 0xFB, 0xE1, 0xFB, 0xF9, 0xFB, 0xFF,
+    0x00, 0x51, 0x9C, /* UNICODE索引 - 农 */
+    0xFB, 0xF7, 0xE3, 0xE7, 0xE7, 0xCF, 0xEF, 0x9F, 0xEF, 0x00, 0xEC, 0x00, 0xE0, 0xF9, 0x00, 0xFB,
+    0x0C, 0x3F, 0xEF, 0x1F, 0xEF, 0x8F, 0xEF, 0x27, 0xEA, 0x73, 0xE2, 0xF9, 0xE7, 0xFD, 0xFF, 0xFD,
+    0x00, 0x51, 0xAC, /* UNICODE索引 - 冬 */
+    0xFF, 0xBF, 0xFB, 0xBF, 0xF3, 0x3F, 0xE7, 0x7F, 0xC6, 0x7B, 0x12, 0xDB, 0x18, 0xDB, 0xDD, 0xD9,
+    0xDD, 0xCD, 0xD8, 0xEC, 0xD2, 0xE6, 0xC6, 0x77, 0xCF, 0x7F, 0xFF, 0x3F, 0xFF, 0xBF, 0xFF, 0xBF,
+    0x00, 0x51, 0xCF, /* UNICODE索引 - 减 */
+    0xFF, 0xBF, 0xBF, 0xBF, 0x8F, 0x01, 0xCC, 0x00, 0xFC, 0xFC, 0xE0, 0x01, 0xE0, 0x03, 0xED, 0x87,
+    0xED, 0x86, 0xED, 0x84, 0xED, 0x81, 0x00, 0x13, 0x00, 0x03, 0x6F, 0x81, 0x2E, 0x10, 0xAE, 0x70,
+    0x00, 0x52, 0x1D, /* UNICODE索引 - 初 */
+    0xEF, 0xBF, 0xEF, 0x3F, 0x6E, 0x7F, 0x28, 0x00, 0xA0, 0x00, 0xE6, 0x1E, 0xEE, 0x9C, 0xDF, 0xF9,
+    0xDF, 0xE3, 0xC0, 0x07, 0xC0, 0x1D, 0xDF, 0xFC, 0xDF, 0xFC, 0xC0, 0x01, 0xC0, 0x03, 0xFF, 0xFF,
+    0x00, 0x52, 0x36, /* UNICODE索引 - 制 */
+    0xFD, 0xFF, 0xF5, 0xFF, 0x85, 0x83, 0x8D, 0x83, 0xED, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xED, 0xB3,
+    0xED, 0x83, 0xED, 0x87, 0xE0, 0x0F, 0xE0, 0x0D, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0x00, 0x52, 0xA0, /* UNICODE索引 - 加 */
+    0xF7, 0xFE, 0xF7, 0xFC, 0xF7, 0xF1, 0x00, 0x03, 0x00, 0x0D, 0xF7, 0xFC, 0xF0, 0x00, 0xF0, 0x01,
+    0xFF, 0xFF, 0xE0, 0x01, 0xE0, 0x01, 0xEF, 0xFB, 0xEF, 0xFB, 0xE0, 0x01, 0xE0, 0x01, 0xFF, 0xFF,
+    0x00, 0x52, 0xA8, /* UNICODE索引 - 动 */
+    0xFD, 0xF7, 0xDD, 0xC3, 0xDC, 0x03, 0xDC, 0x37, 0xDD, 0xD7, 0xDD, 0xC2, 0xDD, 0xE0, 0xF5, 0xF1,
+    0xF7, 0x83, 0x00, 0x0F, 0x00, 0x7D, 0xF7, 0xFC, 0xF7, 0xFC, 0xF0, 0x01, 0xF0, 0x03, 0xFF, 0xFF,
     0x00, 0x53, 0x41, /* UNICODE索引 - 十（手动加粗） */
     0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0x00, 0x00,
     0x00, 0x00, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-    0x00, 0x9F, 0x20, /* UNICODE索引 - 鼠 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x81, 0x00, 0xAD, 0x6C, 0x2D, 0x25, 0x6D, 0xB7, 0xFD, 0x00,
-    0xFD, 0x00, 0xAD, 0x6C, 0xAD, 0x25, 0xAD, 0xB7, 0x81, 0x03, 0x81, 0x01, 0xFF, 0xF0, 0xFF, 0xF0,
-    0x00, 0x72, 0x5B, /* UNICODE索引 - 牛 */
-    0xFF, 0xBF, 0xFD, 0xBF, 0xF9, 0xBF, 0x83, 0xBF, 0x87, 0xBF, 0xF7, 0xBF, 0xF7, 0xBF, 0x00, 0x00,
-    0x00, 0x00, 0xF7, 0xBF, 0xF7, 0xBF, 0xF7, 0xBF, 0xF7, 0xBF, 0xF7, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF,
-    0x00, 0x86, 0x4E, /* UNICODE索引 - 虎 */
-    0xFF, 0xFE, 0xFF, 0xF8, 0xE0, 0x01, 0xE0, 0x06, 0xED, 0xFC, 0xED, 0xF9, 0xED, 0xC3, 0x00, 0xC7,
-    0x00, 0x5F, 0xA9, 0x5F, 0xAB, 0x41, 0xAB, 0x40, 0xAC, 0x7E, 0xA4, 0x78, 0xE7, 0xF8, 0xFF, 0xFF,
-    0x00, 0x51, 0x54, /* UNICODE索引 - 兔 */
-    0xFD, 0xFE, 0xF9, 0xFE, 0xF0, 0x1C, 0xE0, 0x19, 0x0B, 0xB3, 0x1B, 0xA7, 0xDB, 0x8F, 0xD8, 0x1F,
-    0xD8, 0x01, 0xD3, 0x80, 0xC3, 0xAE, 0xCB, 0xA2, 0xF8, 0x12, 0xF8, 0x1E, 0xFF, 0xF8, 0xFF, 0xF8,
-    0x00, 0x9F, 0x99, /* UNICODE索引 - 龙 */
-    0xF7, 0xFE, 0xF7, 0xFC, 0xF7, 0xF9, 0xF7, 0xE3, 0xF7, 0x87, 0x00, 0x1D, 0x00, 0x79, 0xF7, 0xF3,
-    0xF0, 0x03, 0xF0, 0x01, 0x77, 0x9D, 0x17, 0x3D, 0x94, 0x7D, 0xF4, 0xFD, 0xF7, 0xE1, 0xF7, 0xE1,
-    0x00, 0x86, 0xC7, /* UNICODE索引 - 蛇 */
-    0xFF, 0xFB, 0xE0, 0x39, 0xE0, 0x39, 0x00, 0x03, 0x00, 0x07, 0xE0, 0x67, 0xE0, 0x63, 0xE3, 0xF3,
-    0xE4, 0x03, 0xEC, 0x01, 0x6F, 0x9D, 0x0F, 0x3D, 0x8E, 0x7D, 0xEA, 0xFD, 0xE3, 0xE1, 0xE7, 0xE1,
-    0x00, 0x9A, 0x6C, /* UNICODE索引 - 马 */
-    0xFF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xB0, 0xEF, 0xB0, 0xEF, 0xBE, 0xEF, 0xBE, 0xEF, 0xBE, 0xEF,
-    0xBE, 0xEF, 0xBE, 0xEF, 0x80, 0xED, 0x80, 0xEC, 0xFE, 0xFC, 0xFE, 0x01, 0xFE, 0x03, 0xFF, 0xFF,
-    0x00, 0x7F, 0x8A, /* UNICODE索引 - 羊 */
-    0xFF, 0xEF, 0xEF, 0xEF, 0xEE, 0xEF, 0xEE, 0xEF, 0x6E, 0xEF, 0x0E, 0xEF, 0x8E, 0xEF, 0xE0, 0x00,
-    0xE0, 0x00, 0xCE, 0xEF, 0x0E, 0xEF, 0x2E, 0xEF, 0xEE, 0xEF, 0xEE, 0xEF, 0xEF, 0xEF, 0xFF, 0xEF,
-    0x00, 0x73, 0x34, /* UNICODE索引 - 猴 */
-    0xBB, 0xDD, 0x93, 0x9C, 0xC7, 0x3C, 0xC0, 0x01, 0x90, 0x03, 0xB9, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-    0x17, 0x5E, 0xB0, 0x5C, 0xB0, 0xD1, 0xB6, 0x03, 0x86, 0x03, 0x86, 0xD1, 0xF6, 0xDC, 0xF7, 0xDE,
-    0x00, 0x9E, 0x21, /* UNICODE索引 - 鸡 */
-    0xEF, 0xFB, 0xED, 0xF3, 0xEC, 0xC7, 0xEE, 0x0F, 0xEC, 0x1F, 0xE0, 0xC7, 0xE3, 0xE7, 0xFF, 0xF7,
-    0xC0, 0x37, 0x80, 0x37, 0x17, 0xB7, 0x55, 0xB5, 0xDC, 0xB4, 0xC0, 0xB4, 0xC1, 0x81, 0xFF, 0x83,
-    0x00, 0x72, 0xD7, /* UNICODE索引 - 狗 */
-    0xFD, 0xEF, 0xB9, 0xCD, 0x93, 0x9C, 0xC7, 0x3C, 0xC0, 0x01, 0x90, 0x03, 0xB3, 0xFF, 0xC4, 0x0F,
-    0x0C, 0x0F, 0x2D, 0xDF, 0xEC, 0x0D, 0xEC, 0x0C, 0xEF, 0xFC, 0xE0, 0x01, 0xE0, 0x03, 0xFF, 0xFF,
-    0x00, 0x73, 0x2A, /* UNICODE索引 - 猪 */
-    0xBB, 0xDD, 0x93, 0x9C, 0xC7, 0x3C, 0xC0, 0x01, 0x90, 0x03, 0xBB, 0xDF, 0xDB, 0x9F, 0xDB, 0x00,
-    0xDA, 0x00, 0x00, 0x6D, 0x01, 0x6D, 0xD3, 0x6D, 0xC3, 0x00, 0x8B, 0x00, 0x9B, 0xFF, 0xFB, 0xFF,
-    0x00, 0x75, 0x32, /* UNICODE索引 - 甲 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0x80, 0x1F, 0xBB, 0xBF, 0xBB, 0xBF, 0xBB, 0xBF, 0x80, 0x00,
-    0x80, 0x00, 0xBB, 0xBF, 0xBB, 0xBF, 0xBB, 0xBF, 0x80, 0x1F, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4E, 0x59, /* UNICODE索引 - 乙 */
-    0xFF, 0xFF, 0xBF, 0xFF, 0xBF, 0xE3, 0xBF, 0x81, 0xBF, 0x1D, 0xBE, 0x7D, 0xBC, 0xFD, 0xB9, 0xFD,
-    0xB3, 0xFD, 0xA7, 0xFD, 0x8F, 0xFD, 0x9F, 0xFD, 0xBF, 0xFD, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xFF,
-    0x00, 0x4E, 0x19, /* UNICODE索引 - 丙 */
-    0xBF, 0xFF, 0xB8, 0x00, 0xB8, 0x00, 0xBB, 0xFF, 0xBB, 0xEF, 0xBB, 0xCF, 0xBB, 0x1F, 0x80, 0x3F,
-    0x80, 0x7F, 0xBB, 0x3F, 0xBB, 0x8F, 0xBB, 0xCD, 0xBB, 0xFC, 0xB8, 0x00, 0xB8, 0x01, 0xBF, 0xFF,
-    0x00, 0x4E, 0x01, /* UNICODE索引 - 丁 */
-    0xFF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFD, 0xBF, 0xFC, 0x80, 0x00,
-    0x80, 0x01, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x62, 0x0A, /* UNICODE索引 - 戊 */
-    0xFF, 0xFE, 0xFF, 0xF8, 0xE0, 0x01, 0xE0, 0x07, 0xEF, 0xFE, 0xEF, 0xFE, 0xEF, 0xFC, 0xEF, 0xFD,
-    0x01, 0xF9, 0x00, 0x33, 0xEE, 0x07, 0x6F, 0xC7, 0x2F, 0x13, 0xAC, 0x39, 0xEC, 0xE0, 0xEF, 0xE0,
-    0x00, 0x5D, 0xF2, /* UNICODE索引 - 已 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x03, 0xB8, 0x01, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD,
-    0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0x80, 0xFD, 0x80, 0xFD, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xFF,
-    0x00, 0x5E, 0x9A, /* UNICODE索引 - 庚 */
-    0xFF, 0xFD, 0xFF, 0xF1, 0xC0, 0x02, 0xC0, 0x0E, 0xDB, 0x6C, 0xDB, 0x6D, 0xDB, 0x69, 0x5B, 0x63,
-    0x10, 0x07, 0x90, 0x07, 0xDB, 0x63, 0xDB, 0x69, 0xD8, 0x0D, 0xD8, 0x0C, 0xDF, 0x7E, 0xDF, 0x7E,
-    0x00, 0x8F, 0x9B, /* UNICODE索引 - 辛 */
-    0xFD, 0xFF, 0xFD, 0xDF, 0xDD, 0xDF, 0xDD, 0xDF, 0xD5, 0xDF, 0xD1, 0xDF, 0x59, 0xDF, 0x1C, 0x00,
-    0x9C, 0x00, 0xD9, 0xDF, 0xD1, 0xDF, 0xD5, 0xDF, 0xDD, 0xDF, 0xDD, 0xDF, 0xFD, 0xDF, 0xFD, 0xFF,
+    0x00, 0x53, 0x48, /* UNICODE索引 - 午 */
+    0xFF, 0xBF, 0xFD, 0xBF, 0xF9, 0xBF, 0xE3, 0xBF, 0x07, 0xBF, 0x0F, 0xBF, 0xEF, 0xBF, 0xE0, 0x00,
+    0xE0, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF,
+    0x00, 0x53, 0x6F, /* UNICODE索引 - 卯 */
+    0xFF, 0xFF, 0x80, 0x1F, 0x80, 0x1E, 0xBF, 0xDC, 0x3F, 0x91, 0x40, 0x03, 0x40, 0x0F, 0xFF, 0xFF,
+    0x80, 0x00, 0x80, 0x00, 0xBF, 0xDF, 0xBF, 0xCF, 0xBF, 0xCF, 0x80, 0x1F, 0x80, 0x3F, 0xFF, 0xFF,
+    0x00, 0x53, 0x86, /* UNICODE索引 - 历 */
+    0xFF, 0xFE, 0xFF, 0xF8, 0x80, 0x01, 0x80, 0x06, 0xBD, 0xFC, 0xBD, 0xF9, 0xBD, 0xE3, 0xBD, 0x87,
+    0xA0, 0x1F, 0xA0, 0x7F, 0xBD, 0xFD, 0xBD, 0xFC, 0xBD, 0xFC, 0xBC, 0x01, 0xBC, 0x03, 0xBF, 0xFF,
+    0x00, 0x53, 0xD6, /* UNICODE索引 - 取 */
+    0xBF, 0xEF, 0xBF, 0xE7, 0x80, 0x07, 0x80, 0x0F, 0xB6, 0xEF, 0xB6, 0xCF, 0x80, 0x00, 0x80, 0x00,
+    0x9F, 0xDE, 0x80, 0xDC, 0xC0, 0x19, 0xDF, 0x03, 0xDF, 0x03, 0xC0, 0x19, 0xC0, 0xFC, 0xFF, 0xFE,
+    0x00, 0x53, 0xEF, /* UNICODE索引 - 可 */
+    0xFF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xB0, 0x0F, 0xB0, 0x0F, 0xB7, 0xDF, 0xB7, 0xDF, 0xB0, 0x0F,
+    0xB0, 0x0F, 0xBF, 0xFD, 0xBF, 0xFC, 0x80, 0x00, 0x80, 0x01, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF,
+    0x00, 0x54, 0x0C, /* UNICODE索引 - 同 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x80, 0x00, 0xB7, 0xFF, 0xB6, 0x07, 0xB6, 0x07, 0xB6, 0xEF,
+    0xB6, 0xEF, 0xB6, 0xEF, 0xB6, 0x07, 0xB6, 0x05, 0xB7, 0xFC, 0x80, 0x00, 0x80, 0x01, 0xFF, 0xFF,
+    0x00, 0x54, 0x8C, /* UNICODE索引 - 和 */
+    0xFB, 0xF7, 0xDB, 0xE7, 0xDB, 0x8F, 0xDA, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3B, 0x1F, 0xBB, 0x9F,
+    0xFB, 0xFF, 0xE0, 0x03, 0xE0, 0x03, 0xEF, 0xF7, 0xEF, 0xF7, 0xE0, 0x03, 0xE0, 0x03, 0xFF, 0xFF,
+    0x00, 0x56, 0xDB, /* UNICODE索引 - 四 */
+    0xFF, 0xFF, 0xC0, 0x01, 0xC0, 0x01, 0xDF, 0xCB, 0xDF, 0x1B, 0xC0, 0x3B, 0xC0, 0xFB, 0xDF, 0xFB,
+    0xDF, 0xFB, 0xC0, 0x7B, 0xC0, 0x3B, 0xDF, 0xBB, 0xDF, 0xBB, 0xC0, 0x01, 0xC0, 0x01, 0xFF, 0xFF,
     0x00, 0x58, 0xEC, /* UNICODE索引 - 壬 */
     0xFE, 0xFF, 0xFE, 0xFF, 0xDE, 0xFD, 0xDE, 0xFD, 0xDE, 0xFD, 0xDE, 0xFD, 0xDE, 0xFD, 0xC0, 0x01,
     0x80, 0x01, 0xBE, 0xFD, 0xBE, 0xFD, 0x3E, 0xFD, 0x3E, 0xFD, 0xBE, 0xFD, 0xFE, 0xFF, 0xFE, 0xFF,
-    0x00, 0x76, 0x78, /* UNICODE索引 - 癸 */
-    0xFE, 0xFF, 0xAE, 0xDE, 0xA4, 0xDE, 0xB1, 0xDC, 0xB2, 0xDD, 0xA6, 0xD9, 0x8E, 0xD3, 0x9E, 0x07,
-    0x3E, 0x07, 0x0E, 0xD7, 0x86, 0xD3, 0x32, 0xD9, 0x61, 0xDC, 0xCC, 0xDE, 0xDE, 0xDF, 0xFE, 0xFF,
+    0x00, 0x59, 0x0D, /* UNICODE索引 - 复 */
+    0xFB, 0xFE, 0xF3, 0xF6, 0xE7, 0xF6, 0x00, 0x64, 0x10, 0x4D, 0xD5, 0x05, 0xD5, 0x11, 0xD5, 0x5B,
+    0xD5, 0x5B, 0xD5, 0x51, 0xD5, 0x45, 0xD0, 0x4D, 0xD0, 0x5C, 0xDF, 0xFE, 0xDF, 0xFE, 0xFF, 0xFE,
     0x00, 0x5B, 0x50, /* UNICODE索引 - 子 */
     0xFE, 0xFF, 0xBE, 0xFF, 0xBE, 0xFF, 0xBE, 0xFF, 0xBE, 0xFF, 0xBE, 0xFD, 0xBE, 0xFC, 0xB8, 0x00,
     0xB8, 0x01, 0xB2, 0xFF, 0xA6, 0xFF, 0x8E, 0xFF, 0x9E, 0xFF, 0xBE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
-    0x00, 0x4E, 0x11, /* UNICODE索引 - 丑 */
-    0xFF, 0xFD, 0xFF, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0x01, 0x80, 0x01, 0x80, 0xFD,
-    0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0x80, 0x01, 0x80, 0x01, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD,
+    0x00, 0x5B, 0x58, /* UNICODE索引 - 存 */
+    0xDF, 0xBF, 0xDF, 0x3F, 0xDE, 0x7F, 0xD8, 0x00, 0xC0, 0x00, 0x07, 0xBF, 0x1B, 0xBF, 0xDB, 0xBD,
+    0xDB, 0xBC, 0xDB, 0x00, 0xDA, 0x01, 0xD8, 0xBF, 0xD9, 0xBF, 0xDB, 0xBF, 0xDF, 0xBF, 0xDF, 0xBF,
     0x00, 0x5B, 0xC5, /* UNICODE索引 - 寅 */
     0xF7, 0xFF, 0xC7, 0xFF, 0xCF, 0xFF, 0xD4, 0x06, 0xD4, 0x04, 0xD5, 0xB1, 0x55, 0xB3, 0x10, 0x07,
     0x90, 0x07, 0xD5, 0xB3, 0xD5, 0xB1, 0xD4, 0x04, 0xD4, 0x06, 0xD7, 0xFF, 0xC7, 0xFF, 0xCF, 0xFF,
-    0x00, 0x53, 0x6F, /* UNICODE索引 - 卯 */
-    0xFF, 0xFF, 0x80, 0x1F, 0x80, 0x1E, 0xBF, 0xDC, 0x3F, 0x91, 0x40, 0x03, 0x40, 0x0F, 0xFF, 0xFF,
-    0x80, 0x00, 0x80, 0x00, 0xBF, 0xDF, 0xBF, 0xCF, 0xBF, 0xCF, 0x80, 0x1F, 0x80, 0x3F, 0xFF, 0xFF,
-    0x00, 0x8F, 0xB0, /* UNICODE索引 - 辰 */
-    0xFF, 0xFD, 0xFF, 0xF1, 0x80, 0x03, 0x80, 0x0F, 0xB6, 0xFF, 0xB6, 0x00, 0xB6, 0x00, 0xB6, 0xF9,
-    0xB6, 0x3B, 0xB6, 0x1F, 0xB6, 0xCF, 0xB6, 0xC7, 0xB6, 0x93, 0xB6, 0xB9, 0xBE, 0xFD, 0xFF, 0xFD,
+    0x00, 0x5D, 0xF2, /* UNICODE索引 - 已 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x03, 0xB8, 0x01, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD,
+    0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0x80, 0xFD, 0x80, 0xFD, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xFF,
     0x00, 0x5D, 0xF3, /* UNICODE索引 - 巳 */
     0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0x80, 0x01, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD,
     0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0x80, 0xFD, 0x80, 0xFD, 0xFF, 0xE1, 0xFF, 0xE1, 0xFF, 0xFF,
-    0x00, 0x53, 0x48, /* UNICODE索引 - 午 */
-    0xFF, 0xBF, 0xFD, 0xBF, 0xF9, 0xBF, 0xE3, 0xBF, 0x07, 0xBF, 0x0F, 0xBF, 0xEF, 0xBF, 0xE0, 0x00,
-    0xE0, 0x00, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF,
+    0x00, 0x5E, 0x74, /* UNICODE索引 - 年 */
+    0xFF, 0xDF, 0xFB, 0xDF, 0xE3, 0xDF, 0x04, 0x1F, 0x1C, 0x1F, 0xDD, 0xDF, 0xDD, 0xDF, 0xDD, 0xDF,
+    0xC0, 0x00, 0xC0, 0x00, 0xDD, 0xDF, 0xDD, 0xDF, 0xDD, 0xDF, 0xDD, 0xDF, 0xDF, 0xDF, 0xFF, 0xDF,
+    0x00, 0x5E, 0x76, /* UNICODE索引 - 并 */
+    0xFF, 0xBF, 0xF7, 0xBE, 0xF7, 0xBC, 0x77, 0xB1, 0x10, 0x03, 0x90, 0x0F, 0xF7, 0xBF, 0xF7, 0xBF,
+    0xF7, 0xBF, 0xF7, 0xBF, 0xD0, 0x00, 0x10, 0x00, 0x37, 0xBF, 0xF7, 0xBF, 0xF7, 0xBF, 0xFF, 0xBF,
+    0x00, 0x5E, 0x9A, /* UNICODE索引 - 庚 */
+    0xFF, 0xFD, 0xFF, 0xF1, 0xC0, 0x02, 0xC0, 0x0E, 0xDB, 0x6C, 0xDB, 0x6D, 0xDB, 0x69, 0x5B, 0x63,
+    0x10, 0x07, 0x90, 0x07, 0xDB, 0x63, 0xDB, 0x69, 0xD8, 0x0D, 0xD8, 0x0C, 0xDF, 0x7E, 0xDF, 0x7E,
+    0x00, 0x5E, 0xFF, /* UNICODE索引 - 廿 */
+    0xFB, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFD, 0xFB, 0xFD,
+    0xFB, 0xFD, 0xFB, 0xFD, 0xFB, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFB, 0xFF, 0xFB, 0xFF,
+    0x00, 0x5F, 0x3A, /* UNICODE索引 - 强 */
+    0xBF, 0xFF, 0xB8, 0x3D, 0xB8, 0x3C, 0xBB, 0xBC, 0x83, 0x81, 0x83, 0x81, 0xFE, 0x1D, 0x86, 0x1D,
+    0x86, 0xDD, 0xB6, 0xDD, 0xB0, 0x01, 0xB0, 0x01, 0xB6, 0xDD, 0x86, 0xD5, 0x86, 0x10, 0xFE, 0x18,
+    0x00, 0x62, 0x0A, /* UNICODE索引 - 戊 */
+    0xFF, 0xFE, 0xFF, 0xF8, 0xE0, 0x01, 0xE0, 0x07, 0xEF, 0xFE, 0xEF, 0xFE, 0xEF, 0xFC, 0xEF, 0xFD,
+    0x01, 0xF9, 0x00, 0x33, 0xEE, 0x07, 0x6F, 0xC7, 0x2F, 0x13, 0xAC, 0x39, 0xEC, 0xE0, 0xEF, 0xE0,
+    0x00, 0x62, 0x0C, /* UNICODE索引 - 戌 */
+    0xFF, 0xFE, 0xFF, 0xF8, 0xE0, 0x01, 0xE0, 0x07, 0xEF, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F, 0xEF, 0x7E,
+    0xEF, 0xFC, 0x00, 0x79, 0x00, 0x13, 0x6F, 0x87, 0x2F, 0x83, 0xAC, 0x19, 0xEC, 0x60, 0xEF, 0xE0,
+    0x00, 0x62, 0xE9, /* UNICODE索引 - 择 */
+    0xF7, 0xBD, 0xF7, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x7F, 0xBE, 0xF7, 0x9E, 0xB7, 0x8C, 0xB7,
+    0xA5, 0xB7, 0xB0, 0x00, 0xB0, 0x00, 0xA5, 0xB7, 0x8C, 0xB7, 0x9E, 0xB7, 0xFE, 0xF7, 0xFE, 0xFF,
+    0x00, 0x63, 0x09, /* UNICODE索引 - 按 */
+    0xF7, 0xBF, 0xF7, 0xBD, 0xF7, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xF2, 0xFF, 0xE2, 0xFE, 0xE6, 0xDE,
+    0xEE, 0x0C, 0x68, 0x29, 0x08, 0xE3, 0x8E, 0xE3, 0xEE, 0x09, 0xEA, 0x1C, 0xE2, 0xFE, 0xE6, 0xFF,
+    0x00, 0x63, 0x6E, /* UNICODE索引 - 据 */
+    0xF7, 0xBD, 0xF7, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF6, 0x7E, 0xF6, 0xF8, 0x80, 0x01, 0x80, 0x07,
+    0xB6, 0xC0, 0xB6, 0xC0, 0xB0, 0x1D, 0xB0, 0x1D, 0xB6, 0xDD, 0x86, 0xC0, 0x86, 0xC0, 0xFE, 0xFF,
+    0x00, 0x64, 0xE6, /* UNICODE索引 - 擦 */
+    0xF7, 0xBD, 0xF7, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF6, 0x6F, 0xC4, 0x4D, 0xC0, 0x09, 0xD2, 0x2B,
+    0x58, 0x2E, 0x18, 0xA0, 0x90, 0xA0, 0xD0, 0x2F, 0xDA, 0x2B, 0xD0, 0x89, 0xC1, 0xCD, 0xCF, 0xEF,
+    0x00, 0x65, 0x70, /* UNICODE索引 - 数 */
+    0xF6, 0xBE, 0xB4, 0xA6, 0x91, 0x84, 0xD3, 0x11, 0x00, 0x39, 0x00, 0xB1, 0xD3, 0x84, 0x91, 0x8E,
+    0xB4, 0xFE, 0xF0, 0xFC, 0x00, 0x31, 0x0E, 0x03, 0xEF, 0x03, 0xE0, 0x31, 0xE0, 0xFC, 0xEF, 0xFE,
+    0x00, 0x65, 0xF6, /* UNICODE索引 - 时 */
+    0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xDE, 0xF7, 0xDE, 0xF7, 0xC0, 0x03, 0xC0, 0x03, 0xF7, 0xFF,
+    0xF7, 0x7F, 0xF7, 0x1F, 0xF7, 0x9D, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xFF, 0xF7, 0xFF,
+    0x00, 0x67, 0x08, /* UNICODE索引 - 月 */
+    0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xF1, 0x80, 0x03, 0x80, 0x0F, 0xBB, 0xBF, 0xBB, 0xBF, 0xBB, 0xBF,
+    0xBB, 0xBF, 0xBB, 0xBF, 0xBB, 0xBD, 0xBB, 0xBC, 0x80, 0x00, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
     0x00, 0x67, 0x2A, /* UNICODE索引 - 未 */
     0xFE, 0xFB, 0xFE, 0xFB, 0xEE, 0xF3, 0xEE, 0xE7, 0xEE, 0xCF, 0xEE, 0x9F, 0xEE, 0x3F, 0x00, 0x00,
     0x00, 0x00, 0xEE, 0x3F, 0xEE, 0x9F, 0xEE, 0xCF, 0xEE, 0xE7, 0xEE, 0xF3, 0xFE, 0xFB, 0xFE, 0xFB,
+    0x00, 0x6B, 0x63, /* UNICODE索引 - 正 */
+    0xFF, 0xFD, 0xBF, 0xFD, 0xBF, 0xFD, 0xBC, 0x01, 0xBC, 0x01, 0xBF, 0xFD, 0xBF, 0xFD, 0x80, 0x01,
+    0x80, 0x01, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBE, 0xFD, 0xBF, 0xFD, 0xFF, 0xFD,
+    0x00, 0x6D, 0x88, /* UNICODE索引 - 消 */
+    0xF7, 0xDF, 0xF1, 0xDF, 0xB9, 0xC1, 0x8F, 0x01, 0xCC, 0x3F, 0xFC, 0xFF, 0xB8, 0x00, 0x88, 0x00,
+    0xCB, 0x6F, 0x03, 0x6F, 0x03, 0x6D, 0xEB, 0x6C, 0x88, 0x00, 0x98, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x6D, 0xA6, /* UNICODE索引 - 润 */
+    0xF7, 0xDF, 0xF1, 0xDF, 0xB9, 0x81, 0x8E, 0x01, 0xCE, 0x7F, 0xC0, 0x00, 0x40, 0x00, 0x17, 0x77,
+    0x97, 0x77, 0xB0, 0x07, 0xB0, 0x07, 0xB7, 0x75, 0xB7, 0x74, 0x80, 0x00, 0x80, 0x01, 0xFF, 0xFF,
+    0x00, 0x72, 0x5B, /* UNICODE索引 - 牛 */
+    0xFF, 0xBF, 0xFD, 0xBF, 0xF9, 0xBF, 0x83, 0xBF, 0x87, 0xBF, 0xF7, 0xBF, 0xF7, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xBF, 0xF7, 0xBF, 0xF7, 0xBF, 0xF7, 0xBF, 0xF7, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF,
+    0x00, 0x72, 0xD7, /* UNICODE索引 - 狗 */
+    0xFD, 0xEF, 0xB9, 0xCD, 0x93, 0x9C, 0xC7, 0x3C, 0xC0, 0x01, 0x90, 0x03, 0xB3, 0xFF, 0xC4, 0x0F,
+    0x0C, 0x0F, 0x2D, 0xDF, 0xEC, 0x0D, 0xEC, 0x0C, 0xEF, 0xFC, 0xE0, 0x01, 0xE0, 0x03, 0xFF, 0xFF,
+    0x00, 0x73, 0x2A, /* UNICODE索引 - 猪 */
+    0xBB, 0xDD, 0x93, 0x9C, 0xC7, 0x3C, 0xC0, 0x01, 0x90, 0x03, 0xBB, 0xDF, 0xDB, 0x9F, 0xDB, 0x00,
+    0xDA, 0x00, 0x00, 0x6D, 0x01, 0x6D, 0xD3, 0x6D, 0xC3, 0x00, 0x8B, 0x00, 0x9B, 0xFF, 0xFB, 0xFF,
+    0x00, 0x73, 0x34, /* UNICODE索引 - 猴 */
+    0xBB, 0xDD, 0x93, 0x9C, 0xC7, 0x3C, 0xC0, 0x01, 0x90, 0x03, 0xB9, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x17, 0x5E, 0xB0, 0x5C, 0xB0, 0xD1, 0xB6, 0x03, 0x86, 0x03, 0x86, 0xD1, 0xF6, 0xDC, 0xF7, 0xDE,
+    0x00, 0x75, 0x32, /* UNICODE索引 - 甲 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0x80, 0x1F, 0xBB, 0xBF, 0xBB, 0xBF, 0xBB, 0xBF, 0x80, 0x00,
+    0x80, 0x00, 0xBB, 0xBF, 0xBB, 0xBF, 0xBB, 0xBF, 0x80, 0x1F, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
     0x00, 0x75, 0x33, /* UNICODE索引 - 申 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xE0, 0x07, 0xEE, 0xEF, 0xEE, 0xEF, 0xEE, 0xEF, 0x00, 0x00,
-    0x00, 0x00, 0xEE, 0xEF, 0xEE, 0xEF, 0xEE, 0xEF, 0xE0, 0x07, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x91, 0x49, /* UNICODE索引 - 酉 */
-    0xBF, 0xFF, 0xB0, 0x00, 0xB0, 0x00, 0xB7, 0x2D, 0xB6, 0x6D, 0x80, 0xED, 0x81, 0xED, 0xB7, 0xED,
-    0xB7, 0xED, 0x80, 0xED, 0x80, 0x6D, 0xB7, 0x6D, 0xB7, 0x6D, 0xB0, 0x00, 0xB0, 0x00, 0xBF, 0xFF,
-    0x00, 0x62, 0x0C, /* UNICODE索引 - 戌 */
-    0xFF, 0xFE, 0xFF, 0xF8, 0xE0, 0x01, 0xE0, 0x07, 0xEF, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F, 0xEF, 0x7E,
-    0xEF, 0xFC, 0x00, 0x79, 0x00, 0x13, 0x6F, 0x87, 0x2F, 0x83, 0xAC, 0x19, 0xEC, 0x60, 0xEF, 0xE0,
-    0x00, 0x4E, 0xA5, /* UNICODE索引 - 亥 */
-    0xFF, 0xFF, 0xEF, 0xF6, 0xEF, 0x76, 0xEE, 0x66, 0xEC, 0x6C, 0xE9, 0x4D, 0x63, 0x59, 0x27, 0x1B,
-    0xAF, 0x33, 0xEE, 0x67, 0xEC, 0xC7, 0xED, 0x93, 0xEF, 0x39, 0xEF, 0x7C, 0xEF, 0xFE, 0xFF, 0xFF,
-    0x00, 0x5E, 0x74, /* UNICODE索引 - 年 */
-    0xFF, 0xDF, 0xFB, 0xDF, 0xE3, 0xDF, 0x04, 0x1F, 0x1C, 0x1F, 0xDD, 0xDF, 0xDD, 0xDF, 0xDD, 0xDF,
-    0xC0, 0x00, 0xC0, 0x00, 0xDD, 0xDF, 0xDD, 0xDF, 0xDD, 0xDF, 0xDD, 0xDF, 0xDF, 0xDF, 0xFF, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xE0, 0x07, 0xEE, 0xEF, 0xEE, 0xEF, 0xEE, 0xEF, 0x00, 0x00,
+    0x00, 0x00, 0xEE, 0xEF, 0xEE, 0xEF, 0xEE, 0xEF, 0xE0, 0x07, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x76, 0x78, /* UNICODE索引 - 癸 */
+    0xFE, 0xFF, 0xAE, 0xDE, 0xA4, 0xDE, 0xB1, 0xDC, 0xB2, 0xDD, 0xA6, 0xD9, 0x8E, 0xD3, 0x9E, 0x07,
+    0x3E, 0x07, 0x0E, 0xD7, 0x86, 0xD3, 0x32, 0xD9, 0x61, 0xDC, 0xCC, 0xDE, 0xDE, 0xDF, 0xFE, 0xFF,
+    0x00, 0x77, 0xE5, /* UNICODE索引 - 知 */
+    0xFB, 0x7E, 0xE3, 0x7C, 0x07, 0x71, 0x0F, 0x43, 0xE0, 0x0F, 0xE0, 0x0F, 0xEF, 0x41, 0xEF, 0x71,
+    0xFF, 0x7F, 0xC0, 0x03, 0xC0, 0x03, 0xDF, 0xF7, 0xDF, 0xF7, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xFF,
+    0x00, 0x79, 0xFB, /* UNICODE索引 - 移 */
+    0xDB, 0xEF, 0xDB, 0x8F, 0xDA, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3B, 0x1F, 0xBB, 0x9F, 0xF7, 0x6E,
+    0xE7, 0x6E, 0xC6, 0x4C, 0x10, 0x8D, 0x19, 0x21, 0xD2, 0x33, 0xC6, 0xA7, 0xCF, 0x8F, 0xFF, 0x9F,
+    0x00, 0x7A, 0x7A, /* UNICODE索引 - 空 */
+    0xF7, 0xFF, 0xC7, 0xFD, 0xCD, 0xFD, 0xD9, 0x7D, 0xD3, 0x7D, 0xD7, 0x7D, 0x5F, 0x7D, 0x1F, 0x01,
+    0x9F, 0x01, 0xDF, 0x7D, 0xD7, 0x7D, 0xD3, 0x7D, 0xD9, 0x7D, 0xD5, 0xFD, 0xC7, 0xFD, 0xCF, 0xFF,
     0x00, 0x7E, 0xE7, /* UNICODE索引 - 继 */
     0xFB, 0xBB, 0xF3, 0x19, 0xC2, 0x19, 0x08, 0xB3, 0x31, 0xB7, 0xF7, 0xB7, 0x80, 0x01, 0x80, 0x01,
     0xE5, 0x9D, 0xF5, 0x3D, 0x00, 0x01, 0x00, 0x01, 0xF5, 0x3D, 0xE5, 0x9D, 0xED, 0xDD, 0xFF, 0xFD,
     0x00, 0x7E, 0xED, /* UNICODE索引 - 续 */
     0xFB, 0xBB, 0xF3, 0x19, 0xC2, 0x19, 0x08, 0xB3, 0x39, 0xB7, 0xE3, 0xB7, 0xE3, 0xA6, 0xDB, 0xAE,
     0xDA, 0x8C, 0xDA, 0x49, 0x03, 0x63, 0x02, 0x07, 0xDA, 0x07, 0xDA, 0xE3, 0xD8, 0xE8, 0xF9, 0xEC,
-    0x00, 0x8B, 0xBE, /* UNICODE索引 - 设 */
-    0xFD, 0xFF, 0xFD, 0xFF, 0xBD, 0xFF, 0x8C, 0x03, 0xCC, 0x02, 0xFD, 0xE6, 0xF8, 0xEC, 0x82, 0x3D,
-    0x86, 0x09, 0xBE, 0xC3, 0xBE, 0xE3, 0x86, 0x89, 0x82, 0x1D, 0xFA, 0x7C, 0xFB, 0xFE, 0xFB, 0xFE,
     0x00, 0x7F, 0x6E, /* UNICODE索引 - 置 */
     0xFF, 0xFD, 0x17, 0xFD, 0x17, 0xFD, 0x54, 0x01, 0x54, 0x01, 0x15, 0x55, 0x15, 0x55, 0x41, 0x55,
     0x41, 0x55, 0x15, 0x55, 0x15, 0x55, 0x54, 0x01, 0x54, 0x01, 0x17, 0xFD, 0x17, 0xFD, 0xFF, 0xFD,
-    0x00, 0x52, 0xA0, /* UNICODE索引 - 加 */
-    0xF7, 0xFE, 0xF7, 0xFC, 0xF7, 0xF1, 0x00, 0x03, 0x00, 0x0D, 0xF7, 0xFC, 0xF0, 0x00, 0xF0, 0x01,
-    0xFF, 0xFF, 0xE0, 0x01, 0xE0, 0x01, 0xEF, 0xFB, 0xEF, 0xFB, 0xE0, 0x01, 0xE0, 0x01, 0xFF, 0xFF,
-    0x00, 0x51, 0xCF, /* UNICODE索引 - 减 */
-    0xFF, 0xBF, 0xBF, 0xBF, 0x8F, 0x01, 0xCC, 0x00, 0xFC, 0xFC, 0xE0, 0x01, 0xE0, 0x03, 0xED, 0x87,
-    0xED, 0x86, 0xED, 0x84, 0xED, 0x81, 0x00, 0x13, 0x00, 0x03, 0x6F, 0x81, 0x2E, 0x10, 0xAE, 0x70,
-    0x00, 0x4E, 0x0A, /* UNICODE索引 - 上 */
-    0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD, 0x00, 0x01, 0x00, 0x01,
-    0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF, 0xFD, 0xFF, 0xFD,
-    0x00, 0x4E, 0x0B, /* UNICODE索引 - 下 */
-    0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0x80, 0x00, 0x80, 0x00,
-    0xBF, 0xFF, 0xBD, 0xFF, 0xBC, 0xFF, 0xBE, 0x7F, 0xBF, 0x1F, 0xBF, 0x9F, 0xBF, 0xFF, 0xBF, 0xFF,
-    0x00, 0x7A, 0x7A, /* UNICODE索引 - 空 */
-    0xF7, 0xFF, 0xC7, 0xFD, 0xCD, 0xFD, 0xD9, 0x7D, 0xD3, 0x7D, 0xD7, 0x7D, 0x5F, 0x7D, 0x1F, 0x01,
-    0x9F, 0x01, 0xDF, 0x7D, 0xD7, 0x7D, 0xD3, 0x7D, 0xD9, 0x7D, 0xD5, 0xFD, 0xC7, 0xFD, 0xCF, 0xFF,
-    0x00, 0x90, 0x09, /* UNICODE索引 - 选 */
-    0xFD, 0xFF, 0xFD, 0xFD, 0xBD, 0xF9, 0x8C, 0x03, 0xCC, 0x03, 0xF5, 0xF1, 0x85, 0xC5, 0x8C, 0x0D,
-    0xEC, 0x3D, 0x01, 0xFD, 0x00, 0x0D, 0xEC, 0x05, 0xED, 0xF5, 0xED, 0xC5, 0xFD, 0xC5, 0xFF, 0xFD,
-    0x00, 0x62, 0xE9, /* UNICODE索引 - 择 */
-    0xF7, 0xBD, 0xF7, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x7F, 0xBE, 0xF7, 0x9E, 0xB7, 0x8C, 0xB7,
-    0xA5, 0xB7, 0xB0, 0x00, 0xB0, 0x00, 0xA5, 0xB7, 0x8C, 0xB7, 0x9E, 0xB7, 0xFE, 0xF7, 0xFE, 0xFF,
-    0x00, 0x79, 0xFB, /* UNICODE索引 - 移 */
-    0xDB, 0xEF, 0xDB, 0x8F, 0xDA, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3B, 0x1F, 0xBB, 0x9F, 0xF7, 0x6E,
-    0xE7, 0x6E, 0xC6, 0x4C, 0x10, 0x8D, 0x19, 0x21, 0xD2, 0x33, 0xC6, 0xA7, 0xCF, 0x8F, 0xFF, 0x9F,
-    0x00, 0x52, 0xA8, /* UNICODE索引 - 动 */
-    0xFD, 0xF7, 0xDD, 0xC3, 0xDC, 0x03, 0xDC, 0x37, 0xDD, 0xD7, 0xDD, 0xC2, 0xDD, 0xE0, 0xF5, 0xF1,
-    0xF7, 0x83, 0x00, 0x0F, 0x00, 0x7D, 0xF7, 0xFC, 0xF7, 0xFC, 0xF0, 0x01, 0xF0, 0x03, 0xFF, 0xFF,
-    0x00, 0x4F, 0xDD, /* UNICODE索引 - 保 */
-    0xFF, 0x7F, 0xFE, 0x7F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x73, 0x83, 0x67, 0x83, 0x4F,
-    0xBB, 0x1F, 0xB8, 0x00, 0xB8, 0x00, 0xBB, 0x1F, 0x83, 0x4F, 0x83, 0x67, 0xFF, 0x73, 0xFF, 0xFB,
-    0x00, 0x5B, 0x58, /* UNICODE索引 - 存 */
-    0xDF, 0xBF, 0xDF, 0x3F, 0xDE, 0x7F, 0xD8, 0x00, 0xC0, 0x00, 0x07, 0xBF, 0x1B, 0xBF, 0xDB, 0xBD,
-    0xDB, 0xBC, 0xDB, 0x00, 0xDA, 0x01, 0xD8, 0xBF, 0xD9, 0xBF, 0xDB, 0xBF, 0xDF, 0xBF, 0xDF, 0xBF,
-    0x00, 0x53, 0xD6, /* UNICODE索引 - 取 */
-    0xBF, 0xEF, 0xBF, 0xE7, 0x80, 0x07, 0x80, 0x0F, 0xB6, 0xEF, 0xB6, 0xCF, 0x80, 0x00, 0x80, 0x00,
-    0x9F, 0xDE, 0x80, 0xDC, 0xC0, 0x19, 0xDF, 0x03, 0xDF, 0x03, 0xC0, 0x19, 0xC0, 0xFC, 0xFF, 0xFE,
-    0x00, 0x6D, 0x88, /* UNICODE索引 - 消 */
-    0xF7, 0xDF, 0xF1, 0xDF, 0xB9, 0xC1, 0x8F, 0x01, 0xCC, 0x3F, 0xFC, 0xFF, 0xB8, 0x00, 0x88, 0x00,
-    0xCB, 0x6F, 0x03, 0x6F, 0x03, 0x6D, 0xEB, 0x6C, 0x88, 0x00, 0x98, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x7F, 0x8A, /* UNICODE索引 - 羊 */
+    0xFF, 0xEF, 0xEF, 0xEF, 0xEE, 0xEF, 0xEE, 0xEF, 0x6E, 0xEF, 0x0E, 0xEF, 0x8E, 0xEF, 0xE0, 0x00,
+    0xE0, 0x00, 0xCE, 0xEF, 0x0E, 0xEF, 0x2E, 0xEF, 0xEE, 0xEF, 0xEE, 0xEF, 0xEF, 0xEF, 0xFF, 0xEF,
+    0x00, 0x86, 0x4E, /* UNICODE索引 - 虎 */
+    0xFF, 0xFE, 0xFF, 0xF8, 0xE0, 0x01, 0xE0, 0x06, 0xED, 0xFC, 0xED, 0xF9, 0xED, 0xC3, 0x00, 0xC7,
+    0x00, 0x5F, 0xA9, 0x5F, 0xAB, 0x41, 0xAB, 0x40, 0xAC, 0x7E, 0xA4, 0x78, 0xE7, 0xF8, 0xFF, 0xFF,
+    0x00, 0x86, 0xC7, /* UNICODE索引 - 蛇 */
+    0xFF, 0xFB, 0xE0, 0x39, 0xE0, 0x39, 0x00, 0x03, 0x00, 0x07, 0xE0, 0x67, 0xE0, 0x63, 0xE3, 0xF3,
+    0xE4, 0x03, 0xEC, 0x01, 0x6F, 0x9D, 0x0F, 0x3D, 0x8E, 0x7D, 0xEA, 0xFD, 0xE3, 0xE1, 0xE7, 0xE1,
+    0x00, 0x8B, 0xBE, /* UNICODE索引 - 设 */
+    0xFD, 0xFF, 0xFD, 0xFF, 0xBD, 0xFF, 0x8C, 0x03, 0xCC, 0x02, 0xFD, 0xE6, 0xF8, 0xEC, 0x82, 0x3D,
+    0x86, 0x09, 0xBE, 0xC3, 0xBE, 0xE3, 0x86, 0x89, 0x82, 0x1D, 0xFA, 0x7C, 0xFB, 0xFE, 0xFB, 0xFE,
+    0x00, 0x8F, 0x9B, /* UNICODE索引 - 辛 */
+    0xFD, 0xFF, 0xFD, 0xDF, 0xDD, 0xDF, 0xDD, 0xDF, 0xD5, 0xDF, 0xD1, 0xDF, 0x59, 0xDF, 0x1C, 0x00,
+    0x9C, 0x00, 0xD9, 0xDF, 0xD1, 0xDF, 0xD5, 0xDF, 0xDD, 0xDF, 0xDD, 0xDF, 0xFD, 0xDF, 0xFD, 0xFF,
+    0x00, 0x8F, 0xB0, /* UNICODE索引 - 辰 */
+    0xFF, 0xFD, 0xFF, 0xF1, 0x80, 0x03, 0x80, 0x0F, 0xB6, 0xFF, 0xB6, 0x00, 0xB6, 0x00, 0xB6, 0xF9,
+    0xB6, 0x3B, 0xB6, 0x1F, 0xB6, 0xCF, 0xB6, 0xC7, 0xB6, 0x93, 0xB6, 0xB9, 0xBE, 0xFD, 0xFF, 0xFD,
     0x00, 0x8F, 0xDB, /* UNICODE索引 - 进 */
     0xFD, 0xFF, 0xFD, 0xFD, 0xBD, 0xF9, 0x8C, 0x03, 0xCC, 0x03, 0xFE, 0xF9, 0xEE, 0xF5, 0xEE, 0xC5,
     0x00, 0x0D, 0x00, 0x3D, 0xEE, 0xFD, 0x00, 0x05, 0x00, 0x05, 0xEE, 0xFD, 0xEE, 0xFD, 0xFE, 0xFD,
-    0x00, 0x51, 0x65, /* UNICODE索引 - 入 */
-    0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xF9, 0xFF, 0xF3, 0xFF, 0xC7, 0x7F, 0x0F, 0x38, 0x3F, 0x80, 0xFF,
-    0xC0, 0xFF, 0xF8, 0x3F, 0xFF, 0x0F, 0xFF, 0xC3, 0xFF, 0xF1, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF, 0xFE,
-    0x00, 0x54, 0x0C, /* UNICODE索引 - 同 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x80, 0x00, 0xB7, 0xFF, 0xB6, 0x07, 0xB6, 0x07, 0xB6, 0xEF,
-    0xB6, 0xEF, 0xB6, 0xEF, 0xB6, 0x07, 0xB6, 0x05, 0xB7, 0xFC, 0x80, 0x00, 0x80, 0x01, 0xFF, 0xFF,
-    0x00, 0x65, 0xF6, /* UNICODE索引 - 时 */
-    0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xDE, 0xF7, 0xDE, 0xF7, 0xC0, 0x03, 0xC0, 0x03, 0xF7, 0xFF,
-    0xF7, 0x7F, 0xF7, 0x1F, 0xF7, 0x9D, 0xF7, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xF7, 0xFF, 0xF7, 0xFF,
-    0x00, 0x63, 0x09, /* UNICODE索引 - 按 */
-    0xF7, 0xBF, 0xF7, 0xBD, 0xF7, 0x3C, 0x00, 0x00, 0x00, 0x01, 0xF2, 0xFF, 0xE2, 0xFE, 0xE6, 0xDE,
-    0xEE, 0x0C, 0x68, 0x29, 0x08, 0xE3, 0x8E, 0xE3, 0xEE, 0x09, 0xEA, 0x1C, 0xE2, 0xFE, 0xE6, 0xFF,
-    0x00, 0x4F, 0x4F, /* UNICODE索引 - 住 */
-    0xFF, 0x7F, 0xFE, 0x7F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D,
-    0x6F, 0x7D, 0x20, 0x01, 0xA0, 0x01, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xEF, 0x7D, 0xFF, 0xFD,
-    0x00, 0x54, 0x8C, /* UNICODE索引 - 和 */
-    0xFB, 0xF7, 0xDB, 0xE7, 0xDB, 0x8F, 0xDA, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x3B, 0x1F, 0xBB, 0x9F,
-    0xFB, 0xFF, 0xE0, 0x03, 0xE0, 0x03, 0xEF, 0xF7, 0xEF, 0xF7, 0xE0, 0x03, 0xE0, 0x03, 0xFF, 0xFF,
+    0x00, 0x90, 0x09, /* UNICODE索引 - 选 */
+    0xFD, 0xFF, 0xFD, 0xFD, 0xBD, 0xF9, 0x8C, 0x03, 0xCC, 0x03, 0xF5, 0xF1, 0x85, 0xC5, 0x8C, 0x0D,
+    0xEC, 0x3D, 0x01, 0xFD, 0x00, 0x0D, 0xEC, 0x05, 0xED, 0xF5, 0xED, 0xC5, 0xFD, 0xC5, 0xFF, 0xFD,
+    0x00, 0x90, 0xE8, /* UNICODE索引 - 部 */
+    0xFD, 0xFF, 0xDD, 0xFF, 0xD5, 0x81, 0x51, 0x81, 0x19, 0xBB, 0x9D, 0xBB, 0xD9, 0xBB, 0xD1, 0x81,
+    0xD5, 0x81, 0xDD, 0xFF, 0x80, 0x00, 0x80, 0x00, 0xBB, 0xE7, 0xA0, 0xE7, 0x84, 0x0F, 0x9F, 0x1F,
+    0x00, 0x91, 0x49, /* UNICODE索引 - 酉 */
+    0xBF, 0xFF, 0xB0, 0x00, 0xB0, 0x00, 0xB7, 0x2D, 0xB6, 0x6D, 0x80, 0xED, 0x81, 0xED, 0xB7, 0xED,
+    0xB7, 0xED, 0x80, 0xED, 0x80, 0x6D, 0xB7, 0x6D, 0xB7, 0x6D, 0xB0, 0x00, 0xB0, 0x00, 0xBF, 0xFF,
     0x00, 0x95, 0x2E, /* UNICODE索引 - 键 */
     0xFD, 0x7F, 0xF1, 0x7F, 0x00, 0x01, 0x08, 0x01, 0xDB, 0x71, 0xDA, 0x11, 0xD8, 0x83, 0xC0, 0x03,
     0xC6, 0x19, 0xD5, 0x5D, 0xD5, 0x5D, 0x00, 0x05, 0x00, 0x05, 0xC1, 0x5D, 0xC1, 0x5D, 0xF7, 0xDD,
-    0x00, 0x5E, 0x76, /* UNICODE索引 - 并 */
-    0xFF, 0xBF, 0xF7, 0xBE, 0xF7, 0xBC, 0x77, 0xB1, 0x10, 0x03, 0x90, 0x0F, 0xF7, 0xBF, 0xF7, 0xBF,
-    0xF7, 0xBF, 0xF7, 0xBF, 0xD0, 0x00, 0x10, 0x00, 0x37, 0xBF, 0xF7, 0xBF, 0xF7, 0xBF, 0xFF, 0xBF,
-    0x00, 0x59, 0x0D, /* UNICODE索引 - 复 */
-    0xFB, 0xFE, 0xF3, 0xF6, 0xE7, 0xF6, 0x00, 0x64, 0x10, 0x4D, 0xD5, 0x05, 0xD5, 0x11, 0xD5, 0x5B,
-    0xD5, 0x5B, 0xD5, 0x51, 0xD5, 0x45, 0xD0, 0x4D, 0xD0, 0x5C, 0xDF, 0xFE, 0xDF, 0xFE, 0xFF, 0xFE,
-    0x00, 0x4F, 0x4D, /* UNICODE索引 - 位 */
-    0xFF, 0x7F, 0xFE, 0x7F, 0xF8, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x17, 0xFD, 0xF6, 0x7D, 0xF6, 0x05,
-    0x77, 0x85, 0x17, 0xFD, 0x97, 0xF1, 0xF7, 0x81, 0xF4, 0x0D, 0xF4, 0x7D, 0xF7, 0xFD, 0xFF, 0xFD,
-    0x00, 0x53, 0xEF, /* UNICODE索引 - 可 */
-    0xFF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF, 0xB0, 0x0F, 0xB0, 0x0F, 0xB7, 0xDF, 0xB7, 0xDF, 0xB0, 0x0F,
-    0xB0, 0x0F, 0xBF, 0xFD, 0xBF, 0xFC, 0x80, 0x00, 0x80, 0x01, 0xBF, 0xFF, 0xBF, 0xFF, 0xBF, 0xFF,
-    0x00, 0x4E, 0xE5, /* UNICODE索引 - 以 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xC0, 0x03, 0xFF, 0xE7, 0xBF, 0xCE, 0x9F, 0xDC, 0xC7, 0xF9,
-    0xE7, 0xF3, 0xFF, 0xC7, 0xFE, 0x0F, 0x00, 0x2F, 0x01, 0xE7, 0xFF, 0xF3, 0xFF, 0xF8, 0xFF, 0xFC,
-    0x00, 0x5F, 0x3A, /* UNICODE索引 - 强 */
-    0xBF, 0xFF, 0xB8, 0x3D, 0xB8, 0x3C, 0xBB, 0xBC, 0x83, 0x81, 0x83, 0x81, 0xFE, 0x1D, 0x86, 0x1D,
-    0x86, 0xDD, 0xB6, 0xDD, 0xB0, 0x01, 0xB0, 0x01, 0xB6, 0xDD, 0x86, 0xD5, 0x86, 0x10, 0xFE, 0x18,
-    0x00, 0x52, 0x36, /* UNICODE索引 - 制 */
-    0xFD, 0xFF, 0xF5, 0xFF, 0x85, 0x83, 0x8D, 0x83, 0xED, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xED, 0xB3,
-    0xED, 0x83, 0xED, 0x87, 0xE0, 0x0F, 0xE0, 0x0D, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-    0x00, 0x64, 0xE6, /* UNICODE索引 - 擦 */
-    0xF7, 0xBD, 0xF7, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF6, 0x6F, 0xC4, 0x4D, 0xC0, 0x09, 0xD2, 0x2B,
-    0x58, 0x2E, 0x18, 0xA0, 0x90, 0xA0, 0xD0, 0x2F, 0xDA, 0x2B, 0xD0, 0x89, 0xC1, 0xCD, 0xCF, 0xEF,
     0x00, 0x96, 0x64, /* UNICODE索引 - 除 */
     0xFF, 0xFF, 0x80, 0x00, 0x80, 0x00, 0xA1, 0xCF, 0x84, 0x0B, 0x9A, 0x13, 0xF3, 0x47, 0xE3, 0x4D,
     0xCB, 0x7C, 0x18, 0x00, 0x18, 0x01, 0xCB, 0x5F, 0xE3, 0x4F, 0xF3, 0x63, 0xFB, 0x73, 0xFB, 0xFF,
-    0x00, 0x51, 0x68, /* UNICODE索引 - 全 */
-    0xFE, 0xFF, 0xFE, 0xFD, 0xFC, 0xFD, 0xF9, 0xDD, 0xF1, 0xDD, 0xE5, 0xDD, 0xCD, 0xDD, 0x1C, 0x01,
-    0x1C, 0x01, 0xCD, 0xDD, 0xE5, 0xDD, 0xF1, 0xDD, 0xF9, 0xDD, 0xFC, 0xFD, 0xFE, 0xFD, 0xFE, 0xFF,
-    0x00, 0x90, 0xE8, /* UNICODE索引 - 部 */
-    0xFD, 0xFF, 0xDD, 0xFF, 0xD5, 0x81, 0x51, 0x81, 0x19, 0xBB, 0x9D, 0xBB, 0xD9, 0xBB, 0xD1, 0x81,
-    0xD5, 0x81, 0xDD, 0xFF, 0x80, 0x00, 0x80, 0x00, 0xBB, 0xE7, 0xA0, 0xE7, 0x84, 0x0F, 0x9F, 0x1F,
-    0x00, 0x65, 0x70, /* UNICODE索引 - 数 */
-    0xF6, 0xBE, 0xB4, 0xA6, 0x91, 0x84, 0xD3, 0x11, 0x00, 0x39, 0x00, 0xB1, 0xD3, 0x84, 0x91, 0x8E,
-    0xB4, 0xFE, 0xF0, 0xFC, 0x00, 0x31, 0x0E, 0x03, 0xEF, 0x03, 0xE0, 0x31, 0xE0, 0xFC, 0xEF, 0xFE,
-    0x00, 0x63, 0x6E, /* UNICODE索引 - 据 */
-    0xF7, 0xBD, 0xF7, 0xBC, 0x00, 0x00, 0x00, 0x01, 0xF6, 0x7E, 0xF6, 0xF8, 0x80, 0x01, 0x80, 0x07,
-    0xB6, 0xC0, 0xB6, 0xC0, 0xB0, 0x1D, 0xB0, 0x1D, 0xB6, 0xDD, 0x86, 0xC0, 0x86, 0xC0, 0xFE, 0xFF,
+    0x00, 0x9A, 0x6C, /* UNICODE索引 - 马 */
+    0xFF, 0xEF, 0xBF, 0xEF, 0xBF, 0xEF, 0xB0, 0xEF, 0xB0, 0xEF, 0xBE, 0xEF, 0xBE, 0xEF, 0xBE, 0xEF,
+    0xBE, 0xEF, 0xBE, 0xEF, 0x80, 0xED, 0x80, 0xEC, 0xFE, 0xFC, 0xFE, 0x01, 0xFE, 0x03, 0xFF, 0xFF,
+    0x00, 0x9E, 0x21, /* UNICODE索引 - 鸡 */
+    0xEF, 0xFB, 0xED, 0xF3, 0xEC, 0xC7, 0xEE, 0x0F, 0xEC, 0x1F, 0xE0, 0xC7, 0xE3, 0xE7, 0xFF, 0xF7,
+    0xC0, 0x37, 0x80, 0x37, 0x17, 0xB7, 0x55, 0xB5, 0xDC, 0xB4, 0xC0, 0xB4, 0xC1, 0x81, 0xFF, 0x83,
+    0x00, 0x9F, 0x20, /* UNICODE索引 - 鼠 */
+    0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x81, 0x00, 0xAD, 0x6C, 0x2D, 0x25, 0x6D, 0xB7, 0xFD, 0x00,
+    0xFD, 0x00, 0xAD, 0x6C, 0xAD, 0x25, 0xAD, 0xB7, 0x81, 0x03, 0x81, 0x01, 0xFF, 0xF0, 0xFF, 0xF0,
+    0x00, 0x9F, 0x99, /* UNICODE索引 - 龙 */
+    0xF7, 0xFE, 0xF7, 0xFC, 0xF7, 0xF9, 0xF7, 0xE3, 0xF7, 0x87, 0x00, 0x1D, 0x00, 0x79, 0xF7, 0xF3,
+    0xF0, 0x03, 0xF0, 0x01, 0x77, 0x9D, 0x17, 0x3D, 0x94, 0x7D, 0xF4, 0xFD, 0xF7, 0xE1, 0xF7, 0xE1,
     0x00, 0xFF, 0x1A, /* UNICODE索引 - ： */
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x93, 0xFF, 0x93, 0xFF, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x30, 0x10, /* UNICODE索引 - 【 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x83, 0xC1, 0x8F, 0xF1, 0x9F, 0xF9, 0xBF, 0xFD, 0xFF, 0xFF,
-    0x00, 0x30, 0x11, /* UNICODE索引 - 】 */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFD, 0x9F, 0xF9, 0x8F, 0xF1, 0x83, 0xC1, 0x80, 0x01, 0x80, 0x01,
-    0x80, 0x01, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
 static const uint8_t EPD_FontUTF8_16x16[] = {
-    0, 16, 16, 18,    /* 起始字符，字体宽度，字体高度，字体个数 */
-    0x00, 0x8F, 0x6F, /* UNICODE索引 - 软 */
-    0xEF, 0xEF, 0xEC, 0xE7, 0xE2, 0xEF, 0x0E, 0xEF, 0xE8, 0x00, 0xEE, 0xDF, 0xEE, 0xDE, 0xFD, 0xFD,
-    0xF3, 0xF3, 0x0F, 0x8F, 0xEC, 0x7F, 0xEF, 0x8F, 0xEB, 0xF3, 0xE7, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF,
-    0x00, 0x78, 0x6C, /* UNICODE索引 - 硬 */
-    0xDF, 0xBF, 0xDE, 0x7F, 0xD8, 0x01, 0xC5, 0xF7, 0xDD, 0xF7, 0xDC, 0x03, 0xFF, 0xFE, 0xB0, 0x0E,
-    0xB6, 0xD5, 0xB6, 0xDB, 0x80, 0x05, 0xB6, 0xDD, 0xB6, 0xDE, 0xB0, 0x1E, 0xBF, 0xFE, 0xFF, 0xFF,
+    EPD_FONT_SORTED, 16, 16, 18, /* 索引已排序，字体宽度，字体高度，字体个数 */
+    0x00, 0x21, 0x03, /* UNICODE索引 - ℃（手动修改） */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xB7, 0xFF, 0xB7, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F,
+    0xF3, 0xE7, 0xEF, 0xFB, 0xEF, 0xFB, 0xEF, 0xFB, 0xEF, 0xF7, 0xE3, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
     0x00, 0x4E, 0xF6, /* UNICODE索引 - 件 */
     0xFF, 0x7F, 0xFE, 0xFF, 0xF9, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFE, 0xBF, 0xF9, 0xBF, 0xC7, 0xBF,
     0xF7, 0xBF, 0xF7, 0xBF, 0x00, 0x00, 0xF7, 0xBF, 0xF7, 0xBF, 0xF7, 0xBF, 0xFF, 0xBF, 0xFF, 0xFF,
-    0x00, 0x72, 0x48, /* UNICODE索引 - 版 */
-    0xFF, 0xFE, 0x80, 0x01, 0xFB, 0x7F, 0xFB, 0x7F, 0x03, 0x00, 0xFB, 0xFE, 0xFF, 0xF9, 0xC0, 0x07,
-    0xDB, 0xFE, 0xD8, 0x7D, 0xDB, 0x9B, 0xBB, 0xE7, 0x3B, 0x9B, 0xB8, 0x7D, 0xFF, 0xFE, 0xFF, 0xFF,
-    0x00, 0x67, 0x2C, /* UNICODE索引 - 本 */
-    0xFF, 0xF7, 0xF7, 0xEF, 0xF7, 0xDF, 0xF7, 0xBF, 0xF7, 0x6F, 0xF4, 0xEF, 0xF3, 0xEF, 0x00, 0x00,
-    0xF3, 0xEF, 0xF4, 0xEF, 0xF7, 0x6F, 0xF7, 0xBF, 0xF7, 0xDF, 0xF7, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF,
-    0x00, 0x7F, 0x16, /* UNICODE索引 - 编 */
-    0xFB, 0xBB, 0xF3, 0x19, 0xCA, 0xBB, 0x39, 0xB7, 0xF3, 0xB5, 0xFF, 0xE3, 0xC0, 0x1F, 0xDB, 0x00,
-    0x5B, 0x6F, 0x9B, 0x01, 0xDB, 0x6F, 0xDB, 0x03, 0xDB, 0x6E, 0xC3, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x8B, 0xD1, /* UNICODE索引 - 译 */
-    0xFD, 0xFF, 0xFD, 0xFF, 0xBD, 0xFF, 0xCC, 0x03, 0xFF, 0xF7, 0xFF, 0xEF, 0xBE, 0xF7, 0x9E, 0xB7,
-    0xAD, 0xB7, 0xB5, 0xB7, 0xBA, 0x00, 0xB5, 0xB7, 0xAD, 0xB7, 0x9E, 0xB7, 0xFE, 0xF7, 0xFF, 0xFF,
-    0x00, 0x65, 0xF6, /* UNICODE索引 - 时 */
-    0xFF, 0xFF, 0xC0, 0x03, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xC0, 0x03, 0xFF, 0xFF, 0xF7, 0xFF,
-    0xF7, 0x7F, 0xF7, 0x9F, 0xF7, 0xFD, 0xF7, 0xFE, 0x00, 0x01, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
-    0x00, 0x95, 0xF4, /* UNICODE索引 - 间 */
-    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xB7, 0x77, 0xB7, 0x77,
-    0xB7, 0x77, 0xB0, 0x07, 0xBF, 0xFF, 0xBF, 0xFD, 0xBF, 0xFE, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x5E, 0x8F, /* UNICODE索引 - 序 */
-    0xFF, 0xFD, 0xFF, 0xF3, 0xC0, 0x0F, 0xDF, 0xFF, 0xDF, 0x7F, 0xDF, 0x7F, 0xD7, 0x7F, 0x57, 0x7D,
-    0x95, 0x7E, 0xD6, 0x01, 0xD5, 0x7F, 0xD3, 0x7F, 0xD7, 0x7F, 0xDF, 0x5F, 0xDF, 0x3F, 0xFF, 0xFF,
+    0x00, 0x4F, 0xE1, /* UNICODE索引 - 信 */
+    0xFF, 0x7F, 0xFE, 0xFF, 0xF9, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDB, 0x60,
+    0xDB, 0x6D, 0x5B, 0x6D, 0x9B, 0x6D, 0xDB, 0x6D, 0xDB, 0x6D, 0xDB, 0x60, 0xDF, 0xFF, 0xFF, 0xFF,
     0x00, 0x52, 0x17, /* UNICODE索引 - 列 */
     0xFF, 0xBF, 0xBF, 0x7E, 0xBC, 0xFD, 0xB3, 0x7B, 0x87, 0xB7, 0xB7, 0xCF, 0xB7, 0x3F, 0xB0, 0xFF,
     0xBF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFD, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
     0x00, 0x53, 0xF7, /* UNICODE索引 - 号 */
     0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0x82, 0x9F, 0xBA, 0x5F, 0xBA, 0xDF, 0xBA, 0xDF, 0xBA, 0xDF,
     0xBA, 0xDD, 0xBA, 0xDE, 0xBA, 0xDD, 0x82, 0xC3, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
-    0x00, 0x4F, 0xE1, /* UNICODE索引 - 信 */
-    0xFF, 0x7F, 0xFE, 0xFF, 0xF9, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xDB, 0x60,
-    0xDB, 0x6D, 0x5B, 0x6D, 0x9B, 0x6D, 0xDB, 0x6D, 0xDB, 0x6D, 0xDB, 0x60, 0xDF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x5E, 0x8F, /* UNICODE索引 - 序 */
+    0xFF, 0xFD, 0xFF, 0xF3, 0xC0, 0x0F, 0xDF, 0xFF, 0xDF, 0x7F, 0xDF, 0x7F, 0xD7, 0x7F, 0x57, 0x7D,
+    0x95, 0x7E, 0xD6, 0x01, 0xD5, 0x7F, 0xD3, 0x7F, 0xD7, 0x7F, 0xDF, 0x5F, 0xDF, 0x3F, 0xFF, 0xFF,
+    0x00, 0x60, 0x01, /* UNICODE索引 - 态 */
+    0xFF, 0x7D, 0xDF, 0x63, 0xDE, 0xFF, 0xDE, 0xFF, 0xDD, 0xC3, 0xDB, 0xFD, 0xD5, 0xFD, 0x0E, 0xBD,
+    0xD7, 0xCD, 0xDB, 0xFD, 0xDD, 0xFD, 0xDE, 0xF1, 0xDE, 0xDF, 0xDF, 0x6F, 0xFF, 0x73, 0xFF, 0xFF,
     0x00, 0x60, 0x6F, /* UNICODE索引 - 息 */
     0xFF, 0xFD, 0xFF, 0xF3, 0xFF, 0xFF, 0xC0, 0x3F, 0xD5, 0x63, 0xD5, 0x7D, 0x95, 0x7D, 0x55, 0x5D,
     0xD5, 0x65, 0xD5, 0x7D, 0xD5, 0x7D, 0xC0, 0x31, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xF3, 0xFF, 0xFF,
+    0x00, 0x65, 0xF6, /* UNICODE索引 - 时 */
+    0xFF, 0xFF, 0xC0, 0x03, 0xDE, 0xF7, 0xDE, 0xF7, 0xDE, 0xF7, 0xC0, 0x03, 0xFF, 0xFF, 0xF7, 0xFF,
+    0xF7, 0x7F, 0xF7, 0x9F, 0xF7, 0xFD, 0xF7, 0xFE, 0x00, 0x01, 0xF7, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF,
+    0x00, 0x67, 0x2C, /* UNICODE索引 - 本 */
+    0xFF, 0xF7, 0xF7, 0xEF, 0xF7, 0xDF, 0xF7, 0xBF, 0xF7, 0x6F, 0xF4, 0xEF, 0xF3, 0xEF, 0x00, 0x00,
+    0xF3, 0xEF, 0xF4, 0xEF, 0xF7, 0x6F, 0xF7, 0xBF, 0xF7, 0xDF, 0xF7, 0xEF, 0xFF, 0xF7, 0xFF, 0xFF,
+    0x00, 0x72, 0x48, /* UNICODE索引 - 版 */
+    0xFF, 0xFE, 0x80, 0x01, 0xFB, 0x7F, 0xFB, 0x7F, 0x03, 0x00, 0xFB, 0xFE, 0xFF, 0xF9, 0xC0, 0x07,
+    0xDB, 0xFE, 0xD8, 0x7D, 0xDB, 0x9B, 0xBB, 0xE7, 0x3B, 0x9B, 0xB8, 0x7D, 0xFF, 0xFE, 0xFF, 0xFF,
     0x00, 0x72, 0xB6, /* UNICODE索引 - 状 */
     0xFF, 0xDF, 0xEF, 0xDF, 0xF3, 0xBF, 0xFF, 0x7F, 0x00, 0x00, 0xFB, 0xFE, 0xFB, 0xFD, 0xFB, 0xF3,
     0xFB, 0x8F, 0x00, 0x7F, 0xFB, 0x9F, 0xFB, 0xE7, 0xBB, 0xFB, 0xCB, 0xFD, 0xFB, 0xFE, 0xFF, 0xFF,
-    0x00, 0x60, 0x01, /* UNICODE索引 - 态 */
-    0xFF, 0x7D, 0xDF, 0x63, 0xDE, 0xFF, 0xDE, 0xFF, 0xDD, 0xC3, 0xDB, 0xFD, 0xD5, 0xFD, 0x0E, 0xBD,
-    0xD7, 0xCD, 0xDB, 0xFD, 0xDD, 0xFD, 0xDE, 0xF1, 0xDE, 0xDF, 0xDF, 0x6F, 0xFF, 0x73, 0xFF, 0xFF,
-    0x00, 0x21, 0x03, /* UNICODE索引 - ℃（手动修改） */
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xB7, 0xFF, 0xB7, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F,
-    0xF3, 0xE7, 0xEF, 0xFB, 0xEF, 0xFB, 0xEF, 0xFB, 0xEF, 0xF7, 0xE3, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x78, 0x6C, /* UNICODE索引 - 硬 */
+    0xDF, 0xBF, 0xDE, 0x7F, 0xD8, 0x01, 0xC5, 0xF7, 0xDD, 0xF7, 0xDC, 0x03, 0xFF, 0xFE, 0xB0, 0x0E,
+    0xB6, 0xD5, 0xB6, 0xDB, 0x80, 0x05, 0xB6, 0xDD, 0xB6, 0xDE, 0xB0, 0x1E, 0xBF, 0xFE, 0xFF, 0xFF,
+    0x00, 0x7F, 0x16, /* UNICODE索引 - 编 */
+    0xFB, 0xBB, 0xF3, 0x19, 0xCA, 0xBB, 0x39, 0xB7, 0xF3, 0xB5, 0xFF, 0xE3, 0xC0, 0x1F, 0xDB, 0x00,
+    0x5B, 0x6F, 0x9B, 0x01, 0xDB, 0x6F, 0xDB, 0x03, 0xDB, 0x6E, 0xC3, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x8B, 0xD1, /* UNICODE索引 - 译 */
+    0xFD, 0xFF, 0xFD, 0xFF, 0xBD, 0xFF, 0xCC, 0x03, 0xFF, 0xF7, 0xFF, 0xEF, 0xBE, 0xF7, 0x9E, 0xB7,
+    0xAD, 0xB7, 0xB5, 0xB7, 0xBA, 0x00, 0xB5, 0xB7, 0xAD, 0xB7, 0x9E, 0xB7, 0xFE, 0xF7, 0xFF, 0xFF,
+    0x00, 0x8F, 0x6F, /* UNICODE索引 - 软 */
+    0xEF, 0xEF, 0xEC, 0xE7, 0xE2, 0xEF, 0x0E, 0xEF, 0xE8, 0x00, 0xEE, 0xDF, 0xEE, 0xDE, 0xFD, 0xFD,
+    0xF3, 0xF3, 0x0F, 0x8F, 0xEC, 0x7F, 0xEF, 0x8F, 0xEB, 0xF3, 0xE7, 0xFD, 0xFF, 0xFE, 0xFF, 0xFF,
+    0x00, 0x95, 0xF4, /* UNICODE索引 - 间 */
+    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xB7, 0x77, 0xB7, 0x77,
+    0xB7, 0x77, 0xB0, 0x07, 0xBF, 0xFF, 0xBF, 0xFD, 0xBF, 0xFE, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
     0x00, 0xFF, 0x05, /* UNICODE索引 - ％（手动修改） */
     0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xEF, 0x73, 0xF0, 0xCF, 0xFE, 0x3F, 0xF9, 0x87, 0xE7, 0x7B,
     0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
@@ -1638,622 +1660,6 @@ static const uint8_t EPD_Image_ArrowUp_12x8[] = {
     12, 0, 8, /* 图像宽度，图像宽度，图像高度*/
     0xF9, 0xF1, 0xE1, 0xC1, 0x81, 0x01, 0x01, 0x81, 0xC1, 0xE1, 0xF1, 0xF9};
 
-static const uint8_t EPD_Image_Welcome_296x96[] = {
-    255, 41, 96, /* 图像宽度，图像宽度，图像高度*/
-    0xF0, 0x03, 0xBB, 0xDD, 0xC0, 0x0F, 0x9C, 0xF7, 0xDD, 0xFB, 0xFF, 0xFF, 0xF7, 0x77, 0xDD, 0xBD,
-    0xDD, 0xDF, 0x7A, 0xF7, 0xDD, 0xDB, 0x80, 0x0F, 0xF7, 0x77, 0x80, 0x6D, 0xDD, 0xDF, 0x76, 0xF6,
-    0x00, 0x1B, 0xBF, 0xFF, 0xF0, 0x03, 0xBF, 0xDD, 0xC0, 0x0F, 0x6E, 0xF7, 0xDB, 0xFB, 0xA8, 0x7F,
-    0xFF, 0xFF, 0xA0, 0x3D, 0xFF, 0xFF, 0x9E, 0xF7, 0xFF, 0xDB, 0xAB, 0x7F, 0xFD, 0xFF, 0xBF, 0xDD,
-    0xF7, 0xFF, 0xFF, 0xF7, 0x9B, 0xDB, 0xAB, 0x7F, 0xFD, 0xBF, 0x80, 0x6D, 0xF6, 0xFF, 0x81, 0xF7,
-    0xB8, 0xBB, 0xAB, 0x7F, 0xFD, 0xCD, 0xFF, 0xFD, 0xF7, 0x37, 0x7E, 0xF6, 0xA3, 0x7B, 0xAB, 0x7F,
-    0xFD, 0xFD, 0xC0, 0x7D, 0xF7, 0xF7, 0x7E, 0xF7, 0x3B, 0x7B, 0xA8, 0x6F, 0xE0, 0x01, 0xFF, 0xED,
-    0x80, 0x07, 0x7E, 0xF7, 0xB8, 0xBB, 0xBF, 0xEF, 0xFD, 0xFF, 0x00, 0x0D, 0xF7, 0xFF, 0x81, 0xF7,
-    0x9B, 0xDB, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xEF, 0xED, 0xFF, 0xFF, 0xFD, 0xF7, 0x7F, 0xFB, 0x80, 0x1F, 0xFD, 0xDF, 0x00, 0xAD,
-    0xF7, 0x7F, 0xF3, 0xF7, 0x7F, 0xFB, 0xBB, 0xBF, 0xE2, 0xDF, 0x6A, 0xAD, 0x8B, 0x7F, 0xCF, 0xF7,
-    0x7F, 0xFB, 0xBB, 0xBF, 0xFA, 0x01, 0x6A, 0xAD, 0xE8, 0x07, 0xFF, 0xB7, 0x7F, 0xFB, 0x80, 0x1F,
-    0xFA, 0xDB, 0x6A, 0xAD, 0xEB, 0x6F, 0xFF, 0xB7, 0x00, 0x1B, 0xFF, 0xFF, 0xFA, 0xD7, 0x20, 0x0D,
-    0xEB, 0x5C, 0x00, 0x37, 0x7F, 0xFB, 0xEF, 0xFF, 0xFF, 0xFF, 0x4A, 0xAD, 0xFF, 0xFF, 0xFF, 0xF7,
-    0x6F, 0xFB, 0xED, 0xFF, 0xFC, 0x0F, 0x6A, 0xAD, 0xF0, 0x3F, 0xFF, 0xF7, 0x77, 0xFB, 0xEE, 0x6F,
-    0xFD, 0xDF, 0x6A, 0xAD, 0xF7, 0x7F, 0xDF, 0xF7, 0x7B, 0xFB, 0xEF, 0xEF, 0xE0, 0x01, 0x00, 0xAD,
-    0x80, 0x07, 0xE7, 0xF7, 0x7C, 0xFB, 0x00, 0x0F, 0xFD, 0xDF, 0xEF, 0xED, 0xF7, 0x7F, 0xF9, 0xF7,
-    0x7F, 0xFB, 0xEF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFD, 0xF0, 0x3F, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE6, 0xDD, 0xFF, 0xFE, 0x00, 0x77, 0xFF, 0xFB, 0xEE, 0xFF, 0xF6, 0xFF, 0xD4, 0xDD,
-    0xFF, 0xFE, 0xEE, 0xF7, 0xBF, 0xFB, 0xEE, 0xEF, 0xF6, 0xFF, 0x32, 0xBD, 0xE0, 0x06, 0xEE, 0xF6,
-    0x7F, 0xFB, 0x00, 0x0F, 0xF5, 0x01, 0xEE, 0xBD, 0xEF, 0xFE, 0x00, 0x77, 0xBF, 0xFB, 0xED, 0xFF,
-    0xE0, 0x57, 0xDF, 0xFD, 0xEF, 0x7F, 0xFF, 0xF6, 0x7F, 0xFB, 0xFF, 0xEF, 0xFF, 0x57, 0xDA, 0x0D,
-    0xEC, 0xFF, 0xBF, 0xF7, 0xFF, 0xFB, 0xCD, 0xEF, 0xFF, 0x57, 0xDA, 0xDD, 0x83, 0xFF, 0xB7, 0xF7,
-    0xEF, 0xFB, 0xDC, 0x5F, 0xE3, 0x57, 0x02, 0xDD, 0xED, 0xFF, 0xB9, 0xB6, 0xEF, 0xFB, 0x51, 0xBF,
-    0xF5, 0x55, 0xDA, 0xDD, 0xEE, 0x77, 0xBF, 0xB7, 0x60, 0x3B, 0x9D, 0xBF, 0xF5, 0x01, 0xDA, 0x0D,
-    0xEF, 0xF4, 0x00, 0x37, 0xFF, 0x7B, 0xDC, 0x5F, 0xED, 0xFF, 0xDF, 0xFD, 0xE0, 0x07, 0xBF, 0xF7,
-    0xEB, 0xDB, 0xCD, 0xEF, 0xF9, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF6, 0x19, 0xDB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0xDD, 0xFF, 0xFF, 0xFF, 0xF6, 0xFA, 0xBB, 0xBF, 0xFF, 0xFF, 0x7F, 0x82, 0xDD,
-    0xFB, 0xF7, 0xFF, 0xF6, 0xFB, 0x7B, 0xBF, 0xFF, 0xF5, 0x41, 0xAA, 0xBD, 0x8B, 0xF7, 0xF2, 0xF6,
-    0x1A, 0xBB, 0xBF, 0xFF, 0xF6, 0x5B, 0xAA, 0x7D, 0xAA, 0x07, 0xF1, 0xF7, 0xE9, 0xDB, 0xBF, 0xFF,
-    0xE7, 0x5B, 0xAA, 0xFD, 0xAA, 0xF7, 0xFF, 0xF7, 0xEF, 0xDB, 0x80, 0x0F, 0xF6, 0x5B, 0x80, 0x0D,
-    0x8A, 0xF7, 0xFF, 0xF7, 0xFF, 0xFB, 0xBF, 0xFF, 0xF5, 0x41, 0xAA, 0xFD, 0xA0, 0xC7, 0xFF, 0xF7,
-    0xEF, 0xDB, 0xB7, 0xFF, 0xFF, 0x7F, 0xAA, 0x7D, 0x8A, 0xF7, 0xFF, 0xF6, 0x2F, 0xDB, 0xBB, 0xFF,
-    0xF0, 0x01, 0xAA, 0xBD, 0xAA, 0xF7, 0xFF, 0xF6, 0xA8, 0x1B, 0xBD, 0xFF, 0xF7, 0xF7, 0x82, 0xDD,
-    0xAA, 0x07, 0xFF, 0xF6, 0xAB, 0xDB, 0xBE, 0x7F, 0xF6, 0x77, 0xFE, 0xDD, 0x8B, 0xF7, 0xFF, 0xF6,
-    0x2B, 0xDB, 0xBF, 0xFF, 0xF1, 0x8F, 0xFF, 0xFD, 0xFB, 0xF7, 0xFF, 0xF6, 0x83, 0x1B, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xFD, 0xFF, 0xFF, 0x7B, 0xF6, 0x2B, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0D,
-    0xFF, 0xFF, 0x77, 0xF6, 0xAB, 0xDB, 0xDF, 0xFF, 0xFB, 0xFB, 0x3F, 0x7D, 0xEE, 0xFF, 0x60, 0x36,
-    0xA8, 0x1B, 0x3F, 0xFF, 0xFB, 0xF7, 0xFE, 0xFD, 0xED, 0xFF, 0x1F, 0xF6, 0x2F, 0xDB, 0xDF, 0xFF,
-    0xFB, 0xCD, 0x80, 0x0D, 0xE8, 0x04, 0x7F, 0xB7, 0xEF, 0xDB, 0x3F, 0xFF, 0xFA, 0x3D, 0xAB, 0x7D,
-    0xE2, 0xBF, 0x7B, 0xB7, 0xFF, 0xFB, 0xFF, 0xFF, 0xE1, 0xBD, 0xA8, 0x1D, 0x8A, 0xBF, 0x7B, 0xB7,
-    0xFF, 0xFB, 0xBF, 0xFF, 0xFB, 0xBD, 0x2B, 0x7D, 0xEA, 0xBF, 0x40, 0x37, 0xBF, 0xFB, 0xBF, 0xFF,
-    0xFB, 0x81, 0xA8, 0x1D, 0xEA, 0xBF, 0x7B, 0xB6, 0x7F, 0xFB, 0xBF, 0xFF, 0xFB, 0xBD, 0xAB, 0x6D,
-    0xEA, 0xBF, 0x7B, 0xB7, 0xBF, 0xFB, 0xBF, 0xFF, 0xFB, 0xBD, 0x88, 0x0D, 0xEA, 0xB7, 0x7F, 0xB6,
-    0x7F, 0xFB, 0x80, 0x0F, 0xFB, 0xBD, 0xFF, 0xFD, 0xE8, 0x07, 0xFF, 0xF7, 0xFF, 0xFB, 0xBF, 0xFF,
-    0xFB, 0xFD, 0xBE, 0x0D, 0xEF, 0xFF, 0xFF, 0xB7, 0xDD, 0xFB, 0xB7, 0xFF, 0xFF, 0xFF, 0xBE, 0xFD,
-    0xFF, 0xFF, 0x80, 0x37, 0xDD, 0xDB, 0xBB, 0xFF, 0xFE, 0xFF, 0xA2, 0xFD, 0xFD, 0xFF, 0xFF, 0xB6,
-    0x00, 0x1B, 0xBD, 0xFF, 0xF8, 0x01, 0xAA, 0x8D, 0xED, 0xFC, 0x00, 0x77, 0xDB, 0xFB, 0xBE, 0x7F,
-    0xE7, 0xFD, 0xAA, 0xAD, 0xDA, 0x07, 0xEF, 0x77, 0xFF, 0xDB, 0xBF, 0xFF, 0xF0, 0x1B, 0x2A, 0xAD,
-    0x8A, 0xAF, 0xEF, 0x77, 0x9B, 0xDB, 0xFF, 0xFF, 0xF7, 0x87, 0xAA, 0xAD, 0xD6, 0xAF, 0xFF, 0xF7,
-    0xB8, 0xBB, 0xFF, 0xFF, 0xF7, 0xFB, 0xAA, 0x8D, 0xD6, 0x0C, 0x00, 0x76, 0xA3, 0x7B, 0xDF, 0xFF,
-    0xF0, 0x1D, 0xA2, 0xFD, 0xD6, 0xAF, 0xEF, 0xB7, 0x3B, 0x7B, 0x3F, 0xFF, 0xFF, 0xFF, 0xBE, 0xED,
-    0xCA, 0xAF, 0xDF, 0xB7, 0xB8, 0xBB, 0xDF, 0xFF, 0xF8, 0x0F, 0xBE, 0x0D, 0xDA, 0x07, 0x3E, 0x37,
-    0x9B, 0xDB, 0x3F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD, 0xFD, 0xFF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xE0, 0x01, 0xFF, 0xFD, 0xFD, 0xFE, 0x00, 0x77, 0xCD, 0xFB, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFE, 0xEE, 0xF6, 0x20, 0x1B, 0xB6, 0xFF, 0xFF, 0xFD, 0xFC, 0xFD, 0xFB, 0xFE, 0xEE, 0xF7,
-    0xAD, 0xBB, 0xB5, 0xFF, 0xFD, 0xFB, 0xFB, 0x7D, 0xE0, 0x06, 0x00, 0x77, 0xAD, 0xDB, 0x80, 0x0F,
-    0xF5, 0xF7, 0xFB, 0x7D, 0x9F, 0xFF, 0xFF, 0xF7, 0x7B, 0xDB, 0x75, 0xFF, 0xF9, 0xEF, 0xFC, 0xFD,
-    0xFB, 0xF7, 0xBF, 0xF7, 0x78, 0x1B, 0xF6, 0xFF, 0xFD, 0x9F, 0xFF, 0xFD, 0xE5, 0xCF, 0xB7, 0xF7,
-    0x03, 0xDB, 0xC0, 0x1F, 0xFC, 0x7F, 0xFF, 0xFD, 0x9C, 0x3F, 0xB9, 0xB7, 0x7B, 0xDB, 0xDF, 0xBF,
-    0xE1, 0xBF, 0xFF, 0xFD, 0xFD, 0xFF, 0xBF, 0xB7, 0x7B, 0xDB, 0xDF, 0xBF, 0xFD, 0xCD, 0xFF, 0xFD,
-    0xFD, 0xF4, 0x00, 0x37, 0x00, 0x1B, 0xDF, 0xBF, 0xFD, 0xFD, 0xFF, 0xFD, 0x9D, 0xF7, 0xBF, 0xF7,
-    0xFF, 0xDB, 0xC0, 0x1F, 0xFD, 0xFD, 0xFF, 0xFD, 0xE4, 0x0F, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFC, 0x03, 0xFF, 0xFD, 0xFB, 0xFF, 0xFF, 0xF7, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFD, 0x80, 0x37, 0x60, 0x7B, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xF7,
-    0x6E, 0xFB, 0x3F, 0xFF, 0xF7, 0x7B, 0xFF, 0xFD, 0xE0, 0x1F, 0x80, 0xF7, 0x6E, 0xFB, 0xDF, 0xFF,
-    0xFB, 0xB7, 0xFF, 0xFD, 0xED, 0xBD, 0xB6, 0xF7, 0x6E, 0xFB, 0x3F, 0xFF, 0xFF, 0xED, 0xFF, 0xFD,
-    0xED, 0xBD, 0xB6, 0xF7, 0x6E, 0xFB, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFD, 0xED, 0xBD, 0xB6, 0xF7,
-    0x60, 0xFB, 0xF7, 0xFF, 0xE0, 0xBD, 0xFF, 0xFD, 0x80, 0x0D, 0xB6, 0xF7, 0x7F, 0xDB, 0x77, 0xFF,
-    0xEA, 0x81, 0xFF, 0xFD, 0xED, 0xB5, 0x80, 0xB7, 0x7F, 0xDB, 0xB0, 0x1F, 0xEA, 0xBD, 0xFF, 0xFD,
-    0xED, 0xB5, 0xFF, 0xB7, 0x00, 0x1B, 0xFF, 0xBF, 0xEA, 0x81, 0xFF, 0xFD, 0xED, 0xB4, 0x00, 0x37,
-    0x7F, 0xFB, 0xF5, 0xEF, 0xE0, 0xBD, 0xFF, 0xFD, 0xE0, 0x37, 0xFF, 0xF7, 0xFF, 0xFB, 0x0C, 0xEF,
-    0xFF, 0x81, 0xFF, 0xFD, 0xFF, 0xF7, 0xFF, 0xF7, 0xFF, 0xFB, 0x7D, 0x5F, 0xFF, 0xFD, 0xFF, 0xFD,
-    0xFF, 0xC7, 0x00, 0x37, 0x00, 0x7B, 0x7D, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x7F, 0xF7,
-    0xFE, 0xDB, 0x0D, 0x5F, 0xFF, 0xED, 0xFF, 0xFD, 0xCE, 0xFF, 0x7B, 0xF7, 0xFD, 0xDB, 0xF4, 0xEF,
-    0xF0, 0x13, 0xFF, 0xFD, 0xDE, 0xFF, 0x67, 0xF7, 0x7B, 0xBB, 0xF7, 0xEF, 0xF7, 0xFF, 0xFF, 0xFD,
-    0xD5, 0x04, 0x1F, 0xF7, 0x9F, 0xBB, 0xFF, 0xFF, 0xF5, 0x13, 0xFF, 0xFD, 0xCD, 0x6F, 0x6F, 0xF7,
-    0xFF, 0x7B, 0xF7, 0xEF, 0xF5, 0x5D, 0xFF, 0xFD, 0xDB, 0x6F, 0x73, 0xB7, 0xFC, 0xFB, 0x17, 0xEF,
-    0xF5, 0x15, 0xFF, 0xFD, 0x97, 0x6F, 0x7F, 0xB6, 0x03, 0x7B, 0x54, 0x0F, 0xF7, 0xE9, 0xFF, 0xFD,
-    0xDB, 0x6F, 0x00, 0x37, 0xFF, 0xBB, 0x55, 0xEF, 0xE0, 0xDD, 0xFF, 0xFD, 0xCD, 0x6F, 0xFF, 0xF7,
-    0xFF, 0xDB, 0x15, 0xEF, 0xF7, 0x39, 0xFF, 0xFD, 0xD5, 0x07, 0xFF, 0xF7, 0xFF, 0xFB, 0x41, 0x8F,
-    0xE4, 0xD7, 0xFF, 0xFD, 0xDE, 0xFE, 0xFF, 0xB7, 0xDD, 0xFB, 0x15, 0xEF, 0xF7, 0x89, 0xFF, 0xFD,
-    0xCE, 0xFE, 0x81, 0xB7, 0xDD, 0xDB, 0x55, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0xAA, 0xB6,
-    0x00, 0x1B, 0x54, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0xAB, 0x77, 0xDB, 0xFB, 0x17, 0xEF,
-    0xF0, 0x01, 0xFF, 0xFD, 0xFF, 0xFE, 0xAB, 0x77, 0xDB, 0xFB, 0xF7, 0xEF, 0xF7, 0xFD, 0xFF, 0xFD,
-    0xFE, 0x5E, 0x00, 0xB7, 0x7F, 0xFB, 0xFF, 0xFF, 0xF5, 0xF5, 0xFF, 0xFD, 0xFE, 0x3E, 0xAB, 0xB7,
-    0x7F, 0xDB, 0xFF, 0xFF, 0xF6, 0xED, 0xFF, 0xFD, 0xFF, 0xFE, 0xAB, 0xB7, 0x7F, 0xDB, 0xDF, 0xFF,
-    0xF7, 0x5D, 0xFF, 0xFD, 0xFF, 0xFE, 0xAB, 0xB7, 0x00, 0x1B, 0x3F, 0xFF, 0xF7, 0xBD, 0xFF, 0xFD,
-    0xFF, 0xFE, 0x83, 0xB7, 0x7F, 0xFB, 0xDF, 0xFF, 0xF7, 0x5D, 0xFF, 0xFD, 0xFF, 0xFE, 0xFF, 0xB7,
-    0x7F, 0xFB, 0x3F, 0xFF, 0xF6, 0xED, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xF5, 0xF5, 0xFF, 0xFD, 0xFF, 0xFF, 0xBB, 0xF7, 0xFB, 0xFB, 0xEE, 0xFF, 0xF7, 0xFD, 0xFF, 0xFD,
-    0xFF, 0xFF, 0xBB, 0xB7, 0x7B, 0xDB, 0xEE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFC, 0x00, 0x37,
-    0x7B, 0x3B, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xB7, 0xF7, 0x00, 0xFB, 0xED, 0xFF,
-    0xFE, 0xFB, 0xFF, 0xFD, 0xEF, 0x7F, 0xBD, 0xB7, 0x7B, 0xFB, 0xFF, 0xEF, 0xE0, 0x03, 0xFF, 0xFD,
-    0xEE, 0xFF, 0x41, 0x77, 0x7B, 0xFB, 0xCD, 0xEF, 0xFE, 0xF7, 0xFF, 0xFD, 0xEC, 0x04, 0xDC, 0xF7,
-    0x7B, 0xFB, 0xDC, 0x5F, 0xFF, 0xFF, 0xFF, 0xFD, 0xE3, 0xFE, 0x81, 0xF7, 0x00, 0x1B, 0x51, 0xBF,
-    0xFA, 0x1B, 0xFF, 0xFD, 0x8F, 0xF6, 0x5C, 0xF7, 0x7B, 0xFB, 0x9D, 0xBF, 0xFA, 0xDB, 0xFF, 0xFD,
-    0xEF, 0x77, 0xC1, 0x77, 0x7B, 0xFB, 0xDC, 0x5F, 0xFA, 0x15, 0xFF, 0xFD, 0xEF, 0x77, 0xFD, 0xB7,
-    0xFB, 0xFB, 0xCD, 0xEF, 0xFB, 0xFB, 0xFF, 0xFD, 0xE8, 0x07, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xE0, 0x07, 0xFF, 0xFD, 0xEF, 0x77, 0x00, 0xF7, 0xFF, 0xDB, 0xE6, 0xFF, 0xFB, 0xCB, 0xFF, 0xFD,
-    0xEF, 0x77, 0x6D, 0xF7, 0xDD, 0xDB, 0x10, 0x0F, 0xEB, 0x31, 0xFF, 0xFD, 0xEF, 0xF7, 0x6D, 0xF7,
-    0xDD, 0xDB, 0xD6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x6D, 0xF7, 0xDD, 0xDB, 0xD6, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xE0, 0x1C, 0x00, 0x76, 0xDD, 0xDB, 0xBD, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xED, 0xBF, 0x6D, 0xB7, 0x40, 0x1B, 0xBC, 0x0F, 0xFF, 0x97, 0xFF, 0xFD, 0xED, 0xBF, 0x6D, 0xB7,
-    0xDD, 0xDB, 0x81, 0xEF, 0xFF, 0x8F, 0xFF, 0xFD, 0xED, 0xBF, 0x6D, 0xB7, 0xDD, 0xDB, 0xBD, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0x0F, 0x01, 0xB7, 0xDD, 0xDB, 0xBD, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xED, 0xB7, 0xFF, 0xB7, 0xDD, 0xDB, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0xED, 0xB7, 0xFE, 0x37,
-    0xFF, 0xDB, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 0xED, 0xB7, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xE0, 0x36, 0xEF, 0x77, 0x6E, 0xDB, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xF7, 0x76, 0xF7, 0x66, 0xDB, 0xB0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xC7, 0xF7, 0xF7,
-    0x6A, 0xBB, 0xB7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x76, 0x2E, 0x7B, 0xB7, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xEF, 0xB7, 0x66, 0xFB, 0xB7, 0x7F, 0xEE, 0xFF, 0xFF, 0xFD,
-    0xDD, 0xEF, 0xDF, 0xB7, 0x68, 0x1B, 0xB7, 0x7F, 0xF6, 0x01, 0xFF, 0xFD, 0xEE, 0xDC, 0x00, 0xB7,
-    0x6E, 0xFB, 0xB0, 0x7F, 0xFF, 0xFB, 0xFF, 0xFD, 0xFE, 0xFF, 0xBF, 0xB6, 0x1A, 0x7B, 0xBF, 0xEF,
-    0xF7, 0x7F, 0xFF, 0xFD, 0xE0, 0x0F, 0x7D, 0xB7, 0x56, 0xBB, 0xBF, 0xEF, 0xF5, 0x01, 0xFF, 0xFD,
-    0xFD, 0xF7, 0x01, 0xB7, 0x5E, 0xDB, 0x80, 0x0F, 0xF5, 0x57, 0xFF, 0xFD, 0xFB, 0xF7, 0xFF, 0x37,
-    0x7E, 0xDB, 0xBF, 0xFF, 0xE0, 0x57, 0xFF, 0xFD, 0x80, 0x17, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xF5, 0x57, 0xFF, 0xFD, 0xF7, 0xF7, 0xFF, 0xB7, 0xFE, 0xFB, 0xFF, 0xFF, 0xF5, 0x55, 0xFF, 0xFD,
-    0xEF, 0xB7, 0xFE, 0x77, 0x82, 0xFB, 0x80, 0x3F, 0xF5, 0x01, 0xFF, 0xFD, 0xE0, 0x36, 0x01, 0xF6,
-    0xAA, 0xFB, 0xFF, 0x6F, 0xF7, 0x7F, 0xFF, 0xFD, 0xFF, 0xE6, 0xDF, 0xF7, 0x2A, 0xFB, 0xFE, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0xD8, 0x37, 0xAA, 0xFB, 0xBD, 0xDF, 0xEE, 0xFD, 0xFF, 0xFD,
-    0xCF, 0x76, 0xDB, 0x77, 0x80, 0x1B, 0xCF, 0xDF, 0xF6, 0x03, 0xFF, 0xFD, 0xDF, 0x76, 0xDB, 0x77,
-    0xAA, 0xFB, 0xFF, 0xBF, 0xFF, 0xDD, 0xFF, 0xFD, 0xDB, 0x6D, 0xDB, 0x77, 0x2A, 0xFB, 0xFE, 0x7F,
-    0xF0, 0x05, 0xFF, 0xFD, 0xDB, 0x1D, 0xDB, 0x76, 0xAA, 0xFB, 0x01, 0xBF, 0xF6, 0xB5, 0xFF, 0xFD,
-    0xDB, 0x7D, 0xDB, 0x77, 0x82, 0xFB, 0xFF, 0xDF, 0xF0, 0x85, 0xFF, 0xFD, 0x9B, 0x7F, 0xD8, 0x37,
-    0xFE, 0xFB, 0xFF, 0xEF, 0xFF, 0x7D, 0xFF, 0xFD, 0xDB, 0x7F, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xF5, 0x6D, 0xFF, 0xFD, 0xDB, 0x0E, 0xFD, 0xF7, 0xFF, 0xFB, 0xB0, 0xEF, 0xE6, 0x01, 0xFF, 0xFD,
-    0xDB, 0x76, 0xFD, 0xF7, 0xFF, 0xFB, 0xB6, 0xEF, 0xF5, 0x6D, 0xFF, 0xFD, 0xDF, 0x76, 0xFB, 0xF7,
-    0xF9, 0x7B, 0x86, 0x1F, 0xFF, 0x7D, 0xFF, 0xFD, 0xCF, 0x66, 0xF7, 0xF7, 0xF8, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0xEF, 0xF7, 0xFF, 0xFB, 0xF8, 0x6F, 0xFE, 0xFD, 0xFF, 0xFD,
-    0xFB, 0xF6, 0xC0, 0x37, 0xFF, 0xFB, 0x0B, 0x6F, 0xFC, 0x1D, 0xFF, 0xFD, 0xFB, 0xB6, 0x3F, 0xF7,
-    0xFF, 0xFB, 0x6B, 0x6F, 0xFA, 0xDB, 0xFF, 0xFD, 0xF5, 0xB6, 0xEF, 0xF7, 0xFF, 0xFB, 0x60, 0x0F,
-    0xE6, 0xD7, 0xFF, 0xFD, 0xED, 0xB6, 0xF7, 0xF7, 0xFF, 0xFB, 0x6B, 0x6F, 0xF6, 0xCF, 0xFF, 0xFD,
-    0xDD, 0xB6, 0xFB, 0xF7, 0xFF, 0xFB, 0x0B, 0x4F, 0xF6, 0x1F, 0xFF, 0xFD, 0xBC, 0x06, 0xFD, 0xF7,
-    0xFF, 0xFB, 0xF8, 0x6F, 0xF4, 0xC3, 0xFF, 0xFD, 0xDD, 0xB7, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xF2, 0xDD, 0xFF, 0xFD, 0xED, 0xB7, 0x3B, 0xF7, 0xFF, 0xFB, 0xE7, 0xFF, 0xFE, 0xDD, 0xFF, 0xFD,
-    0xF5, 0xB5, 0x6A, 0x37, 0xDF, 0xDB, 0x94, 0x1F, 0xFE, 0x1D, 0xFF, 0xFD, 0xFB, 0xB5, 0x2A, 0xF7,
-    0xDF, 0xBB, 0xD5, 0xFF, 0xFF, 0xF9, 0xFF, 0xFD, 0xFB, 0xF5, 0x2A, 0xF7, 0xDF, 0x7B, 0x00, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD, 0x7A, 0x36, 0xDE, 0xBB, 0xD5, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFC, 0x08, 0xF7, 0x5D, 0xDB, 0xD4, 0x1F, 0xFD, 0xD7, 0xFF, 0xFD, 0xEE, 0xDD, 0x7A, 0x37,
-    0xDB, 0xDB, 0xF7, 0xFF, 0xF9, 0xD7, 0xFF, 0xFD, 0xEA, 0xBD, 0x2A, 0xF7, 0xD7, 0xDB, 0xC0, 0x7F,
-    0xE4, 0x57, 0xFF, 0xFD, 0x80, 0x05, 0x2A, 0xB7, 0xCF, 0xDB, 0xFF, 0xEF, 0xF5, 0x57, 0xFF, 0xFD,
-    0xEA, 0xBD, 0x6A, 0x37, 0xDF, 0xDB, 0xFF, 0xEF, 0xF5, 0x01, 0xFF, 0xFD, 0xEE, 0xDF, 0x3B, 0xF7,
-    0xFF, 0xDB, 0x00, 0x0F, 0xE1, 0x7F, 0xFF, 0xFD, 0xDB, 0x7F, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xF5, 0x01, 0xFF, 0xFD, 0xDB, 0x7E, 0xFB, 0xB7, 0xFF, 0xDB, 0xBF, 0xEF, 0xF5, 0x57, 0xFF, 0xFD,
-    0xC0, 0x0E, 0x8B, 0xB7, 0xFF, 0x3B, 0xA0, 0x6F, 0xF4, 0x57, 0xFF, 0xFD, 0xB6, 0xF6, 0xAA, 0xB7,
-    0x00, 0xFB, 0xAA, 0xAF, 0xF5, 0xD7, 0xFF, 0xFD, 0xB6, 0xF6, 0xA8, 0xB7, 0x6F, 0xFB, 0xAA, 0xDF,
-    0xFD, 0xD7, 0xFF, 0xFD, 0xFE, 0xC6, 0x03, 0x77, 0x6C, 0x1B, 0xAA, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFE, 0xAB, 0x77, 0x6D, 0xBB, 0x80, 0x2F, 0xFE, 0xFD, 0xFF, 0xFD, 0xFF, 0xDE, 0x0B, 0x77,
-    0x6D, 0xBB, 0xAA, 0xEF, 0xEE, 0xFB, 0xFF, 0xFD, 0xFF, 0xBE, 0xAA, 0xB6, 0xED, 0xBB, 0xAA, 0xEF,
-    0xF6, 0x07, 0xFF, 0xFD, 0xC0, 0x7E, 0xA9, 0xB6, 0xED, 0xBB, 0xAA, 0xEF, 0xFF, 0xFB, 0xFF, 0xFD,
-    0xDB, 0xDE, 0x8B, 0xB6, 0xED, 0xBB, 0xA0, 0xEF, 0xFF, 0xF5, 0xFF, 0xFD, 0xDA, 0xDE, 0xFB, 0xF7,
-    0xEC, 0x1B, 0xBF, 0xEF, 0xF0, 0x0D, 0xFF, 0xFD, 0xDA, 0xEF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xF6, 0xFD, 0xFF, 0xFD, 0xDB, 0x6F, 0xBF, 0xB7, 0xED, 0xFB, 0xFB, 0xDF, 0xF6, 0xFD, 0xFF, 0xFD,
-    0xD8, 0xF6, 0x82, 0xB7, 0xED, 0xBB, 0xAA, 0xBF, 0xEE, 0x05, 0xFF, 0xFD, 0xDB, 0x7E, 0xAA, 0xB7,
-    0xDD, 0x3B, 0xB2, 0xEF, 0xEE, 0xFD, 0xFF, 0xFD, 0xC3, 0xBE, 0xAA, 0xB7, 0xAC, 0xBB, 0x38, 0x0F,
-    0xFE, 0xFD, 0xFF, 0xFD, 0xFF, 0xDE, 0xAA, 0xB7, 0x6D, 0xBB, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFE, 0x00, 0x36, 0xED, 0xBB, 0xAA, 0xAF, 0xFB, 0x7D, 0xFF, 0xFD, 0xFF, 0xF5, 0xAA, 0xB7,
-    0x6D, 0xBB, 0xFF, 0xDF, 0xFB, 0x6B, 0xFF, 0xFD, 0xFF, 0xCD, 0xAA, 0xB7, 0xAD, 0xBB, 0x80, 0x3F,
-    0xE0, 0x0F, 0xFF, 0xFD, 0xC0, 0x3D, 0xAA, 0xB7, 0xDD, 0x3B, 0xB7, 0xFF, 0xFA, 0xFB, 0xFF, 0xFD,
-    0xDB, 0xFD, 0x82, 0xB7, 0xED, 0x9B, 0xB0, 0x0F, 0xFF, 0xED, 0xFF, 0xFD, 0xDB, 0x07, 0xBF, 0xB7,
-    0xED, 0xFB, 0x77, 0xFF, 0xFA, 0x9F, 0xFF, 0xFD, 0xDB, 0x6F, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xE0, 0x7B, 0xFF, 0xFD, 0xDB, 0x6F, 0xEF, 0x77, 0xFD, 0xDB, 0xFD, 0xFF, 0xFB, 0xBD, 0xFF, 0xFD,
-    0xBB, 0x6E, 0xAA, 0xF7, 0x06, 0xDB, 0xFD, 0xFF, 0xF8, 0x3F, 0xFF, 0xFD, 0xBB, 0x6E, 0xCB, 0xB7,
-    0x57, 0x5B, 0xFD, 0xFF, 0xFF, 0xDB, 0xFF, 0xFD, 0xBB, 0x6C, 0xE0, 0x37, 0x50, 0x1B, 0xFD, 0xFF,
-    0xFF, 0x0D, 0xFF, 0xFD, 0xFB, 0x06, 0xCB, 0xF7, 0x57, 0xDB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xFE, 0xAA, 0xB7, 0x57, 0xDB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x77,
-    0x57, 0xDB, 0xFD, 0xFF, 0xEE, 0xFB, 0xFF, 0xFD, 0xDF, 0xFE, 0x00, 0xF7, 0x50, 0x1B, 0xFD, 0xFF,
-    0xF7, 0x77, 0xFF, 0xFD, 0xD8, 0x1E, 0xDF, 0xF7, 0x57, 0x5B, 0xFD, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD,
-    0xDB, 0xBE, 0xC0, 0x37, 0x06, 0xDB, 0xFD, 0xFF, 0xE0, 0x03, 0xFF, 0xFD, 0xDB, 0xBD, 0xDF, 0xF7,
-    0xFD, 0xDB, 0xFD, 0xFF, 0xEF, 0xFB, 0xFF, 0xFD, 0xDB, 0xBF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xEC, 0x17, 0xFF, 0xFD, 0xDB, 0xBD, 0xDF, 0xF7, 0xEF, 0xBB, 0xBF, 0xBF, 0xE9, 0x5D, 0xFF, 0xFD,
-    0xD8, 0x3E, 0xC0, 0x77, 0xEF, 0x7B, 0xDF, 0x7F, 0xE5, 0x41, 0xFF, 0xFD, 0xDF, 0xF7, 0xFE, 0xF7,
-    0x6C, 0xFB, 0xFE, 0xEF, 0xED, 0x5F, 0xFF, 0xFD, 0xDF, 0xF7, 0xFF, 0xB7, 0x6F, 0xFB, 0xFB, 0xDF,
-    0xEC, 0x17, 0xFF, 0xFD, 0xC0, 0x04, 0x00, 0x77, 0x6F, 0xDB, 0xE7, 0xBF, 0xEF, 0xFB, 0xFF, 0xFD,
-    0xDF, 0xFD, 0xEF, 0xF7, 0x60, 0x1B, 0x1E, 0x7F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD, 0xA8, 0xF7,
-    0x6F, 0xFB, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD, 0x0A, 0xF7, 0x6F, 0xFB, 0xDE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xC0, 0x1D, 0xA8, 0xB7, 0x6D, 0xFB, 0xDF, 0xBF, 0xFF, 0x97, 0xFF, 0xFD,
-    0xFF, 0xB5, 0xEF, 0xB7, 0xEE, 0xFB, 0xD7, 0xDF, 0xFF, 0x8F, 0xFF, 0xFD, 0xFF, 0x74, 0x00, 0x37,
-    0xEF, 0x3B, 0xCF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 0xDE, 0xEF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xE7, 0xEE, 0xF3, 0xB7, 0xDD, 0xFB, 0xFE, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xDE, 0x2B, 0xB7, 0xDD, 0xDB, 0x83, 0x6F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x3E, 0x9A, 0x36,
-    0x00, 0x1B, 0xAB, 0xAF, 0xFF, 0xFF, 0xFF, 0xFD, 0x80, 0xDC, 0x03, 0xB7, 0xDB, 0xFB, 0xA8, 0x0F,
-    0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xEE, 0x9B, 0xB7, 0xFF, 0xDB, 0xAB, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD,
-    0xFF, 0xF6, 0x28, 0x37, 0x9B, 0xDB, 0xAB, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0x72, 0xB7,
-    0xB8, 0xBB, 0xAB, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFC, 0xAA, 0xB6, 0xA3, 0x7B, 0xA8, 0x0F,
-    0xF0, 0x07, 0xFF, 0xFD, 0xFB, 0xFE, 0xDA, 0xB7, 0x3B, 0x7B, 0xAB, 0xAF, 0xFF, 0xED, 0xFF, 0xFD,
-    0xE0, 0x06, 0x2A, 0xB7, 0xB8, 0xBB, 0x83, 0x6F, 0xFF, 0xDD, 0xFF, 0xFD, 0x9F, 0xFE, 0xF3, 0xB7,
-    0x9B, 0xDB, 0xFE, 0xEF, 0xF7, 0xBB, 0xFF, 0xFD, 0xFE, 0xEF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xF9, 0xFB, 0xFF, 0xFD, 0xC2, 0xDE, 0x00, 0x77, 0xCD, 0xFB, 0xF7, 0xDF, 0xFF, 0xF7, 0xFF, 0xFD,
-    0xDA, 0xBE, 0xEE, 0xF6, 0x20, 0x1B, 0xF7, 0xBF, 0xFF, 0xCF, 0xFF, 0xFD, 0xD8, 0x06, 0xEE, 0xF7,
-    0xAD, 0xBB, 0xB6, 0x7F, 0xE0, 0x37, 0xFF, 0xFD, 0xDA, 0xBE, 0x00, 0x77, 0xAD, 0xDB, 0xB7, 0xFF,
-    0xFF, 0xFB, 0xFF, 0xFD, 0xC2, 0xDF, 0xFF, 0xF7, 0x7B, 0xDB, 0xB7, 0xEF, 0xFF, 0xFD, 0xFF, 0xFD,
-    0xFE, 0xEF, 0xBF, 0xF7, 0x78, 0x1B, 0xB0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xB7, 0xF7,
-    0x03, 0xDB, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xB9, 0xB7, 0x7B, 0xDB, 0xB7, 0xFF,
-    0xFE, 0xFD, 0xFF, 0xFD, 0xF7, 0x7F, 0xBF, 0xB7, 0x7B, 0xDB, 0xB6, 0xFF, 0xFC, 0x1D, 0xFF, 0xFD,
-    0xF7, 0x74, 0x00, 0x37, 0x00, 0x1B, 0xF7, 0x7F, 0xFA, 0xDB, 0xFF, 0xFD, 0x80, 0x07, 0xBF, 0xF7,
-    0xFF, 0xDB, 0xF7, 0x9F, 0xE6, 0xD7, 0xFF, 0xFD, 0xF6, 0xFF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xF6, 0xCF, 0xFF, 0xFD, 0xFB, 0xFF, 0xFF, 0xF7, 0xDD, 0xFB, 0xFF, 0xFF, 0xF6, 0x1F, 0xFF, 0xFD,
-    0xEA, 0xBD, 0x80, 0x37, 0xDD, 0xDB, 0xFF, 0xFF, 0xF4, 0xC3, 0xFF, 0xFD, 0xEA, 0xD6, 0xFF, 0xF6,
-    0x00, 0x1B, 0xFC, 0xFF, 0xF2, 0xDD, 0xFF, 0xFD, 0x82, 0xF7, 0x80, 0xF7, 0xDB, 0xFB, 0xFB, 0x7F,
-    0xFE, 0xDD, 0xFF, 0xFD, 0xE8, 0x05, 0xB6, 0xF7, 0xDF, 0xDB, 0xFB, 0x7F, 0xFE, 0x1D, 0xFF, 0xFD,
-    0xEA, 0xFD, 0xB6, 0xF6, 0x0A, 0x3B, 0xFC, 0xFF, 0xFF, 0xF9, 0xFF, 0xFD, 0xFA, 0xFD, 0xB6, 0xF6,
-    0xAB, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFD, 0xB6, 0xF6, 0xA8, 0x1B, 0xFF, 0xFF,
-    0xEE, 0xFD, 0xFF, 0xFD, 0xFD, 0xF5, 0x80, 0xB6, 0xAA, 0xDB, 0xFF, 0xFF, 0xF6, 0x03, 0xFF, 0xFD,
-    0xED, 0xED, 0xFF, 0xB6, 0x0A, 0xDB, 0xFF, 0xFF, 0xFD, 0x7D, 0xFF, 0xFD, 0xED, 0x1C, 0x00, 0x37,
-    0xFB, 0xDB, 0xFF, 0xFF, 0xF3, 0x45, 0xFF, 0xFD, 0xED, 0xEF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFB, 0x55, 0xFF, 0xFD, 0xED, 0xF7, 0xFF, 0xF7, 0xEF, 0xBB, 0xFF, 0xFF, 0xFB, 0x55, 0xFF, 0xFD,
-    0x80, 0x07, 0xFF, 0xF7, 0xEF, 0x7B, 0xFF, 0xFF, 0xE0, 0x55, 0xFF, 0xFD, 0xED, 0xB7, 0xF3, 0xF7,
-    0x6C, 0xFB, 0xFF, 0xFF, 0xFB, 0x55, 0xFF, 0xFD, 0xED, 0xB7, 0xED, 0xF7, 0x6F, 0xFB, 0xFF, 0xFF,
-    0xFB, 0x55, 0xFF, 0xFD, 0xED, 0xB7, 0xED, 0xF7, 0x6F, 0xDB, 0xFF, 0xFF, 0xFB, 0x45, 0xFF, 0xFD,
-    0xED, 0xB7, 0xF3, 0xF7, 0x60, 0x1B, 0xFF, 0xFF, 0xFF, 0x7D, 0xFF, 0xFD, 0xFD, 0xF7, 0xFF, 0xF7,
-    0x6F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0x6F, 0xFB, 0xFF, 0xFF,
-    0xFF, 0xFD, 0xFF, 0xFD, 0xC0, 0x0F, 0xFF, 0xF7, 0x6D, 0xFB, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFD,
-    0xDD, 0xDF, 0xFF, 0xF7, 0xEE, 0xFB, 0xFF, 0xFF, 0xFB, 0x7F, 0xFF, 0xFD, 0xDD, 0xDF, 0xFF, 0xF7,
-    0xEF, 0x3B, 0xFF, 0xFF, 0xFB, 0x77, 0xFF, 0xFD, 0xC0, 0x0F, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF,
-    0xFB, 0x05, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xFD,
-    0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF, 0xE0, 0x17, 0xFF, 0xFD, 0xF6, 0xFF, 0xFF, 0xF7,
-    0xF9, 0xFB, 0xFF, 0xFF, 0xFB, 0xEF, 0xFF, 0xFD, 0xF7, 0x37, 0xFF, 0xF7, 0xF6, 0xFB, 0xFF, 0xFF,
-    0xEB, 0xD7, 0xFF, 0xFD, 0xF7, 0xF7, 0xFF, 0xF7, 0xF6, 0xFB, 0xFF, 0xFF, 0xF3, 0x3B, 0xFF, 0xFD,
-    0x80, 0x07, 0xFF, 0xF7, 0xF9, 0xFB, 0xFF, 0xFF, 0xFB, 0xE1, 0xFF, 0xFD, 0xF7, 0xFF, 0xFF, 0xF7,
-    0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFF};
-
-static const uint8_t EPD_Image_BatteryLow_296x128[] = {
-    255, 41, 128, /* 图像宽度，图像宽度，图像高度*/
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x85, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xF0, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xE3, 0xFE, 0x1F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xC7, 0xFF, 0x0F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x8F, 0xFF, 0xC7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0x1F, 0xFF, 0xE3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x4F, 0x3F, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xCE, 0x3F, 0xFF, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xCE, 0x5F, 0xFF, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0x8C, 0xDF, 0xFF, 0xF8, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0x98, 0x9F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x0F, 0xFF, 0x99, 0x9F, 0xFF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0x01, 0xDF, 0xE7, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x73, 0xFF, 0xE1, 0xFF, 0xFF, 0x00, 0x07, 0xC7, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xF1, 0xFF, 0x87, 0xFF, 0xFF, 0xFE, 0x00, 0x03, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xF8, 0x0E, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x23, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xF9, 0xFC, 0x0C, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFE, 0x3F,
-    0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF3, 0xFC, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x3F,
-    0xFF, 0xFF, 0xE1, 0xFF, 0xFE, 0x33, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x3F,
-    0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x03, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x3F,
-    0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0xC3, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0x1F,
-    0xFF, 0xFC, 0x7F, 0xFF, 0xF9, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x1F,
-    0xFF, 0xF8, 0xFF, 0xFF, 0xF9, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0x9F,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x9F, 0xFF, 0x9F,
-    0xFF, 0xF1, 0xFF, 0xFF, 0xF9, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0x1F, 0xFF, 0x9F,
-    0xFF, 0xF8, 0x7E, 0x0F, 0xF9, 0xFF, 0xE3, 0xFF, 0xF0, 0x03, 0x00, 0x00, 0x60, 0x3F, 0xFF, 0x9F,
-    0xFF, 0xFE, 0x1F, 0x00, 0xF9, 0xFF, 0xC7, 0xFF, 0xC0, 0x00, 0x00, 0x01, 0xF0, 0xFF, 0xFF, 0x8F,
-    0xFF, 0xFF, 0x8F, 0xF0, 0x08, 0xFF, 0x8F, 0xFF, 0xCF, 0xF8, 0x0C, 0x3F, 0xF9, 0xFF, 0xFF, 0x8F,
-    0xFF, 0xFF, 0xC3, 0xFF, 0x00, 0x7F, 0x9F, 0xFF, 0xFF, 0xF9, 0xC4, 0x1F, 0xF8, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xF0, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0x04, 0x1F, 0xFC, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x00, 0x3C, 0x1F, 0xFC, 0xFF, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x13, 0xFC, 0x1F, 0xFC, 0x7F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF3, 0xFC, 0x1F, 0xFE, 0x7F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF3, 0xFC, 0x1F, 0xFE, 0x7F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xF3, 0xFC, 0x1F, 0xFE, 0x7F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF0, 0xFF, 0xF3, 0xFE, 0x1F, 0xFE, 0x7F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x73, 0xFE, 0x1F, 0xFE, 0x7F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFE, 0x1F, 0xFF, 0x3F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFC, 0x1F, 0xFF, 0x00, 0xF9, 0x0F, 0xFF, 0x3F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x3D, 0x0F, 0xFF, 0x3F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x0C, 0x8F, 0xFF, 0x3F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0xC2, 0x87, 0xFF, 0x3F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xC7, 0xFF, 0x3F, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x3F, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xC7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x1F, 0xFF, 0xE7,
-    0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F, 0xFF, 0xE7,
-    0xFC, 0x7F, 0x9F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFC, 0x39, 0xBF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFF, 0xF0, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFF, 0xE6, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFF, 0xE6, 0x7F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFF, 0xE7, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFF, 0xE7, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFF, 0xE2, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFF, 0xF0, 0x63, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xC7, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFF, 0x78, 0xE3, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xC7, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x07, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFE, 0x7F, 0xFF, 0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x7E, 0x07, 0xFF, 0x9F, 0xFF, 0xE7,
-    0xFE, 0xFF, 0xFF, 0xE8, 0x0C, 0xF0, 0x0F, 0x81, 0xFF, 0xFC, 0xF0, 0x07, 0xFF, 0x9F, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFC, 0x07, 0xC0, 0x00, 0x04, 0x00, 0x07, 0xFF, 0x1F, 0xFF, 0xE3,
-    0xFF, 0xFF, 0xE0, 0x1F, 0xF1, 0xFF, 0xF3, 0xF0, 0x00, 0x00, 0x1C, 0x0F, 0xFF, 0x1F, 0xFF, 0xE3,
-    0xFF, 0xFF, 0x03, 0xFF, 0xF9, 0xFF, 0xF3, 0xFC, 0x7C, 0x09, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0xE3,
-    0xFF, 0xFC, 0x1F, 0xFF, 0xC1, 0xFF, 0xF3, 0xFE, 0x1F, 0xF9, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0xF3,
-    0xFF, 0xF0, 0xFF, 0xFF, 0x83, 0xFF, 0xF3, 0xFF, 0x8F, 0xF9, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0xF3,
-    0xFF, 0xE3, 0xFF, 0xFF, 0x1F, 0xFF, 0xF3, 0xFF, 0xC3, 0xF9, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0xF3,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xF1, 0xF9, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0xF3,
-    0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xF8, 0xF9, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0xF3,
-    0xFF, 0xC7, 0xFF, 0xFF, 0x3F, 0xFF, 0xE3, 0xFF, 0xFC, 0x79, 0xFF, 0x0F, 0xFF, 0x3F, 0xFF, 0xF3,
-    0xFF, 0xE1, 0xFF, 0xFF, 0x3F, 0xFF, 0xE7, 0xFF, 0xFE, 0x39, 0xFF, 0x0F, 0xFF, 0x3F, 0xFF, 0xF3,
-    0xFF, 0xF8, 0xE3, 0xFF, 0x9F, 0xFF, 0xE3, 0xFF, 0xFF, 0x19, 0xFF, 0x07, 0x3F, 0x3F, 0xFF, 0xF3,
-    0xFF, 0xFE, 0x30, 0xFF, 0x9F, 0xFF, 0xF1, 0xFF, 0xFF, 0x8C, 0xFF, 0x04, 0x3C, 0x01, 0xFF, 0xF3,
-    0xFF, 0xFF, 0x0C, 0x1F, 0x8F, 0xFF, 0xF9, 0xFF, 0xFF, 0xC4, 0xFE, 0x00, 0x20, 0x00, 0x7F, 0xF3,
-    0xFF, 0xFF, 0xC7, 0x07, 0xCF, 0xFF, 0xF9, 0xFF, 0xFF, 0xE2, 0x7F, 0x82, 0x03, 0xFE, 0x3F, 0xF3,
-    0xFF, 0xFF, 0xE1, 0xE0, 0xCF, 0xFF, 0xF1, 0xFC, 0x3F, 0xF3, 0x7E, 0x0E, 0x1F, 0xFF, 0x9F, 0xF3,
-    0xFF, 0xFF, 0xF8, 0xF8, 0x27, 0xFF, 0xF3, 0xFE, 0x00, 0x09, 0x00, 0x1C, 0x7F, 0xFF, 0xCF, 0xF3,
-    0xFF, 0xFF, 0xFC, 0x3F, 0x03, 0xFF, 0xE3, 0xFF, 0xF0, 0x00, 0x03, 0xF8, 0xFF, 0xFF, 0x01, 0xF3,
-    0xFF, 0xFF, 0xFF, 0x1F, 0xC0, 0x7F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFC, 0x61, 0xF3,
-    0xFF, 0xFF, 0xFF, 0x87, 0xFC, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x7F, 0xF8, 0x39, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xF1, 0x83, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0x73, 0xE7, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFC, 0x27, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0x0F, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xC3, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x80, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x1F, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x90, 0x3F, 0xFB, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x92, 0x3F, 0xF8, 0x7F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x99, 0x1F, 0xFC, 0x03, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xC9, 0xC7, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xCC, 0xC3, 0xFE, 0x7E, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xCC, 0x11, 0xFE, 0x73, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFD,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xE6, 0x38, 0x7E, 0x77, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xE0, 0x62, 0x3E, 0x67, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xF1,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xF0, 0xC3, 0x0E, 0x67, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x41,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0x8B, 0xC0, 0xCC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x0D,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0x99, 0xF0, 0x48, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x1D,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0x19, 0xF8, 0x03, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1D,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE6, 0x0E, 0x19, 0xF9, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x5D,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x06, 0x7C, 0xF9, 0x98, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0xE0, 0x0C, 0x79, 0x9E, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0xE0, 0x00, 0x39, 0x9C, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x61, 0x07, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x79, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0x20, 0x19, 0xC0, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x19, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xF2, 0x03, 0xF8, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x78, 0x00, 0x87, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x27, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x38, 0x00, 0x1F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x63, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x21, 0x3F, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x73, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x3F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x77, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x9F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x9F, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xCF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF9,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xC7, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x83, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFB,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x33, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x39, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x3C, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7E, 0x7F, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0x3F, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x1F, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0x8F, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xF3,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x83, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0x31, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0x38, 0x7F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xCE, 0x7E, 0x1F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE6, 0x7F, 0x87, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF2, 0x7F, 0xC0, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xE7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xFF, 0xCC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x7F, 0xDF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFE, 0x1F, 0x9F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x6F, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0x8F, 0x9F, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x0F, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE3, 0x9F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x8F, 0xCF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF0, 0x7F, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x87, 0x9F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xC1, 0x9F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xC8, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF8, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFD, 0x9F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x3F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFE, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFC, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF9, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x3F, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x1F, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x9F, 0xF3, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xE7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xE7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xE7, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xEF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFE, 0x03, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xCF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0x7F, 0xFF, 0xFF, 0x9F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x9F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x9F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFE, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFC, 0x7F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFC, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xF8, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xF9, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0xF1, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xF3, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xC7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFE, 0x3F, 0x8F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x8F, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x18, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xF0, 0x03, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0x00, 0x3F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF, 0x80, 0x0F, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x0E, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
-
-static const uint8_t EPD_Image_Info_89x128[] = {
-    89, 0, 128, /* 图像宽度，图像宽度，图像高度*/
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xEF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xE7, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF7, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFB, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF9, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x7F, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x7F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0x3F, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xBE, 0x1C, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0x9C, 0xC4, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xCD, 0xF0, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xE9, 0xFB, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xE1, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF3, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF9, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF9, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0x7F, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFE, 0x78, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x2F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFC, 0x7F,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xE1, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x07, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xE3, 0xFF, 0xF0, 0x3F, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xF9, 0xFF, 0xF8, 0xFF, 0xFF,
-    0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE, 0x7F, 0xFE, 0x3F, 0xFF,
-    0x98, 0x0F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0x3F, 0xFF, 0x1F, 0xFF,
-    0xCF, 0xC0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xFF, 0x9F, 0xFF, 0xCF, 0xFF,
-    0xCF, 0xF8, 0x3F, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x3F, 0xCF, 0xFF, 0xE7, 0xFF,
-    0xE7, 0xFF, 0x87, 0xFF, 0xF9, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0x87, 0x0F, 0xE7, 0xFF, 0xF3, 0xFF,
-    0xE7, 0xFF, 0xE0, 0xFF, 0xF3, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0x31, 0xE3, 0xF3, 0xFF, 0xF8, 0x7F,
-    0xF3, 0xFF, 0xFC, 0x3F, 0xE7, 0xFF, 0xFF, 0xFF, 0x1F, 0x03, 0x3C, 0x88, 0xF9, 0xFF, 0xFC, 0x07,
-    0xF3, 0xFF, 0xFF, 0x0F, 0xE7, 0xFF, 0xFF, 0xFF, 0xC7, 0xF0, 0x3E, 0x0C, 0x3F, 0xFF, 0xFE, 0x60,
-    0xF9, 0xFF, 0xFF, 0xE3, 0xCF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x0F, 0x0F, 0x1F, 0xFF, 0xFF, 0x3F,
-    0xF9, 0xDF, 0xFF, 0xF8, 0x9F, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0x21, 0x1F, 0x9F, 0xFF, 0xFF, 0x9F,
-    0xFC, 0xCF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x3F, 0x7C, 0x1F, 0xC7, 0xFF, 0xFF, 0xCF,
-    0xFC, 0xEF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x7E, 0x3F, 0xF3, 0xFF, 0xFF, 0xE3,
-    0xFE, 0xE7, 0xFF, 0xF9, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x7C, 0x1F, 0xF8, 0x3F, 0xFF, 0xF9,
-    0xFE, 0x73, 0xFF, 0xFB, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x7C, 0x07, 0xFF, 0x1F, 0xFF, 0xFC,
-    0xFF, 0x7B, 0xFF, 0xF3, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3, 0x68, 0x01, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0x39, 0xFE, 0x67, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xF8, 0x40, 0x00, 0xFF, 0xCF, 0xFF, 0xFF,
-    0xFF, 0x3C, 0xFC, 0x07, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFC, 0x90, 0x00, 0x7F, 0xA0, 0xFF, 0xFF,
-    0xFF, 0x9E, 0x7D, 0xCF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x3F, 0xEC, 0x00, 0x00,
-    0xFF, 0x9F, 0x3D, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x1E, 0x6F, 0xF2, 0x07,
-    0xFF, 0xCF, 0x9D, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xEF, 0xFC, 0x7F,
-    0xFF, 0xCF, 0x99, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0D, 0xEF, 0xF1, 0xFF,
-    0xFF, 0xE7, 0xCD, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xF7, 0xC0, 0x00, 0x0F, 0xEF, 0xF8, 0xFF,
-    0xFF, 0xE7, 0xE5, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xF1, 0xE0, 0x00, 0x0F, 0xEF, 0xFE, 0x7F,
-    0xFF, 0xF3, 0xF1, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x61, 0xC0, 0x0F, 0xEF, 0xFF, 0x9F,
-    0xFF, 0xF3, 0xF9, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF, 0xF9, 0x33, 0xC0, 0x0F, 0xCF, 0xFF, 0x8F,
-    0xFF, 0xFB, 0xFC, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x83, 0xC0, 0x1F, 0xCF, 0xE0, 0x00,
-    0xFF, 0xF9, 0xFE, 0x7F, 0xF9, 0xFF, 0xBF, 0xFF, 0xFF, 0xFD, 0xE3, 0x00, 0x1F, 0xCF, 0x83, 0xFF,
-    0xFF, 0xFC, 0xFF, 0x3F, 0xE3, 0xFF, 0xDF, 0xFF, 0xFF, 0xFD, 0xF7, 0x80, 0x3F, 0xDF, 0x1F, 0xFF,
-    0xFF, 0xFC, 0xFF, 0x9F, 0xC7, 0xFF, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF9, 0xFF, 0x9E, 0x7F, 0xFF,
-    0xFE, 0xFE, 0x7F, 0xC7, 0xDF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0x9C, 0xFF, 0xFF,
-    0xFE, 0x7E, 0x7F, 0xF3, 0x9F, 0xFF, 0xE1, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xB9, 0xFF, 0xFF,
-    0xFF, 0x3F, 0x3F, 0xF9, 0x1F, 0xFF, 0xF4, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x39, 0xFF, 0xFF,
-    0xFF, 0xBF, 0xBF, 0xFC, 0x3F, 0xFF, 0xF2, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x73, 0xFF, 0xFF,
-    0xFF, 0x9F, 0x9F, 0xFF, 0xFF, 0xFF, 0xF3, 0x3F, 0xFC, 0xFE, 0xFF, 0xFF, 0xFE, 0x73, 0xFF, 0xFF,
-    0xFE, 0x5F, 0xCF, 0xFF, 0xFF, 0xFF, 0xF9, 0xCF, 0xF0, 0xBE, 0xFF, 0xFF, 0xFE, 0x77, 0xFF, 0xFF,
-    0xFF, 0x3F, 0xEF, 0xFF, 0xFF, 0xFF, 0xF9, 0xE3, 0xCD, 0x3E, 0xFF, 0xFF, 0xFC, 0x67, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFD, 0xF8, 0x3A, 0x3E, 0xFF, 0xFF, 0xFD, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0x12, 0x7E, 0xFF, 0xFF, 0xF9, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFC, 0xF1, 0xC0, 0x41, 0xFF, 0xFF, 0xFB, 0x87, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFE, 0xC7, 0xE8, 0x07, 0xFF, 0xFF, 0xF3, 0x07, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xD8, 0x3F, 0xFF, 0xFF, 0xE7, 0x27, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xF0, 0x0F, 0xFF, 0xFF, 0xEF, 0x67, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xFE, 0x7F, 0xE0, 0x07, 0xFF, 0xFF, 0xCF, 0x63, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0x7F, 0xC0, 0x01, 0xFF, 0xFF, 0xDE, 0x63, 0xFF, 0xFF};
-
 #endif
 
 /*
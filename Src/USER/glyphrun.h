@@ -0,0 +1,283 @@
+#ifndef _GLYPHRUN_H_
+#define _GLYPHRUN_H_
+
+/* 此文件由 资源/字形串生成/glyphrun.py 根据 glyphrun.txt 生成，请勿手动修改 */
+/* 格式：字符个数, 字符索引...，字符串表为多个字形串依次排列，使用EPD_GetGlyphRun()按序号查找 */
+
+#include "main.h"
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_Move[] = {2, 0x49, 0x1E}; /* 移动 */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_Add[] = {1, 0x1D}; /* 加 */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_Sub[] = {1, 0x1A}; /* 减 */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_Save[] = {2, 0x12, 0x2B}; /* 保存 */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_Cancel[] = {2, 0x23, 0x3F}; /* 取消 */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_Continue[] = {2, 0x4B, 0x4C}; /* 继续 */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_Enter[] = {2, 0x54, 0x14}; /* 进入 */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_Up[] = {1, 0x06}; /* 上 */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_Down[] = {1, 0x07}; /* 下 */
+
+/* EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_None[] = {2, 0x8D, 0x8D}; /* -- */
+
+/* NULL, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_MainMenu[] = {3, 0x0A, 0x5D, 0x1D}; /* 主菜单 */
+
+/* NULL, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_SetTime[] = {4, 0x3F, 0x68, 0x61, 0x5A}; /* 时间设置 */
+
+/* NULL, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_Guide[] = {4, 0x46, 0x62, 0x10, 0x51}; /* 欢迎使用 */
+
+/* NULL, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_SetBuzzer[] = {4, 0x66, 0x27, 0x61, 0x5A}; /* 铃声设置 */
+
+/* NULL, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_SetBattery[] = {4, 0x52, 0x4A, 0x61, 0x5A}; /* 电池设置 */
+
+/* NULL, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_SetSensor[] = {5, 0x0F, 0x39, 0x24, 0x61, 0x5A}; /* 传感器设置 */
+
+/* NULL, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_SetVrefint[] = {6, 0x1F, 0x5C, 0x52, 0x1E, 0x61, 0x5A}; /* 参考电压设置 */
+
+/* NULL, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_Info[] = {4, 0x57, 0x59, 0x12, 0x37}; /* 系统信息 */
+
+/* NULL, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_SetRTCAging[] = {6, 0x3F, 0x65, 0x5B, 0x1B, 0x61, 0x5A}; /* 时钟老化设置 */
+
+/* NULL, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_ResetAll[] = {4, 0x36, 0x28, 0x61, 0x5A}; /* 恢复设置 */
+
+/* NULL, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_SetHWVer[] = {6, 0x53, 0x0D, 0x4F, 0x44, 0x61, 0x5A}; /* 硬件版本设置 */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_SetAlarm[] = {5, 0xA1, 0xAC, 0xA1, 0xB2, 0xAD}; /* ALARM */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_Select[] = {1, 0x02}; /* ◀ */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_BuzzerState[] = {8, 0x5E, 0x6D, 0x24, 0x33, 0x21, 0x50, 0x35, 0x70}; /* 蜂鸣器开启状态： */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_On[] = {2, 0x33, 0x21}; /* 开启 */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_Off[] = {2, 0x16, 0x67}; /* 关闭 */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_AgingHint[] = {14, 0xBB, 0x49, 0x08, 0x14, 0x56, 0x58, 0x09, 0x90, 0x8E, 0x91, 0xD0, 0xD0, 0xCD, 0xBD}; /* [每个偏移约为0.1ppm] */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_ResetHint[] = {12, 0x4C, 0x6A, 0x3D, 0x3C, 0x31, 0x36, 0x28, 0x19, 0x18, 0x29, 0x61, 0x5A}; /* 清除数据并恢复到初始设置 */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_ResetDone[] = {4, 0x36, 0x28, 0x2B, 0x3A}; /* 恢复完成 */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_ReturnHint[] = {8, 0x04, 0x55, 0x20, 0x63, 0x26, 0x0A, 0x5D, 0x1D}; /* 三秒后返回主菜单 */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_HWVerHint1[] = {12, 0xBB, 0x4B, 0x38, 0x70, 0x61, 0x5A, 0x11, 0x2A, 0x20, 0x07, 0x0E, 0x17}; /* [注意：设置保存后不会再 */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_HWVerHint2[] = {6, 0x41, 0x54, 0x48, 0x5D, 0x1D, 0xBD}; /* 显示此菜单] */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_BatteryWarn[] = {5, 0x5F, 0x22, 0x52, 0x1E, 0x70}; /* 警告电压： */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_BatteryStop[] = {5, 0x3B, 0x47, 0x52, 0x1E, 0x70}; /* 截止电压： */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_TempOffset[] = {5, 0x4D, 0x32, 0x14, 0x56, 0x70}; /* 温度偏移： */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_RHOffset[] = {5, 0x4E, 0x32, 0x14, 0x56, 0x70}; /* 湿度偏移： */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_OffsetValue[] = {5, 0x14, 0x56, 0x3D, 0x13, 0x70}; /* 偏移数值： */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_BuzzerVolume[] = {6, 0x5E, 0x6D, 0x24, 0x6B, 0x64, 0x70}; /* 蜂鸣器音量： */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_HWVer[] = {6, 0x53, 0x0D, 0x4F, 0x44, 0x70, 0xB6}; /* 硬件版本：V */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_Dot[] = {1, 0x8E}; /* . */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_AlarmSlot[] = {4, 0xAE, 0xAF, 0x8E, 0x9A}; /* NO.: */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_AlarmType[] = {5, 0xB4, 0xB9, 0xB0, 0xA5, 0x9A}; /* TYPE: */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_AlarmTime[] = {5, 0xB4, 0xA9, 0xAD, 0xA5, 0x9A}; /* TIME: */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_AlarmParam[] = {6, 0xA4, 0x8F, 0xAD, 0x8F, 0xB9, 0x9A}; /* D/M/Y: */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_Colon[] = {1, 0x9A}; /* : */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_Slash[] = {1, 0x8F}; /* / */
+
+/* EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_EraseHint1[] = {13, 0x8A, 0x25, 0x3B, 0x37, 0x11, 0x82, 0x06, 0x82, 0x26, 0x82, 0x07, 0x82, 0x58}; /* *同时按住"上"和"下"键 */
+
+/* EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_EraseHint2[] = {8, 0x80, 0x30, 0x37, 0x82, 0x29, 0x10, 0x82, 0x58}; /*  并按"复位"键 */
+
+/* EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_EraseHint3[] = {11, 0x80, 0x24, 0x0F, 0x33, 0x1C, 0x39, 0x59, 0x15, 0x56, 0x3A, 0x38}; /*  可以强制擦除全部数据 */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_AM[] = {2, 0xA1, 0xAD}; /* AM */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_PM[] = {2, 0xB0, 0xAD}; /* PM */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_Week[] = {3, 0x80, 0x40, 0x43}; /*  星期 */
+
+/* EPD_FontAscii_12x24_B, EPD_FontUTF8_24x24_B */
+static const uint8_t GlyphRun_Day[] = {
+    2, 0x80, 0x80, /* 0 -    */
+    1, 0x03, /* 1 - 一 */
+    1, 0x0B, /* 2 - 二 */
+    1, 0x04, /* 3 - 三 */
+    1, 0x25, /* 4 - 四 */
+    1, 0x0C, /* 5 - 五 */
+    1, 0x15, /* 6 - 六 */
+    1, 0x3E}; /* 7 - 日 */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_LunarTitle[] = {3, 0x18, 0x22, 0x5E}; /* 农历： */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_LunarMonthLeap[] = {
+    0, /* 0 -  */
+    1, 0x40}; /* 1 - 润 */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_LunarMonth[] = {
+    2, 0x3D, 0x48, /* 0 - 未知 */
+    2, 0x3E, 0x3C, /* 1 - 正月 */
+    2, 0x0C, 0x3C, /* 2 - 二月 */
+    2, 0x05, 0x3C, /* 3 - 三月 */
+    2, 0x27, 0x3C, /* 4 - 四月 */
+    2, 0x0D, 0x3C, /* 5 - 五月 */
+    2, 0x17, 0x3C, /* 6 - 六月 */
+    2, 0x04, 0x3C, /* 7 - 七月 */
+    2, 0x16, 0x3C, /* 8 - 八月 */
+    2, 0x0B, 0x3C, /* 9 - 九月 */
+    2, 0x1F, 0x3C, /* 10 - 十月 */
+    2, 0x19, 0x3C, /* 11 - 冬月 */
+    2, 0x7E, 0x3C}; /* 12 - 腊月 */
+
+/* NULL, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_LunarDate[] = {
+    2, 0x3D, 0x48, /* 0 - 未知 */
+    2, 0x1B, 0x02, /* 1 - 初一 */
+    2, 0x1B, 0x0C, /* 2 - 初二 */
+    2, 0x1B, 0x05, /* 3 - 初三 */
+    2, 0x1B, 0x27, /* 4 - 初四 */
+    2, 0x1B, 0x0D, /* 5 - 初五 */
+    2, 0x1B, 0x17, /* 6 - 初六 */
+    2, 0x1B, 0x04, /* 7 - 初七 */
+    2, 0x1B, 0x16, /* 8 - 初八 */
+    2, 0x1B, 0x0B, /* 9 - 初九 */
+    2, 0x1B, 0x1F, /* 10 - 初十 */
+    2, 0x1F, 0x02, /* 11 - 十一 */
+    2, 0x1F, 0x0C, /* 12 - 十二 */
+    2, 0x1F, 0x05, /* 13 - 十三 */
+    2, 0x1F, 0x27, /* 14 - 十四 */
+    2, 0x1F, 0x0D, /* 15 - 十五 */
+    2, 0x1F, 0x17, /* 16 - 十六 */
+    2, 0x1F, 0x04, /* 17 - 十七 */
+    2, 0x1F, 0x16, /* 18 - 十八 */
+    2, 0x1F, 0x0B, /* 19 - 十九 */
+    2, 0x0C, 0x1F, /* 20 - 二十 */
+    2, 0x32, 0x02, /* 21 - 廿一 */
+    2, 0x32, 0x0C, /* 22 - 廿二 */
+    2, 0x32, 0x05, /* 23 - 廿三 */
+    2, 0x32, 0x27, /* 24 - 廿四 */
+    2, 0x32, 0x0D, /* 25 - 廿五 */
+    2, 0x32, 0x17, /* 26 - 廿六 */
+    2, 0x32, 0x04, /* 27 - 廿七 */
+    2, 0x32, 0x16, /* 28 - 廿八 */
+    2, 0x32, 0x0B, /* 29 - 廿九 */
+    2, 0x05, 0x1F}; /* 30 - 三十 */
+
+/* EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_LunarStem[] = {
+    1, 0x31, /* 0 - 庚 */
+    1, 0x52, /* 1 - 辛 */
+    1, 0x28, /* 2 - 壬 */
+    1, 0x47, /* 3 - 癸 */
+    1, 0x45, /* 4 - 甲 */
+    1, 0x0A, /* 5 - 乙 */
+    1, 0x09, /* 6 - 丙 */
+    1, 0x03, /* 7 - 丁 */
+    1, 0x34, /* 8 - 戊 */
+    1, 0x2D}; /* 9 - 已 */
+
+/* EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_LunarBranch[] = {
+    1, 0x46, /* 0 - 申 */
+    1, 0x57, /* 1 - 酉 */
+    1, 0x35, /* 2 - 戌 */
+    1, 0x0E, /* 3 - 亥 */
+    1, 0x2A, /* 4 - 子 */
+    1, 0x08, /* 5 - 丑 */
+    1, 0x2C, /* 6 - 寅 */
+    1, 0x21, /* 7 - 卯 */
+    1, 0x53, /* 8 - 辰 */
+    1, 0x2E, /* 9 - 巳 */
+    1, 0x20, /* 10 - 午 */
+    1, 0x3D}; /* 11 - 未 */
+
+/* EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_LunarZodiac[] = {
+    1, 0x44, /* 0 - 猴 */
+    1, 0x5B, /* 1 - 鸡 */
+    1, 0x42, /* 2 - 狗 */
+    1, 0x43, /* 3 - 猪 */
+    1, 0x5C, /* 4 - 鼠 */
+    1, 0x41, /* 5 - 牛 */
+    1, 0x4F, /* 6 - 虎 */
+    1, 0x13, /* 7 - 兔 */
+    1, 0x5D, /* 8 - 龙 */
+    1, 0x50, /* 9 - 蛇 */
+    1, 0x5A, /* 10 - 马 */
+    1, 0x4E}; /* 11 - 羊 */
+
+/* EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_LunarYear[] = {2, 0x2F, 0x00}; /* 年【 */
+
+/* EPD_FontAscii_8x16, EPD_FontUTF8_16x16_B */
+static const uint8_t GlyphRun_LunarYearEnd[] = {2, 0x2F, 0x01}; /* 年】 */
+
+#endif
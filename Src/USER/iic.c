@@ -1,49 +1,57 @@
 #include "iic.h"
+#include "wait.h"
 
-#define WAIT_TIMEOUT(val)                                       \
-    timeout = I2C_TIMEOUT_MS;                                   \
-    systick_tmp = SysTick->CTRL;                                \
-    ((void)systick_tmp);                                        \
-    while (timeout != 0 && val)                                 \
-    {                                                           \
-        if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U) \
-        {                                                       \
-            timeout -= 1;                                       \
-        }                                                       \
-    }                                                           \
-    if (timeout == 0)                                           \
-    {                                                           \
-        if (i2c_reset() == 0)                                   \
-        {                                                       \
-            return 1;                                           \
-        }                                                       \
-        else                                                    \
-        {                                                       \
-            return 2;                                           \
-        }                                                       \
+#define I2C_STATUS_RESET 0xFE /* 内部使用：超时或总线错误，需要清除死锁 */
+
+static struct I2C_Stat Stat[I2C_STAT_SLOTS];
+
+/**
+ * @brief  查找从机的统计位置，没有时分配一个空位置。
+ * @param  addr I2C设备地址。
+ * @return 统计位置，没有空位置时为NULL。
+ */
+static struct I2C_Stat *i2c_find_stat(uint8_t addr)
+{
+    uint8_t i;
+
+    for (i = 0; i < I2C_STAT_SLOTS; i++)
+    {
+        if (Stat[i].addr == addr)
+        {
+            return &Stat[i];
+        }
+    }
+    for (i = 0; i < I2C_STAT_SLOTS; i++)
+    {
+        if (Stat[i].addr == 0)
+        {
+            Stat[i].addr = addr;
+            return &Stat[i];
+        }
     }
+    return NULL;
+}
 
 /**
- * @brief  延时100ns的倍数（不准确，只是大概）。
- * @param  nsX100 延时时间。
+ * @brief  计数加1，达到255后不再增加。
  */
-static void delay_100ns(volatile uint16_t nsX100)
+static void i2c_count(uint8_t *count)
 {
-    while (nsX100)
+    if (*count < 0xFF)
     {
-        nsX100--;
+        (*count)++;
     }
-    ((void)nsX100);
 }
 
 /**
  * @brief  尝试清除I2C死锁状态。
- * @return 1：未成功清除死锁，0：已成功清除死锁。
+ * @return 2：数据线被拉低，已通过时钟脉冲恢复，1：未成功清除死锁，0：已成功清除死锁。
  */
 static uint8_t i2c_reset(void)
 {
+    uint8_t clocked;
     uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    uint16_t start_tick;
     uint32_t i2c_old_state;
 
     i2c_old_state = LL_I2C_IsEnabled(I2C_NUM); /* 保存I2C复位前的启用状态 */
@@ -70,23 +78,20 @@ static uint8_t i2c_reset(void)
     /* 设置IO默认状态 */
     LL_GPIO_SetOutputPin(I2C_SDA_PORT, I2C_SDA_PIN);
     LL_GPIO_SetOutputPin(I2C_SCL_PORT, I2C_SCL_PIN);
-    delay_100ns(100);
+    WAIT_DelayUs(10);
 
+    clocked = 0;
     if (LL_GPIO_IsInputPinSet(I2C_SDA_PORT, I2C_SDA_PIN) == 0) /* 检测I2C是否已释放，如未释放则代表I2C未恢复，继续处理 */
     {
-        timeout = I2C_TIMEOUT_MS;
-        systick_tmp = SysTick->CTRL;
-        ((void)systick_tmp);
-        while (timeout != 0) /* 在时钟线上发送脉冲，用来跳过现有数据 */
+        clocked = 1;
+        timeout = 0;
+        start_tick = LP_GetTick();
+        while (LP_GetElapsedMs(start_tick) < I2C_TIMEOUT_MS) /* 在时钟线上发送脉冲，用来跳过现有数据 */
         {
-            if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
-            {
-                timeout -= 1;
-            }
             LL_GPIO_ResetOutputPin(I2C_SCL_PORT, I2C_SCL_PIN);
-            delay_100ns(100);
+            WAIT_DelayUs(10);
             LL_GPIO_SetOutputPin(I2C_SCL_PORT, I2C_SCL_PIN);
-            delay_100ns(100);
+            WAIT_DelayUs(10);
             if (LL_GPIO_IsInputPinSet(I2C_SDA_PORT, I2C_SDA_PIN) != 0) /* 数据线为高 */
             {
                 timeout = 0xFFFFFFFF; /* I2C数据线已被释放 */
@@ -112,45 +117,52 @@ static uint8_t i2c_reset(void)
     {
         return 1;
     }
+    if (clocked != 0)
+    {
+        return 2;
+    }
     return 0;
 }
 
 /**
- * @brief  产生启动或重新启动标志，开始数据传输。
+ * @brief  使用DMA完成一次写入或读取，传输期间CPU进入Sleep模式，由I2C中断唤醒。
  * @param  addr I2C设备地址。
- * @param  is_read 本次传输是读取数据，不是写入数据。
- * @param  data_size 要传输的数据大小。
- * @return 3：发送开始传输信号后收到了NACK，2：I2C从机未响应或发生死锁，未恢复，1：I2C从机未响应或发生死锁，已恢复，可以重新执行，0：传输已启动。
+ * @param  is_read 1：读取，0：写入。
+ * @param  data 数据指针。
+ * @param  data_size 数据大小，0为只发送地址。
+ * @param  stop 1：完成后自动发送停止标志，0：完成后保持总线，准备重新启动。
+ * @param  wait 整次传输的等待状态，用于超时判断。
+ * @return I2C_STATUS_RESET：超时或总线错误，I2C_STATUS_NACK：收到了NACK，I2C_STATUS_OK：传输完成。
+ * @note   收到NACK时硬件会自动发送停止标志。
  */
-uint8_t I2C_Start(uint8_t addr, uint8_t is_read, uint8_t data_size)
+static uint8_t i2c_transfer_dma(uint8_t addr, uint8_t is_read, const uint8_t *data, uint8_t data_size, uint8_t stop, struct WAIT_Context *wait)
 {
-    uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    uint8_t ret;
+    uint16_t elapsed;
+    uint32_t channel;
 
-    if (LL_I2C_IsActiveFlag_BUSY(I2C_NUM) != 0)
+    channel = is_read != 0 ? I2C_DMA_RX_CHANNEL : I2C_DMA_TX_CHANNEL;
+    if (data_size != 0)
     {
-        timeout = I2C_TIMEOUT_MS;
-        systick_tmp = SysTick->CTRL;
-        ((void)systick_tmp);
-        while (timeout != 0 && LL_I2C_IsActiveFlag_TXE(I2C_NUM) == 0)
+        LL_DMA_ConfigTransfer(I2C_DMA, channel,
+                              (is_read != 0 ? LL_DMA_DIRECTION_PERIPH_TO_MEMORY : LL_DMA_DIRECTION_MEMORY_TO_PERIPH) |
+                                  LL_DMA_PRIORITY_LOW | LL_DMA_MODE_NORMAL | LL_DMA_PERIPH_NOINCREMENT | LL_DMA_MEMORY_INCREMENT |
+                                  LL_DMA_PDATAALIGN_BYTE | LL_DMA_MDATAALIGN_BYTE);
+        LL_DMA_SetPeriphRequest(I2C_DMA, channel, I2C_DMA_REQUEST);
+        if (is_read != 0)
         {
-            if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
-            {
-                timeout -= 1;
-            }
+            LL_DMA_ConfigAddresses(I2C_DMA, channel, LL_I2C_DMA_GetRegAddr(I2C_NUM, LL_I2C_DMA_REG_DATA_RECEIVE), (uint32_t)data, LL_DMA_DIRECTION_PERIPH_TO_MEMORY);
+            LL_I2C_EnableDMAReq_RX(I2C_NUM);
         }
-        if (timeout == 0)
+        else
         {
-            if (i2c_reset() == 0)
-            {
-                return 1;
-            }
-            else
-            {
-                return 2;
-            }
+            LL_DMA_ConfigAddresses(I2C_DMA, channel, (uint32_t)data, LL_I2C_DMA_GetRegAddr(I2C_NUM, LL_I2C_DMA_REG_DATA_TRANSMIT), LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+            LL_I2C_EnableDMAReq_TX(I2C_NUM);
         }
+        LL_DMA_SetDataLength(I2C_DMA, channel, data_size);
+        LL_DMA_EnableChannel(I2C_DMA, channel);
     }
+
     /* DocID025942 Rev 8 - Page 604 */
     LL_I2C_SetMasterAddressingMode(I2C_NUM, LL_I2C_ADDRESSING_MODE_7BIT);
     LL_I2C_SetSlaveAddr(I2C_NUM, addr);
@@ -164,169 +176,205 @@ uint8_t I2C_Start(uint8_t addr, uint8_t is_read, uint8_t data_size)
     }
     LL_I2C_DisableReloadMode(I2C_NUM);
     LL_I2C_SetTransferSize(I2C_NUM, data_size);
-    /* DocID025942 Rev 8 - Page 606 */
-    LL_I2C_DisableAutoEndMode(I2C_NUM);
-    LL_I2C_GenerateStartCondition(I2C_NUM);
-    timeout = I2C_TIMEOUT_MS;
-    systick_tmp = SysTick->CTRL;
-    ((void)systick_tmp);
-    if (is_read == 0)
+    if (stop != 0)
     {
-        while (timeout != 0 && LL_I2C_IsActiveFlag_TXE(I2C_NUM) == 0)
-        {
-            if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
-            {
-                timeout -= 1;
-            }
-            if (LL_I2C_IsActiveFlag_NACK(I2C_NUM) != 0)
-            {
-                LL_I2C_ClearFlag_NACK(I2C_NUM);
-                return 3;
-            }
-        }
+        LL_I2C_EnableAutoEndMode(I2C_NUM);
     }
     else
     {
-        while (timeout != 0 && LL_I2C_IsActiveFlag_RXNE(I2C_NUM) == 0)
-        {
-            if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
-            {
-                timeout -= 1;
-            }
-            if (LL_I2C_IsActiveFlag_NACK(I2C_NUM) != 0)
-            {
-                LL_I2C_ClearFlag_NACK(I2C_NUM);
-                return 3;
-            }
-        }
+        LL_I2C_DisableAutoEndMode(I2C_NUM);
     }
-    if (timeout == 0)
+    LL_I2C_EnableIT_TC(I2C_NUM); /* 只在传输完成、停止、NACK和出错时唤醒，数据由DMA搬运 */
+    LL_I2C_EnableIT_STOP(I2C_NUM);
+    LL_I2C_EnableIT_NACK(I2C_NUM);
+    LL_I2C_EnableIT_ERR(I2C_NUM);
+    LL_I2C_GenerateStartCondition(I2C_NUM);
+
+    while (LL_I2C_IsActiveFlag_STOP(I2C_NUM) == 0 && (stop != 0 || LL_I2C_IsActiveFlag_TC(I2C_NUM) == 0) &&
+           LL_I2C_IsActiveFlag_BERR(I2C_NUM) == 0 && LL_I2C_IsActiveFlag_ARLO(I2C_NUM) == 0)
     {
-        if (i2c_reset() == 0)
+        elapsed = LP_GetElapsedMs(wait->start_tick);
+        if (elapsed >= wait->timeout_ms)
         {
-            return 1;
+            wait->timeout = 1;
+            break;
         }
-        else
+        LP_EnterSleepIRQ(I2C_IRQ, wait->timeout_ms - elapsed); /* 标志未清除时中断保持挂起，不会错过 */
+    }
+
+    ret = I2C_STATUS_OK;
+    if (wait->timeout != 0 || LL_I2C_IsActiveFlag_BERR(I2C_NUM) != 0 || LL_I2C_IsActiveFlag_ARLO(I2C_NUM) != 0)
+    {
+        LL_I2C_ClearFlag_BERR(I2C_NUM);
+        LL_I2C_ClearFlag_ARLO(I2C_NUM);
+        ret = I2C_STATUS_RESET;
+    }
+    else if (LL_I2C_IsActiveFlag_NACK(I2C_NUM) != 0)
+    {
+        LL_I2C_ClearFlag_NACK(I2C_NUM);
+        LL_I2C_ClearFlag_TXE(I2C_NUM); /* 清空未发送的数据 */
+        ret = I2C_STATUS_NACK;
+    }
+    else if (data_size != 0 && LL_DMA_GetDataLength(I2C_DMA, channel) != 0) /* 最后一个字节由DMA取走前已经产生了停止标志 */
+    {
+        WAIT_DelayUs(1);
+        if (LL_DMA_GetDataLength(I2C_DMA, channel) != 0)
         {
-            return 2;
+            ret = I2C_STATUS_RESET;
         }
     }
-    return 0;
+    LL_I2C_ClearFlag_STOP(I2C_NUM);
+
+    LL_I2C_DisableIT_TC(I2C_NUM);
+    LL_I2C_DisableIT_STOP(I2C_NUM);
+    LL_I2C_DisableIT_NACK(I2C_NUM);
+    LL_I2C_DisableIT_ERR(I2C_NUM);
+    LL_I2C_DisableDMAReq_TX(I2C_NUM);
+    LL_I2C_DisableDMAReq_RX(I2C_NUM);
+    if (data_size != 0)
+    {
+        LL_DMA_DisableChannel(I2C_DMA, channel);
+        WRITE_REG(I2C_DMA->IFCR, DMA_IFCR_CGIF1 << ((channel - 1) * 4)); /* 清除该通道全部中断标志 */
+    }
+    return ret;
 }
 
 /**
- * @brief  产生停止标志。
- * @return 2：I2C从机未响应或发生死锁，未恢复，1：I2C从机未响应或发生死锁，已恢复，可以重新执行，0：传输已停止。
+ * @brief  执行一次I2C传输，先写入再读取，传输期间CPU进入Sleep模式。
+ * @param  transfer 传输描述，完成后结果同时存入transfer->status。
+ * @return 传输结果，I2C_STATUS_xxx。
+ * @note   写入和读取都为NULL时只发送地址，用于检测从机。
+ * @note   超时或总线错误时尝试清除死锁，从机的时钟延长期间CPU同样在Sleep模式中等待。
+ * @note   结果和传输时间计入该从机的统计。
  */
-uint8_t I2C_Stop(void)
+uint8_t I2C_Transfer(struct I2C_Transfer *transfer)
 {
-    uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    uint8_t ret, reset;
+    uint16_t elapsed;
+    struct I2C_Stat *stat;
+    struct WAIT_Context wait;
 
-    timeout = I2C_TIMEOUT_MS;
-    systick_tmp = SysTick->CTRL;
-    ((void)systick_tmp);
-    while (timeout != 0 && LL_I2C_IsActiveFlag_TXE(I2C_NUM) == 0)
+    transfer->status = I2C_STATUS_BUSY;
+    WAIT_Begin(&wait, WAIT_SITE_I2C_TRANSFER, I2C_TIMEOUT_MS);
+    while (LL_I2C_IsActiveFlag_BUSY(I2C_NUM) != 0) /* 等待上一次传输的停止标志发送完成 */
     {
-        if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
+        if (WAIT_Poll(&wait) != 0)
         {
-            timeout -= 1;
+            break;
         }
     }
-    if (timeout == 0)
+
+    ret = I2C_STATUS_OK;
+    if (wait.timeout != 0)
+    {
+        ret = I2C_STATUS_RESET;
+    }
+    else
     {
-        if (i2c_reset() == 0)
+        LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+        if (transfer->tx_data != NULL || transfer->rx_data == NULL)
         {
-            return 1;
+            ret = i2c_transfer_dma(transfer->addr, 0, transfer->tx_data, transfer->tx_data != NULL ? transfer->tx_size : 0,
+                                   transfer->rx_data == NULL || transfer->restart == 0, &wait);
         }
-        else
+        if (ret == I2C_STATUS_OK && transfer->rx_data != NULL)
         {
-            return 2;
+            ret = i2c_transfer_dma(transfer->addr, 1, transfer->rx_data, transfer->rx_size, 1, &wait);
         }
+        LL_AHB1_GRP1_DisableClock(LL_AHB1_GRP1_PERIPH_DMA1);
     }
-    LL_I2C_GenerateStopCondition(I2C_NUM);
-    timeout = I2C_TIMEOUT_MS;
-    systick_tmp = SysTick->CTRL;
-    ((void)systick_tmp);
-    while (timeout != 0 && LL_I2C_IsActiveFlag_BUSY(I2C_NUM) != 0)
+    stat = i2c_find_stat(transfer->addr);
+    if (ret == I2C_STATUS_NACK && stat != NULL)
     {
-        if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
-        {
-            timeout -= 1;
-        }
+        i2c_count(&stat->nacks);
     }
-    if (timeout == 0)
+    if (ret == I2C_STATUS_RESET)
     {
-        if (i2c_reset() != 0)
+        reset = i2c_reset();
+        if (stat != NULL)
+        {
+            i2c_count(&stat->timeouts);
+            if (reset == 2)
+            {
+                i2c_count(&stat->recoveries);
+            }
+        }
+        if (reset != 1)
         {
-            return 2;
+            ret = I2C_STATUS_RECOVERED;
         }
         else
         {
-            return 1;
+            ret = I2C_STATUS_STUCK;
         }
     }
-    return 0;
+    elapsed = LP_GetElapsedMs(wait.start_tick);
+    if (stat != NULL && elapsed > stat->max_ms)
+    {
+        stat->max_ms = elapsed;
+    }
+    WAIT_End(&wait);
+
+    transfer->status = ret;
+    return ret;
 }
 
 /**
- * @brief  发送一字节。
- * @param  byte 要传输的数据。
- * @return 2：I2C从机未响应或发生死锁，未恢复，1：I2C从机未响应或发生死锁，需要重新执行，0：数据已发送。
+ * @brief  读取从机的总线健康统计。
+ * @param  addr I2C设备地址。
+ * @param  stat 统计结果，没有记录时全部为0。
+ * @return 1：该从机没有记录，0：读取完成。
  */
-uint8_t I2C_WriteByte(uint8_t byte)
+uint8_t I2C_GetStat(uint8_t addr, struct I2C_Stat *stat)
 {
-    uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    uint8_t i;
 
-    timeout = I2C_TIMEOUT_MS;
-    systick_tmp = SysTick->CTRL;
-    ((void)systick_tmp);
-    while (timeout != 0 && LL_I2C_IsActiveFlag_TXE(I2C_NUM) == 0)
+    for (i = 0; i < I2C_STAT_SLOTS; i++)
     {
-        if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
+        if (Stat[i].addr == addr)
         {
-            timeout -= 1;
+            *stat = Stat[i];
+            return 0;
         }
     }
-    if (timeout == 0)
+    stat->addr = addr;
+    stat->nacks = 0;
+    stat->timeouts = 0;
+    stat->recoveries = 0;
+    stat->crc_errors = 0;
+    stat->max_ms = 0;
+    return 1;
+}
+
+/**
+ * @brief  覆盖从机的总线健康统计，用于从EEPROM恢复。
+ * @param  stat 统计内容，按stat->addr查找位置。
+ * @return 1：没有空位置，0：写入完成。
+ */
+uint8_t I2C_SetStat(const struct I2C_Stat *stat)
+{
+    struct I2C_Stat *slot;
+
+    slot = i2c_find_stat(stat->addr);
+    if (slot == NULL)
     {
-        if (i2c_reset() != 0)
-        {
-            return 2;
-        }
-        else
-        {
-            return 1;
-        }
+        return 1;
     }
-    LL_I2C_TransmitData8(I2C_NUM, byte);
+    *slot = *stat;
     return 0;
 }
 
 /**
- * @brief  接收一字节。
- * @return 接收到的数据。
+ * @brief  设备驱动报告一次数据校验错误，I2C模块本身不检查数据内容。
+ * @param  addr I2C设备地址。
  */
-uint8_t I2C_ReadByte(void)
+void I2C_ReportCRCError(uint8_t addr)
 {
-    uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    struct I2C_Stat *stat;
 
-    timeout = I2C_TIMEOUT_MS;
-    systick_tmp = SysTick->CTRL;
-    ((void)systick_tmp);
-    while (timeout != 0 && LL_I2C_IsActiveFlag_RXNE(I2C_NUM) == 0)
-    {
-        if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U)
-        {
-            timeout -= 1;
-        }
-    }
-    if (timeout == 0)
+    stat = i2c_find_stat(addr);
+    if (stat != NULL)
     {
-        i2c_reset();
-        return 0x00;
+        i2c_count(&stat->crc_errors);
     }
-    return LL_I2C_ReceiveData8(I2C_NUM);
 }
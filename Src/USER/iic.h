@@ -3,6 +3,7 @@
 
 #include "main.h"
 #include "i2c.h"
+#include <stddef.h>
 
 /* 可修改 */
 #define I2C_NUM I2C1
@@ -13,13 +14,47 @@
 #define I2C_SDA_PORT GPIOB
 #define I2C_SDA_PIN LL_GPIO_PIN_7
 #define I2C_INIT_FUNC MX_I2C1_Init
+#define I2C_IRQ I2C1_IRQn
+#define I2C_DMA DMA1
+#define I2C_DMA_TX_CHANNEL LL_DMA_CHANNEL_6 /* 通道2和3与电子纸SPI共用请求线，使用6和7 */
+#define I2C_DMA_RX_CHANNEL LL_DMA_CHANNEL_7
+#define I2C_DMA_REQUEST LL_DMA_REQUEST_6
+#define I2C_STAT_SLOTS 2 /* 分别统计的从机数量，超过后出现的从机不统计 */
 /* 结束 */
 
 #define I2C_TIMEOUT_MS 1000
 
-uint8_t I2C_Start(uint8_t addr, uint8_t is_read, uint8_t data_size);
-uint8_t I2C_Stop(void);
-uint8_t I2C_WriteByte(uint8_t byte);
-uint8_t I2C_ReadByte(void);
+#define I2C_STATUS_OK 0        /* 传输完成 */
+#define I2C_STATUS_RECOVERED 1 /* 从机未响应或发生死锁，已恢复，可以重新执行 */
+#define I2C_STATUS_STUCK 2     /* 从机未响应或发生死锁，未恢复 */
+#define I2C_STATUS_NACK 3      /* 发送地址或数据后收到了NACK */
+#define I2C_STATUS_BUSY 0xFF   /* 传输进行中 */
+
+struct I2C_Transfer /* 一次I2C传输，先写入再读取，只需要其中一种时另一种设置为NULL */
+{
+    uint8_t addr;           /* I2C设备地址 */
+    const uint8_t *tx_data; /* 要写入的数据，NULL为不写入 */
+    uint8_t tx_size;
+    uint8_t *rx_data; /* 读取数据的存放位置，NULL为不读取 */
+    uint8_t rx_size;
+    uint8_t restart; /* 1：写入后重新启动再读取，0：写入后先发送停止标志 */
+    uint8_t status;  /* 传输结果，I2C_STATUS_xxx，传输期间为I2C_STATUS_BUSY */
+};
+
+struct I2C_Stat /* 一个从机的总线健康统计，计数达到255后不再增加 */
+{
+    uint8_t addr;       /* I2C设备地址，0为未使用 */
+    uint8_t nacks;      /* 收到NACK的次数 */
+    uint8_t timeouts;   /* 超时或总线错误的次数 */
+    uint8_t recoveries; /* 数据线被拉低，在时钟线上发送脉冲后恢复的次数 */
+    uint8_t crc_errors; /* 读出的数据校验错误的次数，由设备驱动报告 */
+    uint16_t max_ms;    /* 最长传输时间，包括清除死锁的时间 */
+};
+
+uint8_t I2C_Transfer(struct I2C_Transfer *transfer);
+
+uint8_t I2C_GetStat(uint8_t addr, struct I2C_Stat *stat);
+uint8_t I2C_SetStat(const struct I2C_Stat *stat);
+void I2C_ReportCRCError(uint8_t addr);
 
 #endif
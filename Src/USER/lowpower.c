@@ -24,35 +24,102 @@ static void wkup_exti_deinit(void)
     NVIC_ClearPendingIRQ(LP_WKUP_IRQ);    /* 清除待处理中断 */
 }
 
+/**
+ * @brief  打开指定外部中断线所在的中断请求，用于额外的Stop模式唤醒源。
+ * @param  exti_lines 外部中断线，只支持2至15。
+ * @note   外部中断标志由调用者管理，此处不清除，标志未清除时会立刻唤醒。
+ */
+static void extra_exti_init(uint32_t exti_lines)
+{
+    if ((exti_lines & (LL_EXTI_LINE_2 | LL_EXTI_LINE_3)) != 0)
+    {
+        NVIC_ClearPendingIRQ(EXTI2_3_IRQn);
+        NVIC_EnableIRQ(EXTI2_3_IRQn);
+        NVIC_SetPriority(EXTI2_3_IRQn, 0);
+    }
+    if ((exti_lines & 0x0000FFF0) != 0) /* 外部中断线4至15 */
+    {
+        NVIC_ClearPendingIRQ(EXTI4_15_IRQn);
+        NVIC_EnableIRQ(EXTI4_15_IRQn);
+        NVIC_SetPriority(EXTI4_15_IRQn, 0);
+    }
+}
+
+/**
+ * @brief  关闭额外唤醒源的中断请求。
+ * @param  exti_lines 外部中断线，与extra_exti_init()相同。
+ */
+static void extra_exti_deinit(uint32_t exti_lines)
+{
+    if ((exti_lines & (LL_EXTI_LINE_2 | LL_EXTI_LINE_3)) != 0)
+    {
+        NVIC_DisableIRQ(EXTI2_3_IRQn);
+        NVIC_ClearPendingIRQ(EXTI2_3_IRQn);
+    }
+    if ((exti_lines & 0x0000FFF0) != 0)
+    {
+        NVIC_DisableIRQ(EXTI4_15_IRQn);
+        NVIC_ClearPendingIRQ(EXTI4_15_IRQn);
+    }
+}
+
+/**
+ * @brief  启动低功耗定时器，计数器在0至0xFFFF之间循环计数，作为全局时基。
+ * @note   中断使能只能在定时器关闭时修改，所以启动前打开比较匹配中断，是否唤醒由外部中断和中断请求控制。
+ */
+static void lptim_start(void)
+{
+    if (LL_LPTIM_IsEnabled(LP_LPTIM_NUM) != 0)
+    {
+        return;
+    }
+    LL_LPTIM_EnableIT_CMPM(LP_LPTIM_NUM);
+    LL_LPTIM_Enable(LP_LPTIM_NUM);
+    LL_LPTIM_ClearFlag_ARROK(LP_LPTIM_NUM);
+    LL_LPTIM_SetAutoReload(LP_LPTIM_NUM, 0xFFFF);
+    while (LL_LPTIM_IsActiveFlag_ARROK(LP_LPTIM_NUM) == 0) /* 等待写入同步到低功耗定时器时钟域，约2个LSI周期 */
+    {
+    }
+    LL_LPTIM_StartCounter(LP_LPTIM_NUM, LL_LPTIM_OPERATING_MODE_CONTINUOUS);
+}
+
 /**
  * @brief  低功耗定时器初始化。
  * @param  ms 定时时间，单位为毫秒
  */
 static void lptim_init(uint16_t ms)
 {
-    if (LL_LPTIM_IsEnabled(LP_LPTIM_NUM) == 0) /* 确保已打开低功耗定时器 */
+    uint16_t ticks;
+
+    lptim_start();
+    ticks = (ms / (1000 / LP_LPTIM_FINAL_CLK)) + 0.5;
+    if (ticks < 2) /* 保证比较值写入完成前不会匹配 */
     {
-        LL_LPTIM_Enable(LP_LPTIM_NUM);
+        ticks = 2;
     }
-    LL_LPTIM_SetAutoReload(LP_LPTIM_NUM, (ms / (1000 / LP_LPTIM_FINAL_CLK)) + 0.5); /* 设置重载数值 */
-    LL_LPTIM_EnableIT_ARRM(LP_LPTIM_NUM);                                           /* 打开重载数值匹配中断 */
-    LL_EXTI_EnableIT_0_31(LP_LPTIM_EXTI);                                           /* 打开外部中断 */
-    NVIC_EnableIRQ(LP_LPTIM_WKUP_IRQ);                                              /* 打开中断请求 */
-    NVIC_SetPriority(LP_LPTIM_WKUP_IRQ, 0);                                         /* 设置中断请求优先级 */
-    LL_LPTIM_StartCounter(LP_LPTIM_NUM, LL_LPTIM_OPERATING_MODE_ONESHOT);           /* 开始计数 */
+    LL_LPTIM_ClearFlag_CMPOK(LP_LPTIM_NUM);
+    LL_LPTIM_SetCompare(LP_LPTIM_NUM, (uint16_t)(LP_GetTick() + ticks)); /* 设置比较数值 */
+    while (LL_LPTIM_IsActiveFlag_CMPOK(LP_LPTIM_NUM) == 0)
+    {
+    }
+    LL_LPTIM_ClearFLAG_CMPM(LP_LPTIM_NUM);   /* 清除之前的匹配标志 */
+    LL_EXTI_ClearFlag_0_31(LP_LPTIM_EXTI);   /* 清除中断标志 */
+    NVIC_ClearPendingIRQ(LP_LPTIM_WKUP_IRQ); /* 清除待处理中断 */
+    LL_EXTI_EnableIT_0_31(LP_LPTIM_EXTI);    /* 打开外部中断 */
+    NVIC_EnableIRQ(LP_LPTIM_WKUP_IRQ);       /* 打开中断请求 */
+    NVIC_SetPriority(LP_LPTIM_WKUP_IRQ, 0);  /* 设置中断请求优先级 */
 }
 
 /**
- * @brief  低功耗定时器关闭。
+ * @brief  低功耗定时器关闭定时，计数器继续运行。
  */
 static void lptim_deinit(void)
 {
     NVIC_DisableIRQ(LP_LPTIM_WKUP_IRQ);      /* 关闭中断请求 */
-    LL_LPTIM_DisableIT_ARRM(LP_LPTIM_NUM);   /* 关闭重载数值匹配中断 */
-    LL_LPTIM_ClearFLAG_ARRM(LP_LPTIM_NUM);   /* 清除中断标志 */
+    LL_EXTI_DisableIT_0_31(LP_LPTIM_EXTI);   /* 关闭外部中断 */
+    LL_LPTIM_ClearFLAG_CMPM(LP_LPTIM_NUM);   /* 清除中断标志 */
     LL_EXTI_ClearFlag_0_31(LP_LPTIM_EXTI);   /* 清除中断标志 */
     NVIC_ClearPendingIRQ(LP_LPTIM_WKUP_IRQ); /* 清除待处理中断 */
-    LL_LPTIM_Disable(LP_LPTIM_NUM);          /* 关闭低功耗定时器 */
 }
 
 /**
@@ -69,6 +136,33 @@ void LP_DisableDebug(void)
     LL_GPIO_SetPinPull(GPIOA, LL_GPIO_PIN_14, LL_GPIO_PULL_NO);                        /* 关闭调试IO内部上下拉电阻 */
 }
 
+/**
+ * @brief  获取低功耗定时器的计数值，在Sleep和Stop模式下也会继续计数。
+ * @return 计数值，频率为LP_LPTIM_FINAL_CLK，计满0xFFFF后从0开始。
+ * @note   第一次调用时启动定时器，Standby模式下停止。
+ */
+uint16_t LP_GetTick(void)
+{
+    uint16_t tick;
+
+    lptim_start();
+    do /* 计数器与系统时钟不同步，连续两次读取相同时才有效 */
+    {
+        tick = LL_LPTIM_GetCounter(LP_LPTIM_NUM);
+    } while (tick != LL_LPTIM_GetCounter(LP_LPTIM_NUM));
+    return tick;
+}
+
+/**
+ * @brief  计算从指定计数值到现在经过的时间。
+ * @param  start_tick 开始时通过LP_GetTick()获取的计数值。
+ * @return 经过的时间，单位为毫秒，最长约28秒。
+ */
+uint16_t LP_GetElapsedMs(uint16_t start_tick)
+{
+    return ((uint32_t)(uint16_t)(LP_GetTick() - start_tick) * 2000 + (uint32_t)LP_LPTIM_FINAL_CLK) / (uint32_t)(LP_LPTIM_FINAL_CLK * 2); /* 整数运算并四舍五入 */
+}
+
 /**
  * @brief  获取系统复位类型。
  * @return LP_RESET_NORMALRESET：普通复位（nRST按键复位、看门狗复位...），LP_RESET_POWERON：上电复位（电源连接，安装电池...），LP_RESET_WKUPSTANDBY：从Standby模式唤醒。
@@ -134,6 +228,109 @@ void LP_EnterSleep(uint16_t ms)
     __enable_irq(); /* 重新响应所有中断 */
 }
 
+/**
+ * @brief  进入Sleep模式，等待指定外设中断唤醒。
+ * @param  irq 唤醒用的外设中断请求，进入前需打开外设自身的中断。
+ * @param  ms 超时时间，0为永不超时，每增加1超时时间大约增加1毫秒。
+ * @note   外设时钟保持运行，DMA等传输可以在睡眠期间继续进行。
+ * @note   不进入中断服务函数，唤醒后需由调用者检查并清除外设中断标志。
+ */
+void LP_EnterSleepIRQ(IRQn_Type irq, uint16_t ms)
+{
+    uint32_t voltage_scale;
+
+    __disable_irq(); /* 暂停响应所有中断 */
+
+    NVIC_ClearPendingIRQ(irq); /* 外设标志未清除时会重新挂起 */
+    NVIC_EnableIRQ(irq);
+    NVIC_SetPriority(irq, 0);
+    if (ms != 0)
+    {
+        lptim_init(ms); /* 初始化低功耗定时器 */
+    }
+
+    voltage_scale = LL_PWR_GetRegulVoltageScaling();
+    LL_PWR_SetRegulVoltageScaling(LL_PWR_REGU_VOLTAGE_SCALE2); /* 设置Vcore电压等级到二级，CPU最高允许8Mhz */
+    LL_LPM_EnableSleep();                                      /* 准备进入Sleep模式 */
+    LL_FLASH_DisableSleepPowerDown();                          /* 保持Flash电源，DMA可能正在读取Flash */
+    __WFI();                                                   /* 进入Sleep模式，等待中断唤醒 */
+    LL_PWR_SetRegulVoltageScaling(voltage_scale);              /* 恢复Vcore电压等级 */
+
+    NVIC_DisableIRQ(irq);      /* 关闭中断请求 */
+    NVIC_ClearPendingIRQ(irq); /* 清除待处理中断 */
+    if (ms != 0)
+    {
+        lptim_deinit(); /* 关闭低功耗定时器 */
+    }
+
+    __enable_irq(); /* 重新响应所有中断 */
+}
+
+/**
+ * @brief  进入Sleep模式一段时间，用于等待外设标志。
+ * @param  ms 睡眠时间，每增加1时间大约增加1毫秒。
+ * @note   外设时钟和NVM电源保持，I2C、ADC、EEPROM编程等操作在睡眠期间继续进行。
+ * @note   由低功耗定时器或唤醒外部中断（电子纸BUSY引脚）唤醒，唤醒后程序从停止位置继续执行。
+ */
+void LP_EnterSleepPoll(uint16_t ms)
+{
+    uint32_t voltage_scale;
+
+    __disable_irq(); /* 暂停响应所有中断 */
+
+    wkup_exti_init();
+    lptim_init(ms); /* 初始化低功耗定时器 */
+
+    voltage_scale = LL_PWR_GetRegulVoltageScaling();
+    LL_PWR_SetRegulVoltageScaling(LL_PWR_REGU_VOLTAGE_SCALE2); /* 设置Vcore电压等级到二级，CPU最高允许8Mhz */
+    LL_LPM_EnableSleep();                                      /* 准备进入Sleep模式 */
+    LL_FLASH_DisableSleepPowerDown();                          /* 保持NVM电源，EEPROM可能正在编程 */
+    __WFI();                                                   /* 进入Sleep模式，等待唤醒 */
+    LL_PWR_SetRegulVoltageScaling(voltage_scale);              /* 恢复Vcore电压等级 */
+
+    wkup_exti_deinit();
+    lptim_deinit(); /* 关闭低功耗定时器 */
+
+    __enable_irq(); /* 重新响应所有中断 */
+}
+
+/**
+ * @brief  进入Sleep模式，除唤醒引脚和低功耗定时器外，还可由指定的外部中断线唤醒。
+ * @param  exti_lines 额外的唤醒外部中断线，只支持2至15，0为不使用，需已打开外部中断。
+ * @param  ms 超时时间，0为永不超时，每增加1超时时间大约增加1毫秒。
+ * @note   定时器时钟保持运行，用于等待按钮时蜂鸣器继续鸣响，Stop模式下定时器会停止。
+ * @note   不进入中断服务函数，额外外部中断线的标志由调用者检查并清除。
+ */
+void LP_EnterSleepEXTI(uint32_t exti_lines, uint16_t ms)
+{
+    uint32_t voltage_scale;
+
+    __disable_irq(); /* 暂停响应所有中断 */
+
+    wkup_exti_init();
+    extra_exti_init(exti_lines);
+    if (ms != 0)
+    {
+        lptim_init(ms); /* 初始化低功耗定时器 */
+    }
+
+    voltage_scale = LL_PWR_GetRegulVoltageScaling();
+    LL_PWR_SetRegulVoltageScaling(LL_PWR_REGU_VOLTAGE_SCALE2); /* 设置Vcore电压等级到二级，CPU最高允许8Mhz */
+    LL_LPM_EnableSleep();                                      /* 准备进入Sleep模式 */
+    LL_FLASH_EnableSleepPowerDown();                           /* 进入Sleep模式后，关闭Flash电源，减小电流消耗 */
+    __WFI();                                                   /* 进入Sleep模式，等待中断唤醒 */
+    LL_PWR_SetRegulVoltageScaling(voltage_scale);              /* 恢复Vcore电压等级 */
+
+    extra_exti_deinit(exti_lines);
+    wkup_exti_deinit();
+    if (ms != 0)
+    {
+        lptim_deinit(); /* 关闭低功耗定时器 */
+    }
+
+    __enable_irq(); /* 重新响应所有中断 */
+}
+
 /**
  * @brief  进入Stop模式，等待中断唤醒，进入前需确保I2C没有数据传输或暂时关闭I2C，详见 dm00114897 第16页 2.5.1。
  * @param  ms 超时时间，0为永不超时，每增加1超时时间大约增加1毫秒。
@@ -142,6 +339,17 @@ void LP_EnterSleep(uint16_t ms)
  * @note   唤醒后程序从停止位置继续执行。
  */
 void LP_EnterStop(uint16_t ms)
+{
+    LP_EnterStopEXTI(0, ms);
+}
+
+/**
+ * @brief  进入Stop模式，除唤醒引脚和低功耗定时器外，还可由指定的外部中断线唤醒。
+ * @param  exti_lines 额外的唤醒外部中断线，只支持2至15，0为不使用。
+ * @param  ms 超时时间，0为永不超时。
+ * @param  check_wkup 1：打开唤醒中断后唤醒引脚已经为低电平时不进入Stop模式，0：不检查。
+ */
+static void enter_stop(uint32_t exti_lines, uint16_t ms, uint8_t check_wkup)
 {
     uint32_t voltage_scale;
 
@@ -150,22 +358,28 @@ void LP_EnterStop(uint16_t ms)
     LL_PWR_DisableWakeUpPin(LP_STANDBY_WKUP_PIN); /* 禁用Standby唤醒引脚 */
     LL_PWR_ClearFlag_WU();                        /* 清除Standby唤醒标志 */
     wkup_exti_init();
+    extra_exti_init(exti_lines);
     if (ms != 0)
     {
         lptim_init(ms); /* 初始化低功耗定时器 */
     }
 
-    voltage_scale = LL_PWR_GetRegulVoltageScaling();
-    LL_PWR_SetRegulVoltageScaling(LL_PWR_REGU_VOLTAGE_SCALE2);   /* 设置Vcore电压等级到二级，CPU最高允许8Mhz */
-    LL_PWR_EnableUltraLowPower();                                /* 进入低功耗模式后，关闭VREFINT */
-    LL_PWR_DisableFastWakeUp();                                  /* 唤醒后等待VREFINT恢复 */
-    LL_RCC_SetClkAfterWakeFromStop(LL_RCC_STOP_WAKEUPCLOCK_HSI); /* 设置唤醒后的系统时钟源为HSI16，默认唤醒后为MSI */
-    LL_PWR_SetRegulModeLP(LL_PWR_REGU_LPMODES_LOW_POWER);        /* 设置进入低功耗模式后，稳压器为低功耗模式 */
-    LL_PWR_SetPowerMode(LL_PWR_MODE_STOP);                       /* 设置DeepSleep为Stop模式 */
-    LL_LPM_EnableDeepSleep();                                    /* 准备进入Stop模式 */
-    __WFI();                                                     /* 进入Stop模式，等待中断唤醒 */
-    LL_PWR_SetRegulVoltageScaling(voltage_scale);                /* 恢复Vcore电压等级 */
+    /* 调用者检查引脚之后、唤醒中断标志清除之前出现的下降沿已经丢失，此时引脚为低电平，进入Stop模式只能等到超时 */
+    if (check_wkup == 0 || LL_GPIO_IsInputPinSet(LP_WKUP_PORT, LP_WKUP_PIN) != 0)
+    {
+        voltage_scale = LL_PWR_GetRegulVoltageScaling();
+        LL_PWR_SetRegulVoltageScaling(LL_PWR_REGU_VOLTAGE_SCALE2);   /* 设置Vcore电压等级到二级，CPU最高允许8Mhz */
+        LL_PWR_EnableUltraLowPower();                                /* 进入低功耗模式后，关闭VREFINT */
+        LL_PWR_DisableFastWakeUp();                                  /* 唤醒后等待VREFINT恢复 */
+        LL_RCC_SetClkAfterWakeFromStop(LL_RCC_STOP_WAKEUPCLOCK_HSI); /* 设置唤醒后的系统时钟源为HSI16，默认唤醒后为MSI */
+        LL_PWR_SetRegulModeLP(LL_PWR_REGU_LPMODES_LOW_POWER);        /* 设置进入低功耗模式后，稳压器为低功耗模式 */
+        LL_PWR_SetPowerMode(LL_PWR_MODE_STOP);                       /* 设置DeepSleep为Stop模式 */
+        LL_LPM_EnableDeepSleep();                                    /* 准备进入Stop模式 */
+        __WFI();                                                     /* 进入Stop模式，等待中断唤醒 */
+        LL_PWR_SetRegulVoltageScaling(voltage_scale);                /* 恢复Vcore电压等级 */
+    }
 
+    extra_exti_deinit(exti_lines);
     wkup_exti_deinit();
     LL_PWR_DisableUltraLowPower(); /* 恢复电源配置 */
     if (ms != 0)
@@ -176,6 +390,39 @@ void LP_EnterStop(uint16_t ms)
     __enable_irq(); /* 重新响应所有中断 */
 }
 
+/**
+ * @brief  进入Stop模式，除唤醒引脚和低功耗定时器外，还可由指定的外部中断线唤醒。
+ * @param  exti_lines 额外的唤醒外部中断线，只支持2至15，0为不使用，需已打开外部中断。
+ * @param  ms 超时时间，0为永不超时，每增加1超时时间大约增加1毫秒。
+ * @note   不进入中断服务函数，额外外部中断线的标志由调用者检查并清除。
+ */
+void LP_EnterStopEXTI(uint32_t exti_lines, uint16_t ms)
+{
+    enter_stop(exti_lines, ms, 0);
+}
+
+/**
+ * @brief  进入Stop模式，等待唤醒引脚的下降沿或超时。
+ * @param  ms 超时时间，0为永不超时，每增加1超时时间大约增加1毫秒。
+ * @note   打开唤醒中断后再次检查唤醒引脚，已经为低电平时不进入Stop模式，立即返回。
+ * @note   用于调用者检查到引脚为高电平后等待其变低，LP_EnterStop()会清除检查之后出现的下降沿。
+ */
+void LP_EnterStopWkup(uint16_t ms)
+{
+    enter_stop(0, ms, 1);
+}
+
+/**
+ * @brief  进入Stop模式，等待唤醒引脚的下降沿、指定的外部中断线或超时。
+ * @param  exti_lines 额外的唤醒外部中断线，与LP_EnterStopEXTI()相同。
+ * @param  ms 超时时间，0为永不超时，每增加1超时时间大约增加1毫秒。
+ * @note   与LP_EnterStopWkup()相同，打开唤醒中断后唤醒引脚已经为低电平时立即返回。
+ */
+void LP_EnterStopWkupEXTI(uint32_t exti_lines, uint16_t ms)
+{
+    enter_stop(exti_lines, ms, 1);
+}
+
 /**
  * @brief  进入Standby模式，等待WKUP引脚或复位唤醒。
  * @note   进入后除唤醒IO以外的IO均自动变为高阻状态。
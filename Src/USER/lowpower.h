@@ -7,6 +7,8 @@
 #define LP_STANDBY_WKUP_PIN LL_PWR_WAKEUP_PIN1
 #define LP_WKUP_EXTI LL_EXTI_LINE_0
 #define LP_WKUP_IRQ EXTI0_1_IRQn
+#define LP_WKUP_PORT EPD_BUSY_EXTI0_GPIO_Port /* 唤醒外部中断所在的引脚，下降沿唤醒 */
+#define LP_WKUP_PIN EPD_BUSY_EXTI0_Pin
 
 #define LP_LPTIM_NUM LPTIM1
 #define LP_LPTIM_EXTI LL_EXTI_LINE_29
@@ -21,9 +23,17 @@
 
 void LP_DisableDebug(void);
 uint8_t LP_GetResetInfo(void);
+uint16_t LP_GetTick(void);
+uint16_t LP_GetElapsedMs(uint16_t start_tick);
 
 void LP_EnterSleep(uint16_t ms);
+void LP_EnterSleepIRQ(IRQn_Type irq, uint16_t ms);
+void LP_EnterSleepPoll(uint16_t ms);
+void LP_EnterSleepEXTI(uint32_t exti_lines, uint16_t ms);
 void LP_EnterStop(uint16_t ms);
+void LP_EnterStopEXTI(uint32_t exti_lines, uint16_t ms);
+void LP_EnterStopWkup(uint16_t ms);
+void LP_EnterStopWkupEXTI(uint32_t exti_lines, uint16_t ms);
 void LP_EnterStandby(void);
 void LP_DelayStop(uint16_t ms);
 
@@ -0,0 +1,349 @@
+#ifndef _PACKIMAGE_H_
+#define _PACKIMAGE_H_
+
+/* 此文件由 资源/图像压缩/packimage.py 根据 packimage.txt 生成，请勿手动修改 */
+/* 格式：图像宽度, 图像宽度, 图像高度, 游程编码数据...，使用EPD_DrawPackedImage()绘制 */
+
+#include "main.h"
+
+/* 欢迎_296x96.bmp，原始3552字节，压缩后2846字节 */
+static const uint8_t EPD_PackedImage_Welcome_296x96[] = {
+    255, 41, 96, /* 图像宽度，图像宽度，图像高度*/
+    0x90, 0x53, 0xB9, 0x2E, 0xC5, 0x15, 0x34, 0x49, 0x6E, 0x68, 0x5A, 0xEE, 0x5B, 0xA9, 0x2E, 0xEE,
+    0x59, 0x39, 0x25, 0xBB, 0xAB, 0x16, 0x22, 0xEE, 0x41, 0x0A, 0xAE, 0xEE, 0x5B, 0xA9, 0x28, 0x62,
+    0xB8, 0x48, 0x53, 0x88, 0xBB, 0x14, 0x4A, 0xB9, 0x25, 0xA9, 0xEF, 0xC8, 0x18, 0xCE, 0x48, 0x49,
+    0x12, 0x48, 0xDA, 0xBF, 0xA8, 0xD8, 0xA8, 0x8B, 0x96, 0x17, 0x91, 0x29, 0x2A, 0xFE, 0xA3, 0x6A,
+    0x71, 0x0A, 0xA5, 0xA8, 0x93, 0x16, 0x4B, 0x7B, 0xBF, 0xA8, 0xDB, 0x4A, 0x3E, 0x5B, 0x4A, 0xE6,
+    0x92, 0xBD, 0xA9, 0x2F, 0xEA, 0x36, 0x7B, 0x39, 0x65, 0x9E, 0xE6, 0x92, 0xD3, 0xA9, 0x2F, 0xC8,
+    0xA7, 0x18, 0x32, 0xA8, 0x63, 0x9A, 0x49, 0x2D, 0xEE, 0xE2, 0x62, 0xA2, 0x46, 0x29, 0x63, 0x0C,
+    0x59, 0x12, 0x92, 0xAC, 0x58, 0x22, 0x87, 0x61, 0x08, 0x25, 0x9E, 0xA1, 0x79, 0x6E, 0x32, 0xC5,
+    0x0B, 0xB9, 0x44, 0x7A, 0x96, 0xE2, 0xD1, 0xAE, 0x32, 0xEE, 0xE2, 0x5E, 0xA5, 0xAF, 0xFA, 0xA7,
+    0xA8, 0x94, 0x22, 0xE3, 0x2E, 0xEE, 0x2F, 0x11, 0xAF, 0xFA, 0x93, 0x10, 0x32, 0xAE, 0x32, 0xC5,
+    0x0A, 0xEA, 0xAA, 0xBF, 0xEA, 0x4E, 0xAA, 0x36, 0xAC, 0x5A, 0x85, 0xFA, 0xED, 0x44, 0xA9, 0x3A,
+    0xEC, 0x62, 0xB8, 0xC9, 0x61, 0xCD, 0x7F, 0xA8, 0x76, 0xEA, 0x26, 0x5A, 0x8F, 0x31, 0x2B, 0xFE,
+    0xA5, 0x30, 0x4A, 0xEE, 0x22, 0x5B, 0x4A, 0x2A, 0xE5, 0xAF, 0xFA, 0x96, 0xE2, 0x62, 0x6E, 0x49,
+    0xE5, 0x9E, 0x71, 0x91, 0x1E, 0xA8, 0x61, 0x91, 0xEE, 0x54, 0x5A, 0x18, 0x2A, 0xE2, 0x27, 0xA9,
+    0x6E, 0x31, 0x16, 0xE3, 0x25, 0x84, 0x8C, 0x12, 0x94, 0xC1, 0x28, 0x42, 0x09, 0x52, 0xAB, 0x84,
+    0x05, 0x38, 0x42, 0x5B, 0x8C, 0xA8, 0xAF, 0x4A, 0xE1, 0x0B, 0xB9, 0x24, 0x8B, 0x96, 0xEE, 0x22,
+    0xA2, 0x12, 0x5E, 0x49, 0x05, 0x2B, 0xB9, 0x29, 0x0C, 0xA1, 0x82, 0x3C, 0xE4, 0xBE, 0x49, 0x22,
+    0xC5, 0x39, 0x22, 0xE5, 0xA8, 0xC3, 0x79, 0x62, 0xE4, 0x92, 0x13, 0xA4, 0x32, 0x36, 0x33, 0xE5,
+    0xAC, 0xAA, 0x4A, 0x42, 0x62, 0xA1, 0x09, 0x12, 0x92, 0x33, 0xE5, 0xAE, 0xAE, 0x8A, 0x2E, 0xA7,
+    0x9A, 0x26, 0x4B, 0x78, 0x86, 0xBE, 0xCD, 0xAB, 0x92, 0xA2, 0xAD, 0x2A, 0xAB, 0x89, 0xAF, 0x6A,
+    0x2B, 0xFF, 0xBA, 0xEA, 0xE4, 0xB4, 0xE4, 0x9E, 0xAE, 0x8E, 0xED, 0x3A, 0x8A, 0xF3, 0xBA, 0xCA,
+    0xA4, 0x88, 0xC6, 0x28, 0xB9, 0x24, 0xB7, 0x88, 0xA8, 0xB8, 0xB9, 0x05, 0x12, 0x2A, 0x6E, 0x4A,
+    0x91, 0x29, 0x22, 0x50, 0x5E, 0x1D, 0xA2, 0x24, 0xEA, 0x0A, 0x6A, 0xE1, 0xDA, 0x97, 0xEE, 0xE1,
+    0x68, 0x82, 0xEA, 0xE6, 0x9A, 0x3E, 0xA5, 0xA9, 0x2E, 0x12, 0xFC, 0xAB, 0xFE, 0x4A, 0x79, 0xA7,
+    0x59, 0x28, 0x8B, 0xEE, 0xE1, 0x2A, 0x5A, 0xBF, 0xD1, 0x6B, 0xF3, 0x1D, 0x96, 0x6D, 0x3A, 0xB8,
+    0x45, 0x3E, 0xAF, 0xF9, 0xAB, 0xF9, 0x23, 0xE6, 0x9A, 0xAC, 0x58, 0x8A, 0x5A, 0xB1, 0x6A, 0x9F,
+    0x92, 0x3E, 0x10, 0xB8, 0x4B, 0xF2, 0xAF, 0xE6, 0xAC, 0xA9, 0x8F, 0x9A, 0x6A, 0xBA, 0x84, 0xE2,
+    0x3F, 0x45, 0xA7, 0xE4, 0x8F, 0xA7, 0x9A, 0xAE, 0xE3, 0x85, 0xAF, 0xF9, 0x2B, 0xF9, 0x23, 0xEB,
+    0xF3, 0x2B, 0x92, 0x36, 0x79, 0x0B, 0xAB, 0xAF, 0xCC, 0x3E, 0xBF, 0x92, 0xAE, 0x54, 0x2E, 0x93,
+    0x8A, 0xAB, 0xA7, 0x9A, 0x3E, 0x9F, 0x92, 0xAE, 0x12, 0x69, 0x84, 0xA6, 0x9A, 0x3E, 0xB2, 0xA6,
+    0xA0, 0x9A, 0x26, 0x11, 0x92, 0x6A, 0x7E, 0x4A, 0x82, 0x41, 0x4A, 0x11, 0xB9, 0xEB, 0xF9, 0x2A,
+    0x48, 0x4A, 0x7A, 0x46, 0x96, 0x4B, 0x88, 0xA3, 0xAA, 0xFC, 0xCA, 0x90, 0x4E, 0x68, 0xA9, 0xA4,
+    0xA8, 0x96, 0x26, 0x9E, 0x6A, 0x92, 0x12, 0x91, 0x2A, 0x16, 0xA4, 0xC4, 0x58, 0x8A, 0x9A, 0x6A,
+    0xA4, 0x13, 0xD9, 0x2B, 0xEA, 0x59, 0x1F, 0x9A, 0x4B, 0xA8, 0x42, 0x15, 0x22, 0x92, 0xBC, 0xCE,
+    0x9F, 0xE6, 0x92, 0xEA, 0x10, 0xB8, 0x4E, 0xE4, 0xD7, 0xA9, 0x64, 0xFE, 0x6C, 0x42, 0x92, 0x2E,
+    0xE1, 0x3B, 0x32, 0xF3, 0x39, 0x3F, 0x9A, 0x4B, 0xAA, 0x43, 0x2E, 0x13, 0xB9, 0x2B, 0xEA, 0xAA,
+    0x4F, 0xE6, 0x92, 0xEA, 0x48, 0xBB, 0x84, 0xEE, 0x4A, 0x73, 0xA9, 0x3F, 0xAB, 0x88, 0xAA, 0x43,
+    0x2C, 0x58, 0x9B, 0x92, 0x3E, 0x4C, 0x40, 0xF8, 0x42, 0xE1, 0x38, 0x8A, 0x94, 0xAA, 0x48, 0x56,
+    0xA5, 0xB9, 0xAE, 0xA1, 0xC9, 0x66, 0x84, 0x84, 0xA9, 0x6E, 0xEA, 0xEE, 0x11, 0x89, 0xDE, 0x69,
+    0xE1, 0x2A, 0xA1, 0x8A, 0xE4, 0x8E, 0x14, 0xBF, 0xDA, 0x92, 0xA7, 0x16, 0xE5, 0xA9, 0xEE, 0x54,
+    0x29, 0x09, 0xAF, 0xFE, 0xAE, 0xB3, 0x1A, 0x4B, 0x8D, 0xAB, 0x84, 0x8E, 0xA9, 0x7F, 0xEA, 0x9F,
+    0xF9, 0xE4, 0xB9, 0x12, 0x92, 0xA1, 0x69, 0x08, 0x4F, 0xFE, 0xAF, 0xAF, 0x84, 0x24, 0xB7, 0xB8,
+    0x5A, 0x22, 0xFF, 0xDA, 0xBE, 0x8A, 0x85, 0xBA, 0xF6, 0xA4, 0x92, 0x11, 0x3B, 0xAD, 0xE6, 0xBE,
+    0xBE, 0x79, 0x6A, 0xD3, 0xA9, 0x29, 0x07, 0xE5, 0xBA, 0xB5, 0xFE, 0x69, 0xAA, 0x4B, 0x7B, 0x92,
+    0x12, 0x39, 0x65, 0x2A, 0xBA, 0xCC, 0xD1, 0x5A, 0x91, 0x29, 0x2A, 0x90, 0x72, 0x3E, 0x78, 0x56,
+    0x10, 0x85, 0x46, 0x0F, 0x9E, 0x20, 0x53, 0x95, 0x29, 0xA6, 0xB8, 0x25, 0x84, 0x2E, 0xE4, 0xA7,
+    0x10, 0xAE, 0xAA, 0x16, 0x9D, 0x1A, 0x68, 0x9B, 0xB9, 0x24, 0xEA, 0xAE, 0xEB, 0x8F, 0x9A, 0x7A,
+    0x96, 0x41, 0x48, 0x53, 0x93, 0xAB, 0xAB, 0x16, 0x23, 0x96, 0x22, 0xA5, 0xA4, 0x19, 0xB9, 0x24,
+    0xAA, 0xBE, 0x39, 0x12, 0x29, 0x1A, 0x69, 0xA4, 0x8A, 0xB9, 0x0C, 0xA6, 0xA8, 0xEA, 0x41, 0x39,
+    0x16, 0xD1, 0x6A, 0x7B, 0x31, 0x2A, 0x41, 0x22, 0xD8, 0x56, 0x93, 0x21, 0xED, 0x2A, 0xB9, 0x24,
+    0xA9, 0x26, 0x89, 0x22, 0x85, 0x27, 0x8A, 0x9E, 0xAE, 0x49, 0x2A, 0x49, 0xA3, 0x2D, 0x28, 0xF9,
+    0xE5, 0xC6, 0x2B, 0x16, 0xA4, 0x9A, 0x32, 0x78, 0xFA, 0x4E, 0x59, 0x22, 0xA3, 0x6A, 0x41, 0x22,
+    0xE7, 0x8F, 0x91, 0x4C, 0x10, 0x84, 0x21, 0x81, 0x01, 0x09, 0xA1, 0x6B, 0x8C, 0x83, 0x08, 0xFA,
+    0x12, 0xAE, 0x8C, 0x49, 0x20, 0xAE, 0x10, 0x8C, 0xBA, 0xB9, 0x69, 0x04, 0xAE, 0x48, 0x42, 0x41,
+    0x06, 0x39, 0x2E, 0xAE, 0x59, 0x21, 0x2B, 0xA8, 0x46, 0x4A, 0xA9, 0x2A, 0xAA, 0x4B, 0xAB, 0x96,
+    0x90, 0x66, 0xA3, 0xE4, 0xAA, 0x92, 0xAA, 0xA4, 0xBA, 0xB9, 0x61, 0xB3, 0x0F, 0x92, 0xAA, 0x4A,
+    0xAA, 0x92, 0xE8, 0xA5, 0x9A, 0x38, 0xB9, 0x23, 0xE8, 0x5A, 0xAA, 0xA9, 0x2E, 0x26, 0xAA, 0xE3,
+    0xBF, 0x30, 0xF9, 0x2A, 0xAB, 0xA3, 0xEA, 0xE2, 0x6A, 0xE8, 0xE2, 0x3F, 0x92, 0x3E, 0x4A, 0xAA,
+    0xE2, 0xAA, 0xC5, 0xA8, 0xB8, 0x9F, 0xCC, 0x3E, 0x4A, 0xAA, 0xC6, 0x2B, 0x8C, 0x9B, 0x92, 0x72,
+    0xE4, 0x8F, 0x90, 0xEA, 0x3E, 0x10, 0xA2, 0x24, 0xE3, 0x4C, 0x3E, 0x36, 0x3E, 0x10, 0xA9, 0x7E,
+    0x13, 0x8F, 0x8B, 0x6C, 0x52, 0xB1, 0x24, 0xA9, 0x6A, 0x09, 0x21, 0x18, 0xB8, 0xAA, 0xAA, 0x22,
+    0xF8, 0x42, 0xA3, 0xED, 0x38, 0x89, 0x26, 0x89, 0xBA, 0x9B, 0x4E, 0x20, 0xF4, 0x10, 0xB9, 0x22,
+    0x29, 0x1E, 0xE4, 0xBB, 0x9A, 0x68, 0x88, 0x66, 0xFF, 0x2C, 0xA2, 0x64, 0x46, 0xB8, 0x5B, 0xDD,
+    0x04, 0x2D, 0x2E, 0xA4, 0xA8, 0x88, 0xB9, 0x26, 0x9A, 0x23, 0xFB, 0x8F, 0xBA, 0xAA, 0x92, 0xD3,
+    0xA8, 0x94, 0x5A, 0x79, 0xA2, 0x3D, 0xF8, 0xFA, 0x5B, 0xA9, 0x22, 0x2A, 0x8E, 0xA4, 0xAF, 0xCC,
+    0x22, 0x6D, 0x0F, 0xBA, 0xAA, 0x90, 0x52, 0x8C, 0xBA, 0xFE, 0x49, 0xCA, 0xAE, 0x3E, 0xD2, 0xEA,
+    0x10, 0x8D, 0xAA, 0x7E, 0x48, 0x8B, 0x4D, 0x0F, 0xBF, 0xCA, 0x3E, 0x10, 0xAC, 0xA9, 0x9D, 0x52,
+    0xE1, 0x1B, 0x92, 0x78, 0x9A, 0x96, 0xE6, 0xA7, 0xE4, 0x88, 0x91, 0xD0, 0xFB, 0x4E, 0x7C, 0xCA,
+    0xA5, 0xBB, 0xAA, 0xFE, 0x48, 0x22, 0x84, 0x3F, 0xFA, 0xA1, 0x8A, 0xBF, 0x30, 0x22, 0x84, 0x3F,
+    0xAB, 0x96, 0xA7, 0xA7, 0x9A, 0x20, 0x58, 0xF8, 0x43, 0xFA, 0xB9, 0x6A, 0x79, 0xA6, 0x88, 0x89,
+    0x8F, 0x88, 0x59, 0x04, 0xEA, 0xE3, 0x21, 0x6E, 0x5E, 0x3E, 0x21, 0x97, 0xFB, 0xAB, 0x89, 0xA8,
+    0x5A, 0xAE, 0xA3, 0xE1, 0x0F, 0xEE, 0xAE, 0x26, 0xA4, 0x84, 0x6F, 0xB8, 0xF8, 0x43, 0xFB, 0xAB,
+    0x16, 0xA9, 0x04, 0xA4, 0x92, 0x3E, 0x10, 0xCA, 0xEA, 0xE3, 0x24, 0x84, 0x6F, 0xB8, 0xF8, 0x42,
+    0x26, 0xAE, 0x32, 0x90, 0x4A, 0xAE, 0xA3, 0xE1, 0xD8, 0x42, 0x16, 0xE5, 0xE3, 0xE1, 0x2B, 0x9A,
+    0x22, 0x79, 0x6E, 0x32, 0x26, 0x3E, 0x12, 0xBB, 0xAB, 0x92, 0x4A, 0x96, 0xEE, 0x08, 0xA3, 0xC6,
+    0x2B, 0x92, 0x93, 0xA1, 0x80, 0x8A, 0x12, 0xA9, 0xEC, 0x41, 0x65, 0xA8, 0x42, 0x58, 0x42, 0x49,
+    0x22, 0x24, 0xAA, 0xB9, 0x27, 0x8D, 0x9C, 0x58, 0x42, 0x4B, 0x88, 0xCB, 0xBB, 0x92, 0x79, 0x12,
+    0x92, 0x2E, 0x48, 0x46, 0x4A, 0x3D, 0x2B, 0x44, 0xB9, 0x27, 0x92, 0xDE, 0x08, 0xE4, 0x62, 0x73,
+    0x16, 0xC5, 0xAA, 0xF6, 0xA2, 0xF2, 0x28, 0x42, 0x98, 0x8A, 0x5B, 0x44, 0xB9, 0x27, 0xB4, 0xEA,
+    0x2F, 0xAA, 0x84, 0x24, 0x92, 0xE5, 0x2E, 0xEE, 0x49, 0xE4, 0xB7, 0x8A, 0xC9, 0xE3, 0xE4, 0x92,
+    0xE2, 0x6A, 0xA2, 0x27, 0x91, 0x29, 0x22, 0x67, 0x84, 0x24, 0xC4, 0x0F, 0x84, 0x21, 0x51, 0x41,
+    0x19, 0x24, 0xBB, 0x10, 0x48, 0xDA, 0x95, 0x28, 0xD9, 0x16, 0x10, 0x92, 0x4B, 0xBA, 0xA9, 0x65,
+    0xBB, 0xAA, 0x71, 0x07, 0xE9, 0x26, 0x3E, 0x48, 0x8B, 0xAA, 0x96, 0x5B, 0xBA, 0x93, 0xAA, 0x82,
+    0x38, 0x46, 0xAA, 0x59, 0x6E, 0xEA, 0x4E, 0xAE, 0x08, 0xA4, 0x10, 0xC5, 0xBA, 0xAB, 0xBA, 0xB9,
+    0x24, 0x82, 0x29, 0x2A, 0xA6, 0xAA, 0xAA, 0xBC, 0x4A, 0xB9, 0x0C, 0x35, 0x61, 0x19, 0x2A, 0xA6,
+    0xAA, 0xAA, 0x96, 0xEE, 0xAC, 0xC4, 0x8D, 0x61, 0x29, 0x2A, 0xA6, 0xAA, 0xAA, 0x96, 0xEE, 0xAE,
+    0x49, 0x20, 0x8A, 0x85, 0x90, 0xEA, 0xA5, 0xBB, 0xAB, 0x92, 0x48, 0x22, 0x92, 0xAA, 0xA3, 0x2A,
+    0x5B, 0xBA, 0xB1, 0x60, 0x8A, 0x4A, 0xAA, 0x8A, 0x6A, 0x36, 0xA3, 0x60, 0x8A, 0x4A, 0xAA, 0x8F,
+    0x84, 0x20, 0xC2, 0x43, 0xAA, 0xB9, 0x2E, 0xEA, 0xEA, 0xAE, 0x0B, 0x23, 0x6E, 0xEA, 0x4B, 0xA4,
+    0xAA, 0xAE, 0x8C, 0x09, 0x22, 0xD9, 0xE7, 0xBA, 0xFE, 0xEE, 0xAE, 0x09, 0x61, 0x11, 0x2E, 0x9E,
+    0xD1, 0x2E, 0xAE, 0x09, 0x61, 0x49, 0x6A, 0xE9, 0x29, 0x6E, 0xAE, 0x2A, 0xE1, 0x6B, 0xB9, 0x26,
+    0x9A, 0xAE, 0xB3, 0x2B, 0xAB, 0x8B, 0xA1, 0x03, 0xE4, 0xBA, 0xB1, 0x5A, 0xBA, 0xB9, 0x6E, 0x8A,
+    0x14, 0x84, 0x22, 0x22, 0x67, 0xAA, 0x22, 0xD1, 0x2E, 0x26, 0x22, 0xE1, 0x59, 0x04, 0x92, 0x5A,
+    0xAB, 0xFA, 0xEE, 0xE2, 0x62, 0x3C, 0xE3, 0xE7, 0x96, 0xCE, 0xAA, 0xF9, 0x2A, 0xAC, 0x58, 0x8F,
+    0xF8, 0x46, 0x69, 0xA2, 0xD2, 0xB9, 0xAA, 0xAE, 0x11, 0x37, 0x84, 0x68, 0x56, 0x3E, 0x10, 0x85,
+    0xBF, 0xE1, 0x19, 0x67, 0x8C, 0xA8, 0xA9, 0x61, 0x6F, 0xFE, 0x3E, 0x49, 0x6A, 0x29, 0x39, 0x0B,
+    0x96, 0xC4, 0x8A, 0xF3, 0x8F, 0x90, 0xEA, 0x84, 0x16, 0xBF, 0xE5, 0x8A, 0xA8, 0x8B, 0x85, 0x63,
+    0x12, 0xA8, 0x9B, 0x5F, 0x96, 0x26, 0xE0, 0x8A, 0x10, 0xAA, 0x2A, 0x93, 0xF9, 0x6E, 0x4B, 0x88,
+    0xB9, 0xA3, 0xED, 0x12, 0xEA, 0xAA, 0xAE, 0x41, 0x4A, 0x44, 0x68, 0x9A, 0x38, 0x42, 0xE5, 0xBA,
+    0xAA, 0xAB, 0x93, 0xF9, 0x62, 0xE1, 0x0B, 0x8F, 0xBA, 0xAA, 0xAB, 0xAA, 0xBB, 0x5F, 0x96, 0x25,
+    0x0B, 0x13, 0x8F, 0xBA, 0xA6, 0xEE, 0xAA, 0xEB, 0xFE, 0x5A, 0x3A, 0x8A, 0xAE, 0xB8, 0xFB, 0xAA,
+    0x96, 0xEA, 0xAE, 0x42, 0xE5, 0x8C, 0x89, 0x24, 0x98, 0xFA, 0x4A, 0xA2, 0x68, 0xAA, 0x2A, 0x58,
+    0xD8, 0xC9, 0x63, 0xEE, 0xAA, 0x13, 0x84, 0x21, 0x6F, 0xAA, 0x8F, 0xBA, 0xA2, 0x39, 0xA5, 0x84,
+    0x2E, 0x88, 0xE7, 0x48, 0x40, 0xFB, 0xAA, 0xBA, 0x9A, 0x58, 0x42, 0xEA, 0xAE, 0x23, 0xEA, 0xA3,
+    0xEE, 0x5B, 0xA9, 0x66, 0x88, 0x59, 0x2C, 0x88, 0x83, 0x65, 0x8F, 0xB4, 0x4A, 0x4A, 0x49, 0xE2,
+    0x19, 0x60, 0xC2, 0x10, 0xB8, 0x88, 0x42, 0x72, 0x28, 0xB9, 0xA3, 0xE6, 0x9A, 0xA8, 0x42, 0x84,
+    0x28, 0x9A, 0xA8, 0xA2, 0xB8, 0xF9, 0xAE, 0xA9, 0x8A, 0x84, 0x2A, 0xBA, 0xA8, 0x9E, 0xAA, 0x10,
+    0x97, 0xAA, 0xAB, 0x88, 0x84, 0x2A, 0x84, 0x9D, 0x2A, 0xE1, 0x19, 0x2A, 0xAA, 0xA4, 0x9E, 0x10,
+    0xAA, 0xEA, 0xA2, 0x2A, 0x90, 0x4A, 0xEE, 0xAA, 0xA5, 0x9A, 0x10, 0xA2, 0x6B, 0x42, 0x28, 0x81,
+    0x3A, 0x90, 0xEA, 0x69, 0x61, 0x09, 0xC8, 0xA2, 0x34, 0x88, 0x10, 0xBB, 0xAA, 0x8F, 0x84, 0x21,
+    0x65, 0xAB, 0x8F, 0x92, 0xAA, 0xAD, 0x39, 0xA1, 0x09, 0x50, 0x4A, 0xAE, 0x3E, 0x5E, 0xAB, 0xEB,
+    0xDA, 0x96, 0x7A, 0xB5, 0xCA, 0x30, 0x8E, 0x3E, 0x6B, 0xAF, 0x5F, 0x92, 0x59, 0xAE, 0x4F, 0x85,
+    0x90, 0xF9, 0xA6, 0xF5, 0xF9, 0x25, 0x96, 0x4A, 0x18, 0x08, 0xA3, 0xF9, 0x36, 0xAA, 0xA4, 0xEE,
+    0x4F, 0xB8, 0x23, 0x8F, 0x35, 0x92, 0xFB, 0xBA, 0x93, 0xCA, 0x2E, 0xF8, 0x46, 0x4B, 0xAB, 0xE4,
+    0xDA, 0x96, 0xA4, 0xA9, 0xA1, 0x04, 0xF8, 0x46, 0x4F, 0xE4, 0xD7, 0xE4, 0x97, 0x96, 0xA4, 0x38,
+    0xA5, 0x7E, 0x11, 0xA1, 0x9D, 0x7F, 0xA9, 0x51, 0xAA, 0x36, 0x23, 0xFE, 0x11, 0x93, 0xF9, 0x3A,
+    0xF6, 0xA5, 0x9E, 0xA3, 0x62, 0x3C, 0xE3, 0xE4, 0xBA, 0x95, 0x39, 0xA3, 0x6A, 0x86, 0x1C, 0x98,
+    0x56, 0xEA, 0xA1, 0x38, 0x42, 0x16, 0xF3, 0x8F, 0xBA, 0xA9, 0xA5, 0xBA, 0x8D, 0xAB, 0x89, 0x88,
+    0xFF, 0x84, 0x6C, 0x53, 0xDE, 0xEA, 0x2D, 0x3B, 0xCC, 0xA2, 0x37, 0xE1, 0x1A, 0xAA, 0x92, 0xBF,
+    0xFA, 0xB1, 0x05, 0xBF, 0xFE, 0x23, 0xBE, 0x11, 0xAA, 0xA9, 0x2B, 0xF7, 0xAB, 0xA8, 0x9B, 0xFE,
+    0xA2, 0xEF, 0x84, 0x62, 0x29, 0xA3, 0xAB, 0xBA, 0xA2, 0xAB, 0xFE, 0xA0, 0x8E, 0x10, 0xFE, 0xAE,
+    0xEA, 0xAA, 0xEC, 0x4E, 0x2E, 0x68, 0xF8, 0xB9, 0x0B, 0xAB, 0xBA, 0xAA, 0xBB, 0xFE, 0xE7, 0xB9,
+    0x61, 0x08, 0xA9, 0x7F, 0xFA, 0xAB, 0xAA, 0xBB, 0xFE, 0xE2, 0x28, 0xC1, 0x1B, 0x39, 0xBF, 0x4A,
+    0xAA, 0xEA, 0xAE, 0xFF, 0xB8, 0x46, 0x10, 0xBA, 0x92, 0x4D, 0xEE, 0xAA, 0xEA, 0xAE, 0xF2, 0xB8,
+    0x43, 0x8F, 0xBA, 0xEA, 0x49, 0x66, 0x9A, 0x8A, 0xAE, 0x26, 0x20, 0x42, 0x8F, 0xBA, 0xEE, 0x10,
+    0x84, 0x21, 0x6A, 0x9A, 0x3E, 0xEA, 0xAA, 0x59, 0xEA, 0x6A, 0x9A, 0x79, 0x22, 0x6A, 0x68, 0xFB,
+    0xA6, 0x4A, 0xCB, 0xEA, 0x6A, 0xAB, 0xBF, 0xF8, 0x9B, 0x36, 0x3E, 0xEA, 0xA6, 0xFF, 0xEA, 0x5B,
+    0xD3, 0xBA, 0x5B, 0x9E, 0xE6, 0x8F, 0xB2, 0x39, 0x7F, 0xFA, 0x93, 0xA5, 0xBA, 0x4C, 0xE2, 0xE6,
+    0x8F, 0x8B, 0x93, 0xFF, 0xAB, 0xAA, 0xAB, 0xBA, 0x58, 0x26, 0x84, 0x05, 0xAA, 0xBA, 0xAB, 0xBF,
+    0xFE, 0x26, 0xA5, 0x8F, 0x8D, 0xEB, 0xFE, 0xAE, 0xAA, 0xAE, 0x32, 0x2A, 0xAB, 0x84, 0x22, 0xD2,
+    0xAF, 0xFA, 0x93, 0xAA, 0xBB, 0x12, 0x24, 0x48, 0x4A, 0xC4, 0x12, 0xBF, 0xEA, 0x5B, 0xD3, 0xBA,
+    0x84, 0x39, 0x61, 0x0B, 0xA8, 0x8A, 0x2F, 0xA9, 0xAA, 0x92, 0xBA, 0x10, 0x3E, 0xA3, 0xEE, 0xA8,
+    0xA4, 0x9E, 0xA6, 0xA9, 0xAA, 0xE1, 0x0F, 0x41, 0x3B, 0xAA, 0xA8, 0x42, 0x10, 0x85, 0x4C, 0x48,
+    0x42, 0xEA, 0xAA, 0x79, 0x2E, 0x26, 0xEA, 0x22, 0x3A, 0xE4, 0x8F, 0xAB, 0xAA, 0xBF, 0xF9, 0x2C,
+    0xAA, 0xAA, 0x22, 0x38, 0xA1, 0x4A, 0xBA, 0xAB, 0xA5, 0xBA, 0xBF, 0xBE, 0xA2, 0x21, 0x3A, 0x84,
+    0x2A, 0xEA, 0xA9, 0x33, 0xAB, 0xF3, 0xA8, 0x88, 0x44, 0x8A, 0x3E, 0x6A, 0x2A, 0xA5, 0x9A, 0xFE,
+    0x5A, 0x88, 0x82, 0x78, 0x43, 0xFF, 0xAB, 0xF9, 0x6A, 0x22, 0x09, 0xE1, 0x9B, 0xBF, 0x96, 0xA2,
+    0x23, 0x2E, 0x58, 0x42, 0xE3, 0x04, 0x92, 0xFC, 0xEA, 0x22, 0x36, 0xEE, 0x11, 0xBA, 0x31, 0x2A,
+    0x26, 0xFE, 0xFA, 0x88, 0x85, 0xE3, 0xEE, 0xAE, 0x5A, 0x10, 0xAC, 0xAA, 0xAA, 0x22, 0x30, 0x58,
+    0x42, 0xEA, 0xE4, 0xB8, 0x98, 0x9B, 0xA8, 0x88, 0xC8, 0x98, 0x42, 0xEA, 0xE1, 0x28, 0x42, 0x15,
+    0xA2, 0xE1, 0x1B, 0xAB, 0x92, 0xE2, 0x66, 0x96, 0xEE, 0x78, 0x9D, 0x7B, 0x8F, 0xBA, 0x29, 0x68,
+    0xEE, 0x69, 0x24, 0x92, 0x58, 0xA5, 0xF2, 0x8F, 0xB8, 0x98, 0xA9, 0x2E, 0xA9, 0x16, 0x26, 0xE7,
+    0xAF, 0x84, 0xEE, 0x26, 0x32, 0xAE, 0xA2, 0x67, 0x92, 0x22, 0x8B, 0x84, 0x6C, 0x5C, 0x5B, 0xBA,
+    0x9A, 0xA5, 0x44, 0x89, 0x89, 0x84, 0x2E, 0x2E, 0x48, 0x8B, 0xA1, 0x0A, 0x99, 0x10, 0x25, 0x8F,
+    0xAF, 0x64, 0xBA, 0x89, 0x93, 0x60, 0x9E, 0x3F, 0x27, 0x92, 0xEA, 0x26, 0x49, 0x10, 0x25, 0xB1,
+    0x2E, 0xBD, 0xEA, 0xEA, 0xA6, 0x92, 0x68, 0xF5, 0x84, 0x62, 0xAB, 0x92, 0x5A, 0x9A, 0xE5, 0x93,
+    0x96, 0x39, 0x84, 0xA2, 0x6F, 0x18, 0xA6, 0x91, 0x39, 0x11, 0xE0, 0x8A, 0xE4, 0xB8, 0x42, 0x10,
+    0x83, 0x09, 0x11, 0xAE, 0x44, 0xEA, 0x5B, 0x9A, 0x26, 0xE0, 0x8A, 0x2E, 0x47, 0xEE, 0xA5, 0xBB,
+    0xAB, 0x2A, 0xA8, 0x22, 0x89, 0x45, 0xD2, 0xDA, 0xA1, 0x8A, 0xFE, 0xF8, 0x22, 0xA3, 0xAB, 0x10,
+    0xEA, 0x5A, 0x9E, 0xFC, 0xE0, 0x8A, 0x32, 0xF4, 0xAE, 0xA3, 0x6A, 0xFE, 0x58, 0x22, 0x8D, 0xA7,
+    0xCA, 0xA4, 0x4A, 0x4A, 0xBF, 0x96, 0x08, 0xA1, 0x1B, 0x5E, 0xA4, 0xB7, 0xBB, 0xF9, 0x60, 0x8A,
+    0x79, 0xD7, 0xFE, 0xAB, 0xDA, 0x92, 0xFC, 0xE2, 0x04, 0x84, 0x66, 0x89, 0xAA, 0xFA, 0xB4, 0xEA,
+    0x4B, 0xFB, 0xE3, 0xEA, 0x3E, 0x41, 0x49, 0xFF, 0xA9, 0x2D, 0xEE, 0xCA, 0xAA, 0x3A, 0xE3, 0xE9,
+    0x0C, 0x91, 0x3A, 0x91, 0x29, 0x2A, 0x26, 0xE2, 0x24, 0xB8, 0x42, 0x22, 0xE1, 0x08, 0x42, 0x17,
+    0x46, 0x84, 0x2C, 0x9A, 0x90, 0x53, 0x95, 0x29, 0xA6, 0x96, 0x11, 0x84, 0x6E, 0xBE, 0x5B, 0xB9,
+    0x29, 0xC4, 0x29, 0xA4, 0x84, 0x10, 0x4A, 0xE8, 0x42, 0xBB, 0x92, 0x4E, 0xAA, 0xEE, 0xA9, 0x0A,
+    0x3A, 0x84, 0x6E, 0xBE, 0x51, 0x4E, 0x4E, 0xAE, 0xAE, 0xA1, 0x88, 0x42, 0xC9, 0xA8, 0x46, 0xE4,
+    0x92, 0xAE, 0xA6, 0x84, 0xA3, 0xE2, 0x2E, 0x58, 0xAB, 0x90, 0xCA, 0xE8, 0x40, 0x22, 0x84, 0xAA,
+    0x7B, 0x31, 0x2A, 0xEA, 0x0A, 0x61, 0x2B, 0x4A, 0xAE, 0x49, 0x2A, 0xEA, 0x12, 0x9A, 0x3E, 0x5B,
+    0x88, 0x9E, 0xAE, 0x49, 0x2A, 0xEA, 0xA3, 0x8A, 0xE3, 0xE5, 0xBB, 0xC6, 0x2B, 0x16, 0xA6, 0xB8,
+    0xCE, 0xAA, 0x10, 0xA1, 0x84, 0x8A, 0x8D, 0xA9, 0xA4, 0x42, 0x12, 0xAE, 0x11, 0x96, 0xA1, 0x48,
+    0x42, 0x16, 0xAA, 0x41, 0x29, 0xA1, 0x69, 0x6E, 0x68, 0x5A, 0x88, 0x13, 0x93, 0xF9, 0x28, 0x4A,
+    0x96, 0xEE, 0xA1, 0x6D, 0x22, 0x04, 0x24, 0xFA, 0xEA, 0x32, 0x86, 0x28, 0x84, 0x31, 0x6A, 0xE3,
+    0xE8, 0xB9, 0x24, 0x39, 0x25, 0xA9, 0xE7, 0xA8, 0xEA, 0xB8, 0xF9, 0x31, 0x1A, 0xAA, 0x92, 0x59,
+    0xEA, 0x7A, 0x8E, 0x23, 0x8F, 0x93, 0xE6, 0xAA, 0xA9, 0x28, 0xBD, 0xB8, 0x84, 0x15, 0x43, 0xE6,
+    0xE6, 0xAA, 0xA9, 0x2B, 0xF9, 0x2A, 0x0C, 0x23, 0xEA, 0xAA, 0x4A, 0xFC, 0xCA, 0x15, 0xB9, 0xA3,
+    0xE7, 0x97, 0xA3, 0xEA, 0xBF, 0xEA, 0xA1, 0x6A, 0x38, 0x42, 0x4A, 0x92, 0xA2, 0xAA, 0x8B, 0xEA,
+    0xA1, 0x8E, 0x58, 0xF9, 0x2B, 0x6C, 0x62, 0x88, 0x92, 0xA1, 0x64, 0xB7, 0x8F, 0x92, 0xA4, 0x84,
+    0x21, 0x08, 0x5E, 0xBF, 0x8F, 0x92, 0xA5, 0x8F, 0x9A, 0x5B, 0x85, 0xEB, 0xF8, 0xFA, 0x18, 0x3E,
+    0x69, 0x24, 0x85, 0x4D, 0xF8, 0xF9, 0x2A, 0xAA, 0x74, 0x6B, 0xAA, 0x45, 0x85, 0xEB, 0xF8, 0xF9,
+    0x2A, 0xAA, 0x6A, 0x96, 0xEA, 0x26, 0x17, 0xAF, 0xE3, 0xE4, 0xAA, 0xA9, 0xAA, 0x5B, 0xA9, 0xAA,
+    0x17, 0xAD, 0xE3, 0xE4, 0xAA, 0xA9, 0xD1, 0xAE, 0x84, 0x28, 0x6A, 0x58, 0xF9, 0xE5, 0x8F, 0xBA,
+    0x89, 0x83, 0x08, 0x76, 0xEA, 0x26, 0x08, 0x23, 0xEC, 0x50, 0x42, 0xEA, 0xA6, 0x85, 0xC4, 0x84,
+    0x2E, 0xEE, 0x11, 0x9A, 0xE5, 0x85, 0xEA, 0x15, 0xBB, 0xB8, 0x46, 0x69, 0x13, 0x85, 0xEA, 0xE1,
+    0x1B, 0x14, 0x10, 0x84, 0x21, 0x7A, 0x2E, 0x3E, 0x1D, 0x84, 0x21, 0x79, 0xE1, 0x09, 0x61, 0x78,
+    0x42, 0x15, 0x11, 0x84, 0x65, 0xA8, 0x52, 0x21, 0x1A, 0x17, 0x96, 0x12, 0x96, 0xD2, 0x8F, 0x9E,
+    0xA5, 0x85, 0x79, 0x38, 0x46, 0x59, 0xE3, 0xE7, 0xA9, 0x61, 0x64, 0x93, 0x84, 0x28, 0x60, 0xF8,
+    0x84, 0x68, 0x5E, 0x52, 0x0F, 0x96, 0x17, 0x84, 0x20, 0xC2, 0x1D, 0x84, 0x21, 0x20};
+
+/* 电池电量低_296x128.bmp，原始4736字节，压缩后1766字节 */
+static const uint8_t EPD_PackedImage_BatteryLow_296x128[] = {
+    255, 41, 128, /* 图像宽度，图像宽度，图像高度*/
+    0x80, 0x32, 0xB4, 0x07, 0xE4, 0x07, 0xE4, 0x01, 0x74, 0x81, 0xFC, 0x80, 0x7D, 0x64, 0x26, 0x07,
+    0x91, 0x00, 0xD8, 0xE0, 0xED, 0x37, 0x60, 0xC4, 0x50, 0x39, 0x6D, 0x24, 0x0C, 0x19, 0x4A, 0x0E,
+    0x1A, 0x40, 0xA9, 0x1D, 0x89, 0x20, 0x37, 0x30, 0x2A, 0x46, 0x62, 0xC8, 0x0C, 0x51, 0x18, 0x2A,
+    0x21, 0x58, 0xE6, 0x0B, 0xD8, 0x30, 0x29, 0x18, 0x41, 0x82, 0xE4, 0x0B, 0xC9, 0x44, 0x41, 0x24,
+    0x0B, 0x50, 0x2D, 0x2B, 0x4D, 0x84, 0xD0, 0x16, 0x0C, 0x54, 0xD6, 0x12, 0x40, 0x55, 0x31, 0xDA,
+    0x4A, 0x12, 0x60, 0x52, 0x28, 0xA4, 0x9D, 0x04, 0xD0, 0x39, 0x61, 0x32, 0x8D, 0x49, 0x24, 0x13,
+    0x40, 0xDC, 0xC1, 0x02, 0x8E, 0x3B, 0x88, 0x42, 0x58, 0x35, 0x6D, 0x0D, 0x20, 0x44, 0x69, 0x58,
+    0xA4, 0x09, 0x02, 0x64, 0x62, 0x88, 0x1A, 0x1E, 0x25, 0x02, 0x00, 0xB1, 0x8E, 0xC8, 0x08, 0x8B,
+    0x62, 0x58, 0x74, 0xC1, 0x04, 0x73, 0x26, 0x0A, 0x98, 0x96, 0x1A, 0x28, 0x4D, 0x08, 0x4C, 0x80,
+    0xB1, 0x0B, 0x41, 0x92, 0x04, 0x1A, 0x43, 0x58, 0x2D, 0x42, 0xD0, 0x5D, 0x84, 0x84, 0x0C, 0x40,
+    0xBD, 0x0B, 0x41, 0x66, 0x12, 0x68, 0x82, 0x98, 0x2F, 0x62, 0xD8, 0x4D, 0x85, 0x10, 0x41, 0x83,
+    0x04, 0x31, 0x84, 0x98, 0x55, 0x0F, 0x60, 0xC1, 0x8D, 0x41, 0x16, 0x16, 0x43, 0x98, 0x2A, 0x99,
+    0x0E, 0x41, 0x16, 0x16, 0x43, 0x58, 0x28, 0x33, 0x63, 0x90, 0x48, 0x86, 0x28, 0x94, 0x31, 0x8E,
+    0x14, 0x82, 0x28, 0xE3, 0xD0, 0x50, 0x85, 0x10, 0x54, 0x2D, 0x8D, 0x0E, 0x94, 0x81, 0x16, 0x15,
+    0x62, 0x04, 0x58, 0x96, 0x39, 0x09, 0x3A, 0x20, 0xB4, 0x12, 0x61, 0x62, 0x0A, 0x12, 0x21, 0x06,
+    0x93, 0x72, 0x8A, 0x61, 0x24, 0x18, 0x20, 0xC1, 0xC1, 0xB1, 0x12, 0x8B, 0x41, 0x24, 0x1A, 0x61,
+    0x01, 0x01, 0x71, 0x44, 0x28, 0xB4, 0x12, 0x41, 0xB2, 0x02, 0xA3, 0x50, 0x82, 0x8B, 0x61, 0x14,
+    0x1D, 0x20, 0x25, 0x31, 0x10, 0x82, 0x8C, 0x41, 0x14, 0x1F, 0x20, 0x21, 0x29, 0xD0, 0x82, 0x8C,
+    0x41, 0x14, 0x08, 0x08, 0x1E, 0x20, 0xA4, 0x20, 0xA3, 0x10, 0x45, 0x02, 0x22, 0x06, 0x88, 0x31,
+    0x09, 0x20, 0xC4, 0x11, 0x40, 0x90, 0x81, 0x61, 0xED, 0x09, 0x20, 0xC4, 0x11, 0x40, 0x99, 0x84,
+    0x82, 0xE2, 0x48, 0x35, 0x04, 0x10, 0x27, 0x20, 0xF2, 0x8D, 0x10, 0x55, 0x20, 0xC4, 0x10, 0x40,
+    0xA4, 0x80, 0x90, 0xA4, 0xC8, 0x31, 0x04, 0x10, 0x2B, 0x28, 0x22, 0x32, 0x56, 0x31, 0x04, 0x10,
+    0x2C, 0x60, 0x8D, 0x22, 0x72, 0x0B, 0x41, 0x04, 0x0B, 0x50, 0x29, 0x44, 0x62, 0xD0, 0x41, 0x02,
+    0xD4, 0x08, 0xC5, 0x04, 0x10, 0x41, 0x82, 0xB6, 0x08, 0xC5, 0x04, 0x10, 0x41, 0x82, 0xB4, 0x09,
+    0x58, 0x59, 0x04, 0x18, 0x2B, 0x40, 0x99, 0x85, 0x58, 0x41, 0x05, 0x10, 0x55, 0x02, 0x74, 0x15,
+    0x61, 0x04, 0x25, 0x88, 0x41, 0x46, 0x0A, 0x10, 0x55, 0x04, 0x10, 0x92, 0x34, 0xA1, 0x54, 0x0A,
+    0x90, 0x51, 0x04, 0x10, 0xF2, 0x85, 0x90, 0x2A, 0x41, 0x44, 0x10, 0x43, 0x92, 0x41, 0x64, 0x0A,
+    0xD0, 0x4D, 0x04, 0x10, 0xE4, 0x90, 0x59, 0x02, 0xB4, 0x13, 0x41, 0x04, 0x39, 0x34, 0x15, 0x40,
+    0xB1, 0x04, 0x90, 0x41, 0x0E, 0x4D, 0x05, 0x50, 0x2C, 0x41, 0x24, 0x10, 0x43, 0x9D, 0x85, 0x50,
+    0x2D, 0x41, 0x14, 0x10, 0x43, 0xCA, 0x98, 0x45, 0x02, 0xD4, 0x98, 0xC4, 0x10, 0x42, 0xE4, 0x6D,
+    0x84, 0x50, 0x2D, 0x49, 0x8C, 0x41, 0x04, 0x29, 0x07, 0x8A, 0x09, 0x26, 0x30, 0xC4, 0x10, 0x42,
+    0x90, 0x74, 0x40, 0x21, 0x46, 0x30, 0xC4, 0x10, 0x42, 0xA1, 0x3C, 0xE9, 0x10, 0x41, 0x4C, 0x3D,
+    0x10, 0x48, 0xC4, 0x10, 0x61, 0x80, 0x89, 0xCE, 0x50, 0x9C, 0x78, 0xB6, 0x10, 0x61, 0x51, 0x02,
+    0x58, 0xD4, 0x60, 0xBB, 0x30, 0xC6, 0x10, 0x61, 0x23, 0x0F, 0x43, 0x50, 0x86, 0x53, 0x50, 0x92,
+    0x0C, 0x61, 0x06, 0x10, 0x28, 0xF2, 0x8D, 0x42, 0x48, 0x29, 0x09, 0x20, 0xC6, 0x11, 0x43, 0x88,
+    0x11, 0x28, 0xE4, 0x2D, 0x89, 0x42, 0x48, 0x31, 0x84, 0x50, 0xD6, 0x12, 0x61, 0x14, 0x30, 0x87,
+    0x42, 0x48, 0x31, 0x84, 0x50, 0xC6, 0x13, 0x41, 0x24, 0x39, 0x99, 0x09, 0x20, 0xC6, 0x11, 0x43,
+    0x10, 0x51, 0x04, 0x90, 0xF6, 0x54, 0x24, 0x83, 0x18, 0x45, 0x0C, 0x61, 0x34, 0x11, 0x61, 0x06,
+    0x44, 0x24, 0x83, 0x10, 0x49, 0x0D, 0x20, 0x45, 0x04, 0x50, 0x49, 0xB4, 0x24, 0x83, 0x10, 0x49,
+    0x0F, 0x6D, 0x8B, 0x41, 0x06, 0x12, 0x69, 0x09, 0x2B, 0x46, 0x41, 0x24, 0x11, 0x68, 0x82, 0x50,
+    0x45, 0x84, 0x9A, 0x42, 0x0B, 0x21, 0x04, 0x8D, 0x41, 0x22, 0x22, 0x99, 0x84, 0x50, 0x4D, 0xD1,
+    0xC5, 0xC7, 0x0B, 0x41, 0x46, 0xCA, 0x54, 0x11, 0x41, 0x47, 0x42, 0x0B, 0x38, 0x96, 0x29, 0x05,
+    0x48, 0x42, 0xA4, 0x10, 0x67, 0x20, 0xA4, 0xA6, 0x2B, 0x20, 0xE4, 0x25, 0x05, 0xD9, 0x4B, 0x43,
+    0xD0, 0x91, 0xB5, 0x16, 0xD8, 0x45, 0x08, 0x41, 0x82, 0x18, 0xC3, 0x58, 0xE0, 0x91, 0xD8, 0x40,
+    0xE5, 0x41, 0xA6, 0x73, 0x8A, 0x40, 0x9D, 0x8F, 0x68, 0x85, 0x41, 0xB2, 0x09, 0x12, 0xD0, 0x28,
+    0x4A, 0x30, 0xAD, 0x1A, 0x1C, 0x20, 0xB1, 0x60, 0x9C, 0x59, 0x9A, 0x29, 0xE1, 0xE6, 0x3C, 0xE0,
+    0x8C, 0xC4, 0x3B, 0x45, 0x47, 0x41, 0xF2, 0x03, 0x52, 0x8B, 0x25, 0x0F, 0x40, 0x85, 0x83, 0x36,
+    0x10, 0x20, 0x41, 0x02, 0x22, 0x03, 0x06, 0x13, 0x20, 0xF8, 0x24, 0x60, 0xB4, 0x81, 0x66, 0x3A,
+    0x09, 0x58, 0x2B, 0x61, 0x96, 0x36, 0x09, 0xD8, 0x28, 0x61, 0xB6, 0x32, 0x0A, 0x08, 0x09, 0x58,
+    0x75, 0x8B, 0x82, 0x83, 0x82, 0x24, 0x1F, 0x42, 0xD0, 0x27, 0x53, 0x87, 0x98, 0x7D, 0x8A, 0x40,
+    0x99, 0x25, 0x30, 0xB8, 0xF6, 0x08, 0x58, 0x94, 0x09, 0x92, 0x55, 0x62, 0xC8, 0x31, 0x02, 0x34,
+    0x25, 0x02, 0x64, 0x92, 0x56, 0x2C, 0x41, 0x90, 0x24, 0x62, 0x10, 0x26, 0x4D, 0x53, 0x62, 0xC7,
+    0x02, 0x54, 0x21, 0x02, 0x64, 0xD2, 0x48, 0x82, 0x51, 0x8C, 0x09, 0x90, 0x84, 0x09, 0x93, 0x48,
+    0xB6, 0x21, 0x34, 0x54, 0x09, 0x90, 0x98, 0x26, 0x44, 0x49, 0xB2, 0x19, 0x39, 0x50, 0x28, 0x47,
+    0x40, 0x99, 0x10, 0xC9, 0xD9, 0x52, 0x44, 0x60, 0xA1, 0x19, 0x82, 0x79, 0x48, 0x88, 0x88, 0xD2,
+    0x4D, 0x82, 0x94, 0xB2, 0x82, 0x51, 0x69, 0xE4, 0x32, 0x48, 0xA0, 0xA5, 0x22, 0x28, 0x24, 0x16,
+    0xD2, 0x45, 0x2D, 0x4C, 0x0A, 0x95, 0xB8, 0x24, 0x42, 0xDA, 0x46, 0x12, 0x90, 0x2B, 0x33, 0x82,
+    0x44, 0x8A, 0xC8, 0x91, 0x92, 0x12, 0x0A, 0xC9, 0xB8, 0x24, 0x53, 0xA4, 0x54, 0x54, 0x92, 0x20,
+    0x2C, 0x46, 0x40, 0x91, 0x53, 0x12, 0x99, 0x12, 0x44, 0x40, 0xB1, 0x19, 0x02, 0x45, 0x4C, 0x7B,
+    0x49, 0x36, 0x0B, 0x11, 0x90, 0x21, 0x2C, 0x5A, 0x24, 0xA6, 0x30, 0x24, 0x21, 0x11, 0x90, 0x20,
+    0x33, 0x51, 0x09, 0x31, 0x74, 0x09, 0x4C, 0x91, 0x90, 0x20, 0x42, 0xD4, 0xE7, 0x33, 0x40, 0xA5,
+    0xD1, 0x90, 0x20, 0x44, 0x17, 0x20, 0x45, 0x02, 0x85, 0x42, 0x10, 0x20, 0x6C, 0x70, 0x4D, 0x02,
+    0x8A, 0x67, 0x40, 0x85, 0x49, 0x46, 0x85, 0x18, 0x27, 0x4D, 0x1D, 0x02, 0x13, 0x24, 0x1B, 0x40,
+    0xA1, 0x38, 0x84, 0x08, 0xD9, 0x10, 0x69, 0x02, 0x74, 0x35, 0x02, 0x44, 0x44, 0x1A, 0x40, 0x9D,
+    0x0D, 0x40, 0x91, 0x15, 0x06, 0x50, 0x27, 0x43, 0x50, 0x24, 0x45, 0x61, 0x84, 0x09, 0xD0, 0xD8,
+    0x25, 0x44, 0x28, 0x5D, 0x02, 0x74, 0x36, 0x09, 0x92, 0x49, 0x05, 0x90, 0x28, 0x43, 0x10, 0x26,
+    0x49, 0x34, 0x15, 0x40, 0x9D, 0x8C, 0x40, 0x9D, 0x51, 0x10, 0x51, 0x02, 0x74, 0x35, 0x02, 0x72,
+    0x19, 0x04, 0x90, 0x28, 0x43, 0x50, 0x28, 0x47, 0x61, 0x14, 0x0A, 0x10, 0xD4, 0x0A, 0x10, 0x86,
+    0x10, 0x40, 0xA1, 0x0D, 0x40, 0xA5, 0x08, 0x63, 0xD0, 0x28, 0x43, 0x50, 0x2A, 0x47, 0x28, 0xD4,
+    0x0A, 0x10, 0xC4, 0x0A, 0x88, 0x54, 0x98, 0xB4, 0x0A, 0x50, 0xC4, 0x0A, 0x8A, 0x44, 0xC8, 0x25,
+    0x02, 0x94, 0x31, 0x02, 0x94, 0x93, 0x46, 0x21, 0xD0, 0x29, 0x43, 0x10, 0x29, 0x4D, 0x24, 0x20,
+    0x85, 0x40, 0xA5, 0x0C, 0x40, 0xA5, 0x11, 0x50, 0x93, 0x24, 0x0A, 0x58, 0xB4, 0x0A, 0x51, 0x58,
+    0xA4, 0x8A, 0x0A, 0x98, 0xA4, 0x0A, 0x91, 0x98, 0x99, 0x90, 0x2A, 0x20, 0x94, 0x0A, 0x91, 0xC8,
+    0x64, 0x64, 0x0A, 0x88, 0xA6, 0x40, 0xA9, 0x09, 0x65, 0x46, 0x82, 0xB5, 0x21, 0x90, 0x2A, 0x42,
+    0xDB, 0x45, 0x40, 0xAD, 0x26, 0x64, 0x0A, 0x90, 0xC2, 0x9D, 0x02, 0xB4, 0x88, 0x44, 0x0A, 0xD0,
+    0xE1, 0x60, 0xB1, 0x32, 0xA4, 0x0A, 0xD8, 0xF3, 0x82, 0xE4, 0xD4, 0xC0, 0xB1, 0x01, 0x11, 0x18,
+    0xC0, 0xB1, 0x01, 0x11, 0x1E, 0x90, 0x2C, 0x40, 0x44, 0x42, 0x50, 0x2E, 0x40, 0x43, 0x42, 0x50,
+    0x2E, 0x40, 0x42, 0x42, 0x90, 0x2E, 0x40, 0x42, 0x42, 0x90, 0x2F, 0x40, 0x41, 0x42, 0xA0, 0xC1,
+    0x01, 0x05, 0x09, 0x40, 0xC1, 0x83, 0xF6, 0x25, 0x03, 0x14, 0x0F, 0xD0, 0xA4, 0x0C, 0x50, 0x3F,
+    0x42, 0x90, 0x32, 0x40, 0xF9, 0x09, 0x40, 0xCD, 0x83, 0xC4, 0x29, 0x03, 0x44, 0x0F, 0x10, 0xA4,
+    0x0D, 0x50, 0x3A, 0x62, 0x90, 0x35, 0x60, 0xE4, 0x82, 0x50, 0x36, 0x60, 0xDC, 0xC7, 0x40, 0xE1,
+    0x83, 0x64, 0x99, 0x90, 0x39, 0x40, 0xD5, 0x8B, 0x40, 0xE9, 0x03, 0x44, 0x31, 0x03, 0xB6, 0x0C,
+    0x50, 0xD4, 0x0F, 0x18, 0x30, 0x43, 0x10, 0x3E, 0x60, 0xB8, 0x82, 0xD0, 0x3F, 0x60, 0xB1, 0x58,
+    0xA4, 0x04, 0x02, 0x02, 0x96, 0x98, 0x94, 0x04, 0x26, 0x09, 0xD9, 0x10, 0x94, 0x04, 0x32, 0x02,
+    0x32, 0x0F, 0x40, 0x46, 0x20, 0x20, 0x20, 0x41, 0x01, 0x20, 0x81, 0xC2, 0x04, 0x90, 0x12, 0x8C,
+    0x15, 0x30, 0x4E, 0x04, 0xE3, 0x8E, 0x38, 0x51, 0x01, 0x48, 0x2A, 0x17, 0x40, 0x55, 0x1D, 0x86,
+    0x10, 0x19, 0x50, 0x5D, 0x01, 0x95, 0x05, 0xD0, 0x19, 0x50, 0x59, 0x01, 0x9D, 0x05, 0x50, 0x19,
+    0xD0, 0x55, 0x01, 0x9D, 0x05, 0x10, 0x1A, 0x50, 0x4D, 0x01, 0xA5, 0x04, 0x98, 0x1A, 0x90, 0x45,
+    0x01, 0xAD, 0x04, 0x18, 0x1B, 0x10, 0xF4, 0x06, 0xD6, 0x35, 0x81, 0xB9, 0x0D, 0x40, 0x70, 0x42,
+    0xD0, 0x1C, 0x90, 0x96, 0x04, 0xD1, 0xA1, 0x86, 0x76, 0x04, 0xC0, 0x88, 0x61, 0x91, 0x81, 0x34,
+    0x22, 0x19, 0x10, 0x04, 0xD0, 0x98, 0x6D, 0x81, 0x3C, 0xA2, 0x4A, 0x06, 0xD2, 0x0B, 0x20, 0x1B,
+    0x48, 0x2C, 0x80, 0x6D, 0x20, 0xB2, 0x01, 0xB4, 0x82, 0xC8, 0x06, 0xD2, 0x0B, 0x20, 0x19, 0x81,
+    0x08, 0x17, 0x41, 0x28, 0x16, 0xC1, 0x28, 0x16, 0x81, 0x38, 0x16, 0x48, 0x1F, 0x20, 0x16, 0x48,
+    0x1F, 0x20, 0x16, 0x48, 0x1F, 0x20, 0x16, 0x48, 0x1F, 0x20, 0x16, 0x48, 0x1F, 0x20, 0x16, 0x48,
+    0x1F, 0x20, 0x16, 0x48, 0x1F, 0x20, 0x16, 0x48, 0x1F, 0x20, 0x16, 0x48, 0x1F, 0x40, 0x5B, 0x20,
+    0x1F, 0x08, 0x07, 0xC2, 0x02, 0x82, 0x81, 0x3C, 0x80, 0x98, 0x48, 0x13, 0x48, 0x09, 0x06, 0x01,
+    0x30, 0x80, 0x88, 0x78, 0x12, 0xC8, 0x1F, 0x16, 0x8A, 0x04, 0xB2, 0x07, 0x45, 0x18, 0xA0, 0x4A,
+    0x20, 0x6C, 0x50, 0x92, 0x01, 0x28, 0x81, 0x91, 0x42, 0xC8, 0x04, 0xA2, 0x05, 0xC5, 0x0C, 0x28,
+    0x12, 0x88, 0x14, 0x16, 0x34, 0xA0, 0x4B, 0x20, 0x48, 0x50, 0xE3, 0x81, 0x2C, 0x83, 0xC5, 0x8E,
+    0x10, 0x04, 0xC6, 0x38, 0x58, 0xE1, 0x20, 0x4D, 0x8E, 0x16, 0x38, 0x50, 0x16, 0xC5, 0x0E, 0x16,
+    0x05, 0xB1, 0x43, 0x85, 0x01, 0x6C, 0x58, 0xD1, 0x60, 0x5B, 0x16, 0x38, 0x50, 0x16, 0xC5, 0x0E,
+    0x16, 0x05, 0xB1, 0x43, 0x85, 0x01, 0x6C, 0x58, 0xE1, 0x40, 0x5B, 0x14, 0x38, 0x58, 0x16, 0xC5,
+    0x0E, 0x16, 0x05, 0xB1, 0x43, 0x85, 0x01, 0x6C, 0x58, 0xE1, 0x40, 0x5C, 0x12, 0x38, 0x58, 0xE4,
+    0x04, 0xC1, 0x43, 0x45, 0x8E, 0x20, 0x13, 0x0E, 0x38, 0x58, 0x40, 0x80, 0x4B, 0x30, 0xE1, 0x41,
+    0x32, 0x01, 0x2C, 0x83, 0x45, 0x85, 0x48, 0x04, 0xB2, 0x0C, 0x12, 0x18, 0x20, 0x12, 0xC8, 0x24,
+    0x58, 0x64, 0x80, 0x4B, 0x21, 0xC5, 0x07, 0x08, 0x04, 0xB2, 0xB1, 0x61, 0xE2, 0x01, 0x2C, 0x22,
+    0x08, 0x08, 0x04, 0xC1, 0xC0, 0x88, 0x80, 0x4D, 0x14, 0x09, 0x48, 0x04, 0xE3, 0x82, 0x72, 0x01,
+    0xF0, 0x80, 0x7C, 0x20, 0x17, 0x21, 0xF2, 0x01, 0x69, 0x87, 0xC8, 0x05, 0x92, 0x07, 0xC8, 0x05,
+    0x92, 0x07, 0xC8, 0x05, 0x92, 0x07, 0xC8, 0x05, 0x92, 0x07, 0xC8, 0x05, 0x92, 0x07, 0xC8, 0x05,
+    0x92, 0x07, 0xC8, 0x05, 0x92, 0x07, 0xC8, 0x05, 0x90, 0x4E, 0x05, 0xA0, 0x4A, 0x05, 0xB0, 0x4A,
+    0x05, 0xC0, 0x46, 0x00, 0x7A, 0xE0};
+
+/* 系统信息_89x128.bmp，原始1424字节，压缩后610字节 */
+static const uint8_t EPD_PackedImage_Info_89x128[] = {
+    89, 0, 128, /* 图像宽度，图像宽度，图像高度*/
+    0x80, 0x4B, 0x48, 0x07, 0xC3, 0x01, 0xEA, 0x42, 0x01, 0xDD, 0x14, 0x80, 0x75, 0x47, 0x20, 0x1D,
+    0x22, 0x58, 0x1C, 0xE2, 0xD0, 0x1C, 0xA3, 0x18, 0x1C, 0x23, 0x90, 0x1B, 0xD3, 0x8A, 0x40, 0x6E,
+    0x4D, 0x0A, 0x40, 0x6D, 0x44, 0x8B, 0x40, 0x6C, 0x45, 0x8B, 0x40, 0x6C, 0x95, 0x0B, 0x40, 0x6B,
+    0x9A, 0x31, 0x01, 0xAA, 0x64, 0x31, 0x01, 0xA6, 0x74, 0x2D, 0x01, 0xA6, 0x22, 0x31, 0x01, 0xA1,
+    0x1D, 0x19, 0x12, 0x06, 0x84, 0x22, 0x52, 0x33, 0x81, 0x89, 0x08, 0x4D, 0x27, 0x22, 0x40, 0x61,
+    0x42, 0x52, 0x94, 0x84, 0x40, 0x61, 0x42, 0xB4, 0x69, 0x90, 0x18, 0xA2, 0x88, 0x35, 0x01, 0x8A,
+    0x2D, 0x0E, 0x40, 0x62, 0x8C, 0x43, 0x58, 0x18, 0x63, 0x10, 0xF6, 0x05, 0xF8, 0xD4, 0x10, 0x40,
+    0x5E, 0x43, 0x50, 0xB0, 0x88, 0x14, 0xD0, 0xD4, 0x40, 0xE8, 0x13, 0x90, 0xE1, 0x21, 0x61, 0x00,
+    0x49, 0x40, 0xC8, 0xE0, 0x46, 0x83, 0x72, 0x81, 0x0E, 0x0E, 0x8C, 0x0F, 0xE0, 0xF8, 0xC0, 0xEE,
+    0x04, 0x23, 0x60, 0xD1, 0x01, 0x1D, 0x83, 0x34, 0x04, 0x76, 0x0C, 0x98, 0x25, 0x20, 0x75, 0x83,
+    0x34, 0x0A, 0x48, 0x18, 0x20, 0x34, 0x41, 0x42, 0x84, 0xC8, 0x12, 0x30, 0x35, 0x41, 0x92, 0x04,
+    0x98, 0xE3, 0x03, 0x74, 0x1D, 0x20, 0x45, 0x0E, 0x61, 0x11, 0x01, 0xF4, 0x08, 0x08, 0x11, 0x43,
+    0x98, 0xF4, 0x8E, 0x1B, 0x40, 0x90, 0xC3, 0x50, 0xE6, 0x3D, 0x18, 0xC1, 0x64, 0x09, 0xC4, 0x0A,
+    0x43, 0xD0, 0xE4, 0x24, 0xA1, 0x34, 0x0A, 0x9C, 0xA2, 0x10, 0xF4, 0x39, 0x0C, 0x20, 0x41, 0x05,
+    0x05, 0x0C, 0x23, 0x21, 0xD0, 0xF4, 0x35, 0x0E, 0x28, 0xC4, 0x17, 0x1A, 0x64, 0x99, 0x19, 0x90,
+    0xF2, 0x0B, 0x41, 0x02, 0x09, 0x41, 0xB6, 0x53, 0x24, 0x45, 0x76, 0x54, 0x3C, 0xE7, 0x41, 0x22,
+    0x1D, 0x07, 0x59, 0xCC, 0x52, 0xA2, 0x05, 0x52, 0x29, 0x50, 0x51, 0x91, 0x02, 0x06, 0x24, 0x84,
+    0x21, 0x18, 0x55, 0x0B, 0x4E, 0x12, 0x74, 0x08, 0x98, 0x85, 0x25, 0x99, 0x05, 0x90, 0xB4, 0x90,
+    0x48, 0xA0, 0x91, 0x9A, 0x52, 0x9D, 0x85, 0x50, 0xA4, 0xE1, 0x23, 0x02, 0x46, 0x59, 0x98, 0xA4,
+    0x15, 0x62, 0x6D, 0x04, 0x13, 0x40, 0x95, 0x92, 0x52, 0x8A, 0x28, 0x4D, 0x08, 0x4D, 0x0F, 0x95,
+    0x82, 0x54, 0xE5, 0x38, 0xB6, 0x13, 0x42, 0x24, 0x8E, 0x46, 0x30, 0x22, 0x4A, 0xB1, 0x42, 0xD0,
+    0x71, 0x34, 0x21, 0x24, 0x31, 0x02, 0x22, 0x47, 0x0A, 0x41, 0xC4, 0x44, 0x63, 0x8C, 0x40, 0x8D,
+    0x54, 0x68, 0x8C, 0xA1, 0x94, 0x44, 0x5B, 0x43, 0x60, 0x95, 0xC7, 0x89, 0xA0, 0x90, 0x94, 0x54,
+    0x48, 0x45, 0x02, 0x65, 0x08, 0x11, 0x28, 0x85, 0x30, 0xD4, 0x54, 0xE1, 0x14, 0x09, 0xC2, 0x42,
+    0x22, 0x98, 0x45, 0x15, 0x24, 0x10, 0x40, 0xA0, 0x26, 0xA4, 0x88, 0x61, 0x44, 0x54, 0xA1, 0x04,
+    0x08, 0xE5, 0x09, 0x1E, 0x25, 0x84, 0xD1, 0x96, 0x11, 0x82, 0x36, 0x40, 0x89, 0xE2, 0xD0, 0x4D,
+    0x19, 0x84, 0x60, 0x90, 0x88, 0x8C, 0x51, 0xE3, 0x50, 0x45, 0x1D, 0x04, 0x10, 0x24, 0x54, 0x91,
+    0x05, 0x19, 0x0D, 0x61, 0x18, 0x84, 0x39, 0x02, 0x54, 0x8A, 0x41, 0x27, 0x47, 0x1A, 0x35, 0x08,
+    0x43, 0x10, 0xA8, 0x72, 0x46, 0x85, 0x9D, 0x14, 0xA1, 0x84, 0x21, 0x09, 0x63, 0x21, 0xB9, 0x64,
+    0x12, 0x22, 0x56, 0x1B, 0x42, 0x51, 0xD8, 0xD4, 0x1A, 0x43, 0x50, 0xA4, 0x44, 0x16, 0x9D, 0x09,
+    0x65, 0x84, 0x10, 0x65, 0x06, 0x53, 0x41, 0x74, 0x64, 0x2D, 0x34, 0x10, 0x20, 0x5D, 0x06, 0x6D,
+    0x06, 0x51, 0x90, 0xB5, 0x61, 0x1D, 0x05, 0xE1, 0x84, 0xD0, 0x6A, 0x78, 0xC2, 0x04, 0x95, 0x05,
+    0xA1, 0x8B, 0x41, 0xB4, 0x64, 0x08, 0x52, 0x43, 0x11, 0xE1, 0x74, 0xD0, 0x65, 0x67, 0x40, 0x85,
+    0x34, 0x20, 0x99, 0x61, 0x74, 0xE1, 0xB4, 0x26, 0x08, 0x51, 0x19, 0x12, 0xD1, 0x61, 0x66, 0x90,
+    0x26, 0x40, 0x86, 0x62, 0xBD, 0x96, 0x16, 0xCA, 0x09, 0xD0, 0x20, 0x46, 0x2D, 0x51, 0xA1, 0x55,
+    0x28, 0x28, 0x41, 0xF4, 0x46, 0xCF, 0x28, 0x5A, 0xC8, 0x0A, 0x60, 0x82, 0x99, 0xB1, 0x01, 0x74,
+    0x8A, 0x0A, 0x50, 0x7C, 0x87, 0xA2, 0x86, 0x53, 0x54, 0x0A, 0x90, 0x79, 0x0B, 0x10, 0x17, 0x92,
+    0x90, 0x2B, 0x41, 0xD4, 0x28, 0x50, 0x55, 0x12, 0x98, 0x2B, 0x41, 0xD8, 0x91, 0xA1, 0x39, 0x12,
+    0x61, 0x20};
+
+#endif
@@ -0,0 +1,234 @@
+#include "prof.h"
+#include "lowpower.h"
+#include "eeprom.h"
+#include <string.h>
+
+#define PROF_MS_PER_TICK_Q10 ((uint32_t)(1000.0 / LP_LPTIM_FINAL_CLK * 1024 + 0.5)) /* 每个定时器计数的毫秒数，放大1024倍 */
+
+static uint16_t LastTick[PROF_TRACK_COUNT]; /* 各计时线上次结束阶段的时刻 */
+static uint16_t PhaseTime[PROF_PHASE_COUNT];
+static uint16_t BootTick;
+static uint16_t StartupTime; /* 从启动到第一次SPI通信的时间，0xFFFF为还没有记录 */
+static uint16_t BoundaryTick;
+static uint16_t LatencyTime; /* 从整分钟到开始刷新的时间，0xFFFF为还没有记录 */
+
+/**
+ * @brief  写入一个WORD，数据相同时跳过，减少EEPROM擦写次数。
+ * @param  addr EEPROM地址（WORD）。
+ * @param  data 要写入的数据。
+ */
+static void prof_write_word(uint16_t addr, uint16_t data)
+{
+    if (EEPROM_ReadWORD(addr) != data)
+    {
+        EEPROM_WriteWORD(addr, data);
+    }
+}
+
+/**
+ * @brief  记录启动时刻，复位或唤醒后尽早调用。
+ * @note   低功耗定时器初始化之前的时间无法计入。
+ */
+void PROF_Boot(void)
+{
+    BootTick = LP_GetTick();
+    BoundaryTick = BootTick; /* 闹钟2在整分钟唤醒，启动时刻就是整分钟 */
+    StartupTime = 0xFFFF;
+    LatencyTime = 0xFFFF;
+}
+
+/**
+ * @brief  记录从PROF_Boot()到现在的时间作为启动延迟，在第一次SPI通信前调用，之后的调用无效。
+ */
+void PROF_MarkStartup(void)
+{
+    if (StartupTime == 0xFFFF)
+    {
+        StartupTime = ((uint32_t)(uint16_t)(LP_GetTick() - BootTick) * PROF_MS_PER_TICK_Q10 + 512) >> 10;
+    }
+}
+
+/**
+ * @brief  获取本次启动的启动延迟。
+ * @return 启动延迟，单位为毫秒，0xFFFF为还没有记录。
+ */
+uint16_t PROF_GetStartup(void)
+{
+    return StartupTime;
+}
+
+/**
+ * @brief  记录整分钟时刻，提前唤醒并等到整分钟时调用，否则使用启动时刻。
+ */
+void PROF_MarkBoundary(void)
+{
+    BoundaryTick = LP_GetTick();
+}
+
+/**
+ * @brief  记录从整分钟到现在的时间作为刷新延迟，在发出刷新命令后调用。
+ */
+void PROF_MarkRefresh(void)
+{
+    LatencyTime = ((uint32_t)(uint16_t)(LP_GetTick() - BoundaryTick) * PROF_MS_PER_TICK_Q10 + 512) >> 10;
+}
+
+/**
+ * @brief  获取本次唤醒的刷新延迟。
+ * @return 刷新延迟，单位为毫秒，0xFFFF为还没有记录。
+ */
+uint16_t PROF_GetLatency(void)
+{
+    return LatencyTime;
+}
+
+/**
+ * @brief  开始一次唤醒周期的计时，清除上次记录的各阶段时间。
+ */
+void PROF_Begin(void)
+{
+    uint8_t i;
+    uint16_t tick;
+
+    memset(PhaseTime, 0, sizeof(PhaseTime));
+    tick = LP_GetTick();
+    for (i = 0; i < PROF_TRACK_COUNT; i++)
+    {
+        LastTick[i] = tick;
+    }
+}
+
+/**
+ * @brief  在主流程中结束一个阶段，等同于PROF_MarkTrack(PROF_TRACK_MAIN, phase)。
+ * @param  phase 阶段编号，可设置为：PROF_PHASE_xxx。
+ */
+void PROF_Mark(uint8_t phase)
+{
+    PROF_MarkTrack(PROF_TRACK_MAIN, phase);
+}
+
+/**
+ * @brief  结束一个阶段，从该计时线上次调用PROF_Begin()或PROF_MarkTrack()到现在的时间计入此阶段。
+ * @param  track 计时线，可设置为：PROF_TRACK_xxx，同时运行的任务各用一条，互不分摊时间。
+ * @param  phase 阶段编号，可设置为：PROF_PHASE_xxx，PROF_PHASE_NONE用于设置任务开始的时刻。
+ * @note   使用低功耗定时器计时，包括Sleep和Stop模式的时间，单个阶段最长约28秒。
+ */
+void PROF_MarkTrack(uint8_t track, uint8_t phase)
+{
+    uint16_t tick;
+
+    if (track >= PROF_TRACK_COUNT)
+    {
+        return;
+    }
+    tick = LP_GetTick();
+    if (phase < PROF_PHASE_COUNT)
+    {
+        PhaseTime[phase] += ((uint32_t)(uint16_t)(tick - LastTick[track]) * PROF_MS_PER_TICK_Q10 + 512) >> 10;
+    }
+    LastTick[track] = tick;
+}
+
+/**
+ * @brief  获取本次唤醒周期中某个阶段的时间。
+ * @param  phase 阶段编号，可设置为：PROF_PHASE_xxx。
+ * @return 阶段时间，单位为毫秒。
+ */
+uint16_t PROF_GetLast(uint8_t phase)
+{
+    if (phase >= PROF_PHASE_COUNT)
+    {
+        return 0;
+    }
+    return PhaseTime[phase];
+}
+
+/**
+ * @brief  将本次唤醒周期的各阶段时间和刷新延迟合并到EEPROM中的最小值、平均值和最大值。
+ * @note   没有刷新时不合并刷新延迟。
+ * @note   每次调用都会写入EEPROM，需要由调用者控制频率，避免超过EEPROM擦写寿命。
+ */
+void PROF_Save(void)
+{
+    uint8_t i;
+    uint16_t count, addr, value;
+    int32_t avg;
+    struct PROF_Stat stat;
+
+    count = EEPROM_ReadWORD(PROF_EEPROM_ADDR_WORD);
+    for (i = 0; i < PROF_STAT_COUNT; i++)
+    {
+        addr = PROF_EEPROM_ADDR_WORD + 1 + i * 3;
+        if (i == PROF_STAT_LATENCY)
+        {
+            if (LatencyTime == 0xFFFF)
+            {
+                continue;
+            }
+            value = LatencyTime;
+        }
+        else
+        {
+            value = PhaseTime[i];
+        }
+        PROF_GetStat(i, &stat);
+        if (count == 0 || stat.max_ms == 0) /* 第一次记录，刷新延迟可能在之前的记录中没有合并过 */
+        {
+            stat.min_ms = value;
+            stat.avg_ms = value;
+            stat.max_ms = value;
+        }
+        else
+        {
+            if (value < stat.min_ms)
+            {
+                stat.min_ms = value;
+            }
+            if (value > stat.max_ms)
+            {
+                stat.max_ms = value;
+            }
+            avg = stat.avg_ms;
+            avg += ((int32_t)value - avg) / PROF_AVG_WEIGHT;
+            stat.avg_ms = avg;
+        }
+        prof_write_word(addr + 0, stat.min_ms);
+        prof_write_word(addr + 1, stat.avg_ms);
+        prof_write_word(addr + 2, stat.max_ms);
+    }
+    if (count != 0xFFFF)
+    {
+        prof_write_word(PROF_EEPROM_ADDR_WORD, count + 1);
+    }
+}
+
+/**
+ * @brief  获取已保存的记录次数。
+ * @return 记录次数，EEPROM被擦除后为0。
+ */
+uint16_t PROF_GetCount(void)
+{
+    return EEPROM_ReadWORD(PROF_EEPROM_ADDR_WORD);
+}
+
+/**
+ * @brief  获取某个阶段或刷新延迟已保存的统计数据。
+ * @param  phase 阶段编号，可设置为：PROF_PHASE_xxx、PROF_STAT_LATENCY。
+ * @param  stat 统计数据的指针。
+ * @return 1：没有记录，0：获取完成。
+ */
+uint8_t PROF_GetStat(uint8_t phase, struct PROF_Stat *stat)
+{
+    uint16_t addr;
+
+    if (phase >= PROF_STAT_COUNT || PROF_GetCount() == 0)
+    {
+        memset(stat, 0, sizeof(struct PROF_Stat));
+        return 1;
+    }
+    addr = PROF_EEPROM_ADDR_WORD + 1 + phase * 3;
+    stat->min_ms = EEPROM_ReadWORD(addr + 0);
+    stat->avg_ms = EEPROM_ReadWORD(addr + 1);
+    stat->max_ms = EEPROM_ReadWORD(addr + 2);
+    return 0;
+}
@@ -0,0 +1,49 @@
+#ifndef _PROF_H_
+#define _PROF_H_
+
+#include "main.h"
+
+/* 可修改 */
+#define PROF_EEPROM_ADDR_WORD 0x0200 /* 统计数据在EEPROM中的起始地址（WORD），占用1 + 3 * PROF_STAT_COUNT个WORD */
+#define PROF_AVG_WEIGHT 8            /* 平均值为滑动平均，新数据占1/PROF_AVG_WEIGHT */
+#define PROF_SAVE_INTERVAL_MIN 30    /* 每隔多少分钟保存一次统计数据 */
+/* 结束 */
+
+#define PROF_PHASE_RTC 0     /* 读取时间并设置闹钟 */
+#define PROF_PHASE_SENSOR 1  /* 温湿度单次测量，在PROF_TRACK_SENSOR中计时 */
+#define PROF_PHASE_EPDINIT 2 /* 电子纸初始化 */
+#define PROF_PHASE_DRAW 3    /* 绘制并发送显示数据 */
+#define PROF_PHASE_SHOW 4    /* 电子纸刷新 */
+#define PROF_PHASE_ADC 5     /* 电池电压测量和电子纸休眠 */
+#define PROF_PHASE_COUNT 6
+#define PROF_PHASE_NONE 0xFF /* 不计入任何阶段，用于跳过等待时间 */
+
+#define PROF_TRACK_MAIN 0   /* 主流程和电子纸更新任务，各阶段依次进行，总和为唤醒时长 */
+#define PROF_TRACK_SENSOR 1 /* 温湿度测量任务，与主流程的阶段同时进行 */
+#define PROF_TRACK_COUNT 2
+
+#define PROF_STAT_LATENCY PROF_PHASE_COUNT /* 统计数据中各阶段之后是整分钟到开始刷新的延迟 */
+#define PROF_STAT_COUNT (PROF_PHASE_COUNT + 1)
+
+struct PROF_Stat
+{
+    uint16_t min_ms;
+    uint16_t avg_ms;
+    uint16_t max_ms;
+};
+
+void PROF_Boot(void);
+void PROF_MarkStartup(void);
+uint16_t PROF_GetStartup(void);
+void PROF_MarkBoundary(void);
+void PROF_MarkRefresh(void);
+uint16_t PROF_GetLatency(void);
+void PROF_Begin(void);
+void PROF_Mark(uint8_t phase);
+void PROF_MarkTrack(uint8_t track, uint8_t phase);
+uint16_t PROF_GetLast(uint8_t phase);
+void PROF_Save(void);
+uint16_t PROF_GetCount(void);
+uint8_t PROF_GetStat(uint8_t phase, struct PROF_Stat *stat);
+
+#endif
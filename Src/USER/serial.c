@@ -1,22 +1,7 @@
 #include "serial.h"
+#include "wait.h"
 #include <stdio.h>
 
-#define WAIT_TIMEOUT(val)                                       \
-    timeout = SERIAL_TIMEOUT_MS;                                \
-    systick_tmp = SysTick->CTRL;                                \
-    ((void)systick_tmp);                                        \
-    while (timeout != 0 && val)                                 \
-    {                                                           \
-        if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U) \
-        {                                                       \
-            timeout -= 1;                                       \
-        }                                                       \
-    }                                                           \
-    if (timeout == 0)                                           \
-    {                                                           \
-        return;                                                 \
-    }
-
 /**
  * @brief  从串口发送指定大小的数据
  * @param  tx_data  要发送的数据指针
@@ -24,18 +9,25 @@
  */
 void SERIAL_SendData(const uint8_t *tx_data, uint32_t data_size)
 {
-    uint32_t timeout;
-    volatile uint32_t systick_tmp;
+    struct WAIT_Context wait;
 
     while (data_size != 0)
     {
-        WAIT_TIMEOUT(LL_USART_IsActiveFlag_TXE(SERIAL_NUM) == 0);
+        WAIT_WHILE(wait, LL_USART_IsActiveFlag_TXE(SERIAL_NUM) == 0, SERIAL_TIMEOUT_MS, WAIT_SITE_SERIAL_TXE);
+        if (wait.timeout != 0)
+        {
+            return;
+        }
         LL_USART_ClearFlag_TC(SERIAL_NUM);
         LL_USART_TransmitData8(SERIAL_NUM, *tx_data);
         tx_data += 1;
         data_size -= 1;
     }
-    WAIT_TIMEOUT(LL_USART_IsActiveFlag_TC(SERIAL_NUM) == 0);
+    WAIT_WHILE(wait, LL_USART_IsActiveFlag_TC(SERIAL_NUM) == 0, SERIAL_TIMEOUT_MS, WAIT_SITE_SERIAL_TC);
+    if (wait.timeout != 0)
+    {
+        return;
+    }
 }
 
 /**
@@ -53,25 +53,43 @@ static void readout_data_conv(const uint8_t *raw_data, struct TH_Value *value)
 }
 
 /**
- * @brief  向传感器发送命令。
- * @param  cmd 要发送的命令。
- * @return 1：发送失败，0：发送成功。
+ * @brief  与传感器进行一次I2C传输。
+ * @param  cmd 要发送的命令，NULL为不发送。
+ * @param  data 数据指针，NULL为不读取。
+ * @param  data_size 数据大小。
+ * @return 1：传输失败，0：传输成功。
  */
-uint8_t TH_WriteCmd(uint16_t cmd)
+static uint8_t th_transfer(const uint8_t *cmd, uint8_t *data, uint8_t data_size)
 {
-    if (I2C_Start(TH_I2C_ADDR, 0, 2) != 0 ||
-        I2C_WriteByte(cmd >> 8) != 0 ||
-        I2C_WriteByte(cmd & 0x00FF) != 0)
-    {
-        return 1;
-    }
-    if (I2C_Stop() != 0)
+    struct I2C_Transfer transfer;
+
+    transfer.addr = TH_I2C_ADDR;
+    transfer.tx_data = cmd;
+    transfer.tx_size = 2;
+    transfer.rx_data = data;
+    transfer.rx_size = data_size;
+    transfer.restart = 1;
+    if (I2C_Transfer(&transfer) != I2C_STATUS_OK)
     {
         return 1;
     }
     return 0;
 }
 
+/**
+ * @brief  向传感器发送命令。
+ * @param  cmd 要发送的命令。
+ * @return 1：发送失败，0：发送成功。
+ */
+uint8_t TH_WriteCmd(uint16_t cmd)
+{
+    uint8_t cmd_tmp[2];
+
+    cmd_tmp[0] = cmd >> 8;
+    cmd_tmp[1] = cmd & 0x00FF;
+    return th_transfer(cmd_tmp, NULL, 0);
+}
+
 /**
  * @brief  从传感器读取数据。
  * @param  data 数据指针。
@@ -80,21 +98,7 @@ uint8_t TH_WriteCmd(uint16_t cmd)
  */
 uint8_t TH_ReadData(uint8_t *data, uint8_t data_size)
 {
-    uint8_t i;
-
-    if (I2C_Start(TH_I2C_ADDR, 1, data_size) != 0)
-    {
-        return 1;
-    }
-    for (i = 0; i < data_size; i++)
-    {
-        data[i] = I2C_ReadByte();
-    }
-    if (I2C_Stop() != 0)
-    {
-        return 1;
-    }
-    return 0;
+    return th_transfer(NULL, data, data_size);
 }
 
 /**
@@ -106,24 +110,11 @@ uint8_t TH_ReadData(uint8_t *data, uint8_t data_size)
  */
 uint8_t TH_ReadCmd(uint16_t cmd, uint8_t *data, uint8_t data_size)
 {
-    uint8_t i;
+    uint8_t cmd_tmp[2];
 
-    if (I2C_Start(TH_I2C_ADDR, 0, 2) != 0 ||
-        I2C_WriteByte(cmd >> 8) != 0 ||
-        I2C_WriteByte(cmd & 0x00FF) != 0 ||
-        I2C_Start(TH_I2C_ADDR, 1, data_size) != 0)
-    {
-        return 1;
-    }
-    for (i = 0; i < data_size; i++)
-    {
-        data[i] = I2C_ReadByte();
-    }
-    if (I2C_Stop() != 0)
-    {
-        return 1;
-    }
-    return 0;
+    cmd_tmp[0] = cmd >> 8;
+    cmd_tmp[1] = cmd & 0x00FF;
+    return th_transfer(cmd_tmp, data, data_size);
 }
 
 /**
@@ -158,6 +149,7 @@ uint8_t TH_GetValue_SingleShotWithCS(uint8_t acc, struct TH_Value *value)
     }
     if (crc8(ht_tmp, 2) != ht_tmp[2] || crc8(ht_tmp + 3, 2) != ht_tmp[5])
     {
+        I2C_ReportCRCError(TH_I2C_ADDR);
         return 2;
     }
     readout_data_conv(ht_tmp, value);
@@ -210,6 +202,7 @@ uint8_t TH_GetValue_SingleShotWithoutCS(struct TH_Value *value)
     }
     if (crc8(ht_tmp, 2) != ht_tmp[2] || crc8(ht_tmp + 3, 2) != ht_tmp[5])
     {
+        I2C_ReportCRCError(TH_I2C_ADDR);
         return 1;
     }
     readout_data_conv(ht_tmp, value);
@@ -290,6 +283,7 @@ uint8_t TH_GetValue_Periodic_ART(struct TH_Value *value)
     }
     if (crc8(ht_tmp, 2) != ht_tmp[2] || crc8(ht_tmp + 3, 2) != ht_tmp[5])
     {
+        I2C_ReportCRCError(TH_I2C_ADDR);
         return 1;
     }
     readout_data_conv(ht_tmp, value);
@@ -368,6 +362,7 @@ uint8_t TH_GetStatus(void)
     }
     if (crc8(status_tmp, 2) != status_tmp[2])
     {
+        I2C_ReportCRCError(TH_I2C_ADDR);
         return 0xFF;
     }
     ret = 0;
@@ -12,6 +12,10 @@
 #define TH_ACC_MID 1
 #define TH_ACC_LOW 2
 
+#define TH_CONV_MS_HIGH 16 /* 单次模式转换最长时间，向上取整 */
+#define TH_CONV_MS_MID 7
+#define TH_CONV_MS_LOW 5
+
 #define TH_MPS_0_5 0
 #define TH_MPS_1 1
 #define TH_MPS_2 2
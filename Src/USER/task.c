@@ -0,0 +1,73 @@
+#include "task.h"
+
+/**
+ * @brief  轮流执行任务直到全部完成，所有任务都在等待时进入Stop模式。
+ * @param  tasks 任务数组，只需要设置func，其他成员由此函数初始化。
+ * @param  count 任务数量。
+ * @note   Stop模式由电子纸BUSY引脚下降沿或最近的等待超时唤醒，唤醒后重新检查所有任务的等待条件。
+ * @note   有任务等待BUSY引脚时，打开唤醒中断后引脚已经为低电平则不进入Stop模式，防止下降沿出现在检查之后而丢失。
+ */
+void TASK_Run(struct TASK *tasks, uint8_t count)
+{
+    uint8_t i, ready, done, wkup;
+    uint16_t elapsed, sleep_ms;
+
+    for (i = 0; i < count; i++)
+    {
+        tasks[i].line = 0;
+        tasks[i].timeout = 0;
+        tasks[i].state = TASK_STATE_READY;
+        tasks[i].wkup = 0;
+    }
+    while (1)
+    {
+        for (i = 0; i < count; i++)
+        {
+            if (tasks[i].state != TASK_STATE_DONE)
+            {
+                tasks[i].state = tasks[i].func(&tasks[i]);
+            }
+        }
+
+        ready = 0;
+        done = 0;
+        wkup = 0;
+        sleep_ms = 0xFFFF;
+        for (i = 0; i < count; i++)
+        {
+            if (tasks[i].state == TASK_STATE_DONE)
+            {
+                done += 1;
+            }
+            else if (tasks[i].state == TASK_STATE_READY)
+            {
+                ready = 1;
+            }
+            else
+            {
+                wkup |= tasks[i].wkup;
+                elapsed = LP_GetElapsedMs(tasks[i].wait_tick);
+                if (elapsed >= tasks[i].wait_ms) /* 已经超时，需要再执行一次 */
+                {
+                    ready = 1;
+                }
+                else if (tasks[i].wait_ms - elapsed < sleep_ms)
+                {
+                    sleep_ms = tasks[i].wait_ms - elapsed;
+                }
+            }
+        }
+        if (done == count)
+        {
+            return;
+        }
+        if (ready == 0 && wkup != 0)
+        {
+            LP_EnterStopWkup(sleep_ms);
+        }
+        else if (ready == 0)
+        {
+            LP_EnterStop(sleep_ms);
+        }
+    }
+}
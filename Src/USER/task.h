@@ -0,0 +1,83 @@
+#ifndef _TASK_H_
+#define _TASK_H_
+
+#include "main.h"
+#include "lowpower.h"
+
+#define TASK_STATE_READY 0   /* 可以继续执行 */
+#define TASK_STATE_WAITING 1 /* 等待条件成立或超时 */
+#define TASK_STATE_DONE 2    /* 执行完成 */
+
+struct TASK;
+typedef uint8_t (*TASK_Func)(struct TASK *task);
+
+struct TASK
+{
+    TASK_Func func;     /* 任务函数，返回TASK_STATE_xxx */
+    uint16_t line;      /* 下次进入时继续执行的位置，0为从头开始 */
+    uint16_t wait_tick; /* 开始等待时的低功耗定时器计数值 */
+    uint16_t wait_ms;   /* 等待超时时间 */
+    uint8_t state;      /* 任务状态 */
+    uint8_t timeout;    /* 上次等待是否超时 */
+    uint8_t wkup;       /* 正在等待唤醒引脚变为低电平 */
+};
+
+/*
+ * 任务函数使用以下宏编写，等待时返回到调度器，下次进入时从等待位置继续执行。
+ * 等待前后局部变量不会保留，需要保留的数据应放在静态变量中；等待不能写在switch语句中，也不能在同一行出现两次。
+ */
+#define TASK_BEGIN(task)        \
+    switch ((task)->line)       \
+    {                           \
+    case 0:
+
+#define TASK_END(task)          \
+    }                           \
+    (task)->line = 0;           \
+    return TASK_STATE_DONE
+
+/* 等待条件成立，最多等待ms毫秒，超时后继续执行并设置task->timeout */
+#define TASK_WAIT_UNTIL(task, cond, ms)                                  \
+    do                                                                   \
+    {                                                                    \
+        (task)->wait_tick = LP_GetTick();                                \
+        (task)->wait_ms = (ms);                                          \
+        (task)->line = __LINE__;                                         \
+    case __LINE__:                                                       \
+        if (cond)                                                        \
+        {                                                                \
+            (task)->timeout = 0;                                         \
+        }                                                                \
+        else if (LP_GetElapsedMs((task)->wait_tick) < (task)->wait_ms)   \
+        {                                                                \
+            return TASK_STATE_WAITING;                                   \
+        }                                                                \
+        else                                                             \
+        {                                                                \
+            (task)->timeout = 1;                                         \
+        }                                                                \
+    } while (0)
+
+/* 等待唤醒引脚（电子纸BUSY）变为低电平，cond在引脚为低电平时成立，调度器打开唤醒中断后再次检查引脚，不会丢失检查之后出现的下降沿 */
+#define TASK_WAIT_WKUP(task, cond, ms)   \
+    do                                   \
+    {                                    \
+        (task)->wkup = 1;                \
+        TASK_WAIT_UNTIL(task, cond, ms); \
+        (task)->wkup = 0;                \
+    } while (0)
+
+#define TASK_DELAY(task, ms) TASK_WAIT_UNTIL(task, 0, ms)
+
+/* 让其他任务先执行，不进入低功耗模式 */
+#define TASK_YIELD(task)                 \
+    do                                   \
+    {                                    \
+        (task)->line = __LINE__;         \
+        return TASK_STATE_READY;         \
+    case __LINE__:;                      \
+    } while (0)
+
+void TASK_Run(struct TASK *tasks, uint8_t count);
+
+#endif
@@ -0,0 +1,114 @@
+#include "wait.h"
+
+static struct WAIT_Stat Stat[WAIT_SITE_COUNT];
+
+/**
+ * @brief  延时指定的微秒数，使用SysTick计数，与系统时钟频率无关。
+ * @param  us 延时时间，单位为微秒。
+ * @note   SysTick需要已经按1ms周期启动，不需要打开中断。
+ */
+void WAIT_DelayUs(uint16_t us)
+{
+    uint32_t load, last, now, ticks, target;
+
+    load = SysTick->LOAD + 1;
+    target = (uint32_t)us * (SystemCoreClock / 1000000);
+    ticks = 0;
+    last = SysTick->VAL;
+    while (ticks < target)
+    {
+        now = SysTick->VAL;
+        if (last >= now) /* SysTick向下计数 */
+        {
+            ticks += last - now;
+        }
+        else
+        {
+            ticks += last + load - now;
+        }
+        last = now;
+    }
+}
+
+/**
+ * @brief  开始一次等待，由WAIT_WHILE()调用。
+ * @param  ctx 等待状态。
+ * @param  site 等待位置编号，可设置为：WAIT_SITE_xxx。
+ * @param  timeout_ms 超时时间，单位为毫秒。
+ */
+void WAIT_Begin(struct WAIT_Context *ctx, uint8_t site, uint16_t timeout_ms)
+{
+    ctx->start_tick = LP_GetTick();
+    ctx->timeout_ms = timeout_ms;
+    ctx->site = site;
+    ctx->timeout = 0;
+}
+
+/**
+ * @brief  等待条件不满足时调用一次，检查是否超时，等待较长时进入Sleep模式。
+ * @param  ctx 等待状态。
+ * @return 1：等待超时，0：继续等待。
+ */
+uint8_t WAIT_Poll(struct WAIT_Context *ctx)
+{
+    uint16_t elapsed;
+
+    elapsed = LP_GetElapsedMs(ctx->start_tick);
+    if (elapsed >= ctx->timeout_ms)
+    {
+        ctx->timeout = 1;
+        return 1;
+    }
+    if (elapsed >= WAIT_SPIN_MS)
+    {
+        LP_EnterSleepPoll(WAIT_NAP_MS);
+    }
+    return 0;
+}
+
+/**
+ * @brief  结束一次等待并记录统计数据，由WAIT_WHILE()调用。
+ * @param  ctx 等待状态。
+ */
+void WAIT_End(struct WAIT_Context *ctx)
+{
+    uint16_t elapsed;
+    struct WAIT_Stat *stat;
+
+    if (ctx->site >= WAIT_SITE_COUNT)
+    {
+        return;
+    }
+    elapsed = LP_GetElapsedMs(ctx->start_tick);
+    stat = &Stat[ctx->site];
+    if (stat->count != 0xFFFF)
+    {
+        stat->count += 1;
+    }
+    if (ctx->timeout != 0 && stat->timeouts != 0xFFFF)
+    {
+        stat->timeouts += 1;
+    }
+    if (elapsed > stat->max_ms)
+    {
+        stat->max_ms = elapsed;
+    }
+    stat->total_ms += elapsed;
+}
+
+/**
+ * @brief  获取某个等待位置的统计数据。
+ * @param  site 等待位置编号，可设置为：WAIT_SITE_xxx。
+ * @param  stat 统计数据的指针。
+ * @return 1：位置编号错误，0：获取完成。
+ * @note   统计数据保存在RAM中，进入Standby模式后清除。
+ */
+uint8_t WAIT_GetStat(uint8_t site, struct WAIT_Stat *stat)
+{
+    if (site >= WAIT_SITE_COUNT)
+    {
+        return 1;
+    }
+    *stat = Stat[site];
+    return 0;
+}
@@ -0,0 +1,70 @@
+#ifndef _WAIT_H_
+#define _WAIT_H_
+
+#include "main.h"
+#include "lowpower.h"
+
+/* 可修改 */
+#define WAIT_SPIN_MS 1 /* 等待时间超过此值后改为在Sleep模式中等待，较短的等待直接查询标志 */
+#define WAIT_NAP_MS 1  /* 每次进入Sleep模式的时间，唤醒后重新检查条件 */
+/* 结束 */
+
+#define WAIT_SITE_I2C_TRANSFER 0 /* 等待位置编号，每处调用WAIT_WHILE()或WAIT_Begin()的位置使用不同编号，分别统计 */
+#define WAIT_SITE_ADC_READY 1
+#define WAIT_SITE_ADC_ABORT 2 /* 关闭ADC前停止转换 */
+#define WAIT_SITE_ADC_DISABLE 3
+#define WAIT_SITE_ADC_CAL 4
+#define WAIT_SITE_ADC_VREFINT 5
+#define WAIT_SITE_ADC_EOC 6
+#define WAIT_SITE_ADC_STOP 7 /* 转换完成后停止连续转换 */
+#define WAIT_SITE_EEPROM 8
+#define WAIT_SITE_SERIAL_TXE 9
+#define WAIT_SITE_SERIAL_TC 10
+#define WAIT_SITE_SPI_TXE 11
+#define WAIT_SITE_SPI_BSY 12
+#define WAIT_SITE_EPD_BUSY 13
+#define WAIT_SITE_COUNT 14
+
+struct WAIT_Context
+{
+    uint16_t start_tick; /* 开始等待时的低功耗定时器计数值 */
+    uint16_t timeout_ms; /* 超时时间，最长约28秒 */
+    uint8_t site;        /* 等待位置编号 */
+    uint8_t timeout;     /* 1：等待超时，0：条件已满足 */
+};
+
+struct WAIT_Stat
+{
+    uint16_t count;    /* 实际发生等待的次数 */
+    uint16_t timeouts; /* 超时次数 */
+    uint16_t max_ms;   /* 最长等待时间 */
+    uint32_t total_ms; /* 总等待时间 */
+};
+
+/*
+ * busy成立期间一直等待，最多等待ms毫秒，完成后ctx.timeout为1表示超时。
+ * 条件一开始就不成立时直接返回，不计入统计；短时间等待直接查询，超过WAIT_SPIN_MS后在Sleep模式中等待。
+ */
+#define WAIT_WHILE(ctx, busy, ms, site_id)              \
+    do                                                  \
+    {                                                   \
+        (ctx).timeout = 0;                              \
+        if (busy)                                       \
+        {                                               \
+            WAIT_Begin(&(ctx), (site_id), (ms));        \
+            while ((busy) && WAIT_Poll(&(ctx)) == 0)    \
+            {                                           \
+            }                                           \
+            WAIT_End(&(ctx));                           \
+        }                                               \
+    } while (0)
+
+void WAIT_DelayUs(uint16_t us);
+
+void WAIT_Begin(struct WAIT_Context *ctx, uint8_t site, uint16_t timeout_ms);
+uint8_t WAIT_Poll(struct WAIT_Context *ctx);
+void WAIT_End(struct WAIT_Context *ctx);
+
+uint8_t WAIT_GetStat(uint8_t site, struct WAIT_Stat *stat);
+
+#endif
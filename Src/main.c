@@ -99,11 +99,8 @@ int main(void)
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
-  MX_ADC_Init();
   MX_I2C1_Init();
   MX_SPI1_Init();
-  MX_USART1_UART_Init();
-  MX_TIM2_Init();
   MX_LPTIM1_Init();
   /* USER CODE BEGIN 2 */
   Init();
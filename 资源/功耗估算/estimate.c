@@ -0,0 +1,46 @@
+/*
+ * 在电脑上使用与固件相同的模型估算电池寿命，用于在刷写固件前评估配置修改。
+ *
+ * 编译：gcc -I../../Src/USER -o estimate estimate.c ../../Src/USER/energy.c
+ * 使用：estimate RTC SENSOR EPDINIT DRAW SHOW ADC [每天唤醒次数] [电池电压] [警告电压] [关机电压]
+ *       各阶段时间单位为毫秒，可以从系统信息界面或DumpProfile()的串口输出中获得。
+ * 示例：estimate 3 16 120 45 450 4 1440 2.80 1.50 1.20
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "energy.h"
+
+#define BAT_MAX_VOLTAGE 3.00 /* 与func.h相同 */
+
+int main(int argc, char *argv[])
+{
+    uint8_t i;
+    uint16_t phase_ms[ENERGY_PHASE_COUNT];
+    uint16_t wakes_per_day;
+    float voltage, warn_voltage, stop_voltage;
+    struct ENERGY_Result result;
+
+    if (argc < 1 + ENERGY_PHASE_COUNT)
+    {
+        printf("usage: %s RTC SENSOR EPDINIT DRAW SHOW ADC [wakes_per_day] [voltage] [warn_voltage] [stop_voltage]\n", argv[0]);
+        return 1;
+    }
+    for (i = 0; i < ENERGY_PHASE_COUNT; i++)
+    {
+        phase_ms[i] = atoi(argv[1 + i]);
+    }
+    wakes_per_day = (argc > 7) ? atoi(argv[7]) : 24 * 60;
+    voltage = (argc > 8) ? atof(argv[8]) : BAT_MAX_VOLTAGE;
+    warn_voltage = (argc > 9) ? atof(argv[9]) : 1.50;
+    stop_voltage = (argc > 10) ? atof(argv[10]) : 1.20;
+
+    ENERGY_Estimate(&ENERGY_DefaultModel, phase_ms, wakes_per_day, voltage, BAT_MAX_VOLTAGE, warn_voltage, stop_voltage, &result);
+
+    printf("wake charge  : %.1f uC\n", result.wake_uc);
+    printf("daily charge : %.3f mAh\n", result.daily_mah);
+    printf("remaining    : %.0f mAh\n", result.remaining_mah);
+    printf("days to warn : %.0f\n", result.days_to_warn);
+    printf("days to stop : %.0f\n", result.days_to_stop);
+    return 0;
+}
@@ -0,0 +1,100 @@
+# 将位图转换为压缩图像，生成 Src/USER/packimage.h
+# 用法：python packimage.py
+# 修改位图或 packimage.txt 后需要重新运行
+#
+# 压缩格式：图像宽度, 图像宽度, 图像高度, 压缩数据...
+# 像素按控制器RAM顺序排列（先Y方向后X方向，每字节高位在上），1为白色
+# 压缩数据为比特流，高位在前：第一位为首个像素的颜色，之后为交替颜色的游程长度，使用Elias gamma编码
+
+import os
+import struct
+
+PATH = os.path.dirname(os.path.abspath(__file__))
+BMP_PATH = os.path.join(PATH, '..', '位图')
+SPEC_FILE = os.path.join(PATH, 'packimage.txt')
+OUT_FILE = os.path.join(PATH, '..', '..', 'Src', 'USER', 'packimage.h')
+
+
+def read_bmp(file_name):
+    """读取1位或8位BMP文件，返回宽度，高度和按行排列的像素（1为白色）"""
+    data = open(file_name, mode='rb').read()
+    offset = struct.unpack_from('<I', data, 10)[0]
+    width, height = struct.unpack_from('<ii', data, 18)
+    bpp = struct.unpack_from('<H', data, 28)[0]
+    colors = struct.unpack_from('<I', data, 46)[0] or (1 << bpp)
+    palette = [data[54 + i * 4:54 + i * 4 + 3] for i in range(colors)]
+    stride = ((width * bpp + 31) // 32) * 4
+    rows = []
+    for row in range(abs(height)):
+        line = abs(height) - 1 - row if height > 0 else row  # 高度为正时数据从下往上存放
+        line_data = data[offset + line * stride:offset + (line + 1) * stride]
+        pixels = []
+        for x in range(width):
+            if bpp == 1:
+                index = (line_data[x // 8] >> (7 - x % 8)) & 1
+            elif bpp == 8:
+                index = line_data[x]
+            else:
+                raise ValueError('不支持的BMP格式：' + file_name)
+            pixels.append(1 if sum(palette[index]) >= 384 else 0)
+        rows.append(pixels)
+    return width, abs(height), rows
+
+
+def to_ram_order(width, height, rows):
+    """按控制器RAM顺序排列像素"""
+    if height % 8 != 0:
+        raise ValueError('图像高度必须是8的倍数')
+    bits = []
+    for x in range(width):
+        for y in range(height):
+            bits.append(rows[y][x])
+    return bits
+
+
+def pack(bits):
+    """游程编码并转换为字节"""
+    stream = [bits[0]]
+    color, run = bits[0], 0
+    for bit in bits + [1 - bits[-1]]:
+        if bit == color:
+            run += 1
+            continue
+        code = bin(run)[2:]
+        stream += [0] * (len(code) - 1) + [int(c) for c in code]
+        color, run = bit, 1
+    stream += [0] * (-len(stream) % 8)
+    return [int(''.join(str(b) for b in stream[i:i + 8]), 2) for i in range(0, len(stream), 8)]
+
+
+def to_c(name, width, height, data):
+    lines = ['static const uint8_t EPD_PackedImage_' + name + '[] = {',
+             '    ' + str(min(width, 255)) + ', ' + str(max(width - 255, 0)) + ', ' + str(height) + ', /* 图像宽度，图像宽度，图像高度*/']
+    for i in range(0, len(data), 16):
+        end = '};' if i + 16 >= len(data) else ','
+        lines.append('    ' + ', '.join('0x' + hex(x)[2:].zfill(2).upper() for x in data[i:i + 16]) + end)
+    return '\n'.join(lines) + '\n'
+
+
+file_new = open(OUT_FILE, mode='w', encoding='utf-8', newline='\n')
+file_new.write('#ifndef _PACKIMAGE_H_\n#define _PACKIMAGE_H_\n\n')
+file_new.write('/* 此文件由 资源/图像压缩/packimage.py 根据 packimage.txt 生成，请勿手动修改 */\n')
+file_new.write('/* 格式：图像宽度, 图像宽度, 图像高度, 游程编码数据...，使用EPD_DrawPackedImage()绘制 */\n\n')
+file_new.write('#include "main.h"\n')
+
+total_raw, total_packed = 0, 0
+for line in open(SPEC_FILE, mode='r', encoding='utf-8'):
+    if line.strip() == '' or line.lstrip().startswith('#'):
+        continue
+    name, bmp_name = line.split()
+    width, height, rows = read_bmp(os.path.join(BMP_PATH, bmp_name))
+    data = pack(to_ram_order(width, height, rows))
+    file_new.write('\n/* ' + bmp_name + '，原始' + str(width * height // 8) + '字节，压缩后' + str(len(data)) + '字节 */\n')
+    file_new.write(to_c(name, width, height, data))
+    total_raw += width * height // 8
+    total_packed += len(data)
+
+file_new.write('\n#endif\n')
+file_new.close()
+
+print('原始大小：' + str(total_raw) + '字节，压缩后：' + str(total_packed) + '字节')
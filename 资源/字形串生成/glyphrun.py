@@ -0,0 +1,106 @@
+# 将固定显示的字符串预先转换为字模索引（字形串），生成 Src/USER/glyphrun.h
+# 用法：python glyphrun.py
+# 修改字模（gdeh029a1.h）或 glyphrun.txt 后需要重新运行
+
+import os
+import re
+import shlex
+
+PATH = os.path.dirname(os.path.abspath(__file__))
+FONT_FILE = os.path.join(PATH, '..', '..', 'Src', 'USER', 'gdeh029a1.h')
+SPEC_FILE = os.path.join(PATH, 'glyphrun.txt')
+OUT_FILE = os.path.join(PATH, '..', '..', 'Src', 'USER', 'glyphrun.h')
+
+GLYPHRUN_ASCII = 0x80    # 0x80及以上为ASCII字符索引
+GLYPHRUN_SPACE = 0x7F    # 未指定ASCII字体时的半宽空格
+GLYPHRUN_MISSING = 0x7E  # 字体中不存在的字符，只占位不绘制
+
+
+def read_fonts():
+    """读取全部字体的头信息，UTF8字体同时读取UNICODE索引"""
+    fonts = {}
+    name = None
+    for line in open(FONT_FILE, mode='r', encoding='utf-8'):
+        m = re.match(r'static const uint8_t (EPD_Font\w+)\[\] = \{', line)
+        if m:
+            name = m.group(1)
+            fonts[name] = None
+            continue
+        if name is None:
+            continue
+        if fonts[name] is None:  # 头信息：起始字符，字体宽度，字体高度，字体个数
+            head = [x.strip() for x in line.split('/*')[0].split(',')]
+            if head[0].startswith("'"):
+                start = ord(head[0][1])
+            elif head[0] == 'EPD_FONT_SORTED':
+                start = 0
+            else:
+                start = int(head[0], 0)
+            fonts[name] = {'start': start, 'count': int(head[3]), 'index': []}
+        m = re.match(r'\s*0x([0-9A-Fa-f]{2}), 0x([0-9A-Fa-f]{2}), 0x([0-9A-Fa-f]{2}), /\* UNICODE索引', line)
+        if m:
+            fonts[name]['index'].append(int(m.group(1) + m.group(2) + m.group(3), 16))
+        if line.rstrip().endswith('};'):
+            name = None
+    return fonts
+
+
+def convert(text, ascii_font, utf8_font):
+    """按照EPD_DrawUTF8()的规则将字符串转换为字形串"""
+    run = []
+    for charter in text:
+        if ord(charter) < 0x80:
+            if ascii_font is not None:
+                index = ord(charter) - ascii_font['start']
+                if index < 0 or index >= ascii_font['count'] or index >= 0x80:
+                    raise ValueError('ASCII字体中没有字符：' + charter)
+                run.append(GLYPHRUN_ASCII | index)
+            elif charter == ' ' and utf8_font is not None:
+                run.append(GLYPHRUN_SPACE)
+        elif utf8_font is not None:
+            if ord(charter) in utf8_font['index']:
+                index = utf8_font['index'].index(ord(charter))
+                if index >= GLYPHRUN_MISSING:
+                    raise ValueError('UTF8字体字符数过多：' + charter)
+                run.append(index)
+            else:
+                print('警告：UTF8字体中没有字符：' + charter)
+                run.append(GLYPHRUN_MISSING)
+    if len(run) > 255:
+        raise ValueError('字符串过长：' + text)
+    return run
+
+
+def to_c(run):
+    return ', '.join([str(len(run))] + ['0x' + hex(x)[2:].zfill(2).upper() for x in run])
+
+
+fonts = read_fonts()
+file_new = open(OUT_FILE, mode='w', encoding='utf-8', newline='\n')
+file_new.write('#ifndef _GLYPHRUN_H_\n#define _GLYPHRUN_H_\n\n')
+file_new.write('/* 此文件由 资源/字形串生成/glyphrun.py 根据 glyphrun.txt 生成，请勿手动修改 */\n')
+file_new.write('/* 格式：字符个数, 字符索引...，字符串表为多个字形串依次排列，使用EPD_GetGlyphRun()按序号查找 */\n\n')
+file_new.write('#include "main.h"\n')
+
+total = 0
+for line in open(SPEC_FILE, mode='r', encoding='utf-8'):
+    if line.strip() == '' or line.lstrip().startswith('#'):
+        continue
+    items = shlex.split(line)
+    name, ascii_name, utf8_name, texts = items[0], items[1], items[2], items[3:]
+    ascii_font = None if ascii_name == 'NULL' else fonts[ascii_name]
+    utf8_font = None if utf8_name == 'NULL' else fonts[utf8_name]
+    file_new.write('\n/* ' + ascii_name + ', ' + utf8_name + ' */\n')
+    if len(texts) == 1:
+        file_new.write('static const uint8_t GlyphRun_' + name + '[] = {' + to_c(convert(texts[0], ascii_font, utf8_font)) + '}; /* ' + texts[0] + ' */\n')
+    else:
+        file_new.write('static const uint8_t GlyphRun_' + name + '[] = {\n')
+        for i, text in enumerate(texts):
+            end = '};' if i == len(texts) - 1 else ','
+            file_new.write('    ' + to_c(convert(text, ascii_font, utf8_font)) + end + ' /* ' + str(i) + ' - ' + text + ' */\n')
+    total = total + 1
+
+file_new.write('\n#endif\n')
+file_new.close()
+
+print('总字形串数：' + str(total))
@@ -0,0 +1,211 @@
+/*
+ * 在电脑上用C库的gmtime_r()逐日验证epoch.c，修改时间库后运行一次。
+ *
+ * 编译：gcc -include rtc_time.h -I../../Src/USER -o epoch_test epoch_test.c ../../Src/USER/epoch.c
+ * 使用：epoch_test
+ *       检查2000年至2199年的每一天，32位秒数可以表示的日期内每天再检查若干时刻的两种小时制和寄存器编码，
+ *       寄存器按ds3231.c中RTC_SetTime()和RTC_GetTime()的方式编码和解码后比较，全部一致时返回0。
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "epoch.h"
+
+#define UNIX_2000 946684800L /* 2000年1月1日0点的Unix时间 */
+#define ERROR_PRINT_MAX 10
+
+static long Errors;
+static long Checks;
+
+static void report(const char *what, uint32_t value, int is_12hr)
+{
+    if (Errors < ERROR_PRINT_MAX)
+    {
+        printf("%s: %lu is_12hr=%d\n", what, (unsigned long)value, is_12hr);
+    }
+    Errors += 1;
+}
+
+static uint8_t bin_to_bcd(uint8_t bin)
+{
+    return ((bin / 10) << 4) | (bin % 10);
+}
+
+static uint8_t bcd_to_bin(uint8_t bcd)
+{
+    return (bcd >> 4) * 10 + (bcd & 0x0F);
+}
+
+static void regs_decode(const uint8_t *regs, struct RTC_Time *time) /* 与RTC_GetTime()相同 */
+{
+    time->Seconds = bcd_to_bin(regs[0]);
+    time->Minutes = bcd_to_bin(regs[1]);
+    if ((regs[2] & 0x40) != 0)
+    {
+        time->Is_12hr = 1;
+        time->PM = (regs[2] & 0x20) != 0;
+        time->Hours = bcd_to_bin(regs[2] & 0x1F);
+    }
+    else
+    {
+        time->Is_12hr = 0;
+        time->PM = 0;
+        time->Hours = bcd_to_bin(regs[2] & 0x3F);
+    }
+    time->Day = ((regs[3] + 12) % 7) + 1;
+    time->Date = bcd_to_bin(regs[4]);
+    time->Month = bcd_to_bin(regs[5] & 0x1F);
+    time->Year = bcd_to_bin(regs[6]) + ((regs[5] & 0x80) != 0 ? 100 : 0);
+}
+
+static void regs_encode(const struct RTC_Time *time, uint8_t *regs) /* 与RTC_SetTime()相同 */
+{
+    uint8_t year;
+
+    regs[0] = bin_to_bcd(time->Seconds);
+    regs[1] = bin_to_bcd(time->Minutes);
+    regs[2] = bin_to_bcd(time->Hours);
+    if (time->Is_12hr != 0)
+    {
+        regs[2] = (regs[2] & 0x1F) | 0x40 | (time->PM != 0 ? 0x20 : 0x00);
+    }
+    regs[3] = ((time->Day + 7) % 7) + 1;
+    regs[4] = bin_to_bcd(time->Date);
+    year = time->Year;
+    regs[5] = bin_to_bcd(time->Month);
+    if (year > 99)
+    {
+        year -= 100;
+        regs[5] |= 0x80;
+    }
+    regs[6] = bin_to_bcd(year);
+}
+
+static int time_equal(const struct RTC_Time *a, const struct RTC_Time *b)
+{
+    return a->Seconds == b->Seconds && a->Minutes == b->Minutes && a->Hours == b->Hours && a->Day == b->Day &&
+           a->Date == b->Date && a->Month == b->Month && a->Year == b->Year && a->PM == b->PM && a->Is_12hr == b->Is_12hr;
+}
+
+static void check_seconds(uint32_t seconds, int is_12hr)
+{
+    time_t unix_time;
+    struct tm ref;
+    struct RTC_Time time, decoded;
+    uint8_t regs[EPOCH_RTC_REG_COUNT], expect[EPOCH_RTC_REG_COUNT];
+    uint8_t hours, i;
+
+    Checks += 1;
+    unix_time = UNIX_2000 + (time_t)seconds;
+    gmtime_r(&unix_time, &ref);
+    hours = ref.tm_hour;
+    if (is_12hr != 0)
+    {
+        hours = (hours % 12 == 0) ? 12 : hours % 12;
+    }
+
+    EPOCH_ToTime(seconds, is_12hr, &time);
+    if (time.Year != ref.tm_year - 100 || time.Month != ref.tm_mon + 1 || time.Date != ref.tm_mday ||
+        time.Hours != hours || time.Minutes != ref.tm_min || time.Seconds != ref.tm_sec ||
+        time.Day != (ref.tm_wday == 0 ? 7 : ref.tm_wday) || time.Is_12hr != is_12hr ||
+        time.PM != (is_12hr != 0 && ref.tm_hour >= 12))
+    {
+        report("EPOCH_ToTime", seconds, is_12hr);
+    }
+    if (EPOCH_FromTime(&time) != seconds)
+    {
+        report("EPOCH_FromTime", seconds, is_12hr);
+    }
+
+    EPOCH_ToRegs(seconds, is_12hr, regs);
+    if (EPOCH_FromRegs(regs) != seconds)
+    {
+        report("EPOCH_FromRegs", seconds, is_12hr);
+    }
+    regs_decode(regs, &decoded);
+    if (time_equal(&decoded, &time) == 0)
+    {
+        report("EPOCH_ToRegs decode", seconds, is_12hr);
+    }
+    regs_encode(&time, expect);
+    for (i = 0; i < EPOCH_RTC_REG_COUNT; i++)
+    {
+        if (regs[i] != expect[i])
+        {
+            report("EPOCH_ToRegs encode", seconds, is_12hr);
+            break;
+        }
+    }
+}
+
+static void check_day(uint32_t days)
+{
+    time_t unix_time;
+    struct tm ref, next;
+    uint8_t year, month, date, month_days;
+    uint8_t hour;
+    int is_12hr;
+
+    Checks += 1;
+    unix_time = UNIX_2000 + (time_t)days * EPOCH_SECONDS_PER_DAY;
+    gmtime_r(&unix_time, &ref);
+
+    EPOCH_DaysToDate(days, &year, &month, &date);
+    if (year != ref.tm_year - 100 || month != ref.tm_mon + 1 || date != ref.tm_mday)
+    {
+        report("EPOCH_DaysToDate", days, 0);
+    }
+    if (EPOCH_DateToDays(ref.tm_year - 100, ref.tm_mon + 1, ref.tm_mday) != days)
+    {
+        report("EPOCH_DateToDays", days, 0);
+    }
+    if (EPOCH_GetDay(days) != (ref.tm_wday == 0 ? 7 : ref.tm_wday))
+    {
+        report("EPOCH_GetDay", days, 0);
+    }
+
+    unix_time += EPOCH_SECONDS_PER_DAY;
+    gmtime_r(&unix_time, &next);
+    if (next.tm_mday == 1) /* 月末一天，日即为当月天数 */
+    {
+        month_days = EPOCH_GetMonthDays(ref.tm_year - 100, ref.tm_mon + 1);
+        if (month_days != ref.tm_mday)
+        {
+            report("EPOCH_GetMonthDays", days, 0);
+        }
+        if (ref.tm_mon == 1 && EPOCH_IsLeapYear(ref.tm_year - 100) != (ref.tm_mday == 29))
+        {
+            report("EPOCH_IsLeapYear", days, 0);
+        }
+    }
+
+    if (days >= EPOCH_SECONDS_DAY_COUNT) /* 超出32位秒数的范围 */
+    {
+        return;
+    }
+    for (hour = 0; hour < 24; hour++) /* 每小时的开始、中间和结束，覆盖12小时制的上午和下午切换 */
+    {
+        for (is_12hr = 0; is_12hr < 2; is_12hr++)
+        {
+            check_seconds(days * EPOCH_SECONDS_PER_DAY + hour * 3600UL, is_12hr);
+            check_seconds(days * EPOCH_SECONDS_PER_DAY + hour * 3600UL + 1799, is_12hr);
+            check_seconds(days * EPOCH_SECONDS_PER_DAY + hour * 3600UL + 3599, is_12hr);
+        }
+    }
+}
+
+int main(void)
+{
+    uint32_t days;
+    struct RTC_Time time;
+
+    for (days = 0; days < EPOCH_DAY_COUNT; days++)
+    {
+        check_day(days);
+    }
+
+    EPOCH_ToTime(0xFFFFFFFFUL, 0, &time);
+    printf("last second: %u-%02u-%02u %02u:%02u:%02u\n", EPOCH_BASE_YEAR + time.Year, time.Month, time.Date, time.Hours, time.Minutes, time.Seconds);
+    printf("checks: %ld, errors: %ld\n", Checks, Errors);
+    return Errors != 0;
+}
@@ -0,0 +1,24 @@
+/*
+ * 代替ds3231.h，只提供epoch.h需要的struct RTC_Time，使epoch.c不依赖main.h和硬件驱动。
+ * 编译时用-include强制在所有文件之前包含，ds3231.h的头文件保护宏已经定义，不会再被展开。
+ */
+
+#ifndef _DS3231_H_
+#define _DS3231_H_
+
+#include <stdint.h>
+
+struct RTC_Time /* 与ds3231.h相同 */
+{
+    uint8_t Seconds;
+    uint8_t Minutes;
+    uint8_t Hours;
+    uint8_t Day;
+    uint8_t Date;
+    uint8_t Month;
+    uint8_t Year;
+    uint8_t PM;
+    uint8_t Is_12hr;
+};
+
+#endif